@@ -5,7 +5,6 @@
 
 /*
 TODO[high prio]: Triangulo
-TODO[high prio]: Abstract Quill so they don't expose STL types and pollute everything? Search alternatives otherwise? 
 TODO[high prio]: Explore how to do Jumbo builds
 TODO[high prio]: remove STL headers
 
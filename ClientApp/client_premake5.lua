@@ -12,7 +12,6 @@ project "ClientApp "
     includedirs
 	{
 		"../RadiantEngine/include",
-		"../vendor/quill/include",
 		"../vendor/D3D12MemoryAllocator/include",
 		"../vendor/D3D12MemoryAllocator/src",
 		"../vendor/OpenFBX/src"
@@ -29,11 +28,20 @@ project "ClientApp "
 		"../vendor/OpenFBX/src/*"
 	}
 
+	vectorextensions "SSE4.2"
+	defines{"RE_ENABLE_SSE42"}
+
+	--the jumbo build compiles core/compression.cpp, same optional DEFLATE codec as RadiantEngine
+	if os.isdir(path.join(_SCRIPT_DIR, "../vendor/libdeflate")) then
+		defines{"RE_ENABLE_DEFLATE=1"}
+		includedirs{"../vendor/libdeflate"}
+		files{"../vendor/libdeflate/lib/**.c"}
+	end
+
 
 	links
 	{
 		--"RadiantEngine",
-		"quill",
 		"dxgi",
 		"d3d12",
 		"dxguid"
@@ -57,14 +65,14 @@ project "ClientApp "
 	buildaction "None"
 
 	filter "configurations:Debug"
-			defines "APP_DEBUG"
+			defines {"APP_DEBUG", "RE_DEBUG"}
 			symbols "on"
 			optimize "off"
 			linktimeoptimization "off"
 			
 
 	filter "configurations:Release"
-			defines "APP_RELEASE"
+			defines {"APP_RELEASE", "RE_RELEASE"}
 			symbols "on"
 			optimize "on"
 			linktimeoptimization "on"
@@ -72,7 +80,7 @@ project "ClientApp "
 			
 
 	filter "configurations:Shipping"
-			defines "APP_SHIPPING"
+			defines {"APP_SHIPPING", "RE_SHIPPING"}
 			symbols "off"
 			optimize "full"
 			linktimeoptimization "on"
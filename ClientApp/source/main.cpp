@@ -15,9 +15,8 @@
 
 //STD lib
 //#include <execution>
-#include <iostream>
-#include <chrono>
 #include <algorithm>
+#include <atomic>
 
 using namespace Microsoft::WRL;
 
@@ -27,12 +26,40 @@ using namespace Microsoft::WRL;
 //Engine
 #include "RadiantEngine/core/types.h"
 #include "RadiantEngine/math/floatN.h"
+#include "RadiantEngine/render/vertexPacking.h"
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/stringView.h"
+#include "RadiantEngine/core/framePacer.h"
+#include "RadiantEngine/core/clock.h"
+#include "RadiantEngine/core/profiler.h"
+#include "RadiantEngine/core/memoryTracker.h"
+#include "RadiantEngine/core/log.h"
+#include "RadiantEngine/platform/window.h"
+#include "RadiantEngine/platform/file.h"
+#include "RadiantEngine/core/vfs.h"
+#include "RadiantEngine/platform/fileWatcher.h"
 
 
 //LIBS
 
 #include "imgui_jumbo.cpp"
 #include "D3D12MemAlloc.cpp"
+//ClientApp doesn't link RadiantEngine, engine sources it needs are compiled here
+#include "../../RadiantEngine/source/core/arena.cpp"
+#include "../../RadiantEngine/source/core/memoryTracker.cpp"
+#include "../../RadiantEngine/source/core/clock.cpp"
+#include "../../RadiantEngine/source/core/framePacer.cpp"
+#include "../../RadiantEngine/source/core/profiler.cpp"
+#include "../../RadiantEngine/source/core/log.cpp"
+#include "../../RadiantEngine/source/platform/virtualMemory.cpp"
+#include "../../RadiantEngine/source/platform/thread.cpp"
+#include "../../RadiantEngine/source/platform/file.cpp"
+#include "../../RadiantEngine/source/platform/window.cpp"
+#include "../../RadiantEngine/source/platform/fileWatcher.cpp"
+#include "../../RadiantEngine/source/core/jobs.cpp"
+#include "../../RadiantEngine/source/core/compression.cpp"
+#include "../../RadiantEngine/source/core/pack.cpp"
+#include "../../RadiantEngine/source/core/vfs.cpp"
 //#include "libdeflate.c"
 //#include "ofbx.cpp"
 
@@ -43,7 +70,7 @@ internal constexpr fp32 ASPECT_RATIO{ 16.f / 9.f };
 internal constexpr int16 INITIAL_HEIGHT{ 720 };
 internal constexpr int16 INITIAL_WIDTH{ static_cast<int16>(INITIAL_HEIGHT * ASPECT_RATIO) };
 internal constexpr int8 NUM_FRAMES{ 3 };
-internal constexpr wchar_t WINDOW_NAME[]{ L"FedeGordo" };
+internal constexpr char WINDOW_NAME[]{ "FedeGordo" };
 
 
 
@@ -70,7 +97,7 @@ internal HANDLE directFenceEvent;
 
 internal uint8 currentFrame;
 internal uint32 rtvDescriptorSize;
-internal bool isFullscreen{ false };
+internal Window mainWindow;
 internal RECT windowRect;
 
 internal ComPtr<ID3D12DescriptorHeap> rtvDescriptorHeap;
@@ -84,6 +111,7 @@ ComPtr<ID3D12Resource> vtxStagingBuffer;
 D3D12MA::Allocation* vtxResidentAllocation;
 ComPtr<ID3D12Resource> vtxResidentBuffer;
 internal D3D12_VERTEX_BUFFER_VIEW vtxBufferView;
+internal PositionQuantization triQuantization;
 
 internal constexpr float4 red{ 1.0f, 0.0f, 0.0f, 1.0f };
 internal constexpr float4 green{ 0.f, 1.0f, 0.0f, 1.0f };
@@ -92,54 +120,13 @@ internal constexpr float4 black{ 0.0f, 0.0f, 0.0f, 1.0f };
 
 internal float4 clearColors[NUM_FRAMES]{ red, green, blue };
 
-template<typename T>
-struct Span
-{
-	T* data;
-	size_t num;
-};
-
-
-template<typename T>
-struct str
-{
-	T* data;
-	size_t num;
-	size_t cap;
-	
-	operator Span<T>()
-	{
-		return Span<T>{.data = data, .num = num };
-	}
-
-	template<typename T>
-	operator Span<const T>()
-	{
-		return Span<const T>{.data = data, .num = num };
-	}
-};
-
-
-template<typename T>
-internal constexpr Span<T> ShaderRegistryPath();
-
-namespace {
+//Shipping data, built with PackBuilder. Loose files in SHADERS_DIRECTORY are mounted after it and win, so recompiled
+//shaders are picked up without rebuilding the pack
+internal constexpr const char DATA_PACK_PATH[]{ "data.pack" };
+internal constexpr const char SHADERS_DIRECTORY[]{ "../shaders" };
 
-	constexpr const char shaderAssetsRelPath[]{ "../shaders" };
-	constexpr const wchar_t shaderAssetsRelWPath[]{ L"../shaders" };
-}
-
-template<>
-constexpr Span<const char> ShaderRegistryPath()
-{
-	return { .data = shaderAssetsRelPath, .num = _countof(shaderAssetsRelPath) };
-}
-
-template<>
-constexpr Span<const wchar_t> ShaderRegistryPath()
-{
-	return {.data = shaderAssetsRelWPath, .num = _countof(shaderAssetsRelWPath) };
-}
+//Set by the file watcher when a blob in SHADERS_DIRECTORY changes (RunShaderCompilation.bat), the main loop rebuilds the PSO
+internal std::atomic<bool> shadersChanged;
 
 
 internal void WaitForFence(ID3D12Fence* fence, uint64 valueToWaitFor)
@@ -160,123 +147,74 @@ internal void Flush(ID3D12CommandQueue* queue, ID3D12Fence* fence, uint64& fence
 }
 
 
-internal void Update(fp64 dt)
+//D3D12MA bookkeeping shows up in the memory stats under GpuAllocator
+internal void* D3D12MAAllocate(size_t size, size_t alignment, void*)
 {
-
+	return TrackedAlloc(MemoryTagGpuAllocator, size, alignment);
 }
 
-internal void PrepInitialDataUpload()
+internal void D3D12MAFree(void* memory, void*)
 {
-	//1- Read shaders blob - OK -
-	//2- Serialize RootSignature - OK -
-	//3- IA layout - OK -
-	//4- PSO - OK -
-	//5- Buffers (?) - OK - 
-	//6- fence buffers upload
-	//7- draw call
-
-
-	static constexpr size_t _100kb{ 100000 };
-
-	
-	
-
-	char vsBlob[_100kb];
-	size_t vsByteSize;
-
-	char psBlob[_100kb];
-	size_t psByteSize;
-
-	Span<const char> shadersRegistryPath{ ShaderRegistryPath<const char>() };
-
-	{//Read VS
-		char vsPathBuffer[128];
-
-		str<char> vsShaderPath{ .data = vsPathBuffer,
-		.num = shadersRegistryPath.num,
-		.cap = 128 };
-
-		char vsRegistryPath[]{ "/basicVS.cso" };
-		FILE* vsFile{};
-
-		strcpy(vsShaderPath.data, shadersRegistryPath.data);
-		strncat(vsShaderPath.data, vsRegistryPath, _countof(vsRegistryPath));
-		vsShaderPath.num += _countof(vsRegistryPath);
+	TrackedFree(memory);
+}
 
-		int result{ fopen_s(&vsFile, vsShaderPath.data, "rb")};
+internal const D3D12MA::ALLOCATION_CALLBACKS d3d12maCallbacks{ .pAllocate = D3D12MAAllocate, .pFree = D3D12MAFree, .pPrivateData = nullptr };
 
-		fseek(vsFile, 0, SEEK_END);
-		vsByteSize = ftell(vsFile);
-		rewind(vsFile);
+#if RE_ENABLE_MEMORY_TRACKING
+//Live memory per tag and what changed since the previous call
+internal void PrintMemoryStats()
+{
+	persistent MemorySnapshot previous{};
 
-		fread(vsBlob, vsByteSize, 1, vsFile);
-		fclose(vsFile);
+	MemorySnapshot current;
+	TakeMemorySnapshot(current);
+	const MemorySnapshot diff{ DiffMemorySnapshots(previous, current) };
+	previous = current;
 
+	printf("%-14s %14s %14s %14s %12s %12s\n", "tag", "live (KB)", "delta (KB)", "peak (KB)", "live allocs", "new allocs");
+	for (uint32 t{}; t < NUM_MEMORY_TAGS; ++t)
+	{
+		const MemoryTagStats& s{ current.tags[t] };
+		const MemoryTagStats& d{ diff.tags[t] };
+		printf("%-14s %14.1f %+14.1f %14.1f %12lld %12lld\n", MemoryTagName(static_cast<eMemoryTag>(t)), s.liveBytes / 1024.0, d.liveBytes / 1024.0,
+			s.peakBytes / 1024.0, s.liveAllocations, d.numAllocations);
 	}
+}
+#endif
 
-	{//Read VS
-		char psPathBuffer[128];
-
-		str<char> psShaderPath{ .data = psPathBuffer,
-		.num = shadersRegistryPath.num,
-		.cap = 128 };
-
-		char psRegistryPath[]{ "/basicPS.cso" };
-		FILE* psFile{};
-
-		strcpy(psShaderPath.data, shadersRegistryPath.data);
-		strncat(psShaderPath.data, psRegistryPath, _countof(psRegistryPath));
-		psShaderPath.num += _countof(psRegistryPath);
-
-		int result{ fopen_s(&psFile, psShaderPath.data, "rb") };
+internal void Update(fp64 dt)
+{
 
-		fseek(psFile, 0, SEEK_END);
-		psByteSize = ftell(psFile);
-		rewind(psFile);
+}
 
-		fread(psBlob, psByteSize, 1, psFile);
-		fclose(psFile);
+//Built from whatever the VFS finds now, so a reload after a shader rebuild picks up the new blobs
+internal bool CreatePipelineState(ComPtr<ID3D12PipelineState>& out)
+{
+	//shader blobs are mapped straight from the pack or the loose file and only live until the PSO is created
+	VfsFile vsFile{};
+	VfsFile psFile{};
+	if (!VfsOpen(vsFile, "shaders/basicVS.cso"_sid) || !VfsOpen(psFile, "shaders/basicPS.cso"_sid))
+	{
+		VfsClose(vsFile);
+		VfsClose(psFile);
+		return false;
 	}
 
-	ComPtr<ID3DBlob> serializedBlob;
-	ComPtr<ID3DBlob> errorBlob;
-
-	D3D12_ROOT_PARAMETER1 pushConstants{
-		.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
-		.Constants = {
-		.ShaderRegister = 0,
-		.RegisterSpace = 0,
-		.Num32BitValues = 1},
-		.ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX
-	};
-
-	const D3D12_ROOT_PARAMETER1 rootParams[]{ pushConstants };
-	D3D12_VERSIONED_ROOT_SIGNATURE_DESC rsDsc{
-		.Version = D3D_ROOT_SIGNATURE_VERSION_1_1,
-		.Desc_1_1 = {.NumParameters = 1,
-				.pParameters = rootParams,
-				.NumStaticSamplers = 0,
-				.pStaticSamplers = 0,
-				.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT | D3D12_ROOT_SIGNATURE_FLAG_DENY_AMPLIFICATION_SHADER_ROOT_ACCESS
-		| D3D12_ROOT_SIGNATURE_FLAG_DENY_HULL_SHADER_ROOT_ACCESS | D3D12_ROOT_SIGNATURE_FLAG_DENY_DOMAIN_SHADER_ROOT_ACCESS | D3D12_ROOT_SIGNATURE_FLAG_DENY_GEOMETRY_SHADER_ROOT_ACCESS |
-		 D3D12_ROOT_SIGNATURE_FLAG_ALLOW_STREAM_OUTPUT | D3D12_ROOT_SIGNATURE_FLAG_DENY_MESH_SHADER_ROOT_ACCESS }
-	};
-
-	D3D12SerializeVersionedRootSignature(&rsDsc, serializedBlob.GetAddressOf(), errorBlob.GetAddressOf());
+	bool created{};
+	const Span<const uint8> vsBlob{ vsFile.data };
+	const Span<const uint8> psBlob{ psFile.data };
 
-	device->CreateRootSignature(0, serializedBlob->GetBufferPointer(), serializedBlob->GetBufferSize(), IID_PPV_ARGS(&rootSignature));
-	
 	{
 		
 		const D3D12_INPUT_ELEMENT_DESC inputElementDescs[] {
-			{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-			{ "COLOR", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+			{ "POSITION", 0, DXGI_FORMAT_R16G16B16A16_SNORM, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+			{ "COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, 8, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
 		};
 
 		D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc{};
 		psoDesc.pRootSignature = rootSignature.Get();
-		psoDesc.VS = D3D12_SHADER_BYTECODE{ .pShaderBytecode = vsBlob, .BytecodeLength = vsByteSize };
-		psoDesc.PS = D3D12_SHADER_BYTECODE{ .pShaderBytecode = psBlob, .BytecodeLength = psByteSize };
+		psoDesc.VS = D3D12_SHADER_BYTECODE{ .pShaderBytecode = vsBlob.data, .BytecodeLength = vsBlob.num };
+		psoDesc.PS = D3D12_SHADER_BYTECODE{ .pShaderBytecode = psBlob.data, .BytecodeLength = psBlob.num };
 		psoDesc.BlendState = D3D12_BLEND_DESC{
 				.AlphaToCoverageEnable = FALSE,
 				.IndependentBlendEnable = FALSE };
@@ -322,15 +260,64 @@ internal void PrepInitialDataUpload()
 
 
 
-		device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&pso));
-
+		created = SUCCEEDED(device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&out)));
 	}
 
+	VfsClose(vsFile);
+	VfsClose(psFile);
+	return created;
+}
+
+internal void PrepInitialDataUpload()
+{
+	RE_PROFILE_FUNCTION();
+
+	//1- Read shaders blob - OK -
+	//2- Serialize RootSignature - OK -
+	//3- IA layout - OK -
+	//4- PSO - OK -
+	//5- Buffers (?) - OK - 
+	//6- fence buffers upload
+	//7- draw call
+
+
+	ComPtr<ID3DBlob> serializedBlob;
+	ComPtr<ID3DBlob> errorBlob;
+
+	D3D12_ROOT_PARAMETER1 pushConstants{
+		.ParameterType = D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS,
+		.Constants = {
+		.ShaderRegister = 0,
+		.RegisterSpace = 0,
+		.Num32BitValues = 7},//aspect ratio + PositionQuantization
+		.ShaderVisibility = D3D12_SHADER_VISIBILITY_VERTEX
+	};
+
+	const D3D12_ROOT_PARAMETER1 rootParams[]{ pushConstants };
+	D3D12_VERSIONED_ROOT_SIGNATURE_DESC rsDsc{
+		.Version = D3D_ROOT_SIGNATURE_VERSION_1_1,
+		.Desc_1_1 = {.NumParameters = 1,
+				.pParameters = rootParams,
+				.NumStaticSamplers = 0,
+				.pStaticSamplers = 0,
+				.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT | D3D12_ROOT_SIGNATURE_FLAG_DENY_AMPLIFICATION_SHADER_ROOT_ACCESS
+		| D3D12_ROOT_SIGNATURE_FLAG_DENY_HULL_SHADER_ROOT_ACCESS | D3D12_ROOT_SIGNATURE_FLAG_DENY_DOMAIN_SHADER_ROOT_ACCESS | D3D12_ROOT_SIGNATURE_FLAG_DENY_GEOMETRY_SHADER_ROOT_ACCESS |
+		 D3D12_ROOT_SIGNATURE_FLAG_ALLOW_STREAM_OUTPUT | D3D12_ROOT_SIGNATURE_FLAG_DENY_MESH_SHADER_ROOT_ACCESS }
+	};
+
+	D3D12SerializeVersionedRootSignature(&rsDsc, serializedBlob.GetAddressOf(), errorBlob.GetAddressOf());
+
+	device->CreateRootSignature(0, serializedBlob->GetBufferPointer(), serializedBlob->GetBufferSize(), IID_PPV_ARGS(&rootSignature));
+
+	if (!CreatePipelineState(pso))
+		RE_LOG_ERROR("Couldn't create the pipeline state");
+
 
 	
-	struct alignas(16) vtx {
-		float3 pos;
-		float3 color;
+	//12 bytes, positions are relative to the triangle bounds and decoded in the VS
+	struct vtx {
+		snorm16x4 pos;
+		unorm8x4 color;
 	};
 
 	//Create staging buffer
@@ -370,12 +357,21 @@ internal void PrepInitialDataUpload()
 	vtxResidentBuffer->SetName(L"VtxResidentBuffer");
 	
 	{//copy to staging
-		vtx  tri[3]
-		{
-			vtx{.pos = float3{0.f, 0.25f, 0.f}, .color = float3{1.0f, 0.0f, 0.0f}},
-			vtx{.pos = float3{0.25f, -0.25f, 0.f}, .color = float3{0.0f, 1.0f, 0.0f}},
-			vtx{.pos = float3{-0.25f, -0.25f, 0.f}, .color = float3{0.0f, 0.0f, 1.0f}}
-		};
+		const float3 positions[3]{ float3{0.f, 0.25f, 0.f}, float3{0.25f, -0.25f, 0.f}, float3{-0.25f, -0.25f, 0.f} };
+		const float4 colors[3]{ float4{1.0f, 0.0f, 0.0f, 1.0f}, float4{0.0f, 1.0f, 0.0f, 1.0f}, float4{0.0f, 0.0f, 1.0f, 1.0f} };
+
+		float3 boundsMin, boundsMax;
+		computeBounds(positions, 3, boundsMin, boundsMax);
+		triQuantization = snorm16Quantization(boundsMin, boundsMax);
+
+		snorm16x4 packedPositions[3];
+		unorm8x4 packedColors[3];
+		packPositionsSnorm16(positions, packedPositions, 3, triQuantization);
+		packColors(colors, packedColors, 3);
+
+		vtx tri[3];
+		for (int32 i{}; i < 3; ++i)
+			tri[i] = vtx{ .pos = packedPositions[i], .color = packedColors[i] };
 
 		D3D12_RANGE mapRange{
 			.Begin = 0,
@@ -415,6 +411,8 @@ internal void PrepInitialDataUpload()
 
 internal void Render(fp64 dt)
 {
+	RE_PROFILE_FUNCTION();
+
 	WaitForFence(directFence.Get(), frameDirectFenceValue[currentFrame]);
 
 	ID3D12CommandAllocator* frameAlloc{ commandAllocators[currentFrame].Get() };
@@ -467,6 +465,7 @@ internal void Render(fp64 dt)
 	frameList->SetPipelineState(pso.Get());
 	frameList->SetGraphicsRootSignature(rootSignature.Get());
 	frameList->SetGraphicsRoot32BitConstants(0, 1, &aspectRatio, 0);
+	frameList->SetGraphicsRoot32BitConstants(0, sizeof(PositionQuantization) / sizeof(uint32), &triQuantization, 1);
 	frameList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 	frameList->IASetVertexBuffers(0, 1, &vtxBufferView);
 
@@ -505,114 +504,133 @@ internal void Render(fp64 dt)
 
 internal void UpdateApp(fp64 dt)
 {
+	RE_PROFILE_SCOPE("Frame");
+
 	Update(dt);
 	Render(dt);
 }
 
-//process messages from kernel
-LRESULT CALLBACK WndProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
+internal void ResizeSwapChain(const uint32 width, const uint32 height)
+{
+	DXGI_SWAP_CHAIN_DESC1 dsc;
+	swapChain->GetDesc1(&dsc);
 
+	if (dsc.Width != width || dsc.Height != height)
+	{
+		RE_LOG_INFO("Resize {{ {}, {} }}", width, height);
+		//flush
 
+		Flush(directQueue.Get(), directFence.Get(), frameDirectFenceValue[currentFrame]);
 
-	switch (uMsg)
-	{
-	case WM_SIZE:
-	{
-		RECT clientRect = {};
-		::GetClientRect(hwnd, &clientRect);
+		//Reset all fences to the same value (basically scratch all frames and start over)
+		for (int32 i{}; i < NUM_FRAMES; ++i)
+		{
+			backBuffers[i].Reset();
+		}
+
+		swapChain->ResizeBuffers(NUM_FRAMES, width, height, dsc.Format, dsc.Flags);
 
-		int width = static_cast<int>(std::max(1L, clientRect.right - clientRect.left));
-		int height = static_cast<int>(std::max(1L, clientRect.bottom - clientRect.top));
+		currentFrame = swapChain->GetCurrentBackBufferIndex();
 
-		DXGI_SWAP_CHAIN_DESC1 dsc;
-		swapChain->GetDesc1(&dsc);
+		//recreate the RTV
 
-		if (dsc.Width != width || dsc.Height != height)
+		D3D12_CPU_DESCRIPTOR_HANDLE descriptorHandle{ rtvDescriptorHeap->GetCPUDescriptorHandleForHeapStart() };
+		for (int32 i{}; i < NUM_FRAMES; ++i)
 		{
-			std::cout << "Resize { " << width << ", " << height << " }\n";
-			//flush
+			swapChain->GetBuffer(i, IID_PPV_ARGS(&backBuffers[i]));
+			device->CreateRenderTargetView(backBuffers[i].Get(), nullptr, descriptorHandle);
+			descriptorHandle.ptr += rtvDescriptorSize;
+		}
 
-			Flush(directQueue.Get(), directFence.Get(), frameDirectFenceValue[currentFrame]);
+		windowRect = { 0, 0, static_cast<LONG>(width), static_cast<LONG>(height) };
+	}
+}
 
-			//Reset all fences to the same value (basically scratch all frames and start over)
-			for (int32 i{}; i < NUM_FRAMES; ++i)
-			{
-				backBuffers[i].Reset();
-			}
+internal void OnShadersChanged(const FileChange* changes, const uint32 num, void*)
+{
+	for (uint32 i{}; i < num; ++i)
+	{
+		const size_t length{ strlen(changes[i].path) };
+		const bool isBlob{ length > 4 && !strcmp(changes[i].path + length - 4, ".cso") };
+		if (changes[i].type == FileChangeRescan || (isBlob && changes[i].type != FileChangeRemoved))
+			shadersChanged.store(true, std::memory_order_release);
+	}
+}
 
-			swapChain->ResizeBuffers(NUM_FRAMES, width, height, dsc.Format, dsc.Flags);
+internal void ReloadShaders()
+{
+	RE_PROFILE_FUNCTION();
 
-			currentFrame = swapChain->GetCurrentBackBufferIndex();
+	//new files aren't in the directory index yet
+	RescanVfsDirectories();
 
-			//recreate the RTV
+	ComPtr<ID3D12PipelineState> reloaded;
+	if (!CreatePipelineState(reloaded))
+	{
+		RE_LOG_WARNING("Shader reload failed, keeping the old pipeline state");
+		return;
+	}
 
-			D3D12_CPU_DESCRIPTOR_HANDLE descriptorHandle{ rtvDescriptorHeap->GetCPUDescriptorHandleForHeapStart() };
-			for (int32 i{}; i < NUM_FRAMES; ++i)
-			{
-				swapChain->GetBuffer(i, IID_PPV_ARGS(&backBuffers[i]));
-				device->CreateRenderTargetView(backBuffers[i].Get(), nullptr, descriptorHandle);
-				descriptorHandle.ptr += rtvDescriptorSize;
-			}
+	//the old PSO may still be used by frames in flight
+	Flush(directQueue.Get(), directFence.Get(), frameDirectFenceValue[currentFrame]);
+	pso = reloaded;
+	RE_LOG_INFO("Shaders reloaded");
+}
 
-			windowRect = clientRect;
-		}
+internal void OnKeyDown(const uint32 key)
+{
+	if (key == 'F')
+		SetWindowFullscreen(mainWindow, !mainWindow.fullscreen);
 
-		
-		break;
-	}
-	case WM_DESTROY:
+#if RE_ENABLE_MEMORY_TRACKING
+	if (key == 'M') //prints memory per tag and the change since the last press
+		PrintMemoryStats();
+#endif
+
+#if RE_ENABLE_PROFILER
+	if (key == 'P') //dumps the last 2 seconds of profiling, open profile.json in ui.perfetto.dev or chrome://tracing
 	{
-		::PostQuitMessage(0);
-		break;
+		const int64 now{ GetTimeNs() };
+		const bool written{ WriteProfileTrace("profile.json", now - MsToNs(2000.0), now) && WriteProfileBinary("profile.bin", now - MsToNs(2000.0), now) };
+		if (written)
+			RE_LOG_INFO("Profile written to profile.json / profile.bin");
+		else
+			RE_LOG_WARNING("Couldn't write the profile");
 	}
-	case WM_KEYDOWN:
+#endif
+}
+
+//returns false once the window asks to close
+internal bool ProcessWindowEvents()
+{
+	bool running{ true };
+
+	WindowEvent events[32];
+	uint32 num;
+	while ((num = PumpWindowEvents(mainWindow, events, _countof(events))) > 0)
 	{
-		if (wParam == 0x46 && !(lParam >> 30)) //key F is pressed and was up before
+		for (uint32 i{}; i < num; ++i)
 		{
-			isFullscreen = isFullscreen ^ 1; //toggle it
-
-			if (isFullscreen)
+			const WindowEvent& e{ events[i] };
+			switch (e.type)
 			{
-				::GetWindowRect(hwnd, &windowRect);
-				//idk XD -> we already have the old state of the rect so we can restore later
-				UINT style{ WS_OVERLAPPEDWINDOW & ~(WS_CAPTION | WS_BORDER | WS_SYSMENU | WS_THICKFRAME | WS_MAXIMIZEBOX | WS_MINIMIZEBOX) };
-
-				::SetWindowLong(hwnd, GWL_STYLE, style);
-				HMONITOR hMonitor{ ::MonitorFromWindow(hwnd, MONITOR_DEFAULTTONEAREST) };
-				MONITORINFOEX monitorInfo{};
-				monitorInfo.cbSize = sizeof(MONITORINFOEX);
-				::GetMonitorInfo(hMonitor, &monitorInfo);
-				::SetWindowPos(hwnd, HWND_TOP,
-					monitorInfo.rcMonitor.left,
-					monitorInfo.rcMonitor.top,
-					monitorInfo.rcMonitor.right - monitorInfo.rcMonitor.left,
-					monitorInfo.rcMonitor.bottom - monitorInfo.rcMonitor.top, 
-					SWP_FRAMECHANGED | SWP_NOACTIVATE);
-				::ShowWindow(hwnd, SW_MAXIMIZE);
-				
-			}
-			else {
-				//restore old state
-				::SetWindowLongW(hwnd, GWL_STYLE, WS_OVERLAPPEDWINDOW);
-				::SetWindowPos(hwnd, HWND_TOP,
-					windowRect.left,
-					windowRect.top,
-					windowRect.right - windowRect.left,
-					windowRect.bottom - windowRect.top,
-					SWP_FRAMECHANGED | SWP_NOACTIVATE);
-				::ShowWindow(hwnd, SW_NORMAL);
-
+			case WindowEventClose:
+				running = false;
+				break;
+			case WindowEventResize:
+				ResizeSwapChain(e.width, e.height);
+				break;
+			case WindowEventKeyDown:
+				if (!e.repeat)
+					OnKeyDown(e.key);
+				break;
+			default:
+				break;
 			}
 		}
-	}break;
-	default:
-	{
-		return ::DefWindowProcW(hwnd, uMsg, wParam, lParam);
-	}
 	}
 
-
-	return 0;
+	return running;
 }
 
 
@@ -623,66 +641,67 @@ int CALLBACK wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdL
 
 	AllocConsole();
 
+	InitProfiler();
+	RE_PROFILE_THREAD_NAME("Main");
+
 	// Redirect STDOUT to the console
 	FILE* fp;
 	freopen_s(&fp, "CONOUT$", "w", stdout);
 	freopen_s(&fp, "CONOUT$", "w", stderr);
 	freopen_s(&fp, "CONIN$", "r", stdin);
 
-	// Set std::cout and std::cin to use the console
-	std::ios::sync_with_stdio();
+	//console plus a binary copy, decode it with LogDecoder
+	InitLog({ .console = true, .textPath = nullptr, .binaryPath = "log.bin", .minLevel = LogLevelTrace });
+
+	//shaders are read through the vfs, there is nothing to run without it
+	if (!InitVfs())
+	{
+		RE_LOG_ERROR("Couldn't initialize the vfs");
+		ShutdownProfiler();
+		ShutdownLog();
+		return 1;
+	}
+	if (FileExists(DATA_PACK_PATH) && !MountPack(DATA_PACK_PATH))
+	{
+		RE_LOG_ERROR("{} isn't a valid pack", DATA_PACK_PATH);
+		ShutdownVfs();
+		ShutdownProfiler();
+		ShutdownLog();
+		return 1;
+	}
+	if (!MountDirectory(SHADERS_DIRECTORY, "shaders"))
+	{
+		RE_LOG_ERROR("Couldn't mount {}", SHADERS_DIRECTORY);
+		ShutdownVfs();
+		ShutdownProfiler();
+		ShutdownLog();
+		return 1;
+	}
+
+	//hot reload is a convenience, run without it
+	if (!InitFileWatcher())
+		RE_LOG_WARNING("Couldn't start the file watcher");
+	const uint32 shadersWatch{ WatchDirectory(SHADERS_DIRECTORY, OnShadersChanged, nullptr) };
+	if (shadersWatch == INVALID_FILE_WATCH)
+		RE_LOG_WARNING("Couldn't watch {}, shaders won't hot reload", SHADERS_DIRECTORY);
 
 	// Optional: set console title
 	SetConsoleTitleW(L"Debug Console");
 
 	{
-		WNDCLASSEXW windowClass = {};
-		const wchar_t* windowClassName = L"DX12WindowClass";
-		windowClass.cbSize = sizeof(WNDCLASSEXW);
-		windowClass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
-		windowClass.lpfnWndProc = &WndProc;
-		windowClass.cbClsExtra = 0;
-		windowClass.cbWndExtra = 0;
-		windowClass.hInstance = hInstance;
-		windowClass.hIcon = ::LoadIcon(hInstance, NULL);
-		windowClass.hCursor = ::LoadCursor(NULL, IDC_ARROW);
-		windowClass.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1);
-		windowClass.lpszMenuName = NULL;
-		windowClass.lpszClassName = windowClassName;
-		windowClass.hIconSm = ::LoadIcon(hInstance, NULL);
-
-		::SetProcessDPIAware();
-		::RegisterClassExW(&windowClass);
-
-
-		int screenWidth = ::GetSystemMetrics(SM_CXSCREEN);
-		int screenHeight = ::GetSystemMetrics(SM_CYSCREEN);
-
-
-		//center it, please
-		int32 xPos{ std::max<int32>(1, (screenWidth - INITIAL_WIDTH) / 2) };
-		int32 yPos{ std::max<int32>(1, (screenHeight - INITIAL_HEIGHT) / 2) };
-
-		RECT myRect{ 0, 0, INITIAL_WIDTH, INITIAL_HEIGHT };
-
-		AdjustWindowRect(&myRect, WS_OVERLAPPEDWINDOW, FALSE);
-
-		HWND hWnd = ::CreateWindowExW(
-			NULL,
-			windowClassName,
-			WINDOW_NAME,
-			WS_OVERLAPPEDWINDOW,
-			xPos,
-			yPos,
-			myRect.right - myRect.left,
-			myRect.bottom - myRect.top,
-			NULL,
-			NULL,
-			hInstance,
-			nullptr
-		);
-
-		::windowRect = myRect;
+		if (!InitWindow(mainWindow, { .title = WINDOW_NAME, .width = INITIAL_WIDTH, .height = INITIAL_HEIGHT, .headless = false }))
+		{
+			RE_LOG_ERROR("Couldn't create the main window");
+			UnwatchDirectory(shadersWatch);
+			ShutdownFileWatcher();
+			ShutdownVfs();
+			ShutdownProfiler();
+			ShutdownLog();
+			return 1;
+		}
+		const HWND hWnd{ static_cast<HWND>(mainWindow.native) };
+
+		::windowRect = { 0, 0, INITIAL_WIDTH, INITIAL_HEIGHT };
 
 
 		ComPtr<ID3D12Debug> dbgLayer;
@@ -903,7 +922,7 @@ int CALLBACK wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdL
 			.Flags = D3D12MA_RECOMMENDED_ALLOCATOR_FLAGS | D3D12MA::ALLOCATOR_FLAGS::ALLOCATOR_FLAG_SINGLETHREADED,
 			.pDevice = device.Get(),
 			.PreferredBlockSize = 0,
-			.pAllocationCallbacks = nullptr,
+			.pAllocationCallbacks = &d3d12maCallbacks,
 			.pAdapter = adapter.Get()
 		};
 
@@ -915,7 +934,7 @@ int CALLBACK wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdL
 
 
 
-		::ShowWindow(hWnd, SW_SHOW);
+		MakeWindowVisible(mainWindow);
 	}
 
 	dxgidebug->ReportLiveObjects(DXGI_DEBUG_ALL, DXGI_DEBUG_RLO_IGNORE_INTERNAL);
@@ -932,45 +951,28 @@ int CALLBACK wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdL
 	
 	
 	
-	std::chrono::system_clock::time_point prevFrame{ std::chrono::system_clock::now()};
+	FramePacer pacer;
+	InitFramePacer(pacer, PacingFixed, 60.0);
 
-	static constexpr fp64 targetMs{ 1000. / 60. }; //120fps
 
-
-	MSG msg = { };
 	bool running{ true };
 	while (running)
 	{
-		while (::PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
-		{
-			::TranslateMessage(&msg);
-			::DispatchMessage(&msg);
-
-			if (msg.message == WM_QUIT)
-			{
-				running = false;
-				break;
-			}
-
-			
-		}
-		std::chrono::system_clock::time_point currentFrame{ std::chrono::system_clock::now() };
-		std::chrono::duration<fp64, std::milli> diff{ currentFrame - prevFrame };
+		running = ProcessWindowEvents();
+		if (!running)
+			break;
 
-
-		fp64 delta{ diff.count() };
-		while (delta < targetMs)
+		fp64 delta;
 		{
-			std::this_thread::yield();
-			currentFrame = std::chrono::system_clock::now();
-			diff = currentFrame - prevFrame;
-			delta = diff.count();
+			RE_PROFILE_SCOPE("PaceFrame");
+			delta = PaceFrame(pacer);
 		}
 
-		prevFrame = currentFrame;
-
 		//std::cout << come mierdas << "\n";
 
+		if (shadersChanged.exchange(false, std::memory_order_acquire))
+			ReloadShaders();
+
 		UpdateApp(delta);
 	}
 	
@@ -978,7 +980,13 @@ int CALLBACK wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR lpCmdL
 
 	Flush(directQueue.Get(), directFence.Get(), frameDirectFenceValue[currentFrame]);
 	::CloseHandle(directFenceEvent);
+	ShutdownWindow(mainWindow);
+	UnwatchDirectory(shadersWatch);
+	ShutdownFileWatcher();
+	ShutdownVfs();
 
+	ShutdownProfiler();
+	ShutdownLog();
 
 	return 0;
 }
\ No newline at end of file
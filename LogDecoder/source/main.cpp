@@ -0,0 +1,44 @@
+//  Filename: main 
+//	Author:	Daniel														
+//	Date: 19/10/2026 02:44:10		
+//  Sqwack-Studios													
+
+#include <cstdio>
+
+#include "RadiantEngine/core/log.h"
+
+using namespace RE;
+
+// Arguments:
+/*
+* <in>			Binary log written with LogConfig::binaryPath
+* [out]			Text file to write, stdout when missing
+*/
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: LogDecoder <in> [out]\n");
+		return 2;
+	}
+
+	FILE* out{ argc > 2 ? fopen(argv[2], "wb") : stdout };
+	if (!out)
+	{
+		fprintf(stderr, "Couldn't open %s\n", argv[2]);
+		return 2;
+	}
+
+	const bool decoded{ DecodeBinaryLog(argv[1], out) };
+	if (out != stdout)
+		fclose(out);
+
+	if (!decoded)
+	{
+		fprintf(stderr, "%s isn't a binary log or is truncated\n", argv[1]);
+		return 1;
+	}
+
+	return 0;
+}
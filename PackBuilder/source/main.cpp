@@ -0,0 +1,81 @@
+//  Filename: main 
+//	Author:	Daniel														
+//	Date: 19/10/2026 05:21:36		
+//  Sqwack-Studios													
+
+#include <cstdio>
+#include <cstring>
+
+#include "RadiantEngine/core/pack.h"
+
+using namespace RE;
+
+// Arguments:
+/*
+* <directory>		Every file under it goes into the pack
+* <out>				Pack to write
+* [mountPoint]		Prefix for the paths inside the pack, none when missing
+* [codec]			none, lz (default) or deflate
+*/
+
+internal bool ParseCodec(const char* name, eCompressionCodec& codec)
+{
+	for (uint32 c{}; c < NUM_COMPRESSION_CODECS; ++c)
+	{
+		if (!strcmp(name, CompressionCodecName(static_cast<eCompressionCodec>(c))))
+		{
+			codec = static_cast<eCompressionCodec>(c);
+			return true;
+		}
+	}
+	return false;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: PackBuilder <directory> <out> [mountPoint] [none|lz|deflate]\n");
+		return 2;
+	}
+
+	eCompressionCodec codec{ CompressionLZ };
+	if (argc > 4 && !ParseCodec(argv[4], codec))
+	{
+		fprintf(stderr, "Unknown codec %s\n", argv[4]);
+		return 2;
+	}
+	if (!IsCompressionCodecAvailable(codec))
+	{
+		fprintf(stderr, "%s isn't available in this build\n", CompressionCodecName(codec));
+		return 2;
+	}
+
+	const char* mountPoint{ argc > 3 ? argv[3] : "" };
+	if (!WritePackFromDirectory(argv[2], argv[1], mountPoint, codec))
+	{
+		fprintf(stderr, "Couldn't pack %s into %s\n", argv[1], argv[2]);
+		return 1;
+	}
+
+	Pack pack;
+	if (!OpenPack(pack, argv[2]))
+	{
+		fprintf(stderr, "%s was written but doesn't validate\n", argv[2]);
+		return 1;
+	}
+
+	uint64 size{};
+	uint32 numCompressed{};
+	for (uint32 i{}; i < pack.header->tocCapacity; ++i)
+	{
+		const PackEntry& entry{ pack.toc[i] };
+		size += entry.size;
+		numCompressed += entry.pathHash && IsPackEntryCompressed(entry);
+	}
+
+	printf("%s: %u files (%u compressed with %s), %llu bytes, %llu uncompressed\n", argv[2], pack.header->numEntries, numCompressed,
+		CompressionCodecName(codec), static_cast<unsigned long long>(pack.header->fileSize), static_cast<unsigned long long>(size));
+	ClosePack(pack);
+	return 0;
+}
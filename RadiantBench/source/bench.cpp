@@ -0,0 +1,69 @@
+//  Filename: bench 
+//	Author:	Daniel														
+//	Date: 18/10/2026 19:10:44		
+//  Sqwack-Studios													
+
+#include <chrono>
+#include <cstdlib>
+
+#include "bench.h"
+
+namespace RE
+{
+
+	int64 BenchNowNs()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	bool BenchNext(Bench& b)
+	{
+		const int64 now{ BenchNowNs() };
+		const uint32 total{ b.config.warmup + b.config.reps };
+
+		//iteration counts started iterations, the one that just ended is a sample once warmup is over
+		if (b.iteration > b.config.warmup)
+			b.samples[b.iteration - b.config.warmup - 1] = static_cast<fp64>(now - b.sampleStart);
+
+		if (b.iteration == total)
+			return false;
+
+		b.iteration++;
+		b.sampleStart = BenchNowNs();
+		return true;
+	}
+
+	internal int CompareSamples(const void* a, const void* b)
+	{
+		const fp64 x{ *static_cast<const fp64*>(a) };
+		const fp64 y{ *static_cast<const fp64*>(b) };
+		return (x > y) - (x < y);
+	}
+
+	BenchStats ComputeBenchStats(const Bench& b)
+	{
+		BenchStats s{};
+		const uint32 n{ b.config.reps };
+		if (n == 0)
+			return s;
+
+		qsort(b.samples, n, sizeof(fp64), CompareSamples);
+
+		fp64 sum{};
+		for (uint32 i{}; i < n; ++i)
+			sum += b.samples[i];
+
+		s.minNs = b.samples[0];
+		s.medianNs = n & 1 ? b.samples[n / 2] : (b.samples[n / 2 - 1] + b.samples[n / 2]) * 0.5;
+		//nearest rank
+		const uint32 p99{ (n * 99 + 99) / 100 };
+		s.p99Ns = b.samples[p99 > 0 ? p99 - 1 : 0];
+		s.meanNs = sum / n;
+
+		const fp64 seconds{ s.medianNs * 1e-9 };
+		s.itemsPerSec = seconds > 0.0 ? b.items / seconds : 0.0;
+		s.bytesPerSec = seconds > 0.0 ? b.bytes / seconds : 0.0;
+		return s;
+	}
+
+}
@@ -0,0 +1,106 @@
+//  Filename: bench 
+//	Author:	Daniel														
+//	Date: 18/10/2026 19:02:17		
+//  Sqwack-Studios													
+
+#ifndef RE_BENCH_H
+#define RE_BENCH_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+//Tiny benchmark harness. A benchmark prepares its data, declares how much work one sample does and then loops:
+//
+//	void BenchDot(Bench& b)
+//	{
+//		...setup...
+//		b.items = NUM;
+//		b.bytes = NUM * sizeof(float3) * 2;
+//		while (BenchNext(b))
+//			kernel();
+//	}
+//
+//BenchNext runs config.warmup untimed iterations, then config.reps timed ones, each one is a sample. Samples are sorted
+//to get min/median/p99, throughput is computed from the median.
+namespace RE
+{
+
+	struct BenchConfig
+	{
+		uint32 warmup;
+		uint32 reps;
+	};
+
+	struct BenchStats
+	{
+		fp64 minNs;
+		fp64 medianNs;
+		fp64 p99Ns;
+		fp64 meanNs;
+		fp64 itemsPerSec;
+		fp64 bytesPerSec;
+	};
+
+	struct Bench
+	{
+		uint64 items;	//work done by one sample, 0 to skip the items/s column
+		uint64 bytes;	//memory touched by one sample, 0 to skip the bytes/s column
+
+		BenchConfig config;
+		uint32 iteration;
+		int64 sampleStart;
+		fp64* samples;
+	};
+
+	using BenchFn = void(*)(Bench&);
+
+	struct BenchEntry
+	{
+		const char* name;
+		BenchFn fn;
+	};
+
+	struct BenchGroup
+	{
+		const BenchEntry* entries;
+		uint32 num;
+	};
+
+	//Returns false once every sample has been taken
+	bool BenchNext(Bench& b);
+	BenchStats ComputeBenchStats(const Bench& b);
+	int64 BenchNowNs();
+
+	//Stops the compiler from removing work whose result is never read
+	RE_INLINE void KeepAlive(const void* p)
+	{
+#if defined(_MSC_VER)
+		persistent const void* volatile sink;
+		sink = p;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r"(p) : "memory");
+#endif
+	}
+
+	template<typename T>
+	RE_INLINE void KeepAlive(const T& v) { KeepAlive(static_cast<const void*>(&v)); }
+
+	//One per source file, referenced from main.cpp
+	extern const BenchGroup MATH_BENCHES;
+	extern const BenchGroup CONTAINER_BENCHES;
+	extern const BenchGroup JOB_BENCHES;
+	extern const BenchGroup QUEUE_BENCHES;
+	extern const BenchGroup LOG_BENCHES;
+	extern const BenchGroup IO_BENCHES;
+	extern const BenchGroup PACK_BENCHES;
+	extern const BenchGroup CULLING_BENCHES;
+	extern const BenchGroup BVH_BENCHES;
+
+}
+
+#endif // !RE_BENCH_H
@@ -0,0 +1,126 @@
+//  Filename: benchBVH 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:41:27		
+//  Sqwack-Studios													
+
+#include <cstdlib>
+
+#include "bench.h"
+#include "RadiantEngine/core/jobs.h"
+#include "RadiantEngine/scene/bvh.h"
+
+//BVH build and raycasts over NUM_TRIANGLES small random triangles. build runs the subtrees through the job system,
+//build_serial as a single task. The raycasts shoot a 256x256 camera grid, once ray by ray and once in packets of 8;
+//neighbouring rays are coherent, which is the case packets are meant for.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_TRIANGLES{ 1 << 17 };
+	internal constexpr uint32 RAY_GRID{ 256 };
+	internal constexpr uint32 NUM_RAYS{ RAY_GRID * RAY_GRID };
+
+	struct BVHData
+	{
+		float3* vertices;
+		uint32* indices;
+		Ray* rays;
+		RayHit* hits;
+		BVH bvh;
+	};
+
+	internal fp32 NextBVHRandom(uint32& state)
+	{
+		state = state * 1664525u + 1013904223u;
+		return static_cast<fp32>(state >> 8) * (2.f / 16777216.f) - 1.f;
+	}
+
+	internal BVHData& GetBVHData()
+	{
+		persistent BVHData d{};
+		if (d.vertices)
+			return d;
+
+		d.vertices = static_cast<float3*>(malloc(sizeof(float3) * NUM_TRIANGLES * 3));
+		d.indices = static_cast<uint32*>(malloc(sizeof(uint32) * NUM_TRIANGLES * 3));
+		d.rays = static_cast<Ray*>(malloc(sizeof(Ray) * NUM_RAYS));
+		d.hits = static_cast<RayHit*>(malloc(sizeof(RayHit) * NUM_RAYS));
+
+		uint32 state{ 0x7F4A7C15 };
+		for (uint32 i{}; i < NUM_TRIANGLES; ++i)
+		{
+			const float3 c{ NextBVHRandom(state) * 10.f, NextBVHRandom(state) * 10.f, NextBVHRandom(state) * 10.f };
+			for (uint32 v{}; v < 3; ++v)
+			{
+				d.vertices[i * 3 + v] = c + float3{ NextBVHRandom(state), NextBVHRandom(state), NextBVHRandom(state) } * 0.1f;
+				d.indices[i * 3 + v] = i * 3 + v;
+			}
+		}
+
+		for (uint32 i{}; i < NUM_RAYS; ++i)
+		{
+			const fp32 x{ (static_cast<fp32>(i % RAY_GRID) + 0.5f) / RAY_GRID * 2.f - 1.f };
+			const fp32 y{ (static_cast<fp32>(i / RAY_GRID) + 0.5f) / RAY_GRID * 2.f - 1.f };
+			d.rays[i] = { .origin = { 0.f, 0.f, -20.f }, .direction = { x * 0.5f, y * 0.5f, 1.f }, .tMax = 1e30f };
+		}
+
+		InitBVH(d.bvh, d.vertices, d.indices, NUM_TRIANGLES);
+		BuildBVH(d.bvh);
+		return d;
+	}
+
+	internal void BenchBuild(Bench& b)
+	{
+		BVHData& d{ GetBVHData() };
+		b.items = NUM_TRIANGLES;
+		while (BenchNext(b))
+			BuildBVH(d.bvh);
+	}
+
+	internal void BenchBuildSerial(Bench& b)
+	{
+		BVHData& d{ GetBVHData() };
+		b.items = NUM_TRIANGLES;
+		while (BenchNext(b))
+		{
+			const uint32 numTasks{ BeginBVHBuild(d.bvh, 1) };
+			for (uint32 t{}; t < numTasks; ++t)
+				BuildBVHTask(d.bvh, t);
+			EndBVHBuild(d.bvh);
+		}
+		//leave the parallel layout for the raycasts
+		BuildBVH(d.bvh);
+	}
+
+	internal void BenchRaycast(Bench& b)
+	{
+		BVHData& d{ GetBVHData() };
+		b.items = NUM_RAYS;
+		while (BenchNext(b))
+		{
+			RaycastBVH(d.bvh, d.rays, d.hits, NUM_RAYS);
+			KeepAlive(d.hits);
+		}
+	}
+
+	internal void BenchRaycastPackets(Bench& b)
+	{
+		BVHData& d{ GetBVHData() };
+		b.items = NUM_RAYS;
+		while (BenchNext(b))
+		{
+			RaycastBVHPackets(d.bvh, d.rays, d.hits, NUM_RAYS);
+			KeepAlive(d.hits);
+		}
+	}
+
+	internal constexpr BenchEntry BVH_ENTRIES[]
+	{
+		{ "bvh/build",				BenchBuild },
+		{ "bvh/build_serial",		BenchBuildSerial },
+		{ "bvh/raycast",			BenchRaycast },
+		{ "bvh/raycast_packets",	BenchRaycastPackets },
+	};
+
+	const BenchGroup BVH_BENCHES{ BVH_ENTRIES, sizeof(BVH_ENTRIES) / sizeof(BVH_ENTRIES[0]) };
+
+}
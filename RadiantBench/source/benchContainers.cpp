@@ -0,0 +1,232 @@
+//  Filename: benchContainers 
+//	Author:	Daniel														
+//	Date: 18/10/2026 21:24:03		
+//  Sqwack-Studios													
+
+#include <cstdlib>
+
+#include "bench.h"
+#include "RadiantEngine/core/hashMap.h"
+#include "RadiantEngine/core/hash.h"
+
+//Core containers and hashing. Lookups are compared against the linear scan over a key array they replace, Hash64
+//against byte at a time FNV-1a.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_KEYS{ 4096 };
+	internal constexpr uint32 NUM_LOOKUPS{ 4096 };
+	//linear scans are O(n), fewer keys keep the run short and are still well past the break even point
+	internal constexpr uint32 NUM_SCAN_KEYS{ 256 };
+
+	struct ContainerData
+	{
+		uint64* keys;
+		uint64* hits;		//present keys, shuffled
+		uint64* misses;		//never inserted
+		HashMap<uint64, uint32> map;
+		HashMap<uint64, uint32> scanMap;
+	};
+
+	internal uint64 NextKey(uint64& state)
+	{
+		state += 0x9E3779B97F4A7C15ull;
+		return MixHash(state);
+	}
+
+	internal ContainerData& GetContainerData()
+	{
+		persistent ContainerData d{};
+		if (d.keys)
+			return d;
+
+		d.keys = static_cast<uint64*>(malloc(sizeof(uint64) * NUM_KEYS));
+		d.hits = static_cast<uint64*>(malloc(sizeof(uint64) * NUM_LOOKUPS));
+		d.misses = static_cast<uint64*>(malloc(sizeof(uint64) * NUM_LOOKUPS));
+
+		uint64 state{ 1 };
+		d.map.init(NUM_KEYS);
+		d.scanMap.init(NUM_SCAN_KEYS);
+		for (uint32 i{}; i < NUM_KEYS; ++i)
+		{
+			d.keys[i] = NextKey(state);
+			d.map.insert(d.keys[i], i);
+			if (i < NUM_SCAN_KEYS)
+				d.scanMap.insert(d.keys[i], i);
+		}
+
+		for (uint32 i{}; i < NUM_LOOKUPS; ++i)
+		{
+			d.hits[i] = d.keys[NextKey(state) % NUM_KEYS];
+			d.misses[i] = NextKey(state);
+		}
+
+		return d;
+	}
+
+	internal void BenchHashMapFindHit(Bench& b)
+	{
+		const ContainerData& d{ GetContainerData() };
+		b.items = NUM_LOOKUPS;
+		while (BenchNext(b))
+		{
+			uint32 sum{};
+			for (uint32 i{}; i < NUM_LOOKUPS; ++i)
+				sum += *d.map.find(d.hits[i]);
+			KeepAlive(sum);
+		}
+	}
+
+	internal void BenchHashMapFindMiss(Bench& b)
+	{
+		const ContainerData& d{ GetContainerData() };
+		b.items = NUM_LOOKUPS;
+		while (BenchNext(b))
+		{
+			uint32 found{};
+			for (uint32 i{}; i < NUM_LOOKUPS; ++i)
+				found += d.map.contains(d.misses[i]);
+			KeepAlive(found);
+		}
+	}
+
+	internal void BenchHashMapInsert(Bench& b)
+	{
+		const ContainerData& d{ GetContainerData() };
+		HashMap<uint64, uint32> map{};
+		b.items = NUM_KEYS;
+		while (BenchNext(b))
+		{
+			map.clear();
+			for (uint32 i{}; i < NUM_KEYS; ++i)
+				map.insert(d.keys[i], i);
+			KeepAlive(map.ctrl);
+		}
+		map.release();
+	}
+
+	internal void BenchHashMapFindHitSmall(Bench& b)
+	{
+		const ContainerData& d{ GetContainerData() };
+		b.items = NUM_LOOKUPS;
+		while (BenchNext(b))
+		{
+			uint32 sum{};
+			for (uint32 i{}; i < NUM_LOOKUPS; ++i)
+				sum += *d.scanMap.find(d.keys[i % NUM_SCAN_KEYS]);
+			KeepAlive(sum);
+		}
+	}
+
+	internal void BenchLinearScanHitSmall(Bench& b)
+	{
+		const ContainerData& d{ GetContainerData() };
+		b.items = NUM_LOOKUPS;
+		while (BenchNext(b))
+		{
+			uint32 sum{};
+			for (uint32 i{}; i < NUM_LOOKUPS; ++i)
+			{
+				const uint64 key{ d.keys[i % NUM_SCAN_KEYS] };
+				for (uint32 k{}; k < NUM_SCAN_KEYS; ++k)
+				{
+					if (d.keys[k] == key)
+					{
+						sum += k;
+						break;
+					}
+				}
+			}
+			KeepAlive(sum);
+		}
+	}
+
+	internal constexpr uint32 HASH_BLOCK_SIZE{ 64 * 1024 };
+	internal constexpr uint32 NUM_SHORT_KEYS{ 4096 };
+	internal constexpr uint32 SHORT_KEY_SIZE{ 24 };
+
+	internal uint8* GetHashData()
+	{
+		persistent uint8* data{};
+		if (data)
+			return data;
+
+		data = static_cast<uint8*>(malloc(HASH_BLOCK_SIZE));
+		uint64 state{ 7 };
+		for (uint32 i{}; i < HASH_BLOCK_SIZE; ++i)
+			data[i] = static_cast<uint8>(NextKey(state));
+
+		return data;
+	}
+
+	internal uint64 Fnv1a64(const uint8* p, const size_t size)
+	{
+		uint64 h{ 0xCBF29CE484222325ull };
+		for (size_t i{}; i < size; ++i)
+			h = (h ^ p[i]) * 0x100000001B3ull;
+		return h;
+	}
+
+	internal void BenchHash64Block(Bench& b)
+	{
+		const uint8* data{ GetHashData() };
+		b.items = 1;
+		b.bytes = HASH_BLOCK_SIZE;
+		while (BenchNext(b))
+			KeepAlive(Hash64(data, HASH_BLOCK_SIZE));
+	}
+
+	internal void BenchFnv1aBlock(Bench& b)
+	{
+		const uint8* data{ GetHashData() };
+		b.items = 1;
+		b.bytes = HASH_BLOCK_SIZE;
+		while (BenchNext(b))
+			KeepAlive(Fnv1a64(data, HASH_BLOCK_SIZE));
+	}
+
+	//names and paths are short, this is where the setup and finalization costs show
+	internal void BenchHash64Short(Bench& b)
+	{
+		const uint8* data{ GetHashData() };
+		b.items = NUM_SHORT_KEYS;
+		b.bytes = NUM_SHORT_KEYS * SHORT_KEY_SIZE;
+		while (BenchNext(b))
+		{
+			uint64 h{};
+			for (uint32 i{}; i < NUM_SHORT_KEYS; ++i)
+				h ^= Hash64(data + i * 8, SHORT_KEY_SIZE);
+			KeepAlive(h);
+		}
+	}
+
+	internal void BenchFnv1aShort(Bench& b)
+	{
+		const uint8* data{ GetHashData() };
+		b.items = NUM_SHORT_KEYS;
+		b.bytes = NUM_SHORT_KEYS * SHORT_KEY_SIZE;
+		while (BenchNext(b))
+		{
+			uint64 h{};
+			for (uint32 i{}; i < NUM_SHORT_KEYS; ++i)
+				h ^= Fnv1a64(data + i * 8, SHORT_KEY_SIZE);
+			KeepAlive(h);
+		}
+	}
+
+	internal constexpr BenchEntry CONTAINER_ENTRIES[]
+	{
+		{ "containers/hashmap_find_hit",		BenchHashMapFindHit },
+		{ "containers/hashmap_find_miss",		BenchHashMapFindMiss },
+		{ "containers/hashmap_insert",			BenchHashMapInsert },
+		{ "containers/hashmap_find_hit_256",	BenchHashMapFindHitSmall },
+		{ "containers/linear_scan_hit_256",		BenchLinearScanHitSmall },
+		{ "hash/hash64_64kb",					BenchHash64Block },
+		{ "hash/fnv1a_64kb",					BenchFnv1aBlock },
+		{ "hash/hash64_24b",					BenchHash64Short },
+		{ "hash/fnv1a_24b",						BenchFnv1aShort },
+	};
+
+	const BenchGroup CONTAINER_BENCHES{ CONTAINER_ENTRIES, sizeof(CONTAINER_ENTRIES) / sizeof(CONTAINER_ENTRIES[0]) };
+
+}
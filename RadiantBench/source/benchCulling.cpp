@@ -0,0 +1,168 @@
+//  Filename: benchCulling 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:26:12		
+//  Sqwack-Studios													
+
+#include <cmath>
+#include <cstdlib>
+
+#include "bench.h"
+#include "RadiantEngine/render/culling.h"
+
+//Frustum culling throughput. NUM_BOUNDS bounds are scattered around a camera so about half of them are visible, the
+//items/s column is bounds tested per second (1 G/s = 1 M bounds per ms). Every kernel is paired with a plain one plane at
+//a time loop over the same data, the ratio is what fp32x8 buys on this machine.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_BOUNDS{ 1 << 16 };
+
+	struct CullingData
+	{
+		Frustum frustum;
+		SphereSoA spheres;
+		AABBSoA boxes;
+		uint32* out;
+	};
+
+	//deterministic values in [-1, 1)
+	internal fp32 NextCullRandom(uint32& state)
+	{
+		state = state * 1664525u + 1013904223u;
+		return static_cast<fp32>(state >> 8) * (2.f / 16777216.f) - 1.f;
+	}
+
+	internal CullingData& GetCullingData()
+	{
+		persistent CullingData d{};
+		if (d.out)
+			return d;
+
+		fp32* memory{ static_cast<fp32*>(malloc(sizeof(fp32) * NUM_BOUNDS * 10)) };
+		fp32* x{ memory };
+		fp32* y{ memory + NUM_BOUNDS };
+		fp32* z{ memory + NUM_BOUNDS * 2 };
+		fp32* radius{ memory + NUM_BOUNDS * 3 };
+		fp32* extentX{ memory + NUM_BOUNDS * 4 };
+		fp32* extentY{ memory + NUM_BOUNDS * 5 };
+		fp32* extentZ{ memory + NUM_BOUNDS * 6 };
+
+		//camera at the origin looking down +z with a 90 degree fov, bounds in a 200 unit cube in front and around it
+		uint32 state{ 0x2545F491 };
+		for (uint32 i{}; i < NUM_BOUNDS; ++i)
+		{
+			x[i] = NextCullRandom(state) * 100.f;
+			y[i] = NextCullRandom(state) * 100.f;
+			z[i] = NextCullRandom(state) * 100.f + 50.f;
+			radius[i] = NextCullRandom(state) * 1.5f + 2.f;
+			extentX[i] = NextCullRandom(state) * 1.f + 1.5f;
+			extentY[i] = NextCullRandom(state) * 1.f + 1.5f;
+			extentZ[i] = NextCullRandom(state) * 1.f + 1.5f;
+		}
+
+		const float3x4 view{ lookAtLH(float3{ 0.f, 0.f, 0.f }, float3{ 0.f, 0.f, 1.f }, float3{ 0.f, 1.f, 0.f }) };
+		const float4x4 projection{ perspectiveFovLH(1.5707963f, 16.f / 9.f, 0.1f, 150.f) };
+
+		d.frustum = FrustumFromMatrix(mul(projection, toFloat4x4(view)));
+		d.spheres = { x, y, z, radius };
+		d.boxes = { x, y, z, extentX, extentY, extentZ };
+		d.out = reinterpret_cast<uint32*>(memory + NUM_BOUNDS * 7);
+		return d;
+	}
+
+	//Same tests as the kernels, one bound and one plane at a time
+	internal uint32 CullSpheresScalar(const Frustum& f, const SphereSoA s, uint32* out)
+	{
+		uint32 numVisible{};
+		for (uint32 i{}; i < NUM_BOUNDS; ++i)
+		{
+			bool visible{ true };
+			for (uint32 p{}; p < 6 && visible; ++p)
+			{
+				const float4 plane{ f.planes[p] };
+				visible = plane.x * s.x[i] + plane.y * s.y[i] + plane.z * s.z[i] + plane.w > -s.radius[i];
+			}
+			if (visible)
+				out[numVisible++] = i;
+		}
+		return numVisible;
+	}
+
+	internal uint32 CullAABBsScalar(const Frustum& f, const AABBSoA b, uint32* out)
+	{
+		uint32 numVisible{};
+		for (uint32 i{}; i < NUM_BOUNDS; ++i)
+		{
+			bool visible{ true };
+			for (uint32 p{}; p < 6 && visible; ++p)
+			{
+				const float4 plane{ f.planes[p] };
+				const fp32 distance{ plane.x * b.centerX[i] + plane.y * b.centerY[i] + plane.z * b.centerZ[i] + plane.w };
+				const fp32 reach{ fabsf(plane.x) * b.extentX[i] + fabsf(plane.y) * b.extentY[i] + fabsf(plane.z) * b.extentZ[i] };
+				visible = distance > -reach;
+			}
+			if (visible)
+				out[numVisible++] = i;
+		}
+		return numVisible;
+	}
+
+	internal void BenchCullSpheres(Bench& b)
+	{
+		CullingData& d{ GetCullingData() };
+		b.items = NUM_BOUNDS;
+		b.bytes = NUM_BOUNDS * sizeof(fp32) * 4;
+		while (BenchNext(b))
+		{
+			const CullResult r{ CullSpheres(d.frustum, d.spheres, 0, NUM_BOUNDS, d.out) };
+			KeepAlive(r);
+		}
+	}
+
+	internal void BenchCullSpheresScalar(Bench& b)
+	{
+		CullingData& d{ GetCullingData() };
+		b.items = NUM_BOUNDS;
+		b.bytes = NUM_BOUNDS * sizeof(fp32) * 4;
+		while (BenchNext(b))
+		{
+			const uint32 numVisible{ CullSpheresScalar(d.frustum, d.spheres, d.out) };
+			KeepAlive(numVisible);
+		}
+	}
+
+	internal void BenchCullAABBs(Bench& b)
+	{
+		CullingData& d{ GetCullingData() };
+		b.items = NUM_BOUNDS;
+		b.bytes = NUM_BOUNDS * sizeof(fp32) * 6;
+		while (BenchNext(b))
+		{
+			const CullResult r{ CullAABBs(d.frustum, d.boxes, 0, NUM_BOUNDS, d.out) };
+			KeepAlive(r);
+		}
+	}
+
+	internal void BenchCullAABBsScalar(Bench& b)
+	{
+		CullingData& d{ GetCullingData() };
+		b.items = NUM_BOUNDS;
+		b.bytes = NUM_BOUNDS * sizeof(fp32) * 6;
+		while (BenchNext(b))
+		{
+			const uint32 numVisible{ CullAABBsScalar(d.frustum, d.boxes, d.out) };
+			KeepAlive(numVisible);
+		}
+	}
+
+	internal constexpr BenchEntry CULLING_ENTRIES[]
+	{
+		{ "culling/spheres",			BenchCullSpheres },
+		{ "culling/spheres_scalar",		BenchCullSpheresScalar },
+		{ "culling/aabbs",				BenchCullAABBs },
+		{ "culling/aabbs_scalar",		BenchCullAABBsScalar },
+	};
+
+	const BenchGroup CULLING_BENCHES{ CULLING_ENTRIES, sizeof(CULLING_ENTRIES) / sizeof(CULLING_ENTRIES[0]) };
+
+}
@@ -0,0 +1,130 @@
+//  Filename: benchIO 
+//	Author:	Daniel														
+//	Date: 19/10/2026 04:31:52		
+//  Sqwack-Studios													
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "bench.h"
+#include "RadiantEngine/platform/file.h"
+#include "RadiantEngine/platform/asyncIO.h"
+
+//Loading NUM_FILES small assets: one blocking read after another (what PrepInitialDataUpload used to do) against one
+//SubmitIO batch on each async backend. The files are written once to bench_io/ in the working directory and are usually
+//in the page cache, so this measures per request overhead and how well the backends overlap; with a cold cache the gap
+//is the disk latency the serial loop waits on NUM_FILES times.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_FILES{ 64 };
+	internal constexpr uint64 FILE_BYTES{ 256 * 1024 };
+
+	struct IOBenchData
+	{
+		File files[NUM_FILES];
+		uint8* buffer;		//NUM_FILES * FILE_BYTES
+		bool valid;
+	};
+
+	internal IOBenchData OpenBenchFiles()
+	{
+		IOBenchData d{};
+		d.buffer = static_cast<uint8*>(malloc(NUM_FILES * FILE_BYTES));
+		d.valid = d.buffer && MakeDirectories("bench_io");
+
+		for (uint32 i{}; i < NUM_FILES && d.valid; ++i)
+		{
+			char path[64];
+			snprintf(path, sizeof(path), "bench_io/asset%02u.bin", i);
+			if (!FileExists(path))
+			{
+				for (uint64 j{}; j < FILE_BYTES; ++j)
+					d.buffer[j] = static_cast<uint8>(i * 31 + j);
+				d.valid = WriteEntireFile(path, d.buffer, FILE_BYTES);
+			}
+			d.valid = d.valid && FileOpen(d.files[i], path, FileAccessRead);
+		}
+
+		if (!d.valid)
+			printf("io: couldn't create the files in bench_io/\n");
+		return d;
+	}
+
+	internal void CloseBenchFiles(IOBenchData& d)
+	{
+		for (File& file : d.files)
+		{
+			if (file.valid)
+				FileClose(file);
+		}
+		free(d.buffer);
+	}
+
+	internal void BenchSerialReads(Bench& b)
+	{
+		IOBenchData d{ OpenBenchFiles() };
+		if (!d.valid)
+		{
+			CloseBenchFiles(d);
+			return;
+		}
+
+		b.items = NUM_FILES;
+		b.bytes = NUM_FILES * FILE_BYTES;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM_FILES; ++i)
+				FileRead(d.files[i], d.buffer + i * FILE_BYTES, FILE_BYTES, 0);
+			KeepAlive(d.buffer);
+		}
+
+		CloseBenchFiles(d);
+	}
+
+	internal void BenchAsyncReads(Bench& b, const bool forceWorkerPool)
+	{
+		IOBenchData d{ OpenBenchFiles() };
+		if (!d.valid || !InitAsyncIO({ .numWorkers = 0, .queueDepth = 0, .forceWorkerPool = forceWorkerPool }))
+		{
+			CloseBenchFiles(d);
+			return;
+		}
+
+		IORequest* requests{ new IORequest[NUM_FILES]{} };
+		for (uint32 i{}; i < NUM_FILES; ++i)
+		{
+			requests[i].file = d.files[i];
+			requests[i].size = FILE_BYTES;
+			requests[i].dst = d.buffer + i * FILE_BYTES;
+			requests[i].priority = IOPriorityNormal;
+		}
+
+		b.items = NUM_FILES;
+		b.bytes = NUM_FILES * FILE_BYTES;
+		while (BenchNext(b))
+		{
+			SubmitIO(requests, NUM_FILES);
+			for (uint32 i{}; i < NUM_FILES; ++i)
+				WaitIO(requests[i]);
+			KeepAlive(d.buffer);
+		}
+
+		ShutdownAsyncIO();
+		delete[] requests;
+		CloseBenchFiles(d);
+	}
+
+	internal void BenchAsyncDefault(Bench& b) { BenchAsyncReads(b, false); }
+	internal void BenchAsyncWorkerPool(Bench& b) { BenchAsyncReads(b, true); }
+
+	internal constexpr BenchEntry IO_ENTRIES[]
+	{
+		{ "io/serial_reads",		BenchSerialReads },
+		{ "io/async_batch",			BenchAsyncDefault },		//io_uring where available
+		{ "io/async_worker_pool",	BenchAsyncWorkerPool },
+	};
+
+	const BenchGroup IO_BENCHES{ IO_ENTRIES, sizeof(IO_ENTRIES) / sizeof(IO_ENTRIES[0]) };
+
+}
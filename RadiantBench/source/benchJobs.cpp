@@ -0,0 +1,104 @@
+//  Filename: benchJobs 
+//	Author:	Daniel														
+//	Date: 18/10/2026 22:48:19		
+//  Sqwack-Studios													
+
+#include <cstdlib>
+
+#include "bench.h"
+#include "RadiantEngine/core/jobs.h"
+#include "RadiantEngine/math/matrix.h"
+
+//Job system overhead and scaling. transform_points runs the SoA kernel over NUM_POINTS (well past L2) once on the calling
+//thread and once through ParallelFor, the ratio is the speedup on this machine.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_POINTS{ 1 << 20 };
+	internal constexpr uint32 NUM_EMPTY_JOBS{ 4096 };
+
+	struct TransformJob
+	{
+		float3x4 m;
+		float3SoA in;
+		float3SoA out;
+	};
+
+	internal TransformJob& GetTransformJob()
+	{
+		persistent TransformJob t{};
+		if (t.in.x)
+			return t;
+
+		fp32* memory{ static_cast<fp32*>(malloc(sizeof(fp32) * NUM_POINTS * 6)) };
+		t.in = { memory, memory + NUM_POINTS, memory + NUM_POINTS * 2 };
+		t.out = { memory + NUM_POINTS * 3, memory + NUM_POINTS * 4, memory + NUM_POINTS * 5 };
+		for (uint32 i{}; i < NUM_POINTS * 3; ++i)
+			memory[i] = static_cast<fp32>(i % 1024) * (1.f / 512.f) - 1.f;
+
+		t.m = mul(translation({ 1.f, 2.f, 3.f }), scaling({ 2.f, 0.5f, 1.f }));
+		return t;
+	}
+
+	internal void TransformRange(void* data, const uint32 begin, const uint32 end)
+	{
+		const TransformJob& t{ *static_cast<const TransformJob*>(data) };
+		const float3SoA in{ t.in.x + begin, t.in.y + begin, t.in.z + begin };
+		const float3SoA out{ t.out.x + begin, t.out.y + begin, t.out.z + begin };
+		transformPoints(t.m, in, out, end - begin);
+	}
+
+	internal void EmptyJob(void*) {}
+
+	internal void BenchTransformSerial(Bench& b)
+	{
+		TransformJob& t{ GetTransformJob() };
+		b.items = NUM_POINTS;
+		b.bytes = NUM_POINTS * sizeof(fp32) * 6;
+		while (BenchNext(b))
+		{
+			TransformRange(&t, 0, NUM_POINTS);
+			KeepAlive(t.out.x);
+		}
+	}
+
+	internal void BenchTransformParallel(Bench& b)
+	{
+		TransformJob& t{ GetTransformJob() };
+		b.items = NUM_POINTS;
+		b.bytes = NUM_POINTS * sizeof(fp32) * 6;
+		while (BenchNext(b))
+		{
+			ParallelFor(NUM_POINTS, 4096, TransformRange, &t);
+			KeepAlive(t.out.x);
+		}
+	}
+
+	//push, steal, run and wait cost per job
+	internal void BenchEmptyJobs(Bench& b)
+	{
+		Job* list{ static_cast<Job*>(malloc(sizeof(Job) * NUM_EMPTY_JOBS)) };
+		for (uint32 i{}; i < NUM_EMPTY_JOBS; ++i)
+			list[i] = { .fn = EmptyJob, .data = nullptr };
+
+		b.items = NUM_EMPTY_JOBS;
+		while (BenchNext(b))
+		{
+			JobCounter counter{};
+			RunJobs(list, NUM_EMPTY_JOBS, &counter);
+			WaitForCounter(&counter);
+		}
+
+		free(list);
+	}
+
+	internal constexpr BenchEntry JOB_ENTRIES[]
+	{
+		{ "jobs/transform_points_serial",	BenchTransformSerial },
+		{ "jobs/transform_points_parallel",	BenchTransformParallel },
+		{ "jobs/empty_jobs",				BenchEmptyJobs },
+	};
+
+	const BenchGroup JOB_BENCHES{ JOB_ENTRIES, sizeof(JOB_ENTRIES) / sizeof(JOB_ENTRIES[0]) };
+
+}
@@ -0,0 +1,85 @@
+//  Filename: benchLog 
+//	Author:	Daniel														
+//	Date: 19/10/2026 02:31:55		
+//  Sqwack-Studios													
+
+#include <cstdio>
+
+#include "bench.h"
+#include "RadiantEngine/core/log.h"
+
+//Cost of a log call on the calling thread. A sample logs NUM_MESSAGES messages, few enough to fit in the thread ring,
+//while the backend drains them with no sink attached, so only the hot path is measured. snprintf_baseline formats the
+//same message in place, which is what the caller would pay with immediate formatting (before any I/O).
+//Warning level so Shipping doesn't compile the calls out.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_MESSAGES{ 1024 };
+
+	internal void BeginLogBench()
+	{
+		InitLog({ .console = false, .textPath = nullptr, .binaryPath = nullptr, .minLevel = LogLevelTrace });
+	}
+
+	internal void BenchLogNoArgs(Bench& b)
+	{
+		BeginLogBench();
+		b.items = NUM_MESSAGES;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM_MESSAGES; ++i)
+				RE_LOG_WARNING("Frame took too long");
+		}
+		ShutdownLog();
+	}
+
+	internal void BenchLogNumbers(Bench& b)
+	{
+		BeginLogBench();
+		b.items = NUM_MESSAGES;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM_MESSAGES; ++i)
+				RE_LOG_WARNING("Frame {} took {} ms, budget {}", i, 17.5, 16u);
+		}
+		ShutdownLog();
+	}
+
+	internal void BenchLogString(Bench& b)
+	{
+		BeginLogBench();
+		b.items = NUM_MESSAGES;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM_MESSAGES; ++i)
+				RE_LOG_WARNING("Shader {} compiled with {} warnings", "shaders/deferred/lighting.hlsl", i);
+		}
+		ShutdownLog();
+	}
+
+	internal void BenchSnprintfBaseline(Bench& b)
+	{
+		char line[256];
+		b.items = NUM_MESSAGES;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM_MESSAGES; ++i)
+			{
+				snprintf(line, sizeof(line), "Frame %u took %g ms, budget %u", i, 17.5, 16u);
+				KeepAlive(line);
+			}
+		}
+	}
+
+	internal constexpr BenchEntry LOG_ENTRIES[]
+	{
+		{ "log/no_args",			BenchLogNoArgs },
+		{ "log/numbers",			BenchLogNumbers },
+		{ "log/string",				BenchLogString },
+		{ "log/snprintf_baseline",	BenchSnprintfBaseline },
+	};
+
+	const BenchGroup LOG_BENCHES{ LOG_ENTRIES, sizeof(LOG_ENTRIES) / sizeof(LOG_ENTRIES[0]) };
+
+}
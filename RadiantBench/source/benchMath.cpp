@@ -0,0 +1,382 @@
+//  Filename: benchMath 
+//	Author:	Daniel														
+//	Date: 18/10/2026 19:27:40		
+//  Sqwack-Studios													
+
+#include <cstdlib>
+
+#include "bench.h"
+#include "RadiantEngine/math/floatNx8.h"
+#include "RadiantEngine/math/fastMath.h"
+#include "RadiantEngine/math/matrix.h"
+
+//floatN / vectorAlgebra / floatNx8 kernels. Every benchmark runs over NUM elements that fit in L2, the RE:: variants are
+//paired with their RE::scalar reference so the SIMD backend can be compared against it in the same run.
+namespace RE
+{
+
+	internal constexpr uint32 NUM{ 4096 };
+
+	struct MathData
+	{
+		float3* a3;
+		float3* b3;
+		float3* out3;
+		float4* a4;
+		float4* b4;
+		float4* out4;
+		fp32* outScalar;
+
+		float3SoA aSoA;
+		float3SoA bSoA;
+		float3SoA outSoA;
+
+		void* memory;
+	};
+
+	//deterministic values in [-1, 1), never a zero vector
+	internal fp32 NextRandom(uint32& state)
+	{
+		state = state * 1664525u + 1013904223u;
+		return static_cast<fp32>(state >> 8) * (2.f / 16777216.f) - 1.f;
+	}
+
+	internal MathData& GetMathData()
+	{
+		persistent MathData d{};
+		if (d.memory)
+			return d;
+
+		const size_t bytes{ NUM * (sizeof(float3) * 3 + sizeof(float4) * 3 + sizeof(fp32) * 10) };
+		d.memory = malloc(bytes);
+
+		uint8* p{ static_cast<uint8*>(d.memory) };
+		auto take = [&p](const size_t size) { void* r{ p }; p += size; return r; };
+
+		d.a3 = static_cast<float3*>(take(NUM * sizeof(float3)));
+		d.b3 = static_cast<float3*>(take(NUM * sizeof(float3)));
+		d.out3 = static_cast<float3*>(take(NUM * sizeof(float3)));
+		d.a4 = static_cast<float4*>(take(NUM * sizeof(float4)));
+		d.b4 = static_cast<float4*>(take(NUM * sizeof(float4)));
+		d.out4 = static_cast<float4*>(take(NUM * sizeof(float4)));
+		d.outScalar = static_cast<fp32*>(take(NUM * sizeof(fp32)));
+		d.aSoA = { static_cast<fp32*>(take(NUM * sizeof(fp32))), static_cast<fp32*>(take(NUM * sizeof(fp32))), static_cast<fp32*>(take(NUM * sizeof(fp32))) };
+		d.bSoA = { static_cast<fp32*>(take(NUM * sizeof(fp32))), static_cast<fp32*>(take(NUM * sizeof(fp32))), static_cast<fp32*>(take(NUM * sizeof(fp32))) };
+		d.outSoA = { static_cast<fp32*>(take(NUM * sizeof(fp32))), static_cast<fp32*>(take(NUM * sizeof(fp32))), static_cast<fp32*>(take(NUM * sizeof(fp32))) };
+
+		uint32 state{ 0x9E3779B9 };
+		for (uint32 i{}; i < NUM; ++i)
+		{
+			d.a3[i] = { NextRandom(state), NextRandom(state), NextRandom(state) + 2.f };
+			d.b3[i] = { NextRandom(state), NextRandom(state), NextRandom(state) + 2.f };
+			d.a4[i] = { NextRandom(state), NextRandom(state), NextRandom(state), NextRandom(state) + 2.f };
+			d.b4[i] = { NextRandom(state), NextRandom(state), NextRandom(state), NextRandom(state) + 2.f };
+		}
+		transpose(d.a3, d.aSoA, NUM);
+		transpose(d.b3, d.bSoA, NUM);
+
+		return d;
+	}
+
+	/* float3 / float4, AoS */
+
+	internal void BenchDot3(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * (sizeof(float3) * 2 + sizeof(fp32));
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.outScalar[i] = dot(d.a3[i], d.b3[i]);
+			KeepAlive(d.outScalar);
+		}
+	}
+
+	internal void BenchDot3Scalar(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * (sizeof(float3) * 2 + sizeof(fp32));
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.outScalar[i] = scalar::dot(d.a3[i], d.b3[i]);
+			KeepAlive(d.outScalar);
+		}
+	}
+
+	internal void BenchDot4(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * (sizeof(float4) * 2 + sizeof(fp32));
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.outScalar[i] = dot(d.a4[i], d.b4[i]);
+			KeepAlive(d.outScalar);
+		}
+	}
+
+	internal void BenchDot4Scalar(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * (sizeof(float4) * 2 + sizeof(fp32));
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.outScalar[i] = scalar::dot(d.a4[i], d.b4[i]);
+			KeepAlive(d.outScalar);
+		}
+	}
+
+	internal void BenchLength3(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * (sizeof(float3) + sizeof(fp32));
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.outScalar[i] = length(d.a3[i]);
+			KeepAlive(d.outScalar);
+		}
+	}
+
+	internal void BenchLength3Scalar(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * (sizeof(float3) + sizeof(fp32));
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.outScalar[i] = scalar::length(d.a3[i]);
+			KeepAlive(d.outScalar);
+		}
+	}
+
+	internal void BenchNormalize3(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 2;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.out3[i] = normalize(d.a3[i]);
+			KeepAlive(d.out3);
+		}
+	}
+
+	internal void BenchNormalize3Scalar(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 2;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.out3[i] = scalar::normalize(d.a3[i]);
+			KeepAlive(d.out3);
+		}
+	}
+
+	internal void BenchNormalize3Fast(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 2;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.out3[i] = fast::normalize(d.a3[i]);
+			KeepAlive(d.out3);
+		}
+	}
+
+	internal void BenchNormalize4(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float4) * 2;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.out4[i] = normalize(d.a4[i]);
+			KeepAlive(d.out4);
+		}
+	}
+
+	internal void BenchNormalize4Scalar(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float4) * 2;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.out4[i] = scalar::normalize(d.a4[i]);
+			KeepAlive(d.out4);
+		}
+	}
+
+	internal void BenchCross3(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 3;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.out3[i] = cross(d.a3[i], d.b3[i]);
+			KeepAlive(d.out3);
+		}
+	}
+
+	internal void BenchCross3Scalar(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 3;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; ++i)
+				d.out3[i] = scalar::cross(d.a3[i], d.b3[i]);
+			KeepAlive(d.out3);
+		}
+	}
+
+	/* float3SoA batches */
+
+	internal void BenchDotSoA(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(fp32) * 7;
+		while (BenchNext(b))
+		{
+			dot(d.aSoA, d.bSoA, d.outScalar, NUM);
+			KeepAlive(d.outScalar);
+		}
+	}
+
+	internal void BenchNormalizeSoA(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(fp32) * 6;
+		while (BenchNext(b))
+		{
+			normalize(d.aSoA, d.outSoA, NUM);
+			KeepAlive(d.outSoA.x);
+		}
+	}
+
+	internal void BenchNormalizeSoAFast(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(fp32) * 6;
+		while (BenchNext(b))
+		{
+			for (uint32 i{}; i < NUM; i += 8)
+				store8(d.outSoA, i, fast::normalize(load8(d.aSoA, i)));
+			KeepAlive(d.outSoA.x);
+		}
+	}
+
+	internal void BenchCrossSoA(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(fp32) * 9;
+		while (BenchNext(b))
+		{
+			cross(d.aSoA, d.bSoA, d.outSoA, NUM);
+			KeepAlive(d.outSoA.x);
+		}
+	}
+
+	internal void BenchTransposeToSoA(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 2;
+		while (BenchNext(b))
+		{
+			transpose(d.a3, d.outSoA, NUM);
+			KeepAlive(d.outSoA.x);
+		}
+	}
+
+	internal void BenchTransposeToAoS(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 2;
+		while (BenchNext(b))
+		{
+			transpose(d.aSoA, d.out3, NUM);
+			KeepAlive(d.out3);
+		}
+	}
+
+	/* matrix */
+
+	internal void BenchTransformPointsAoS(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		const float3x4 m{ mul(translation({ 1.f, 2.f, 3.f }), scaling({ 2.f, 0.5f, 1.f })) };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 2;
+		while (BenchNext(b))
+		{
+			transformPoints(m, d.a3, d.out3, NUM);
+			KeepAlive(d.out3);
+		}
+	}
+
+	internal void BenchTransformPointsSoA(Bench& b)
+	{
+		const MathData& d{ GetMathData() };
+		const float3x4 m{ mul(translation({ 1.f, 2.f, 3.f }), scaling({ 2.f, 0.5f, 1.f })) };
+		b.items = NUM;
+		b.bytes = NUM * sizeof(float3) * 2;
+		while (BenchNext(b))
+		{
+			transformPoints(m, d.aSoA, d.outSoA, NUM);
+			KeepAlive(d.outSoA.x);
+		}
+	}
+
+	internal constexpr BenchEntry MATH_ENTRIES[]
+	{
+		{ "math/dot3",					BenchDot3 },
+		{ "math/dot3_scalar",			BenchDot3Scalar },
+		{ "math/dot4",					BenchDot4 },
+		{ "math/dot4_scalar",			BenchDot4Scalar },
+		{ "math/length3",				BenchLength3 },
+		{ "math/length3_scalar",		BenchLength3Scalar },
+		{ "math/normalize3",			BenchNormalize3 },
+		{ "math/normalize3_scalar",		BenchNormalize3Scalar },
+		{ "math/normalize3_fast",		BenchNormalize3Fast },
+		{ "math/normalize4",			BenchNormalize4 },
+		{ "math/normalize4_scalar",		BenchNormalize4Scalar },
+		{ "math/cross3",				BenchCross3 },
+		{ "math/cross3_scalar",			BenchCross3Scalar },
+		{ "math/dot_soa",				BenchDotSoA },
+		{ "math/normalize_soa",			BenchNormalizeSoA },
+		{ "math/normalize_soa_fast",	BenchNormalizeSoAFast },
+		{ "math/cross_soa",				BenchCrossSoA },
+		{ "math/transpose_to_soa",		BenchTransposeToSoA },
+		{ "math/transpose_to_aos",		BenchTransposeToAoS },
+		{ "math/transform_points_aos",	BenchTransformPointsAoS },
+		{ "math/transform_points_soa",	BenchTransformPointsSoA },
+	};
+
+	const BenchGroup MATH_BENCHES{ MATH_ENTRIES, sizeof(MATH_ENTRIES) / sizeof(MATH_ENTRIES[0]) };
+
+}
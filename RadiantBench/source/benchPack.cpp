@@ -0,0 +1,185 @@
+//  Filename: benchPack 
+//	Author:	Daniel														
+//	Date: 19/10/2026 06:27:15		
+//  Sqwack-Studios													
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include "bench.h"
+#include "RadiantEngine/core/pack.h"
+#include "RadiantEngine/platform/file.h"
+
+//Loading one CORPUS_BYTES asset from a pack: stored (a copy out of the mapping, the raw read speed once the pages are
+//cached), compressed with each codec on one thread, and spread over the job system. Throughput is decompressed bytes,
+//so every row is comparable with the raw read. The corpus mixes what assets look like: vertex data, index data and text.
+//With a cold cache the compressed rows also read a fraction of the bytes from disk, which these numbers don't show.
+namespace RE
+{
+
+	internal constexpr uint64 CORPUS_BYTES{ 16 * 1024 * 1024 };
+	internal constexpr const char* CORPUS_PATH{ "bench_io/corpus.bin" };
+	internal constexpr const char* CORPUS_PACK_PATH{ "bench_io/corpus.pack" };
+
+	struct PackBenchData
+	{
+		Pack pack;
+		uint8* buffer;		//CORPUS_BYTES
+		bool valid;
+	};
+
+	internal uint32 NextCorpusRandom(uint32& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	internal void FillCorpus(uint8* data)
+	{
+		uint32 state{ 0x9E3779B9 };
+		uint64 pos{};
+
+		//vertices on a smooth grid: position, normal, uv
+		const uint64 vertexBytes{ CORPUS_BYTES / 2 };
+		for (uint32 i{}; pos + 32 <= vertexBytes; ++i, pos += 32)
+		{
+			const fp32 x{ static_cast<fp32>(i % 256) * 0.25f };
+			const fp32 z{ static_cast<fp32>(i / 256) * 0.25f };
+			const fp32 v[8]{ x, sinf(x * 0.1f) * cosf(z * 0.1f), z, 0.0f, 1.0f, 0.0f, x / 64.0f, z / 64.0f };
+			memcpy(data + pos, v, sizeof(v));
+		}
+
+		//triangle indices of the same grid, mostly local
+		const uint64 indexEnd{ vertexBytes + CORPUS_BYTES / 4 };
+		for (uint32 quad{}; pos + 24 <= indexEnd; ++quad, pos += 24)
+		{
+			const uint32 a{ quad + quad / 255 };
+			const uint32 idx[6]{ a, a + 256, a + 1, a + 1, a + 256, a + 257 };
+			memcpy(data + pos, idx, sizeof(idx));
+		}
+
+		//shader-like text
+		internal constexpr const char* WORDS[]{ "float4 ", "position", " = ", "mul(", "world, ", "input.", "normal", ";\n",
+			"return ", "texture.Sample(", "sampler", ", uv)", "struct ", "VSOutput", "{\n", "}\n", "\tfloat3 ", "color" };
+		while (pos < CORPUS_BYTES)
+		{
+			const char* word{ WORDS[NextCorpusRandom(state) % (sizeof(WORDS) / sizeof(WORDS[0]))] };
+			for (; *word && pos < CORPUS_BYTES; ++word)
+				data[pos++] = static_cast<uint8>(*word);
+		}
+	}
+
+	internal bool BuildCorpusPack(uint8* buffer)
+	{
+		if (!MakeDirectories("bench_io"))
+			return false;
+		if (!FileExists(CORPUS_PATH))
+		{
+			FillCorpus(buffer);
+			if (!WriteEntireFile(CORPUS_PATH, buffer, CORPUS_BYTES))
+				return false;
+		}
+		if (FileExists(CORPUS_PACK_PATH))
+			return true;
+
+		PackInput inputs[NUM_COMPRESSION_CODECS];
+		uint32 num{};
+		for (uint32 c{}; c < NUM_COMPRESSION_CODECS; ++c)
+		{
+			const eCompressionCodec codec{ static_cast<eCompressionCodec>(c) };
+			if (IsCompressionCodecAvailable(codec))
+				inputs[num++] = { .path = CompressionCodecName(codec), .sourcePath = CORPUS_PATH, .codec = codec };
+		}
+		return WritePack(CORPUS_PACK_PATH, inputs, num);
+	}
+
+	internal PackBenchData OpenCorpusPack()
+	{
+		PackBenchData d{};
+		d.buffer = static_cast<uint8*>(malloc(CORPUS_BYTES));
+		d.valid = d.buffer && BuildCorpusPack(d.buffer) && OpenPack(d.pack, CORPUS_PACK_PATH);
+
+		if (!d.valid)
+			printf("pack: couldn't create %s\n", CORPUS_PACK_PATH);
+		return d;
+	}
+
+	internal void CloseCorpusPack(PackBenchData& d)
+	{
+		ClosePack(d.pack);
+		free(d.buffer);
+	}
+
+	internal void BenchReadRaw(Bench& b)
+	{
+		PackBenchData d{ OpenCorpusPack() };
+		File file;
+		if (!d.valid || !FileOpen(file, CORPUS_PATH, FileAccessRead))
+		{
+			CloseCorpusPack(d);
+			return;
+		}
+
+		b.bytes = CORPUS_BYTES;
+		while (BenchNext(b))
+		{
+			FileRead(file, d.buffer, CORPUS_BYTES, 0);
+			KeepAlive(d.buffer);
+		}
+
+		FileClose(file);
+		CloseCorpusPack(d);
+	}
+
+	internal void BenchReadEntry(Bench& b, const eCompressionCodec codec, const bool jobs)
+	{
+		PackBenchData d{ OpenCorpusPack() };
+		const PackEntry* entry{ d.valid ? FindPackEntry(d.pack, MakeStringId(MakeStringView(CompressionCodecName(codec)))) : nullptr };
+		if (!entry)
+		{
+			if (d.valid)
+				printf("pack: %s isn't available in this build\n", CompressionCodecName(codec));
+			CloseCorpusPack(d);
+			return;
+		}
+
+		printf("pack: %s stores %llu bytes as %llu (%.1f%%)\n", CompressionCodecName(codec), static_cast<unsigned long long>(entry->size),
+			static_cast<unsigned long long>(entry->storedSize), 100.0 * static_cast<fp64>(entry->storedSize) / static_cast<fp64>(entry->size));
+
+		b.bytes = CORPUS_BYTES;
+		while (BenchNext(b))
+		{
+			//ReadPackEntry goes wide on a job thread, DecompressPackBlocks stays on this one
+			if (jobs || !IsPackEntryCompressed(*entry))
+				ReadPackEntry(d.pack, *entry, d.buffer);
+			else
+				DecompressPackBlocks(d.pack, *entry, 0, PackEntryBlocks(*entry), d.buffer);
+			KeepAlive(d.buffer);
+		}
+
+		CloseCorpusPack(d);
+	}
+
+	internal void BenchStored(Bench& b) { BenchReadEntry(b, CompressionNone, false); }
+	internal void BenchLZ(Bench& b) { BenchReadEntry(b, CompressionLZ, false); }
+	internal void BenchLZJobs(Bench& b) { BenchReadEntry(b, CompressionLZ, true); }
+	internal void BenchDeflate(Bench& b) { BenchReadEntry(b, CompressionDeflate, false); }
+	internal void BenchDeflateJobs(Bench& b) { BenchReadEntry(b, CompressionDeflate, true); }
+
+	internal constexpr BenchEntry PACK_ENTRIES[]
+	{
+		{ "pack/read_raw",			BenchReadRaw },
+		{ "pack/stored",			BenchStored },
+		{ "pack/lz",				BenchLZ },
+		{ "pack/lz_jobs",			BenchLZJobs },
+		{ "pack/deflate",			BenchDeflate },		//RE_ENABLE_DEFLATE builds only
+		{ "pack/deflate_jobs",		BenchDeflateJobs },
+	};
+
+	const BenchGroup PACK_BENCHES{ PACK_ENTRIES, sizeof(PACK_ENTRIES) / sizeof(PACK_ENTRIES[0]) };
+
+}
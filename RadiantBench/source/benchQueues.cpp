@@ -0,0 +1,181 @@
+//  Filename: benchQueues 
+//	Author:	Daniel														
+//	Date: 18/10/2026 23:31:06		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+#include "bench.h"
+#include "RadiantEngine/core/spscQueue.h"
+#include "RadiantEngine/core/mpmcQueue.h"
+
+//Queue throughput with real threads. Every sample moves NUM_MESSAGES through the queue, producers push their share of
+//0..n and consumers add up what they pop; a wrong sum means a message was lost or duplicated and is reported.
+//Ordering, loss and duplicates are checked by the queues/* tests in RadiantTests, this only measures.
+//Threads are started per sample, which is noise next to moving NUM_MESSAGES.
+namespace RE
+{
+
+	internal constexpr uint64 NUM_MESSAGES{ 1 << 20 };
+	internal constexpr size_t QUEUE_CAPACITY{ 1024 };
+	internal constexpr size_t BATCH_SIZE{ 32 };
+
+	internal void CheckSum(const char* name, const uint64 sum, const uint64 count)
+	{
+		if (sum != count * (count - 1) / 2)
+			printf("%s: lost or duplicated messages\n", name);
+	}
+
+	internal void BenchSpsc(Bench& b, const bool batched)
+	{
+		SpscQueue<uint64> q{};
+		q.init(QUEUE_CAPACITY);
+
+		b.items = NUM_MESSAGES;
+		b.bytes = NUM_MESSAGES * sizeof(uint64);
+		while (BenchNext(b))
+		{
+			std::thread producer{ [&q, batched]()
+			{
+				uint64 batch[BATCH_SIZE];
+				for (uint64 i{}; i < NUM_MESSAGES; )
+				{
+					if (batched)
+					{
+						uint64 num{};
+						for (; num < BATCH_SIZE && i + num < NUM_MESSAGES; ++num)
+							batch[num] = i + num;
+
+						const size_t pushed{ q.pushBatch(batch, num) };
+						i += pushed;
+						if (!pushed)
+							std::this_thread::yield();
+					}
+					else if (q.push(i))
+					{
+						i++;
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+			} };
+
+			uint64 sum{};
+			uint64 batch[BATCH_SIZE];
+			for (uint64 received{}; received < NUM_MESSAGES; )
+			{
+				const size_t popped{ batched ? q.popBatch(batch, BATCH_SIZE) : q.pop(batch[0]) };
+				for (size_t i{}; i < popped; ++i)
+					sum += batch[i];
+
+				received += popped;
+				if (!popped)
+					std::this_thread::yield();
+			}
+
+			producer.join();
+			CheckSum(batched ? "queues/spsc_batch" : "queues/spsc", sum, NUM_MESSAGES);
+		}
+
+		q.release();
+	}
+
+	//numThreads producers and numThreads consumers, each producer pushes a contiguous slice of 0..NUM_MESSAGES
+	internal void BenchMpmc(Bench& b, const uint32 numThreads, const bool batched)
+	{
+		MpmcQueue<uint64> q{};
+		q.init(QUEUE_CAPACITY);
+
+		b.items = NUM_MESSAGES;
+		b.bytes = NUM_MESSAGES * sizeof(uint64);
+		while (BenchNext(b))
+		{
+			std::atomic<uint64> received{};
+			std::atomic<uint64> total{};
+			std::thread threads[16];
+
+			for (uint32 t{}; t < numThreads; ++t)
+			{
+				threads[t] = std::thread{ [&q, t, numThreads, batched]()
+				{
+					const uint64 begin{ NUM_MESSAGES * t / numThreads };
+					const uint64 end{ NUM_MESSAGES * (t + 1) / numThreads };
+					uint64 batch[BATCH_SIZE];
+					for (uint64 i{ begin }; i < end; )
+					{
+						uint64 num{ 1 };
+						batch[0] = i;
+						if (batched)
+						{
+							for (; num < BATCH_SIZE && i + num < end; ++num)
+								batch[num] = i + num;
+						}
+
+						const size_t pushed{ batched ? q.pushBatch(batch, num) : q.push(batch[0]) };
+						i += pushed;
+						if (!pushed)
+							std::this_thread::yield();
+					}
+				} };
+
+				threads[numThreads + t] = std::thread{ [&q, &received, &total, batched]()
+				{
+					uint64 sum{};
+					uint64 batch[BATCH_SIZE];
+					while (received.load(std::memory_order_relaxed) < NUM_MESSAGES)
+					{
+						const size_t popped{ batched ? q.popBatch(batch, BATCH_SIZE) : q.pop(batch[0]) };
+						for (size_t i{}; i < popped; ++i)
+							sum += batch[i];
+
+						if (popped)
+							received.fetch_add(popped, std::memory_order_relaxed);
+						else
+							std::this_thread::yield();
+					}
+
+					total.fetch_add(sum, std::memory_order_relaxed);
+				} };
+			}
+
+			for (uint32 t{}; t < numThreads * 2; ++t)
+				threads[t].join();
+
+			CheckSum("queues/mpmc", total.load(), NUM_MESSAGES);
+		}
+
+		q.release();
+	}
+
+	internal void BenchSpscSingle(Bench& b) { BenchSpsc(b, false); }
+	internal void BenchSpscBatch(Bench& b) { BenchSpsc(b, true); }
+	internal void BenchMpmc1(Bench& b) { BenchMpmc(b, 1, false); }
+	internal void BenchMpmc2(Bench& b) { BenchMpmc(b, 2, false); }
+	internal void BenchMpmc4(Bench& b) { BenchMpmc(b, 4, false); }
+	internal void BenchMpmc8(Bench& b) { BenchMpmc(b, 8, false); }
+	internal void BenchMpmcBatch1(Bench& b) { BenchMpmc(b, 1, true); }
+	internal void BenchMpmcBatch2(Bench& b) { BenchMpmc(b, 2, true); }
+	internal void BenchMpmcBatch4(Bench& b) { BenchMpmc(b, 4, true); }
+	internal void BenchMpmcBatch8(Bench& b) { BenchMpmc(b, 8, true); }
+
+	internal constexpr BenchEntry QUEUE_ENTRIES[]
+	{
+		{ "queues/spsc",				BenchSpscSingle },
+		{ "queues/spsc_batch",			BenchSpscBatch },
+		{ "queues/mpmc_1p1c",			BenchMpmc1 },
+		{ "queues/mpmc_2p2c",			BenchMpmc2 },
+		{ "queues/mpmc_4p4c",			BenchMpmc4 },
+		{ "queues/mpmc_8p8c",			BenchMpmc8 },
+		{ "queues/mpmc_batch_1p1c",		BenchMpmcBatch1 },
+		{ "queues/mpmc_batch_2p2c",		BenchMpmcBatch2 },
+		{ "queues/mpmc_batch_4p4c",		BenchMpmcBatch4 },
+		{ "queues/mpmc_batch_8p8c",		BenchMpmcBatch8 },
+	};
+
+	const BenchGroup QUEUE_BENCHES{ QUEUE_ENTRIES, sizeof(QUEUE_ENTRIES) / sizeof(QUEUE_ENTRIES[0]) };
+
+}
@@ -0,0 +1,270 @@
+//  Filename: main 
+//	Author:	Daniel														
+//	Date: 18/10/2026 19:21:05		
+//  Sqwack-Studios													
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "bench.h"
+#include "RadiantEngine/core/jobs.h"
+
+using namespace RE;
+
+// Arguments:
+/*
+* --filter <text>		Only run benchmarks whose name contains text
+* --warmup <n>			Untimed iterations before sampling (default 10)
+* --reps <n>			Timed samples per benchmark (default 100)
+* --json <path>			Write the results as JSON
+* --baseline <path>		Compare medians against a JSON file written by --json. Exit code is 1 when something regressed
+* --threshold <pct>		Allowed median slowdown against the baseline before it counts as a regression (default 10)
+* --list				Print the benchmark names and exit
+*/
+
+internal const BenchGroup* GROUPS[]{ &MATH_BENCHES, &CONTAINER_BENCHES, &JOB_BENCHES, &QUEUE_BENCHES, &LOG_BENCHES, &IO_BENCHES, &PACK_BENCHES, &CULLING_BENCHES, &BVH_BENCHES };
+internal constexpr uint32 MAX_BENCHES{ 256 };
+
+struct BenchResult
+{
+	const char* name;
+	BenchStats stats;
+	uint64 items;
+	uint64 bytes;
+};
+
+struct Options
+{
+	const char* filter;
+	const char* jsonPath;
+	const char* baselinePath;
+	fp64 threshold;
+	BenchConfig config;
+	bool list;
+};
+
+internal bool ParseOptions(const int argc, char* argv[], Options& o)
+{
+	o = { .filter = nullptr, .jsonPath = nullptr, .baselinePath = nullptr, .threshold = 10.0, .config = { .warmup = 10, .reps = 100 }, .list = false };
+
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		const char* arg{ argv[i] };
+		const bool hasValue{ i + 1 < argc };
+
+		if (!strcmp(arg, "--list"))
+			o.list = true;
+		else if (!strcmp(arg, "--filter") && hasValue)
+			o.filter = argv[++i];
+		else if (!strcmp(arg, "--json") && hasValue)
+			o.jsonPath = argv[++i];
+		else if (!strcmp(arg, "--baseline") && hasValue)
+			o.baselinePath = argv[++i];
+		else if (!strcmp(arg, "--threshold") && hasValue)
+			o.threshold = atof(argv[++i]);
+		else if (!strcmp(arg, "--warmup") && hasValue)
+			o.config.warmup = static_cast<uint32>(atoi(argv[++i]));
+		else if (!strcmp(arg, "--reps") && hasValue)
+			o.config.reps = static_cast<uint32>(atoi(argv[++i]));
+		else
+		{
+			fprintf(stderr, "Unknown argument \"%s\"\n", arg);
+			return false;
+		}
+	}
+
+	if (o.config.reps == 0)
+		o.config.reps = 1;
+
+	return true;
+}
+
+//value scaled to k/M/G so the columns stay narrow
+internal void PrintRate(const fp64 perSec)
+{
+	if (perSec <= 0.0)
+		printf(" %12s", "-");
+	else if (perSec >= 1e9)
+		printf(" %10.2f G", perSec * 1e-9);
+	else if (perSec >= 1e6)
+		printf(" %10.2f M", perSec * 1e-6);
+	else if (perSec >= 1e3)
+		printf(" %10.2f k", perSec * 1e-3);
+	else
+		printf(" %12.2f", perSec);
+}
+
+internal bool WriteJson(const char* path, const BenchResult* results, const uint32 num, const BenchConfig& config)
+{
+	FILE* f{ fopen(path, "wb") };
+	if (!f)
+		return false;
+
+	fprintf(f, "{\n\t\"warmup\": %u,\n\t\"reps\": %u,\n\t\"benchmarks\": [\n", config.warmup, config.reps);
+	for (uint32 i{}; i < num; ++i)
+	{
+		const BenchResult& r{ results[i] };
+		fprintf(f, "\t\t{ \"name\": \"%s\", \"median_ns\": %.1f, \"p99_ns\": %.1f, \"min_ns\": %.1f, \"mean_ns\": %.1f, "
+				"\"items\": %llu, \"bytes\": %llu, \"items_per_sec\": %.1f, \"bytes_per_sec\": %.1f }%s\n",
+				r.name, r.stats.medianNs, r.stats.p99Ns, r.stats.minNs, r.stats.meanNs,
+				static_cast<unsigned long long>(r.items), static_cast<unsigned long long>(r.bytes),
+				r.stats.itemsPerSec, r.stats.bytesPerSec, i + 1 < num ? "," : "");
+	}
+	fprintf(f, "\t]\n}\n");
+	fclose(f);
+	return true;
+}
+
+internal char* ReadFile(const char* path)
+{
+	FILE* f{ fopen(path, "rb") };
+	if (!f)
+		return nullptr;
+
+	fseek(f, 0, SEEK_END);
+	const long size{ ftell(f) };
+	rewind(f);
+
+	char* data{ static_cast<char*>(malloc(size + 1)) };
+	if (data)
+	{
+		data[fread(data, 1, size, f)] = '\0';
+	}
+	fclose(f);
+	return data;
+}
+
+//Only understands the files written by WriteJson: finds the entry with this name and reads its median.
+internal bool FindBaselineMedian(const char* json, const char* name, fp64& median)
+{
+	char key[256];
+	snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+
+	const char* entry{ strstr(json, key) };
+	if (!entry)
+		return false;
+
+	const char* value{ strstr(entry, "\"median_ns\":") };
+	const char* end{ strchr(entry, '}') };
+	if (!value || (end && value > end))
+		return false;
+
+	median = atof(value + strlen("\"median_ns\":"));
+	return true;
+}
+
+internal uint32 CompareBaseline(const char* json, const BenchResult* results, const uint32 num, const fp64 threshold)
+{
+	printf("\n%-40s %12s %12s %9s\n", "baseline", "old (ns)", "new (ns)", "delta");
+
+	uint32 regressions{};
+	for (uint32 i{}; i < num; ++i)
+	{
+		fp64 old;
+		if (!FindBaselineMedian(json, results[i].name, old))
+		{
+			printf("%-40s %12s %12.1f %9s\n", results[i].name, "-", results[i].stats.medianNs, "new");
+			continue;
+		}
+
+		const fp64 delta{ old > 0.0 ? (results[i].stats.medianNs - old) / old * 100.0 : 0.0 };
+		const bool regressed{ delta > threshold };
+		regressions += regressed;
+		printf("%-40s %12.1f %12.1f %+8.1f%%%s\n", results[i].name, old, results[i].stats.medianNs, delta, regressed ? "  REGRESSION" : "");
+	}
+
+	return regressions;
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!ParseOptions(argc, argv, options))
+		return 2;
+
+	BenchResult* results{ static_cast<BenchResult*>(malloc(sizeof(BenchResult) * MAX_BENCHES)) };
+	fp64* samples{ static_cast<fp64*>(malloc(sizeof(fp64) * options.config.reps)) };
+	uint32 numResults{};
+
+	if (!InitJobSystem())
+	{
+		fprintf(stderr, "Couldn't start the job system\n");
+		return 2;
+	}
+
+	if (!options.list)
+	{
+		printf("warmup %u, reps %u\n\n", options.config.warmup, options.config.reps);
+		printf("%-40s %12s %12s %12s %12s %12s\n", "benchmark", "median (ns)", "p99 (ns)", "min (ns)", "items/s", "bytes/s");
+	}
+
+	for (const BenchGroup* group : GROUPS)
+	{
+		for (uint32 i{}; i < group->num; ++i)
+		{
+			const BenchEntry& entry{ group->entries[i] };
+			if (options.filter && !strstr(entry.name, options.filter))
+				continue;
+
+			if (options.list)
+			{
+				printf("%s\n", entry.name);
+				continue;
+			}
+
+			if (numResults == MAX_BENCHES)
+				break;
+
+			Bench b{ .items = 0, .bytes = 0, .config = options.config, .iteration = 0, .sampleStart = 0, .samples = samples };
+			entry.fn(b);
+
+			if (b.iteration != options.config.warmup + options.config.reps)
+			{
+				printf("%-40s did not run every sample, skipped\n", entry.name);
+				continue;
+			}
+
+			const BenchStats stats{ ComputeBenchStats(b) };
+			results[numResults++] = { .name = entry.name, .stats = stats, .items = b.items, .bytes = b.bytes };
+
+			printf("%-40s %12.1f %12.1f %12.1f", entry.name, stats.medianNs, stats.p99Ns, stats.minNs);
+			PrintRate(stats.itemsPerSec);
+			PrintRate(stats.bytesPerSec);
+			printf("\n");
+		}
+	}
+
+	int exitCode{};
+
+	if (options.jsonPath && !options.list)
+	{
+		if (!WriteJson(options.jsonPath, results, numResults, options.config))
+		{
+			fprintf(stderr, "Couldn't write \"%s\"\n", options.jsonPath);
+			exitCode = 2;
+		}
+	}
+
+	if (options.baselinePath && !options.list)
+	{
+		char* baseline{ ReadFile(options.baselinePath) };
+		if (!baseline)
+		{
+			fprintf(stderr, "Couldn't read baseline \"%s\"\n", options.baselinePath);
+			exitCode = 2;
+		}
+		else
+		{
+			const uint32 regressions{ CompareBaseline(baseline, results, numResults, options.threshold) };
+			printf("\n%u regression(s) above %.1f%%\n", regressions, options.threshold);
+			exitCode = regressions ? 1 : exitCode;
+			free(baseline);
+		}
+	}
+
+	ShutdownJobSystem();
+	free(samples);
+	free(results);
+	return exitCode;
+}
@@ -0,0 +1,102 @@
+//  Filename: allocator 
+//	Author:	Daniel														
+//	Date: 18/10/2026 20:23:14		
+//  Sqwack-Studios													
+
+#ifndef RE_ALLOCATOR_H
+#define RE_ALLOCATOR_H
+
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/memoryTracker.h"
+#include <cstdlib>
+#include <cstring>
+
+//Allocator interface used by the core containers: a function pair and a context, copied by value into every container.
+//A zero initialized Allocator means the heap, so containers work without being told where their memory comes from.
+//Arena allocators ignore frees, the memory goes away when the arena is rewound.
+//Heap allocators report to the memory tracker under their tag (MemoryTagGeneral for the zero Allocator), frees rely on
+//the size the containers pass back.
+namespace RE
+{
+
+	using AllocFn = void* (*)(void* context, const size_t size, const size_t alignment);
+	using FreeFn = void (*)(void* context, void* p, const size_t size);
+
+	struct Allocator
+	{
+		AllocFn alloc;
+		FreeFn free;
+		void* context;
+	};
+
+	/* API */
+
+	Allocator HeapAllocator();
+	Allocator TaggedAllocator(const eMemoryTag tag);
+	Allocator ArenaAllocator(Arena& arena);
+
+	//Both forward to the heap when allocator.alloc is null
+	void* Allocate(const Allocator& allocator, const size_t size, const size_t alignment);
+	void Deallocate(const Allocator& allocator, void* p, const size_t size);
+
+
+	/* IMPLEMENTATIONS */
+
+	namespace detail
+	{
+		//context is the eMemoryTag
+		inline void* HeapAlloc(void* context, const size_t size, const size_t alignment)
+		{
+#if defined(_MSC_VER)
+			void* p{ _aligned_malloc(size, alignment) };
+#else
+			//aligned_alloc wants a multiple of alignment
+			void* p{ aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1)) };
+#endif
+			if (p)
+				TrackAllocation(static_cast<eMemoryTag>(reinterpret_cast<uintptr_t>(context)), size);
+
+			return p;
+		}
+
+		inline void HeapFree(void* context, void* p, const size_t size)
+		{
+			TrackFree(static_cast<eMemoryTag>(reinterpret_cast<uintptr_t>(context)), size);
+#if defined(_MSC_VER)
+			_aligned_free(p);
+#else
+			::free(p);
+#endif
+		}
+
+		inline void* ArenaAlloc(void* context, const size_t size, const size_t alignment)
+		{
+			return PushSize(*static_cast<Arena*>(context), size, alignment);
+		}
+
+		inline void ArenaFree(void*, void*, const size_t) {}
+	}
+
+	RE_INLINE Allocator HeapAllocator() { return { .alloc = detail::HeapAlloc, .free = detail::HeapFree, .context = nullptr }; }
+	RE_INLINE Allocator TaggedAllocator(const eMemoryTag tag) { return { .alloc = detail::HeapAlloc, .free = detail::HeapFree, .context = reinterpret_cast<void*>(static_cast<uintptr_t>(tag)) }; }
+	RE_INLINE Allocator ArenaAllocator(Arena& arena) { return { .alloc = detail::ArenaAlloc, .free = detail::ArenaFree, .context = &arena }; }
+
+	RE_INLINE void* Allocate(const Allocator& allocator, const size_t size, const size_t alignment)
+	{
+		return allocator.alloc ? allocator.alloc(allocator.context, size, alignment) : detail::HeapAlloc(nullptr, size, alignment);
+	}
+
+	RE_INLINE void Deallocate(const Allocator& allocator, void* p, const size_t size)
+	{
+		if (!p)
+			return;
+
+		if (allocator.alloc)
+			allocator.free(allocator.context, p, size);
+		else
+			detail::HeapFree(nullptr, p, size);
+	}
+
+}
+
+#endif // !RE_ALLOCATOR_H
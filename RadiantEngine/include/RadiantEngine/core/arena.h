@@ -0,0 +1,88 @@
+//  Filename: arena 
+//	Author:	Daniel														
+//	Date: 18/10/2026 19:41:12		
+//  Sqwack-Studios													
+
+#ifndef RE_ARENA_H
+#define RE_ARENA_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include "RadiantEngine/core/memoryTracker.h"
+
+//Linear allocator over a virtual memory reservation. InitArena only reserves address space, pages are committed in
+//ARENA_COMMIT_GRANULARITY steps as the arena grows, so reserving gigabytes is fine. Allocating is a pointer bump,
+//there is no per allocation free: take a marker, push, and rewind to the marker to release everything after it.
+//
+//Every thread owns two scratch arenas for temporary memory that dies before the function returns:
+//
+//	ScratchArena scratch{ BeginScratch() };
+//	char* blob{ PushArray<char>(*scratch.arena, size) };
+//	...
+//	EndScratch(scratch);
+//
+//A function that receives an arena to return results in must pass it as conflict, it then gets the other scratch arena
+//and rewinding its temporaries can't free the caller's results.
+namespace RE
+{
+
+	inline constexpr uint64 ARENA_COMMIT_GRANULARITY{ 64ull * 1024 };
+	inline constexpr uint64 ARENA_DEFAULT_ALIGNMENT{ 16 };
+	inline constexpr uint64 SCRATCH_ARENA_RESERVE{ 1ull << 30 };
+
+	struct Arena
+	{
+		uint8* base;
+		uint64 reserved;
+		uint64 committed;
+		uint64 pos;
+		uint64 peak;		//highest pos since init, useful to size reservations
+		eMemoryTag tag;		//committed pages are reported under it
+	};
+
+	struct ArenaMarker
+	{
+		Arena* arena;
+		uint64 pos;
+	};
+
+	using ScratchArena = ArenaMarker;
+
+	//reserveSize is rounded up to ARENA_COMMIT_GRANULARITY
+	bool InitArena(Arena& arena, const uint64 reserveSize, const eMemoryTag tag = MemoryTagGeneral);
+	//Returns reserved and committed pages to the OS
+	void ShutdownArena(Arena& arena);
+
+	//Returns nullptr when the reservation is exhausted or the OS refuses to commit. Memory is not cleared
+	void* PushSize(Arena& arena, const uint64 size, const uint64 alignment = ARENA_DEFAULT_ALIGNMENT);
+	//Same as PushSize but zero filled
+	void* PushSizeZero(Arena& arena, const uint64 size, const uint64 alignment = ARENA_DEFAULT_ALIGNMENT);
+
+	ArenaMarker GetArenaMarker(Arena& arena);
+	void RewindArena(const ArenaMarker marker);
+	//Rewinds to the start, pages stay committed so the next frame doesn't pay for them again
+	void ResetArena(Arena& arena);
+	//Gives back the committed pages above pos
+	void DecommitArena(Arena& arena);
+
+	//Reserves the calling thread's scratch arenas on first use. conflict may be nullptr
+	ScratchArena BeginScratch(const Arena* conflict = nullptr);
+	void EndScratch(const ScratchArena scratch);
+	//Threads must call this before exiting, the main thread can let the OS clean up
+	void ReleaseScratchArenas();
+
+	template<typename T>
+	RE_INLINE T* PushArray(Arena& arena, const uint64 num)
+	{
+		return static_cast<T*>(PushSize(arena, sizeof(T) * num, alignof(T) > ARENA_DEFAULT_ALIGNMENT ? alignof(T) : ARENA_DEFAULT_ALIGNMENT));
+	}
+
+	template<typename T>
+	RE_INLINE T* PushArrayZero(Arena& arena, const uint64 num)
+	{
+		return static_cast<T*>(PushSizeZero(arena, sizeof(T) * num, alignof(T) > ARENA_DEFAULT_ALIGNMENT ? alignof(T) : ARENA_DEFAULT_ALIGNMENT));
+	}
+
+}
+
+#endif // !RE_ARENA_H
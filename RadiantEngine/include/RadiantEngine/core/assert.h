@@ -0,0 +1,45 @@
+//  Filename: assert 
+//	Author:	Daniel														
+//	Date: 18/10/2026 20:18:37		
+//  Sqwack-Studios													
+
+#ifndef RE_ASSERT_H
+#define RE_ASSERT_H
+
+#include "RadiantEngine/core/platform.h"
+#include <cstdio>
+
+//RE_ASSERT only exists in debug builds (RE_DEBUG, from premake and CompileGame.bat), in every other build the condition
+//is not evaluated. Define RE_ENABLE_ASSERTS to force it either way.
+#ifndef RE_ENABLE_ASSERTS
+#if defined(RE_DEBUG) || defined(DEBUG_MODE)
+#define RE_ENABLE_ASSERTS 1
+#else
+#define RE_ENABLE_ASSERTS 0
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#define RE_DEBUG_BREAK() __debugbreak()
+#else
+#define RE_DEBUG_BREAK() __builtin_trap()
+#endif
+
+#if RE_ENABLE_ASSERTS
+#define RE_ASSERT(condition) do { if (!(condition)) { RE::ReportAssert(#condition, __FILE__, __LINE__); RE_DEBUG_BREAK(); } } while (0)
+#else
+#define RE_ASSERT(condition) do { (void)sizeof(condition); } while (0)
+#endif
+
+namespace RE
+{
+
+	inline void ReportAssert(const char* condition, const char* file, const int line)
+	{
+		fprintf(stderr, "%s(%d): assertion failed: %s\n", file, line, condition);
+		fflush(stderr);
+	}
+
+}
+
+#endif // !RE_ASSERT_H
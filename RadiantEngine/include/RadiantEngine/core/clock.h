@@ -0,0 +1,28 @@
+//  Filename: clock 
+//	Author:	Daniel														
+//	Date: 18/10/2026 23:48:12		
+//  Sqwack-Studios													
+
+#ifndef RE_CLOCK_H
+#define RE_CLOCK_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//Monotonic high resolution clock (QueryPerformanceCounter, CLOCK_MONOTONIC). Never jumps with wall clock changes, only
+//differences between two reads mean something.
+namespace RE
+{
+
+	int64 GetTimeNs();
+
+	//OS sleep. Granularity depends on the platform: on Windows it uses a high resolution waitable timer when available
+	//(~0.5ms), else Sleep (~1-16ms). Callers that need precision sleep short and spin the rest
+	void SleepNs(const int64 ns);
+
+	RE_INLINE fp64 NsToMs(const int64 ns) { return static_cast<fp64>(ns) * 1e-6; }
+	RE_INLINE int64 MsToNs(const fp64 ms) { return static_cast<int64>(ms * 1e6); }
+
+}
+
+#endif // !RE_CLOCK_H
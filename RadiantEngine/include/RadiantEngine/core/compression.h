@@ -0,0 +1,61 @@
+//  Filename: compression 
+//	Author:	Daniel														
+//	Date: 19/10/2026 05:38:02		
+//  Sqwack-Studios													
+
+#ifndef RE_COMPRESSION_H
+#define RE_COMPRESSION_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include <cstddef>
+
+//Block compression for asset data. Every call handles one independent block, callers split big inputs themselves
+//(packs use PACK_BLOCK_SIZE) so blocks can be decompressed in parallel or streamed.
+//
+//	CompressionLZ		byte oriented LZ77 in the LZ4 style: a token with literal and match lengths, the literals, a 16 bit
+//						offset. No entropy coding, decoding is only copies and about as fast as LZ4's. The default.
+//	CompressionDeflate	through libdeflate, smaller output at a fraction of the speed. Only available when the engine is
+//						built with RE_ENABLE_DEFLATE (premake turns it on when vendor/libdeflate exists).
+//
+//LZ format, a block is a list of sequences:
+//	token				high nibble literal count, low nibble match length - LZ_MIN_MATCH, 15 means more length bytes follow
+//	[literal length]	255 bytes until one is smaller, summed
+//	literals
+//	offset				uint16 little endian, 1..65535 back from the current output
+//	[match length]		same as the literal length
+//The last sequence has literals only. Matches end at least LZ_LAST_LITERALS bytes before the end of the block, which
+//lets the decoder copy 16 bytes at a time without checking every byte.
+#ifndef RE_ENABLE_DEFLATE
+#define RE_ENABLE_DEFLATE 0
+#endif
+
+namespace RE
+{
+
+	enum eCompressionCodec : uint8
+	{
+		CompressionNone = 0,
+		CompressionLZ,
+		CompressionDeflate,
+		NUM_COMPRESSION_CODECS
+	};
+
+	inline constexpr uint32 LZ_MIN_MATCH{ 4 };
+	inline constexpr uint32 LZ_LAST_LITERALS{ 16 };
+	inline constexpr uint32 LZ_MAX_OFFSET{ 65535 };
+
+	bool IsCompressionCodecAvailable(const eCompressionCodec codec);
+	const char* CompressionCodecName(const eCompressionCodec codec);
+
+	//Worst case output for size input bytes
+	size_t CompressBound(const eCompressionCodec codec, const size_t size);
+	//Returns the compressed size, 0 when it doesn't fit in dstCapacity. Pass srcSize - 1 to only accept output that is
+	//smaller than the input
+	size_t Compress(const eCompressionCodec codec, const void* src, const size_t srcSize, void* dst, const size_t dstCapacity);
+	//dstSize is the exact decompressed size. False on corrupt input, dst is left undefined
+	bool Decompress(const eCompressionCodec codec, const void* src, const size_t srcSize, void* dst, const size_t dstSize);
+
+}
+
+#endif // !RE_COMPRESSION_H
@@ -0,0 +1,47 @@
+//  Filename: fixedArray 
+//	Author:	Daniel														
+//	Date: 18/10/2026 20:34:06		
+//  Sqwack-Studios													
+
+#ifndef RE_FIXED_ARRAY_H
+#define RE_FIXED_ARRAY_H
+
+#include "RadiantEngine/core/span.h"
+
+//Array with inline storage for N elements and a runtime count, never allocates. Elements are trivially copyable (no
+//constructors or destructors are run). Bounds are asserted in debug builds.
+namespace RE
+{
+
+	template<typename T, size_t N>
+	struct FixedArray
+	{
+		T data[N];
+		size_t num;
+
+		RE_INLINE T& operator[](const size_t i) { RE_ASSERT(i < num); return data[i]; }
+		RE_INLINE const T& operator[](const size_t i) const { RE_ASSERT(i < num); return data[i]; }
+
+		RE_INLINE void add(const T& item) { RE_ASSERT(num < N); data[num++] = item; }
+		RE_INLINE T& pop() { RE_ASSERT(num > 0); return data[--num]; }
+		RE_INLINE T& back() { RE_ASSERT(num > 0); return data[num - 1]; }
+		RE_INLINE void clear() { num = 0; }
+		//Order is not kept, the last element takes the place of the removed one
+		RE_INLINE void removeSwap(const size_t i) { RE_ASSERT(i < num); data[i] = data[--num]; }
+
+		RE_INLINE bool full() const { return num == N; }
+		RE_INLINE bool empty() const { return num == 0; }
+		RE_INLINE static constexpr size_t capacity() { return N; }
+
+		RE_INLINE T* begin() { return data; }
+		RE_INLINE T* end() { return data + num; }
+		RE_INLINE const T* begin() const { return data; }
+		RE_INLINE const T* end() const { return data + num; }
+
+		RE_INLINE Span<T> span() { return { data, num }; }
+		RE_INLINE Span<const T> span() const { return { data, num }; }
+	};
+
+}
+
+#endif // !RE_FIXED_ARRAY_H
@@ -0,0 +1,81 @@
+//  Filename: framePacer 
+//	Author:	Daniel														
+//	Date: 19/10/2026 00:04:27		
+//  Sqwack-Studios													
+
+#ifndef RE_FRAME_PACER_H
+#define RE_FRAME_PACER_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//Paces the main loop. PaceFrame is called once per frame, it waits until the next frame is due and returns the frame
+//delta. Waiting sleeps for most of the remaining time and spins only for the last stretch, spinLeadNs, which adapts to
+//how late the OS wakes us up, so the core is free while waiting without losing precision.
+//
+//Frames are scheduled on a fixed grid (next frame = previous deadline + target) so the error of one wait doesn't add up;
+//after a missed deadline the grid restarts from now instead of rushing frames to catch up.
+//
+//Modes:
+//	PacingUnlocked	no waiting, only timing
+//	PacingFixed		caps at targetHz
+//	PacingAdaptive	targetHz is the fastest rate (usually the display refresh). When frames can't keep up the interval
+//					drops to the next multiple of it (60 -> 30 -> 20 -> 15), steady 30 instead of jittering between 60 and 40
+namespace RE
+{
+
+	inline constexpr uint32 FRAME_TIME_WINDOW{ 64 };	//frames in the rolling window, power of two
+	inline constexpr uint32 MAX_ADAPTIVE_DIVIDER{ 4 };
+
+	enum eFramePacing : uint8
+	{
+		PacingUnlocked = 0,
+		PacingFixed,
+		PacingAdaptive
+	};
+
+	struct FrameStats
+	{
+		fp64 lastMs;		//last frame, raw
+		fp64 averageMs;		//over the window
+		fp64 minMs;
+		fp64 maxMs;
+		fp64 p99Ms;
+		fp64 stdDevMs;		//frame time variance, what pacing tries to minimize
+		fp64 workMs;		//average time between the end of a wait and the start of the next one
+		fp64 targetMs;		//current interval, 0 when unlocked
+		fp64 fps;
+		uint64 frameIndex;
+	};
+
+	struct FramePacer
+	{
+		eFramePacing mode;
+		int64 baseIntervalNs;		//1 / targetHz
+		int64 intervalNs;			//current interval, baseIntervalNs * divider in adaptive mode
+		uint32 divider;
+		int64 spinLeadNs;			//part of the wait that is spun instead of slept
+
+		int64 deadline;				//when the current frame started on the grid
+		int64 lastFrame;			//when the last wait ended
+		uint64 frameIndex;
+
+		//rolling windows, ring indexed by frameIndex
+		int64 frameNs[FRAME_TIME_WINDOW];
+		int64 workNs[FRAME_TIME_WINDOW];
+	};
+
+	//targetHz is ignored when unlocked
+	void InitFramePacer(FramePacer& pacer, const eFramePacing mode, const fp64 targetHz);
+	//Can change every frame, the window is kept
+	void SetFramePacing(FramePacer& pacer, const eFramePacing mode, const fp64 targetHz);
+
+	//Waits for the next frame. Returns the frame delta in ms averaged over the window, steadier than the raw delta for
+	//animation and simulation; the raw one is FrameStats::lastMs
+	fp64 PaceFrame(FramePacer& pacer);
+
+	FrameStats GetFrameStats(const FramePacer& pacer);
+
+}
+
+#endif // !RE_FRAME_PACER_H
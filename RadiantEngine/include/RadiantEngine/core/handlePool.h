@@ -0,0 +1,204 @@
+//  Filename: handlePool 
+//	Author:	Daniel														
+//	Date: 18/10/2026 20:04:51		
+//  Sqwack-Studios													
+
+#ifndef RE_HANDLE_POOL_H
+#define RE_HANDLE_POOL_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include "RadiantEngine/core/assert.h"
+#include "RadiantEngine/core/memoryTracker.h"
+#include <cstdlib>
+#include <cstdint>
+
+//Pool of objects referenced by 32 bit generational handles: HANDLE_INDEX_BITS of slot index and HANDLE_GENERATION_BITS
+//of generation. Objects are packed in a dense array, so iterating objects[0, num) touches only live objects; slots map
+//handles to dense positions and are recycled through a free list. Releasing bumps the slot generation, old handles to
+//that slot become stale.
+//
+//With RE_HANDLE_VALIDATION (on in debug builds) ResolveHandle checks the generation and returns nullptr for stale handles.
+//Without it ResolveHandle only follows the index. IsHandleValid always checks.
+//
+//Objects are moved with plain copies when others are released, store trivially copyable types only.
+#ifndef RE_HANDLE_VALIDATION
+#define RE_HANDLE_VALIDATION RE_ENABLE_ASSERTS
+#endif
+
+namespace RE
+{
+
+	inline constexpr uint32 HANDLE_INDEX_BITS{ 20 };
+	inline constexpr uint32 HANDLE_GENERATION_BITS{ 32 - HANDLE_INDEX_BITS };
+	inline constexpr uint32 HANDLE_INDEX_MASK{ (1u << HANDLE_INDEX_BITS) - 1 };
+	inline constexpr uint32 HANDLE_GENERATION_MASK{ (1u << HANDLE_GENERATION_BITS) - 1 };
+	inline constexpr uint32 MAX_HANDLE_POOL_CAPACITY{ HANDLE_INDEX_MASK };
+
+	//T only gives the handle a type, Handle<Buffer> doesn't convert to Handle<Texture>. 0 is never a valid handle
+	template<typename T>
+	struct Handle
+	{
+		uint32 value;
+
+		RE_INLINE bool operator==(const Handle other) const { return value == other.value; }
+		RE_INLINE bool operator!=(const Handle other) const { return value != other.value; }
+	};
+
+	template<typename T>
+	struct HandlePool
+	{
+		T* objects;				//dense, [0, num)
+		uint32* denseToSlot;
+
+		//per slot
+		uint32* slotToDense;	//next free slot while the slot is free
+		uint16* generation;		//starts at 1, 0 is skipped when wrapping
+
+		uint32 freeHead;
+		uint32 num;
+		uint32 capacity;
+
+		void* memory;
+	};
+
+	/* API */
+
+	template<typename T> bool InitHandlePool(HandlePool<T>& pool, const uint32 capacity, const eMemoryTag tag = MemoryTagGeneral);
+	template<typename T> void ShutdownHandlePool(HandlePool<T>& pool);
+
+	//Returns a zero handle when the pool is full
+	template<typename T> Handle<T> CreateHandle(HandlePool<T>& pool, const T& object);
+	//Stale or zero handles are ignored
+	template<typename T> void ReleaseHandle(HandlePool<T>& pool, const Handle<T> handle);
+	template<typename T> bool IsHandleValid(const HandlePool<T>& pool, const Handle<T> handle);
+	template<typename T> T* ResolveHandle(HandlePool<T>& pool, const Handle<T> handle);
+	template<typename T> const T* ResolveHandle(const HandlePool<T>& pool, const Handle<T> handle);
+	//Handle of the object stored at objects[dense]
+	template<typename T> Handle<T> HandleAt(const HandlePool<T>& pool, const uint32 dense);
+
+	RE_INLINE uint32 HandleIndex(const uint32 value) { return value & HANDLE_INDEX_MASK; }
+	RE_INLINE uint32 HandleGeneration(const uint32 value) { return value >> HANDLE_INDEX_BITS; }
+
+
+	/* IMPLEMENTATIONS */
+
+	template<typename T>
+	inline bool InitHandlePool(HandlePool<T>& pool, const uint32 capacity, const eMemoryTag tag)
+	{
+		pool = {};
+		if (capacity == 0 || capacity > MAX_HANDLE_POOL_CAPACITY)
+			return false;
+
+		constexpr size_t alignment{ alignof(T) > alignof(uint32) ? alignof(T) : alignof(uint32) };
+		const size_t objectsBytes{ (sizeof(T) * capacity + alignof(uint32) - 1) & ~(alignof(uint32) - 1) };
+		const size_t bytes{ alignment + objectsBytes + sizeof(uint32) * capacity * 2 + sizeof(uint16) * capacity };
+
+		pool.memory = TrackedAlloc(tag, bytes);
+		if (!pool.memory)
+			return false;
+
+		uint8* p{ reinterpret_cast<uint8*>((reinterpret_cast<uintptr_t>(pool.memory) + alignment - 1) & ~(alignment - 1)) };
+		pool.objects = reinterpret_cast<T*>(p);
+		p += objectsBytes;
+		pool.denseToSlot = reinterpret_cast<uint32*>(p);
+		p += sizeof(uint32) * capacity;
+		pool.slotToDense = reinterpret_cast<uint32*>(p);
+		p += sizeof(uint32) * capacity;
+		pool.generation = reinterpret_cast<uint16*>(p);
+
+		for (uint32 i{}; i < capacity; ++i)
+		{
+			pool.slotToDense[i] = i + 1;
+			pool.generation[i] = 1;
+		}
+
+		pool.capacity = capacity;
+		return true;
+	}
+
+	template<typename T>
+	inline void ShutdownHandlePool(HandlePool<T>& pool)
+	{
+		TrackedFree(pool.memory);
+		pool = {};
+	}
+
+	template<typename T>
+	inline Handle<T> CreateHandle(HandlePool<T>& pool, const T& object)
+	{
+		if (pool.num == pool.capacity)
+			return {};
+
+		const uint32 slot{ pool.freeHead };
+		const uint32 dense{ pool.num++ };
+
+		pool.freeHead = pool.slotToDense[slot];
+		pool.slotToDense[slot] = dense;
+		pool.denseToSlot[dense] = slot;
+		pool.objects[dense] = object;
+
+		return { (static_cast<uint32>(pool.generation[slot]) << HANDLE_INDEX_BITS) | slot };
+	}
+
+	template<typename T>
+	inline bool IsHandleValid(const HandlePool<T>& pool, const Handle<T> handle)
+	{
+		const uint32 slot{ HandleIndex(handle.value) };
+		return handle.value != 0 && slot < pool.capacity && pool.generation[slot] == HandleGeneration(handle.value);
+	}
+
+	template<typename T>
+	inline void ReleaseHandle(HandlePool<T>& pool, const Handle<T> handle)
+	{
+		if (!IsHandleValid(pool, handle))
+			return;
+
+		const uint32 slot{ HandleIndex(handle.value) };
+		const uint32 dense{ pool.slotToDense[slot] };
+		const uint32 last{ --pool.num };
+
+		//keep objects packed, the last one fills the hole
+		if (dense != last)
+		{
+			pool.objects[dense] = pool.objects[last];
+			pool.denseToSlot[dense] = pool.denseToSlot[last];
+			pool.slotToDense[pool.denseToSlot[dense]] = dense;
+		}
+
+		const uint32 nextGeneration{ (pool.generation[slot] + 1u) & HANDLE_GENERATION_MASK };
+		pool.generation[slot] = static_cast<uint16>(nextGeneration ? nextGeneration : 1u);
+		pool.slotToDense[slot] = pool.freeHead;
+		pool.freeHead = slot;
+	}
+
+	template<typename T>
+	inline T* ResolveHandle(HandlePool<T>& pool, const Handle<T> handle)
+	{
+#if RE_HANDLE_VALIDATION
+		if (!IsHandleValid(pool, handle))
+			return nullptr;
+#endif
+		return &pool.objects[pool.slotToDense[HandleIndex(handle.value)]];
+	}
+
+	template<typename T>
+	inline const T* ResolveHandle(const HandlePool<T>& pool, const Handle<T> handle)
+	{
+#if RE_HANDLE_VALIDATION
+		if (!IsHandleValid(pool, handle))
+			return nullptr;
+#endif
+		return &pool.objects[pool.slotToDense[HandleIndex(handle.value)]];
+	}
+
+	template<typename T>
+	inline Handle<T> HandleAt(const HandlePool<T>& pool, const uint32 dense)
+	{
+		const uint32 slot{ pool.denseToSlot[dense] };
+		return { (static_cast<uint32>(pool.generation[slot]) << HANDLE_INDEX_BITS) | slot };
+	}
+
+}
+
+#endif // !RE_HANDLE_POOL_H
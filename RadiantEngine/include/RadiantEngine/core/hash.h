@@ -0,0 +1,153 @@
+//  Filename: hash 
+//	Author:	Daniel														
+//	Date: 18/10/2026 21:38:45		
+//  Sqwack-Studios													
+
+#ifndef RE_HASH_H
+#define RE_HASH_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <type_traits>
+
+//64 bit non cryptographic hash, same algorithm and output as XXH64. Large inputs run four independent lanes over 32 byte
+//stripes, so it goes at memory speed; small inputs only pay for the tail and the final avalanche.
+//Hash64 is constexpr: at compile time bytes are assembled one by one, at runtime they are loaded 8 at a time. Both give
+//the same value, so ids computed by the compiler match ids computed from runtime strings. Assumes little endian.
+namespace RE
+{
+
+	inline constexpr uint64 HASH_PRIME64_1{ 0x9E3779B185EBCA87ull };
+	inline constexpr uint64 HASH_PRIME64_2{ 0xC2B2AE3D27D4EB4Full };
+	inline constexpr uint64 HASH_PRIME64_3{ 0x165667B19E3779F9ull };
+	inline constexpr uint64 HASH_PRIME64_4{ 0x85EBCA77C2B2AE63ull };
+	inline constexpr uint64 HASH_PRIME64_5{ 0x27D4EB2F165667C5ull };
+
+	/* API */
+
+	constexpr uint64 Hash64(const char* data, const size_t size, const uint64 seed = 0);
+	uint64 Hash64(const void* data, const size_t size, const uint64 seed = 0);
+
+
+	/* IMPLEMENTATIONS */
+
+	namespace detail
+	{
+		RE_INLINE constexpr uint64 Read64(const char* p)
+		{
+			if (std::is_constant_evaluated())
+			{
+				uint64 v{};
+				for (uint32 i{}; i < 8; ++i)
+					v |= static_cast<uint64>(static_cast<uint8>(p[i])) << (8 * i);
+				return v;
+			}
+
+			uint64 v;
+			memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		RE_INLINE constexpr uint32 Read32(const char* p)
+		{
+			if (std::is_constant_evaluated())
+			{
+				uint32 v{};
+				for (uint32 i{}; i < 4; ++i)
+					v |= static_cast<uint32>(static_cast<uint8>(p[i])) << (8 * i);
+				return v;
+			}
+
+			uint32 v;
+			memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		RE_INLINE constexpr uint64 HashRound(uint64 acc, const uint64 input)
+		{
+			acc += input * HASH_PRIME64_2;
+			acc = std::rotl(acc, 31);
+			return acc * HASH_PRIME64_1;
+		}
+
+		RE_INLINE constexpr uint64 HashMergeRound(uint64 acc, const uint64 v)
+		{
+			acc ^= HashRound(0, v);
+			return acc * HASH_PRIME64_1 + HASH_PRIME64_4;
+		}
+	}
+
+	constexpr uint64 Hash64(const char* data, const size_t size, const uint64 seed)
+	{
+		const char* p{ data };
+		const char* const end{ data + size };
+		uint64 h;
+
+		if (size >= 32)
+		{
+			uint64 v1{ seed + HASH_PRIME64_1 + HASH_PRIME64_2 };
+			uint64 v2{ seed + HASH_PRIME64_2 };
+			uint64 v3{ seed };
+			uint64 v4{ seed - HASH_PRIME64_1 };
+
+			const char* const limit{ end - 32 };
+			do
+			{
+				v1 = detail::HashRound(v1, detail::Read64(p));
+				v2 = detail::HashRound(v2, detail::Read64(p + 8));
+				v3 = detail::HashRound(v3, detail::Read64(p + 16));
+				v4 = detail::HashRound(v4, detail::Read64(p + 24));
+				p += 32;
+			} while (p <= limit);
+
+			h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+			h = detail::HashMergeRound(h, v1);
+			h = detail::HashMergeRound(h, v2);
+			h = detail::HashMergeRound(h, v3);
+			h = detail::HashMergeRound(h, v4);
+		}
+		else
+		{
+			h = seed + HASH_PRIME64_5;
+		}
+
+		h += static_cast<uint64>(size);
+
+		for (; p + 8 <= end; p += 8)
+		{
+			h ^= detail::HashRound(0, detail::Read64(p));
+			h = std::rotl(h, 27) * HASH_PRIME64_1 + HASH_PRIME64_4;
+		}
+
+		if (p + 4 <= end)
+		{
+			h ^= static_cast<uint64>(detail::Read32(p)) * HASH_PRIME64_1;
+			h = std::rotl(h, 23) * HASH_PRIME64_2 + HASH_PRIME64_3;
+			p += 4;
+		}
+
+		for (; p < end; ++p)
+		{
+			h ^= static_cast<uint64>(static_cast<uint8>(*p)) * HASH_PRIME64_5;
+			h = std::rotl(h, 11) * HASH_PRIME64_1;
+		}
+
+		h ^= h >> 33;
+		h *= HASH_PRIME64_2;
+		h ^= h >> 29;
+		h *= HASH_PRIME64_3;
+		h ^= h >> 32;
+		return h;
+	}
+
+	RE_INLINE uint64 Hash64(const void* data, const size_t size, const uint64 seed)
+	{
+		return Hash64(static_cast<const char*>(data), size, seed);
+	}
+
+}
+
+#endif // !RE_HASH_H
@@ -0,0 +1,309 @@
+//  Filename: hashMap 
+//	Author:	Daniel														
+//	Date: 18/10/2026 21:06:12		
+//  Sqwack-Studios													
+
+#ifndef RE_HASH_MAP_H
+#define RE_HASH_MAP_H
+
+#include "RadiantEngine/core/simd.h"
+#include "RadiantEngine/core/allocator.h"
+#include "RadiantEngine/core/assert.h"
+#include <bit>
+
+//Open addressing hash map with separate control bytes, keys and values (three arrays, like a SoA).
+//Each slot has one control byte: EMPTY, DELETED or the low 7 bits of the key hash (h2). Slots are grouped by 16 and
+//a lookup compares h2 against a whole group at once (one SSE2 compare + movemask), so keys are only touched on h2
+//matches. The upper hash bits pick the first group, next groups follow a triangular sequence, which visits every group
+//when their count is a power of two. A lookup stops at the first group that has an EMPTY slot.
+//
+//Max load is 7/8. Erasing leaves a DELETED marker unless its group still has an EMPTY slot; markers are cleaned up
+//when the table is rebuilt.
+//
+//Keys and values must be trivially copyable. Iterate with:
+//	for (size_t i{}; i < map.capacity; ++i)
+//		if (map.isFull(i)) use(map.keys[i], map.values[i]);
+namespace RE
+{
+
+	inline constexpr size_t HASH_MAP_GROUP_WIDTH{ 16 };
+
+	//Default hashers. Provide a struct with the same operator() to hash other key types
+	template<typename K>
+	struct KeyHash;
+
+	RE_INLINE uint64 MixHash(uint64 h)
+	{
+		//murmur3 finalizer, every input bit affects both h1 and h2
+		h ^= h >> 33;
+		h *= 0xFF51AFD7ED558CCDull;
+		h ^= h >> 33;
+		h *= 0xC4CEB9FE1A85EC53ull;
+		h ^= h >> 33;
+		return h;
+	}
+
+	template<> struct KeyHash<uint32> { RE_INLINE uint64 operator()(const uint32 k) const { return MixHash(k); } };
+	template<> struct KeyHash<uint64> { RE_INLINE uint64 operator()(const uint64 k) const { return MixHash(k); } };
+	template<> struct KeyHash<int32> { RE_INLINE uint64 operator()(const int32 k) const { return MixHash(static_cast<uint32>(k)); } };
+	template<> struct KeyHash<int64> { RE_INLINE uint64 operator()(const int64 k) const { return MixHash(static_cast<uint64>(k)); } };
+	template<typename T> struct KeyHash<T*> { RE_INLINE uint64 operator()(const T* k) const { return MixHash(reinterpret_cast<uintptr_t>(k)); } };
+
+	template<typename K, typename V, typename Hasher = KeyHash<K>>
+	struct HashMap
+	{
+		static constexpr int8 EMPTY{ -128 };	//0b10000000
+		static constexpr int8 DELETED{ -2 };	//0b11111110
+
+		int8* ctrl;
+		K* keys;
+		V* values;
+		size_t num;
+		size_t capacity;		//0 or a power of two >= HASH_MAP_GROUP_WIDTH
+		size_t growthLeft;		//inserts into EMPTY slots before the table is rebuilt
+		Allocator allocator;
+
+		//Reserves room for count entries. Zero initialization is an empty map on the heap; set allocator before the
+		//first insert to use something else
+		bool init(const size_t count, const Allocator alloc = {})
+		{
+			*this = {};
+			allocator = alloc;
+			return rehash(count);
+		}
+
+		void release()
+		{
+			if (ctrl)
+				Deallocate(allocator, ctrl, AllocationSize(capacity));
+
+			*this = { .ctrl = nullptr, .keys = nullptr, .values = nullptr, .num = 0, .capacity = 0, .growthLeft = 0, .allocator = allocator };
+		}
+
+		RE_INLINE bool isFull(const size_t slot) const { return ctrl[slot] >= 0; }
+
+		V* find(const K& key)
+		{
+			const size_t slot{ findSlot(key) };
+			return slot == SIZE_MAX ? nullptr : &values[slot];
+		}
+
+		const V* find(const K& key) const
+		{
+			const size_t slot{ findSlot(key) };
+			return slot == SIZE_MAX ? nullptr : &values[slot];
+		}
+
+		RE_INLINE bool contains(const K& key) const { return findSlot(key) != SIZE_MAX; }
+
+		//Inserts or overwrites. Returns the stored value, nullptr when the allocator couldn't grow the table
+		V* insert(const K& key, const V& value)
+		{
+			bool added;
+			V* v{ findOrAdd(key, added) };
+			if (v)
+				*v = value;
+
+			return v;
+		}
+
+		//Returns the value for key, adding a slot when it wasn't there. The value of a new slot is uninitialized
+		V* findOrAdd(const K& key, bool& added)
+		{
+			added = false;
+			const uint64 hash{ Hasher{}(key) };
+
+			if (capacity)
+			{
+				const size_t found{ findSlot(key, hash) };
+				if (found != SIZE_MAX)
+					return &values[found];
+			}
+
+			size_t slot{ capacity ? findInsertSlot(hash) : SIZE_MAX };
+			//reusing a DELETED slot doesn't cost growth
+			if (slot == SIZE_MAX || (growthLeft == 0 && ctrl[slot] == EMPTY))
+			{
+				//same capacity when tombstones are what filled the table, double otherwise
+				if (!rehash(num + 1 > MaxLoad(capacity) / 2 ? MaxLoad(capacity) + 1 : MaxLoad(capacity)))
+					return nullptr;
+
+				slot = findInsertSlot(hash);
+			}
+
+			growthLeft -= ctrl[slot] == EMPTY;
+			ctrl[slot] = H2(hash);
+			keys[slot] = key;
+			num++;
+			added = true;
+			return &values[slot];
+		}
+
+		bool erase(const K& key)
+		{
+			const size_t slot{ findSlot(key) };
+			if (slot == SIZE_MAX)
+				return false;
+
+			//probes never continue past a group with an EMPTY slot, so this one can be EMPTY again
+			const size_t group{ slot & ~(HASH_MAP_GROUP_WIDTH - 1) };
+			if (MatchEmpty(ctrl + group))
+			{
+				ctrl[slot] = EMPTY;
+				growthLeft++;
+			}
+			else
+			{
+				ctrl[slot] = DELETED;
+			}
+
+			num--;
+			return true;
+		}
+
+		void clear()
+		{
+			if (!ctrl)
+				return;
+
+			memset(ctrl, EMPTY, capacity);
+			num = 0;
+			growthLeft = MaxLoad(capacity);
+		}
+
+		//Rebuilds the table with room for at least count entries, never fewer than it holds, dropping DELETED markers
+		bool rehash(const size_t count)
+		{
+			const size_t target{ count > num ? count : num };
+			size_t newCapacity{ HASH_MAP_GROUP_WIDTH };
+			while (MaxLoad(newCapacity) < target)
+				newCapacity <<= 1;
+
+			void* memory{ Allocate(allocator, AllocationSize(newCapacity), HASH_MAP_GROUP_WIDTH) };
+			if (!memory)
+				return false;
+
+			HashMap old{ *this };
+
+			ctrl = static_cast<int8*>(memory);
+			keys = reinterpret_cast<K*>(static_cast<uint8*>(memory) + KeysOffset(newCapacity));
+			values = reinterpret_cast<V*>(static_cast<uint8*>(memory) + ValuesOffset(newCapacity));
+			capacity = newCapacity;
+			memset(ctrl, EMPTY, newCapacity);
+			growthLeft = MaxLoad(newCapacity) - old.num;
+
+			for (size_t i{}; i < old.capacity; ++i)
+			{
+				if (!old.isFull(i))
+					continue;
+
+				const uint64 hash{ Hasher{}(old.keys[i]) };
+				const size_t slot{ findInsertSlot(hash) };
+				ctrl[slot] = H2(hash);
+				keys[slot] = old.keys[i];
+				values[slot] = old.values[i];
+			}
+
+			if (old.ctrl)
+				Deallocate(allocator, old.ctrl, AllocationSize(old.capacity));
+
+			return true;
+		}
+
+	private:
+		RE_INLINE static int8 H2(const uint64 hash) { return static_cast<int8>(hash & 0x7F); }
+		RE_INLINE static size_t H1(const uint64 hash) { return static_cast<size_t>(hash >> 7); }
+		RE_INLINE static size_t MaxLoad(const size_t cap) { return cap - cap / 8; }
+
+		RE_INLINE static size_t Align(const size_t v, const size_t a) { return (v + a - 1) & ~(a - 1); }
+		RE_INLINE static size_t KeysOffset(const size_t cap) { return Align(cap, alignof(K)); }
+		RE_INLINE static size_t ValuesOffset(const size_t cap) { return Align(KeysOffset(cap) + sizeof(K) * cap, alignof(V)); }
+		RE_INLINE static size_t AllocationSize(const size_t cap) { return ValuesOffset(cap) + sizeof(V) * cap; }
+
+		//one bit per slot of the group starting at g
+#if RE_SIMD_SSE
+		RE_INLINE static uint32 Match(const int8* g, const int8 h2)
+		{
+			const __m128i c{ _mm_load_si128(reinterpret_cast<const __m128i*>(g)) };
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(c, _mm_set1_epi8(h2))));
+		}
+
+		RE_INLINE static uint32 MatchEmpty(const int8* g) { return Match(g, EMPTY); }
+
+		//EMPTY and DELETED are the only negative control bytes
+		RE_INLINE static uint32 MatchEmptyOrDeleted(const int8* g)
+		{
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(g))));
+		}
+#else
+		RE_INLINE static uint32 Match(const int8* g, const int8 h2)
+		{
+			uint32 mask{};
+			for (uint32 i{}; i < HASH_MAP_GROUP_WIDTH; ++i)
+				mask |= static_cast<uint32>(g[i] == h2) << i;
+			return mask;
+		}
+
+		RE_INLINE static uint32 MatchEmpty(const int8* g) { return Match(g, EMPTY); }
+
+		RE_INLINE static uint32 MatchEmptyOrDeleted(const int8* g)
+		{
+			uint32 mask{};
+			for (uint32 i{}; i < HASH_MAP_GROUP_WIDTH; ++i)
+				mask |= static_cast<uint32>(g[i] < 0) << i;
+			return mask;
+		}
+#endif
+
+		RE_INLINE size_t findSlot(const K& key) const
+		{
+			return capacity ? findSlot(key, Hasher{}(key)) : SIZE_MAX;
+		}
+
+		size_t findSlot(const K& key, const uint64 hash) const
+		{
+			const size_t groupMask{ capacity / HASH_MAP_GROUP_WIDTH - 1 };
+			const int8 h2{ H2(hash) };
+			size_t group{ H1(hash) & groupMask };
+
+			for (size_t probe{ 1 }; probe <= groupMask + 1; ++probe)
+			{
+				const int8* g{ ctrl + group * HASH_MAP_GROUP_WIDTH };
+				for (uint32 match{ Match(g, h2) }; match; match &= match - 1)
+				{
+					const size_t slot{ group * HASH_MAP_GROUP_WIDTH + std::countr_zero(match) };
+					if (keys[slot] == key)
+						return slot;
+				}
+
+				if (MatchEmpty(g))
+					return SIZE_MAX;
+
+				group = (group + probe) & groupMask;
+			}
+
+			return SIZE_MAX;
+		}
+
+		//First EMPTY or DELETED slot on the probe sequence, SIZE_MAX when every slot is full
+		size_t findInsertSlot(const uint64 hash) const
+		{
+			const size_t groupMask{ capacity / HASH_MAP_GROUP_WIDTH - 1 };
+			size_t group{ H1(hash) & groupMask };
+
+			for (size_t probe{ 1 }; probe <= groupMask + 1; ++probe)
+			{
+				const uint32 available{ MatchEmptyOrDeleted(ctrl + group * HASH_MAP_GROUP_WIDTH) };
+				if (available)
+					return group * HASH_MAP_GROUP_WIDTH + std::countr_zero(available);
+
+				group = (group + probe) & groupMask;
+			}
+
+			return SIZE_MAX;
+		}
+	};
+
+}
+
+#endif // !RE_HASH_MAP_H
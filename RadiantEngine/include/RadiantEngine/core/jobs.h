@@ -0,0 +1,75 @@
+//  Filename: jobs 
+//	Author:	Daniel														
+//	Date: 18/10/2026 22:17:24		
+//  Sqwack-Studios													
+
+#ifndef RE_JOBS_H
+#define RE_JOBS_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include <atomic>
+
+//Work stealing job system. Thread 0 is the thread that called InitJobSystem (the main thread), threads 1..N-1 are
+//workers, one per remaining core. Every thread owns a Chase-Lev deque: it pushes and pops its own jobs at the bottom
+//(LIFO, cache friendly), idle threads steal from the top of the others (FIFO, oldest and usually biggest work).
+//Workers with nothing to steal sleep on a semaphore and are woken when jobs are pushed.
+//
+//Completion is tracked with counters instead of job handles. RunJobs adds the number of jobs to the counter, each job
+//decrements it when done, WaitForCounter blocks until it drops to a value. Waiting never idles: the waiting thread runs
+//queued jobs meanwhile, so waiting inside a job is fine and doesn't deadlock.
+//
+//	JobCounter counter{};
+//	RunJobs(jobs, num, &counter);
+//	WaitForCounter(&counter);
+//
+//Main thread jobs (window, D3D12 queue, anything thread affine) go through RunMainThreadJobs and only run on thread 0,
+//when it calls RunPendingMainThreadJobs or while it waits on a counter.
+//
+//RunJobs, ParallelFor and WaitForCounter must be called from job threads (thread 0 or a worker).
+namespace RE
+{
+
+	inline constexpr uint32 MAX_JOB_THREADS{ 64 };
+	inline constexpr uint32 JOB_DEQUE_CAPACITY{ 4096 };		//per thread, a full deque runs new jobs inline
+	inline constexpr uint32 MAIN_THREAD_JOB_CAPACITY{ 1024 };
+
+	using JobFn = void(*)(void* data);
+	using ParallelForFn = void(*)(void* data, const uint32 begin, const uint32 end);
+
+	struct JobCounter
+	{
+		std::atomic<uint32> value;
+	};
+
+	struct Job
+	{
+		JobFn fn;
+		void* data;
+	};
+
+	//numThreads includes the main thread, 0 means one per core. Call from the main thread. On failure nothing is left running
+	bool InitJobSystem(const uint32 numThreads = 0);
+	//Waits for the workers to finish their current job and exit. Queued jobs are dropped
+	void ShutdownJobSystem();
+
+	uint32 GetNumJobThreads();
+	//0 on the main thread, INVALID_JOB_THREAD on threads the job system doesn't own
+	uint32 GetJobThreadIndex();
+	inline constexpr uint32 INVALID_JOB_THREAD{ 0xFFFFFFFF };
+
+	//counter may be nullptr for fire and forget jobs
+	void RunJobs(const Job* jobs, const uint32 num, JobCounter* counter);
+	void RunMainThreadJobs(const Job* jobs, const uint32 num, JobCounter* counter);
+	//Runs the main thread jobs queued so far. Main thread only
+	void RunPendingMainThreadJobs();
+
+	void WaitForCounter(const JobCounter* counter, const uint32 value = 0);
+
+	//Splits [0, count) in chunks of at least minChunk and runs fn over them on every thread, the caller included.
+	//Returns when every chunk is done. Without a running job system fn runs over [0, count) on the caller
+	void ParallelFor(const uint32 count, const uint32 minChunk, ParallelForFn fn, void* data);
+
+}
+
+#endif // !RE_JOBS_H
@@ -0,0 +1,291 @@
+//  Filename: log 
+//	Author:	Daniel														
+//	Date: 19/10/2026 01:52:16		
+//  Sqwack-Studios													
+
+#ifndef RE_LOG_H
+#define RE_LOG_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include "RadiantEngine/core/stringView.h"
+
+#include <cstdio>
+
+//Deferred logging.
+//
+//	RE_LOG_INFO("Shader \"{}\" compiled in {} ms", name, ms);
+//
+//The calling thread never formats. Every call site owns a static LogSite (level, file, line, format) and a call only
+//copies a pointer to it, a timestamp and the raw arguments into the thread's own ring of LOG_THREAD_BUFFER_SIZE bytes,
+//created on its first message. Strings are copied, so they don't need to outlive the call. A backend thread drains the
+//rings, substitutes every {} with the next argument and writes the line to the sinks: console, text file and/or a
+//binary file that stores site descriptions once and then only the raw records, decoded offline with DecodeBinaryLog
+//(the LogDecoder tool).
+//
+//When a ring is full the caller waits for the backend. Critical messages also wait until they have been written, so they
+//make it out before a crash. A thread's ring is recycled once the thread has exited and its messages are written.
+//Messages are only lost when more than MAX_LOG_THREADS threads are alive and logging at once (the extra threads' messages
+//are dropped until a slot frees up), and when one message has so many arguments that they don't fit in half a ring.
+//A message whose strings don't fit has its strings cut instead.
+//
+//Arguments: integers, enums, bool, char, floating point, C strings, StringView/WStringView, str<T> and any other
+//pointer (printed as an address). Strings longer than LOG_MAX_STRING_LENGTH are cut.
+//
+//Levels below RE_LOG_MIN_LEVEL compile to nothing, arguments aren't evaluated: Trace and up in Debug (RE_DEBUG), Info and
+//up in Release (RE_RELEASE), Warning and up in Shipping (RE_SHIPPING). Every premake project and CompileGame.bat define one
+//of them. Define RE_LOG_MIN_LEVEL to override it. LogConfig::minLevel filters further at runtime.
+#ifndef RE_LOG_MIN_LEVEL
+#if defined(RE_DEBUG) || defined(DEBUG_MODE)
+#define RE_LOG_MIN_LEVEL 0
+#elif defined(RE_SHIPPING)
+#define RE_LOG_MIN_LEVEL 3
+#else
+#define RE_LOG_MIN_LEVEL 2
+#endif
+#endif
+
+namespace RE
+{
+
+	enum eLogLevel : uint8
+	{
+		LogLevelTrace = 0,
+		LogLevelDebug,
+		LogLevelInfo,
+		LogLevelWarning,
+		LogLevelError,
+		LogLevelCritical,
+		NUM_LOG_LEVELS
+	};
+
+	inline constexpr uint32 MAX_LOG_THREADS{ 64 };
+	inline constexpr uint32 LOG_THREAD_BUFFER_SIZE{ 256 * 1024 };	//power of two
+	inline constexpr uint32 LOG_MAX_STRING_LENGTH{ 16 * 1024 };
+	inline constexpr uint32 LOG_MAX_LINE_LENGTH{ 64 * 1024 };	//formatted lines are cut past this
+
+	struct LogSite
+	{
+		eLogLevel level;
+		uint32 line;
+		const char* file;
+		const char* format;
+	};
+
+	enum eLogArg : uint8
+	{
+		LogArgInt = 0,
+		LogArgUInt,
+		LogArgFloat,
+		LogArgBool,
+		LogArgChar,
+		LogArgString,
+		LogArgWString,
+		LogArgPointer
+	};
+
+	//An argument as the caller passed it, before it's copied into the ring
+	struct LogArg
+	{
+		eLogArg type;
+		uint32 length;	//characters, strings only
+		union
+		{
+			int64 i;
+			uint64 u;
+			fp64 f;
+			const char* s;
+			const wchar_t* ws;
+			const void* p;
+		};
+	};
+
+	struct LogConfig
+	{
+		bool console;
+		const char* textPath;		//nullptr for none
+		const char* binaryPath;		//nullptr for none
+		eLogLevel minLevel;
+	};
+
+	//Binary log layout, little endian:
+	//	LogFileHeader
+	//	a stream of records, each starting with its uint32 kind:
+	//		LogFileSite, char file[fileLength], char format[formatLength]		before the first message of the site
+	//		LogFileMessage, uint8 payload[payloadSize]
+	//The payload is every argument as { eLogArg type, value }: 8 bytes for numbers and pointers, { uint32 length,
+	//characters } for strings, wide characters wcharSize bytes each
+	inline constexpr uint32 LOG_FILE_MAGIC{ 0x474C4552 };	//"RELG"
+	inline constexpr uint32 LOG_FILE_VERSION{ 1 };
+
+	enum eLogFileRecord : uint32
+	{
+		LogFileRecordSite = 1,
+		LogFileRecordMessage
+	};
+
+	struct LogFileHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 wcharSize;
+		uint32 reserved;
+		int64 startTimeOfDayNs;		//local time when the log started, message times are relative to it
+	};
+
+	struct LogFileSite
+	{
+		uint32 kind;
+		uint32 id;
+		uint32 level;
+		uint32 line;
+		uint32 fileLength;
+		uint32 formatLength;
+	};
+
+	struct LogFileMessage
+	{
+		uint32 kind;
+		uint32 siteId;
+		uint32 thread;
+		uint32 numArgs;
+		int64 timeNs;
+		uint32 payloadSize;
+		uint32 reserved;
+	};
+
+	//Starts the backend thread. Messages logged before this or after ShutdownLog are ignored. Returns false, with nothing
+	//left open, when a file can't be created or the backend can't start
+	bool InitLog(const LogConfig& config);
+	//Writes everything still queued, stops the backend and frees every thread ring. No thread may log after this
+	void ShutdownLog();
+	//Blocks until every message logged before the call has been written
+	void FlushLog();
+
+	const char* LogLevelName(const eLogLevel level);
+
+	//Formats a binary log as text. Returns false when in can't be read or isn't a log
+	bool DecodeBinaryLog(const char* inPath, FILE* out);
+
+	//Hot path, use the macros
+	void LogWriteArgs(const LogSite& site, const LogArg* args, const uint32 numArgs);
+
+	RE_INLINE LogArg MakeLogArg(const bool v) { LogArg a{}; a.type = LogArgBool; a.u = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const char v) { LogArg a{}; a.type = LogArgChar; a.u = static_cast<uint8>(v); return a; }
+	RE_INLINE LogArg MakeLogArg(const signed char v) { LogArg a{}; a.type = LogArgInt; a.i = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const short v) { LogArg a{}; a.type = LogArgInt; a.i = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const int v) { LogArg a{}; a.type = LogArgInt; a.i = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const long v) { LogArg a{}; a.type = LogArgInt; a.i = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const long long v) { LogArg a{}; a.type = LogArgInt; a.i = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const unsigned char v) { LogArg a{}; a.type = LogArgUInt; a.u = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const unsigned short v) { LogArg a{}; a.type = LogArgUInt; a.u = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const unsigned int v) { LogArg a{}; a.type = LogArgUInt; a.u = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const unsigned long v) { LogArg a{}; a.type = LogArgUInt; a.u = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const unsigned long long v) { LogArg a{}; a.type = LogArgUInt; a.u = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const fp32 v) { LogArg a{}; a.type = LogArgFloat; a.f = v; return a; }
+	RE_INLINE LogArg MakeLogArg(const fp64 v) { LogArg a{}; a.type = LogArgFloat; a.f = v; return a; }
+
+	RE_INLINE LogArg MakeLogArg(const char* s)
+	{
+		LogArg a{};
+		a.type = LogArgString;
+		const size_t n{ s ? StringLength(s) : 0 };
+		a.length = static_cast<uint32>(n < LOG_MAX_STRING_LENGTH ? n : LOG_MAX_STRING_LENGTH);
+		a.s = s;
+		return a;
+	}
+
+	RE_INLINE LogArg MakeLogArg(const wchar_t* s)
+	{
+		LogArg a{};
+		a.type = LogArgWString;
+		const size_t n{ s ? StringLength(s) : 0 };
+		a.length = static_cast<uint32>(n < LOG_MAX_STRING_LENGTH ? n : LOG_MAX_STRING_LENGTH);
+		a.ws = s;
+		return a;
+	}
+
+	RE_INLINE LogArg MakeLogArg(const StringView s)
+	{
+		LogArg a{};
+		a.type = LogArgString;
+		a.length = static_cast<uint32>(s.num < LOG_MAX_STRING_LENGTH ? s.num : LOG_MAX_STRING_LENGTH);
+		a.s = s.data;
+		return a;
+	}
+
+	RE_INLINE LogArg MakeLogArg(const WStringView s)
+	{
+		LogArg a{};
+		a.type = LogArgWString;
+		a.length = static_cast<uint32>(s.num < LOG_MAX_STRING_LENGTH ? s.num : LOG_MAX_STRING_LENGTH);
+		a.ws = s.data;
+		return a;
+	}
+
+	RE_INLINE LogArg MakeLogArg(const str<char>& s) { return MakeLogArg(StringView{ s.data, s.num }); }
+	RE_INLINE LogArg MakeLogArg(const str<wchar_t>& s) { return MakeLogArg(WStringView{ s.data, s.num }); }
+
+	template<typename T>
+	RE_INLINE LogArg MakeLogArg(const T* p) { LogArg a{}; a.type = LogArgPointer; a.p = p; return a; }
+
+	//format is already in site, it's only here so the macros can pass __VA_ARGS__ as they are
+	template<typename... Args>
+	RE_INLINE void LogWrite(const LogSite& site, const char*, const Args&... args)
+	{
+		if constexpr (sizeof...(Args) == 0)
+		{
+			LogWriteArgs(site, nullptr, 0);
+		}
+		else
+		{
+			const LogArg packed[]{ MakeLogArg(args)... };
+			LogWriteArgs(site, packed, sizeof...(Args));
+		}
+	}
+
+}
+
+//The extra expansion makes MSVC's traditional preprocessor split __VA_ARGS__ into arguments
+#define RE_LOG_EXPAND(x) x
+#define RE_LOG_FORMAT_INNER(format, ...) format
+#define RE_LOG_FORMAT(...) RE_LOG_EXPAND(RE_LOG_FORMAT_INNER(__VA_ARGS__, 0))
+
+#define RE_LOG_AT(lvl, ...) do { \
+		static constexpr RE::LogSite reLogSite{ .level = lvl, .line = __LINE__, .file = __FILE__, .format = RE_LOG_FORMAT(__VA_ARGS__) }; \
+		RE::LogWrite(reLogSite, __VA_ARGS__); \
+	} while (0)
+
+#if RE_LOG_MIN_LEVEL <= 0
+#define RE_LOG_TRACE(...) RE_LOG_AT(RE::LogLevelTrace, __VA_ARGS__)
+#else
+#define RE_LOG_TRACE(...) do {} while (0)
+#endif
+
+#if RE_LOG_MIN_LEVEL <= 1
+#define RE_LOG_DEBUG(...) RE_LOG_AT(RE::LogLevelDebug, __VA_ARGS__)
+#else
+#define RE_LOG_DEBUG(...) do {} while (0)
+#endif
+
+#if RE_LOG_MIN_LEVEL <= 2
+#define RE_LOG_INFO(...) RE_LOG_AT(RE::LogLevelInfo, __VA_ARGS__)
+#else
+#define RE_LOG_INFO(...) do {} while (0)
+#endif
+
+#if RE_LOG_MIN_LEVEL <= 3
+#define RE_LOG_WARNING(...) RE_LOG_AT(RE::LogLevelWarning, __VA_ARGS__)
+#else
+#define RE_LOG_WARNING(...) do {} while (0)
+#endif
+
+#if RE_LOG_MIN_LEVEL <= 4
+#define RE_LOG_ERROR(...) RE_LOG_AT(RE::LogLevelError, __VA_ARGS__)
+#else
+#define RE_LOG_ERROR(...) do {} while (0)
+#endif
+
+#define RE_LOG_CRITICAL(...) RE_LOG_AT(RE::LogLevelCritical, __VA_ARGS__)
+
+#endif // !RE_LOG_H
@@ -0,0 +1,108 @@
+//  Filename: memoryTracker 
+//	Author:	Daniel														
+//	Date: 19/10/2026 01:22:46		
+//  Sqwack-Studios													
+
+#ifndef RE_MEMORY_TRACKER_H
+#define RE_MEMORY_TRACKER_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include <cstddef>
+
+//Per subsystem memory statistics. Every engine allocation carries an eMemoryTag and reports to the tracker: live bytes,
+//peak, allocation counts and a histogram of allocation sizes per tag. Counters are atomics, any thread can allocate.
+//
+//Heap memory goes through TrackedAlloc/TrackedFree, or through a TaggedAllocator for the containers. Arenas report their
+//committed pages (not every push) under the tag given to InitArena, so an arena shows as live bytes without counting as
+//allocations.
+//
+//Take snapshots and diff them to see what grows between two frames:
+//
+//	MemorySnapshot before;
+//	TakeMemorySnapshot(before);
+//	...
+//	MemorySnapshot after;
+//	TakeMemorySnapshot(after);
+//	const MemorySnapshot growth{ DiffMemorySnapshots(before, after) };
+//
+//Tracking compiles out in Shipping (RE_SHIPPING, defined by every premake project): the Track* calls are empty and
+//TrackedAlloc is a plain aligned malloc. Define RE_ENABLE_MEMORY_TRACKING to force it either way.
+#ifndef RE_ENABLE_MEMORY_TRACKING
+#if defined(RE_SHIPPING)
+#define RE_ENABLE_MEMORY_TRACKING 0
+#else
+#define RE_ENABLE_MEMORY_TRACKING 1
+#endif
+#endif
+
+namespace RE
+{
+
+	enum eMemoryTag : uint8
+	{
+		MemoryTagGeneral = 0,
+		MemoryTagScratch,
+		MemoryTagCore,
+		MemoryTagJobs,
+		MemoryTagScene,
+		MemoryTagRenderer,
+		MemoryTagGpuAllocator,	//CPU memory used by D3D12MA for its own bookkeeping
+		MemoryTagAssets,
+		MemoryTagShaders,
+		MemoryTagLogging,
+		MemoryTagProfiler,
+		NUM_MEMORY_TAGS
+	};
+
+	//bucket 0 is sizes up to 16 bytes, bucket i up to 16 << i, the last one everything bigger
+	inline constexpr uint32 MEMORY_HISTOGRAM_BUCKETS{ 24 };
+
+	struct MemoryTagStats
+	{
+		int64 liveBytes;
+		int64 peakBytes;		//highest liveBytes since startup. In a diff, the change of the peak
+		int64 liveAllocations;
+		int64 numAllocations;	//total since startup
+		int64 numFrees;
+		int64 histogram[MEMORY_HISTOGRAM_BUCKETS];	//allocations made, by size
+	};
+
+	struct MemorySnapshot
+	{
+		MemoryTagStats tags[NUM_MEMORY_TAGS];
+	};
+
+	const char* MemoryTagName(const eMemoryTag tag);
+	RE_INLINE uint32 MemoryHistogramBucket(const size_t size)
+	{
+		uint32 bucket{};
+		for (size_t limit{ 16 }; bucket < MEMORY_HISTOGRAM_BUCKETS - 1 && size > limit; limit <<= 1)
+			bucket++;
+
+		return bucket;
+	}
+
+	//Heap allocation with a small header that remembers size and tag, free it with TrackedFree
+	void* TrackedAlloc(const eMemoryTag tag, const size_t size, const size_t alignment = 16);
+	void TrackedFree(void* p);
+
+	void TakeMemorySnapshot(MemorySnapshot& snapshot);
+	//after - before, per tag and per bucket
+	MemorySnapshot DiffMemorySnapshots(const MemorySnapshot& before, const MemorySnapshot& after);
+
+#if RE_ENABLE_MEMORY_TRACKING
+	//For memory the tracker can't see, like pages committed by an arena or allocations made by a library
+	void TrackAllocation(const eMemoryTag tag, const size_t size);
+	void TrackFree(const eMemoryTag tag, const size_t size);
+	//Changes live bytes only, an arena committing or decommitting pages
+	void TrackCommit(const eMemoryTag tag, const int64 delta);
+#else
+	RE_INLINE void TrackAllocation(const eMemoryTag, const size_t) {}
+	RE_INLINE void TrackFree(const eMemoryTag, const size_t) {}
+	RE_INLINE void TrackCommit(const eMemoryTag, const int64) {}
+#endif
+
+}
+
+#endif // !RE_MEMORY_TRACKER_H
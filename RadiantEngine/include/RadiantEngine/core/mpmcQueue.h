@@ -0,0 +1,203 @@
+//  Filename: mpmcQueue 
+//	Author:	Daniel														
+//	Date: 18/10/2026 23:14:50		
+//  Sqwack-Studios													
+
+#ifndef RE_MPMC_QUEUE_H
+#define RE_MPMC_QUEUE_H
+
+#include "RadiantEngine/core/allocator.h"
+#include "RadiantEngine/core/assert.h"
+#include <atomic>
+
+//Bounded lock-free FIFO for any number of producers and consumers (Vyukov). Every cell carries a sequence number that
+//says whose turn it is: seq == pos means free for the producer claiming position pos, seq == pos + 1 means full for the
+//consumer claiming pos. Producers and consumers claim positions with a CAS on their own counter, so they only contend
+//with their own side, then publish the cell with a release store of its sequence.
+//
+//Batches claim several consecutive positions with a single CAS, as many as are ready when the counter is read.
+//
+//Capacity is rounded up to a power of two. Elements must be trivially copyable. init/release are not thread safe.
+namespace RE
+{
+
+	template<typename T>
+	struct MpmcQueue
+	{
+		struct Cell
+		{
+			std::atomic<size_t> sequence;
+			T data;
+		};
+
+		alignas(RE_CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos;
+		alignas(RE_CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos;
+
+		//read only after init
+		alignas(RE_CACHE_LINE_SIZE) Cell* cells;
+		size_t mask;
+		Allocator allocator;
+
+		bool init(const size_t capacity, const Allocator alloc = {})
+		{
+			//2 minimum, with a single cell seq == pos + 1 would be ambiguous
+			size_t cap{ 2 };
+			while (cap < capacity)
+				cap <<= 1;
+
+			allocator = alloc;
+			cells = static_cast<Cell*>(Allocate(allocator, sizeof(Cell) * cap, alignof(Cell) > RE_CACHE_LINE_SIZE ? alignof(Cell) : RE_CACHE_LINE_SIZE));
+			mask = cells ? cap - 1 : 0;
+			for (size_t i{}; cells && i < cap; ++i)
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+
+			enqueuePos.store(0, std::memory_order_relaxed);
+			dequeuePos.store(0, std::memory_order_relaxed);
+			return cells != nullptr;
+		}
+
+		void release()
+		{
+			Deallocate(allocator, cells, sizeof(Cell) * (mask + 1));
+			cells = nullptr;
+			mask = 0;
+		}
+
+		RE_INLINE size_t capacity() const { return cells ? mask + 1 : 0; }
+
+		//Returns false when full
+		bool push(const T& item)
+		{
+			size_t pos{ enqueuePos.load(std::memory_order_relaxed) };
+			for (;;)
+			{
+				Cell& cell{ cells[pos & mask] };
+				const intptr_t diff{ static_cast<intptr_t>(cell.sequence.load(std::memory_order_acquire) - pos) };
+				if (diff == 0)
+				{
+					if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						cell.data = item;
+						cell.sequence.store(pos + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (diff < 0)
+				{
+					//a consumer hasn't freed this cell yet
+					return false;
+				}
+				else
+				{
+					pos = enqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		//Returns false when empty
+		bool pop(T& out)
+		{
+			size_t pos{ dequeuePos.load(std::memory_order_relaxed) };
+			for (;;)
+			{
+				Cell& cell{ cells[pos & mask] };
+				const intptr_t diff{ static_cast<intptr_t>(cell.sequence.load(std::memory_order_acquire) - (pos + 1)) };
+				if (diff == 0)
+				{
+					if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						out = cell.data;
+						cell.sequence.store(pos + mask + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (diff < 0)
+				{
+					return false;
+				}
+				else
+				{
+					pos = dequeuePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		//Pushes up to num items in order. Returns how many were pushed, 0 when full
+		size_t pushBatch(const T* items, const size_t num)
+		{
+			size_t pos{ enqueuePos.load(std::memory_order_relaxed) };
+			for (;;)
+			{
+				//count the free cells from pos on, a cell can't stop being free while pos is unclaimed
+				size_t count{};
+				for (; count < num && count <= mask; ++count)
+				{
+					if (cells[(pos + count) & mask].sequence.load(std::memory_order_acquire) != pos + count)
+						break;
+				}
+
+				if (count == 0)
+				{
+					const intptr_t diff{ static_cast<intptr_t>(cells[pos & mask].sequence.load(std::memory_order_acquire) - pos) };
+					if (diff < 0)
+						return 0;
+
+					pos = enqueuePos.load(std::memory_order_relaxed);
+					continue;
+				}
+
+				if (enqueuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+				{
+					for (size_t i{}; i < count; ++i)
+					{
+						Cell& cell{ cells[(pos + i) & mask] };
+						cell.data = items[i];
+						cell.sequence.store(pos + i + 1, std::memory_order_release);
+					}
+
+					return count;
+				}
+			}
+		}
+
+		//Pops up to max items in order. Returns how many were popped, 0 when empty
+		size_t popBatch(T* out, const size_t max)
+		{
+			size_t pos{ dequeuePos.load(std::memory_order_relaxed) };
+			for (;;)
+			{
+				size_t count{};
+				for (; count < max && count <= mask; ++count)
+				{
+					if (cells[(pos + count) & mask].sequence.load(std::memory_order_acquire) != pos + count + 1)
+						break;
+				}
+
+				if (count == 0)
+				{
+					const intptr_t diff{ static_cast<intptr_t>(cells[pos & mask].sequence.load(std::memory_order_acquire) - (pos + 1)) };
+					if (diff < 0)
+						return 0;
+
+					pos = dequeuePos.load(std::memory_order_relaxed);
+					continue;
+				}
+
+				if (dequeuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed))
+				{
+					for (size_t i{}; i < count; ++i)
+					{
+						Cell& cell{ cells[(pos + i) & mask] };
+						out[i] = cell.data;
+						cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+					}
+
+					return count;
+				}
+			}
+		}
+	};
+
+}
+
+#endif // !RE_MPMC_QUEUE_H
@@ -0,0 +1,113 @@
+//  Filename: pack 
+//	Author:	Daniel														
+//	Date: 19/10/2026 04:44:18		
+//  Sqwack-Studios													
+
+#ifndef RE_PACK_H
+#define RE_PACK_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include "RadiantEngine/core/span.h"
+#include "RadiantEngine/core/stringId.h"
+#include "RadiantEngine/core/compression.h"
+#include "RadiantEngine/platform/file.h"
+
+//Pack archives: many files in one, read through a memory mapping.
+//
+//Layout, little endian, every section PACK_ALIGNMENT aligned:
+//	PackHeader
+//	PackEntry toc[tocCapacity]		open addressing table keyed by the path's StringId, linear probing
+//	char names[namesSize]			every path, '\0' terminated, for tools and debugging
+//	file data						each entry PACK_ALIGNMENT aligned
+//
+//Lookups hash nothing at runtime when the path is a literal ("shaders/basicVS.cso"_sid), probe the table in place and
+//return spans straight into the mapping, so opening a stored file is a few cache misses and no copies. tocCapacity is a
+//power of two at least twice the entry count, probes stay short.
+//
+//Compressed entries (codec other than CompressionNone) are split in PACK_BLOCK_SIZE blocks compressed independently, so
+//they decompress in parallel and can be streamed a block at a time:
+//	uint32 blockEnds[numBlocks]		end of every block, from the end of this table
+//	blocks							a block as big as its decompressed size is stored as is
+//The writer stores an entry uncompressed when asked to (PackInput::codec), when compression saves less than
+//1/PACK_MIN_SAVING of it, and when it's 4 GiB or more.
+//
+//Paths are VFS paths: relative, '/' separated, case sensitive, no "." or ".." parts. See MakeVfsPath.
+namespace RE
+{
+
+	inline constexpr uint32 PACK_MAGIC{ 0x4B504552 };		//"REPK"
+	inline constexpr uint32 PACK_VERSION{ 2 };
+	inline constexpr uint64 PACK_ALIGNMENT{ 64 };
+	inline constexpr uint32 PACK_BLOCK_SIZE{ 64 * 1024 };
+	inline constexpr uint64 PACK_MIN_SAVING{ 16 };
+
+	struct PackHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 numEntries;
+		uint32 tocCapacity;		//power of two
+		uint64 tocOffset;
+		uint64 namesOffset;
+		uint64 namesSize;
+		uint64 dataOffset;
+		uint64 fileSize;		//the whole pack, catches truncated files
+		uint64 reserved;
+	};
+
+	struct PackEntry
+	{
+		uint64 pathHash;		//StringId of the path, 0 for an empty slot
+		uint64 offset;			//from the start of the pack
+		uint64 size;			//bytes of the original file
+		uint64 storedSize;		//bytes in the pack
+		uint32 nameOffset;		//into names
+		uint32 codec;			//eCompressionCodec, CompressionNone when stored as is
+		uint64 reserved;
+	};
+
+	static_assert(sizeof(PackHeader) == 64 && sizeof(PackEntry) == 48, "Pack structs are a file format");
+
+	struct Pack
+	{
+		MappedFile file;
+		const PackHeader* header;
+		const PackEntry* toc;
+		const char* names;
+	};
+
+	//Maps the pack and validates its header and table. Fails on anything that doesn't look like a pack
+	bool OpenPack(Pack& pack, const char* path);
+	void ClosePack(Pack& pack);
+
+	const PackEntry* FindPackEntry(const Pack& pack, const StringId path);
+	//Points into the mapping, valid until ClosePack. For compressed entries this is the block table and the blocks
+	Span<const uint8> PackEntryData(const Pack& pack, const PackEntry& entry);
+	const char* PackEntryName(const Pack& pack, const PackEntry& entry);
+
+	RE_INLINE bool IsPackEntryCompressed(const PackEntry& entry) { return entry.codec != CompressionNone; }
+	RE_INLINE uint32 PackEntryBlocks(const PackEntry& entry) { return static_cast<uint32>((entry.size + PACK_BLOCK_SIZE - 1) / PACK_BLOCK_SIZE); }
+
+	//Decompresses blocks [first, first + num) of a compressed entry to dst, which receives block first at its start.
+	//For streaming, dst needs num * PACK_BLOCK_SIZE bytes (less when the last block is included)
+	bool DecompressPackBlocks(const Pack& pack, const PackEntry& entry, const uint32 first, const uint32 num, void* dst);
+	//Copies or decompresses the whole entry to dst, entry.size bytes. Called from a job thread the blocks are spread
+	//over the job system, anywhere else they decompress on the calling thread
+	bool ReadPackEntry(const Pack& pack, const PackEntry& entry, void* dst);
+
+	struct PackInput
+	{
+		const char* path;			//VFS path inside the pack
+		const char* sourcePath;		//file on disk
+		eCompressionCodec codec;	//CompressionNone to store it as is
+	};
+
+	//Writes a pack with every input, in order. Fails on duplicate paths, unreadable sources or codecs this build lacks
+	bool WritePack(const char* outPath, const PackInput* inputs, const uint32 num);
+	//Packs every file under directory, paths relative to it and prefixed with mountPoint ("" for none)
+	bool WritePackFromDirectory(const char* outPath, const char* directory, const char* mountPoint, const eCompressionCodec codec);
+
+}
+
+#endif // !RE_PACK_H
@@ -19,6 +19,15 @@
 #define RE_INLINE inline
 #endif
 
+//x64 line size. Data written by different threads is kept this far apart to avoid false sharing
+#define RE_CACHE_LINE_SIZE 64
+
+//Per-config defaults (asserts, log level, profiler, memory tracking) key on these. A project that defines none of them
+//silently gets Release defaults in every configuration, so it is an error instead.
+#if !defined(RE_DEBUG) && !defined(RE_RELEASE) && !defined(RE_SHIPPING)
+#error "Define RE_DEBUG, RE_RELEASE or RE_SHIPPING for the build configuration"
+#endif
+
 
 
 #endif // !RE_PLATFORM_H
@@ -0,0 +1,111 @@
+//  Filename: profiler 
+//	Author:	Daniel														
+//	Date: 19/10/2026 00:41:18		
+//  Sqwack-Studios													
+
+#ifndef RE_PROFILER_H
+#define RE_PROFILER_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//Instrumenting CPU profiler.
+//
+//	void Render()
+//	{
+//		RE_PROFILE_SCOPE("Render");
+//		...
+//	}
+//
+//Every thread records begin/end events into its own ring of PROFILE_EVENTS_PER_THREAD events, created on its first
+//event. Only the owner writes its ring, so recording is a timestamp (rdtsc on x64) and a store, no locks. When a ring
+//is full the oldest events are overwritten: the rings always hold the most recent history, and a capture is a time
+//window over it, e.g. the last second when something looked wrong.
+//
+//Names are stored as pointers, they must outlive the profiler (string literals, __func__).
+//
+//RE_PROFILE_* compile to nothing in Shipping (RE_SHIPPING). Define RE_ENABLE_PROFILER to force it either way.
+#ifndef RE_ENABLE_PROFILER
+#if defined(RE_SHIPPING)
+#define RE_ENABLE_PROFILER 0
+#else
+#define RE_ENABLE_PROFILER 1
+#endif
+#endif
+
+namespace RE
+{
+
+	inline constexpr uint32 MAX_PROFILE_THREADS{ 64 };
+	inline constexpr uint32 PROFILE_EVENTS_PER_THREAD{ 1 << 16 };	//power of two, 16 bytes each
+	inline constexpr uint32 MAX_PROFILE_DEPTH{ 256 };
+
+	//Binary capture layout, little endian:
+	//	ProfileFileHeader
+	//	numNames x { uint16 length, char name[length] }		index 0 is the empty name
+	//	numThreads x { ProfileFileThread, numScopes x ProfileFileScope }
+	//Scopes are sorted by start time within a thread
+	inline constexpr uint32 PROFILE_FILE_MAGIC{ 0x46505245 };	//"REPF"
+	inline constexpr uint32 PROFILE_FILE_VERSION{ 1 };
+
+	struct ProfileFileHeader
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 numNames;
+		uint32 numThreads;
+		int64 startNs;		//capture window, same clock as GetTimeNs
+		int64 endNs;
+	};
+
+	struct ProfileFileThread
+	{
+		uint32 nameIndex;
+		uint32 numScopes;
+	};
+
+	struct ProfileFileScope
+	{
+		int64 startNs;		//relative to ProfileFileHeader::startNs, clamped to the window
+		int64 durationNs;
+		uint32 nameIndex;
+		uint32 depth;
+	};
+
+	//Calibrates the timestamp counter against GetTimeNs, call before the first event
+	void InitProfiler();
+	//Frees every thread ring. No thread may record until the next InitProfiler, threads from before register again then
+	void ShutdownProfiler();
+
+	//Shown as the thread name in captures. Threads without one show as "Thread N"
+	void SetProfileThreadName(const char* name);
+
+	void ProfileBegin(const char* name);
+	void ProfileEnd();
+
+	//Scopes overlapping [fromNs, toNs] on the GetTimeNs timeline. Safe to call while other threads keep recording
+	bool WriteProfileTrace(const char* path, const int64 fromNs, const int64 toNs);	//Chrome trace_event JSON
+	bool WriteProfileBinary(const char* path, const int64 fromNs, const int64 toNs);
+
+	struct ProfileScope
+	{
+		RE_INLINE ProfileScope(const char* name) { ProfileBegin(name); }
+		RE_INLINE ~ProfileScope() { ProfileEnd(); }
+	};
+
+}
+
+#define RE_PROFILE_CONCAT_INNER(a, b) a##b
+#define RE_PROFILE_CONCAT(a, b) RE_PROFILE_CONCAT_INNER(a, b)
+
+#if RE_ENABLE_PROFILER
+#define RE_PROFILE_SCOPE(name) const RE::ProfileScope RE_PROFILE_CONCAT(profileScope, __LINE__){ name }
+#define RE_PROFILE_FUNCTION() RE_PROFILE_SCOPE(__func__)
+#define RE_PROFILE_THREAD_NAME(name) RE::SetProfileThreadName(name)
+#else
+#define RE_PROFILE_SCOPE(name) do {} while (0)
+#define RE_PROFILE_FUNCTION() do {} while (0)
+#define RE_PROFILE_THREAD_NAME(name) do {} while (0)
+#endif
+
+#endif // !RE_PROFILER_H
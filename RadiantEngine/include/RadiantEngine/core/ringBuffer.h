@@ -0,0 +1,93 @@
+//  Filename: ringBuffer 
+//	Author:	Daniel														
+//	Date: 18/10/2026 20:47:58		
+//  Sqwack-Studios													
+
+#ifndef RE_RING_BUFFER_H
+#define RE_RING_BUFFER_H
+
+#include "RadiantEngine/core/span.h"
+#include "RadiantEngine/core/allocator.h"
+
+//Fixed capacity FIFO. Capacity is rounded up to a power of two so wrapping is a mask; head and tail are free running
+//counters, num = tail - head. Single threaded, elements must be trivially copyable.
+namespace RE
+{
+
+	template<typename T>
+	struct RingBuffer
+	{
+		T* data;
+		size_t head;		//next to pop
+		size_t tail;		//next to push
+		size_t mask;		//capacity - 1
+		Allocator allocator;
+
+		bool init(const size_t capacity, const Allocator alloc = {})
+		{
+			size_t cap{ 1 };
+			while (cap < capacity)
+				cap <<= 1;
+
+			allocator = alloc;
+			data = static_cast<T*>(Allocate(allocator, sizeof(T) * cap, alignof(T) > 16 ? alignof(T) : 16));
+			head = 0;
+			tail = 0;
+			mask = data ? cap - 1 : 0;
+			return data != nullptr;
+		}
+
+		void release()
+		{
+			Deallocate(allocator, data, sizeof(T) * (mask + 1));
+			data = nullptr;
+			head = tail = mask = 0;
+		}
+
+		RE_INLINE size_t size() const { return tail - head; }
+		RE_INLINE size_t capacity() const { return data ? mask + 1 : 0; }
+		RE_INLINE bool empty() const { return head == tail; }
+		RE_INLINE bool full() const { return size() == capacity(); }
+
+		//Returns false when full
+		RE_INLINE bool push(const T& item)
+		{
+			if (full())
+				return false;
+
+			data[tail++ & mask] = item;
+			return true;
+		}
+
+		//Overwrites the oldest element when full
+		RE_INLINE void pushOverwrite(const T& item)
+		{
+			RE_ASSERT(data);
+			if (full())
+				head++;
+
+			data[tail++ & mask] = item;
+		}
+
+		//Returns false when empty
+		RE_INLINE bool pop(T& out)
+		{
+			if (empty())
+				return false;
+
+			out = data[head++ & mask];
+			return true;
+		}
+
+		RE_INLINE T& front() { RE_ASSERT(!empty()); return data[head & mask]; }
+		RE_INLINE T& back() { RE_ASSERT(!empty()); return data[(tail - 1) & mask]; }
+		RE_INLINE void clear() { head = tail = 0; }
+
+		//i = 0 is the oldest element
+		RE_INLINE T& operator[](const size_t i) { RE_ASSERT(i < size()); return data[(head + i) & mask]; }
+		RE_INLINE const T& operator[](const size_t i) const { RE_ASSERT(i < size()); return data[(head + i) & mask]; }
+	};
+
+}
+
+#endif // !RE_RING_BUFFER_H
@@ -0,0 +1,53 @@
+//  Filename: simd 
+//	Author:	Daniel														
+//	Date: 18/10/2026 10:12:31		
+//  Sqwack-Studios													
+
+#ifndef RE_SIMD_H
+#define RE_SIMD_H
+
+//Instruction set is picked at compile time, the highest available one wins:
+//	RE_SIMD_LEVEL_AVX2		/arch:AVX2 (msvc) or -mavx2 (clang/gcc). FMA is used when the compiler exposes it.
+//	RE_SIMD_LEVEL_SSE42		/arch:SSE4.2 or -msse4.2. Premake maps vectorextensions "SSE4.2" to /arch:SSE2 on msvc, which
+//							does not define __SSE4_2__, so the projects define RE_ENABLE_SSE42 explicitly.
+//	RE_SIMD_LEVEL_SCALAR	anything else, or when RE_FORCE_SCALAR is defined.
+//RE_SIMD_F16C (half <-> float conversion instructions) is only assumed on top of AVX2.
+
+#define RE_SIMD_LEVEL_SCALAR 0
+#define RE_SIMD_LEVEL_SSE42 1
+#define RE_SIMD_LEVEL_AVX2 2
+
+#if defined(RE_FORCE_SCALAR)
+#define RE_SIMD_LEVEL RE_SIMD_LEVEL_SCALAR
+#elif defined(__AVX2__)
+#define RE_SIMD_LEVEL RE_SIMD_LEVEL_AVX2
+#elif defined(__SSE4_2__) || defined(__SSE4_1__) || defined(__AVX__) || defined(RE_ENABLE_SSE42)
+#define RE_SIMD_LEVEL RE_SIMD_LEVEL_SSE42
+#else
+#define RE_SIMD_LEVEL RE_SIMD_LEVEL_SCALAR
+#endif
+
+#if RE_SIMD_LEVEL == RE_SIMD_LEVEL_AVX2
+#include <immintrin.h>
+#if defined(__FMA__) || defined(_MSC_VER) //msvc /arch:AVX2 guarantees FMA3 but doesn't advertise it
+#define RE_SIMD_FMA 1
+#endif
+#if defined(__F16C__) || defined(_MSC_VER) //same as FMA, every AVX2 cpu has it
+#define RE_SIMD_F16C 1
+#endif
+#elif RE_SIMD_LEVEL == RE_SIMD_LEVEL_SSE42
+#include <nmmintrin.h>
+#endif
+
+#ifndef RE_SIMD_FMA
+#define RE_SIMD_FMA 0
+#endif
+
+#ifndef RE_SIMD_F16C
+#define RE_SIMD_F16C 0
+#endif
+
+#define RE_SIMD_SSE (RE_SIMD_LEVEL >= RE_SIMD_LEVEL_SSE42)
+#define RE_SIMD_AVX (RE_SIMD_LEVEL >= RE_SIMD_LEVEL_AVX2)
+
+#endif // !RE_SIMD_H
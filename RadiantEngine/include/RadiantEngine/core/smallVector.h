@@ -0,0 +1,117 @@
+//  Filename: smallVector 
+//	Author:	Daniel														
+//	Date: 18/10/2026 20:41:19		
+//  Sqwack-Studios													
+
+#ifndef RE_SMALL_VECTOR_H
+#define RE_SMALL_VECTOR_H
+
+#include "RadiantEngine/core/span.h"
+#include "RadiantEngine/core/allocator.h"
+
+//Growable array that keeps its first N elements inline and only goes to its allocator once it outgrows them.
+//Zero initialization is a valid empty vector using the heap; set allocator before the first add to use something else.
+//Like the rest of core it is a plain struct: release() frees the heap block, nothing happens on scope exit, and copying
+//the struct copies the pointer, not the elements. Elements must be trivially copyable.
+namespace RE
+{
+
+	template<typename T, size_t N>
+	struct SmallVector
+	{
+		static_assert(N > 0, "use a plain pointer + allocator for vectors without inline storage");
+
+		T* heap;			//nullptr while the elements fit inline
+		size_t num;
+		size_t cap;			//0 means N
+		Allocator allocator;
+		T inlineData[N];
+
+		RE_INLINE T* data() { return heap ? heap : inlineData; }
+		RE_INLINE const T* data() const { return heap ? heap : inlineData; }
+		RE_INLINE size_t capacity() const { return heap ? cap : N; }
+
+		RE_INLINE T& operator[](const size_t i) { RE_ASSERT(i < num); return data()[i]; }
+		RE_INLINE const T& operator[](const size_t i) const { RE_ASSERT(i < num); return data()[i]; }
+
+		//Returns false when the allocator couldn't provide the memory, the contents are untouched
+		bool reserve(const size_t count)
+		{
+			if (count <= capacity())
+				return true;
+
+			size_t newCap{ capacity() * 2 };
+			newCap = newCap < count ? count : newCap;
+
+			T* p{ static_cast<T*>(Allocate(allocator, sizeof(T) * newCap, alignof(T) > 16 ? alignof(T) : 16)) };
+			if (!p)
+				return false;
+
+			memcpy(p, data(), sizeof(T) * num);
+			if (heap)
+				Deallocate(allocator, heap, sizeof(T) * cap);
+
+			heap = p;
+			cap = newCap;
+			return true;
+		}
+
+		bool resize(const size_t count)
+		{
+			if (!reserve(count))
+				return false;
+
+			num = count;
+			return true;
+		}
+
+		RE_INLINE bool add(const T& item)
+		{
+			//item could live inside the buffer reserve is about to move
+			const T copy{ item };
+			if (num == capacity() && !reserve(num + 1))
+				return false;
+
+			data()[num++] = copy;
+			return true;
+		}
+
+		bool append(const Span<const T> items)
+		{
+			if (!reserve(num + items.num))
+				return false;
+
+			memcpy(data() + num, items.data, sizeof(T) * items.num);
+			num += items.num;
+			return true;
+		}
+
+		RE_INLINE T& pop() { RE_ASSERT(num > 0); return data()[--num]; }
+		RE_INLINE T& back() { RE_ASSERT(num > 0); return data()[num - 1]; }
+		RE_INLINE void clear() { num = 0; }
+		RE_INLINE void removeSwap(const size_t i) { RE_ASSERT(i < num); T* d{ data() }; d[i] = d[--num]; }
+		RE_INLINE bool empty() const { return num == 0; }
+
+		//Back to inline storage, elements are dropped
+		void release()
+		{
+			if (heap)
+				Deallocate(allocator, heap, sizeof(T) * cap);
+
+			heap = nullptr;
+			cap = 0;
+			num = 0;
+		}
+
+		RE_INLINE T* begin() { return data(); }
+		RE_INLINE T* end() { return data() + num; }
+		RE_INLINE const T* begin() const { return data(); }
+		RE_INLINE const T* end() const { return data() + num; }
+
+		RE_INLINE Span<T> span() { return { data(), num }; }
+		RE_INLINE Span<const T> span() const { return { data(), num }; }
+	};
+
+}
+
+#endif // !RE_SMALL_VECTOR_H
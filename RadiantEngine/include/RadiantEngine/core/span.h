@@ -0,0 +1,49 @@
+//  Filename: span 
+//	Author:	Daniel														
+//	Date: 18/10/2026 20:29:50		
+//  Sqwack-Studios													
+
+#ifndef RE_SPAN_H
+#define RE_SPAN_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include "RadiantEngine/core/assert.h"
+#include <cstddef>
+
+//Non owning view over num contiguous elements. Aggregate, so it can be built with { .data = p, .num = n }.
+//Span<T> converts to Span<const T>.
+namespace RE
+{
+
+	template<typename T>
+	struct Span
+	{
+		T* data;
+		size_t num;
+
+		RE_INLINE T& operator[](const size_t i) const { RE_ASSERT(i < num); return data[i]; }
+
+		RE_INLINE T* begin() const { return data; }
+		RE_INLINE T* end() const { return data + num; }
+		RE_INLINE bool empty() const { return num == 0; }
+		RE_INLINE size_t bytes() const { return sizeof(T) * num; }
+
+		RE_INLINE Span subspan(const size_t first, const size_t count) const
+		{
+			RE_ASSERT(first <= num && count <= num - first);
+			return { data + first, count };
+		}
+
+		RE_INLINE operator Span<const T>() const { return { data, num }; }
+	};
+
+	template<typename T, size_t N>
+	RE_INLINE Span<T> MakeSpan(T (&array)[N]) { return { array, N }; }
+
+	template<typename T>
+	RE_INLINE Span<T> MakeSpan(T* data, const size_t num) { return { data, num }; }
+
+}
+
+#endif // !RE_SPAN_H
@@ -0,0 +1,136 @@
+//  Filename: spscQueue 
+//	Author:	Daniel														
+//	Date: 18/10/2026 23:02:37		
+//  Sqwack-Studios													
+
+#ifndef RE_SPSC_QUEUE_H
+#define RE_SPSC_QUEUE_H
+
+#include "RadiantEngine/core/allocator.h"
+#include "RadiantEngine/core/assert.h"
+#include <atomic>
+
+//Bounded lock-free FIFO for exactly one producer thread and one consumer thread (main -> render, I/O -> main...).
+//tail is only written by the producer and head only by the consumer, each on its own cache line. Each side also keeps a
+//stale copy of the other side's index and only reloads it when the copy says full/empty, so in steady state a push or
+//pop doesn't touch the other thread's cache line at all.
+//
+//Capacity is rounded up to a power of two. Elements must be trivially copyable. init/release are not thread safe.
+namespace RE
+{
+
+	template<typename T>
+	struct SpscQueue
+	{
+		//consumer
+		alignas(RE_CACHE_LINE_SIZE) std::atomic<size_t> head;
+		size_t cachedTail;
+
+		//producer
+		alignas(RE_CACHE_LINE_SIZE) std::atomic<size_t> tail;
+		size_t cachedHead;
+
+		//read only after init
+		alignas(RE_CACHE_LINE_SIZE) T* data;
+		size_t mask;
+		Allocator allocator;
+
+		bool init(const size_t capacity, const Allocator alloc = {})
+		{
+			size_t cap{ 1 };
+			while (cap < capacity)
+				cap <<= 1;
+
+			allocator = alloc;
+			data = static_cast<T*>(Allocate(allocator, sizeof(T) * cap, alignof(T) > RE_CACHE_LINE_SIZE ? alignof(T) : RE_CACHE_LINE_SIZE));
+			mask = data ? cap - 1 : 0;
+			head.store(0, std::memory_order_relaxed);
+			tail.store(0, std::memory_order_relaxed);
+			cachedTail = 0;
+			cachedHead = 0;
+			return data != nullptr;
+		}
+
+		void release()
+		{
+			Deallocate(allocator, data, sizeof(T) * (mask + 1));
+			data = nullptr;
+			mask = 0;
+		}
+
+		RE_INLINE size_t capacity() const { return data ? mask + 1 : 0; }
+		//Exact only when called from the producer or the consumer while the other side is idle
+		RE_INLINE size_t size() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire); }
+
+		/* producer */
+
+		//Returns false when full
+		RE_INLINE bool push(const T& item)
+		{
+			const size_t t{ tail.load(std::memory_order_relaxed) };
+			if (t - cachedHead > mask)
+			{
+				cachedHead = head.load(std::memory_order_acquire);
+				if (t - cachedHead > mask)
+					return false;
+			}
+
+			data[t & mask] = item;
+			tail.store(t + 1, std::memory_order_release);
+			return true;
+		}
+
+		//Pushes as many items as fit, publishing them together. Returns how many were pushed
+		size_t pushBatch(const T* items, const size_t num)
+		{
+			const size_t t{ tail.load(std::memory_order_relaxed) };
+			if (t - cachedHead + num > mask + 1)
+				cachedHead = head.load(std::memory_order_acquire);
+
+			const size_t room{ mask + 1 - (t - cachedHead) };
+			const size_t count{ num < room ? num : room };
+			for (size_t i{}; i < count; ++i)
+				data[(t + i) & mask] = items[i];
+
+			tail.store(t + count, std::memory_order_release);
+			return count;
+		}
+
+		/* consumer */
+
+		//Returns false when empty
+		RE_INLINE bool pop(T& out)
+		{
+			const size_t h{ head.load(std::memory_order_relaxed) };
+			if (h == cachedTail)
+			{
+				cachedTail = tail.load(std::memory_order_acquire);
+				if (h == cachedTail)
+					return false;
+			}
+
+			out = data[h & mask];
+			head.store(h + 1, std::memory_order_release);
+			return true;
+		}
+
+		//Pops up to max items. Returns how many were popped
+		size_t popBatch(T* out, const size_t max)
+		{
+			const size_t h{ head.load(std::memory_order_relaxed) };
+			if (cachedTail - h < max)
+				cachedTail = tail.load(std::memory_order_acquire);
+
+			const size_t available{ cachedTail - h };
+			const size_t count{ max < available ? max : available };
+			for (size_t i{}; i < count; ++i)
+				out[i] = data[(h + i) & mask];
+
+			head.store(h + count, std::memory_order_release);
+			return count;
+		}
+	};
+
+}
+
+#endif // !RE_SPSC_QUEUE_H
@@ -0,0 +1,51 @@
+//  Filename: stringId 
+//	Author:	Daniel														
+//	Date: 18/10/2026 21:52:10		
+//  Sqwack-Studios													
+
+#ifndef RE_STRING_ID_H
+#define RE_STRING_ID_H
+
+#include "RadiantEngine/core/hash.h"
+#include "RadiantEngine/core/stringView.h"
+#include "RadiantEngine/core/assert.h"
+
+//Names as 64 bit hashes. Ids from literals are computed by the compiler ("basicVS.hlsl"_sid), ids from runtime strings
+//by MakeStringId; both hash the same bytes with Hash64 and compare equal.
+//
+//With RE_STRING_ID_NAMES (debug builds by default) InternStringId also records the string so StringIdName can turn an id
+//back into text for logs and tools, and asserts when two different strings collide. Literal ids are not recorded
+//unless they go through InternStringId once. Without RE_STRING_ID_NAMES nothing is stored and StringIdName returns
+//nullptr.
+#ifndef RE_STRING_ID_NAMES
+#define RE_STRING_ID_NAMES RE_ENABLE_ASSERTS
+#endif
+
+namespace RE
+{
+
+	struct StringId
+	{
+		uint64 value;		//0 is no id
+
+		RE_INLINE constexpr bool operator==(const StringId other) const { return value == other.value; }
+		RE_INLINE constexpr bool operator!=(const StringId other) const { return value != other.value; }
+	};
+
+	RE_INLINE constexpr StringId MakeStringId(const StringView s) { return { Hash64(s.data, s.num) }; }
+
+	consteval StringId operator""_sid(const char* s, const size_t num) { return { Hash64(s, num) }; }
+
+	//Thread safe
+	StringId InternStringId(const StringView s);
+	const char* StringIdName(const StringId id);
+
+	//HashMap keys
+	template<typename K> struct KeyHash;
+	//already a hash, the low bits are as good as any
+	template<> struct KeyHash<StringId> { RE_INLINE uint64 operator()(const StringId k) const { return k.value; } };
+	template<> struct KeyHash<StringView> { RE_INLINE uint64 operator()(const StringView k) const { return Hash64(k.data, k.num); } };
+
+}
+
+#endif // !RE_STRING_ID_H
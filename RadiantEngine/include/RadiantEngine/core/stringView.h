@@ -0,0 +1,155 @@
+//  Filename: stringView 
+//	Author:	Daniel														
+//	Date: 18/10/2026 20:55:31		
+//  Sqwack-Studios													
+
+#ifndef RE_STRING_VIEW_H
+#define RE_STRING_VIEW_H
+
+#include "RadiantEngine/core/span.h"
+
+//Strings without allocations:
+//	BasicStringView<T>	read only view, not necessarily null terminated
+//	str<T>				caller owned buffer of cap elements holding num characters. append() keeps it null terminated, so
+//						data can go straight to C APIs; cap counts the terminator.
+namespace RE
+{
+
+	inline constexpr size_t STRING_NPOS{ ~size_t{} };
+
+	template<typename T>
+	RE_INLINE constexpr size_t StringLength(const T* s)
+	{
+		size_t n{};
+		while (s[n])
+			++n;
+		return n;
+	}
+
+	template<typename T>
+	struct BasicStringView
+	{
+		const T* data;
+		size_t num;
+
+		RE_INLINE const T& operator[](const size_t i) const { RE_ASSERT(i < num); return data[i]; }
+		RE_INLINE const T* begin() const { return data; }
+		RE_INLINE const T* end() const { return data + num; }
+		RE_INLINE bool empty() const { return num == 0; }
+
+		RE_INLINE BasicStringView subview(const size_t first, const size_t count = STRING_NPOS) const
+		{
+			RE_ASSERT(first <= num);
+			return { data + first, count < num - first ? count : num - first };
+		}
+
+		RE_INLINE operator Span<const T>() const { return { data, num }; }
+	};
+
+	using StringView = BasicStringView<char>;
+	using WStringView = BasicStringView<wchar_t>;
+
+	template<typename T>
+	struct str
+	{
+		T* data;
+		size_t num;
+		size_t cap;
+
+		RE_INLINE T& operator[](const size_t i) { RE_ASSERT(i < num); return data[i]; }
+		RE_INLINE const T& operator[](const size_t i) const { RE_ASSERT(i < num); return data[i]; }
+
+		RE_INLINE void clear() { num = 0; if (cap) data[0] = T{}; }
+
+		//Returns false and leaves the string untouched when s plus the terminator doesn't fit
+		RE_INLINE bool append(const BasicStringView<T> s)
+		{
+			if (num + s.num + 1 > cap)
+				return false;
+
+			for (size_t i{}; i < s.num; ++i)
+				data[num + i] = s.data[i];
+
+			num += s.num;
+			data[num] = T{};
+			return true;
+		}
+
+		RE_INLINE bool append(const T c) { return append(BasicStringView<T>{ &c, 1 }); }
+
+		RE_INLINE operator Span<T>() { return { data, num }; }
+		RE_INLINE operator Span<const T>() const { return { data, num }; }
+		RE_INLINE operator BasicStringView<T>() const { return { data, num }; }
+		RE_INLINE BasicStringView<T> view() const { return { data, num }; }
+	};
+
+	using String = str<char>;
+	using WString = str<wchar_t>;
+
+	/* API */
+
+	template<typename T> BasicStringView<T> MakeStringView(const T* s);
+	template<typename T> bool operator==(const BasicStringView<T> a, const BasicStringView<T> b);
+	template<typename T> bool StartsWith(const BasicStringView<T> s, const BasicStringView<T> prefix);
+	template<typename T> bool EndsWith(const BasicStringView<T> s, const BasicStringView<T> suffix);
+	//STRING_NPOS when c is not found
+	template<typename T> size_t FindFirst(const BasicStringView<T> s, const T c);
+	template<typename T> size_t FindLast(const BasicStringView<T> s, const T c);
+
+
+	/* IMPLEMENTATIONS */
+
+	template<typename T>
+	RE_INLINE BasicStringView<T> MakeStringView(const T* s) { return { s, StringLength(s) }; }
+
+	template<typename T>
+	inline bool operator==(const BasicStringView<T> a, const BasicStringView<T> b)
+	{
+		if (a.num != b.num)
+			return false;
+
+		for (size_t i{}; i < a.num; ++i)
+			if (a.data[i] != b.data[i])
+				return false;
+
+		return true;
+	}
+
+	template<typename T>
+	RE_INLINE bool operator!=(const BasicStringView<T> a, const BasicStringView<T> b) { return !(a == b); }
+
+	template<typename T>
+	inline bool StartsWith(const BasicStringView<T> s, const BasicStringView<T> prefix)
+	{
+		return prefix.num <= s.num && BasicStringView<T>{ s.data, prefix.num } == prefix;
+	}
+
+	template<typename T>
+	inline bool EndsWith(const BasicStringView<T> s, const BasicStringView<T> suffix)
+	{
+		return suffix.num <= s.num && BasicStringView<T>{ s.data + s.num - suffix.num, suffix.num } == suffix;
+	}
+
+	template<typename T>
+	inline size_t FindFirst(const BasicStringView<T> s, const T c)
+	{
+		for (size_t i{}; i < s.num; ++i)
+			if (s.data[i] == c)
+				return i;
+
+		return STRING_NPOS;
+	}
+
+	template<typename T>
+	inline size_t FindLast(const BasicStringView<T> s, const T c)
+	{
+		for (size_t i{ s.num }; i > 0; --i)
+			if (s.data[i - 1] == c)
+				return i - 1;
+
+		return STRING_NPOS;
+	}
+
+}
+
+#endif // !RE_STRING_VIEW_H
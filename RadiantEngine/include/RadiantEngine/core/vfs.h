@@ -0,0 +1,69 @@
+//  Filename: vfs 
+//	Author:	Daniel														
+//	Date: 19/10/2026 04:52:30		
+//  Sqwack-Studios													
+
+#ifndef RE_VFS_H
+#define RE_VFS_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include "RadiantEngine/core/span.h"
+#include "RadiantEngine/core/stringId.h"
+#include "RadiantEngine/platform/file.h"
+
+//Virtual file system. Assets are named by VFS paths ("shaders/basicVS.cso") and looked up by their StringId, whether
+//they live in a loose directory or a pack:
+//
+//	MountDirectory("../shaders", "shaders");	//development, files as the tools write them
+//	MountPack("data.pack");						//shipping, one file for everything
+//
+//	VfsFile vs;
+//	if (VfsOpen(vs, "shaders/basicVS.cso"_sid))
+//		use(vs.data);
+//	VfsClose(vs);
+//
+//Later mounts win, so a patch pack or a directory of edited files mounted last overrides what's below it.
+//
+//File data is a span into a memory mapping, of the pack or of the loose file, so opening a file never copies it. Pack
+//files stay valid until ShutdownVfs, loose files until VfsClose. Compressed pack entries are the exception: VfsOpen
+//decompresses them into a buffer (MemoryTagAssets) that VfsClose frees, across the job system when called from a job.
+//
+//Directory mounts index their files when mounted, files added afterwards aren't found until RescanVfsDirectories.
+//Mount and rescan from one thread while nothing else uses the VFS; lookups and VfsOpen are thread safe.
+namespace RE
+{
+
+	inline constexpr uint32 MAX_VFS_MOUNTS{ 16 };
+	inline constexpr uint32 MAX_VFS_PATH{ 512 };
+
+	struct VfsFile
+	{
+		Span<const uint8> data;
+		MappedFile mapping;		//loose files only
+		uint8* buffer;			//compressed pack entries only
+	};
+
+	bool InitVfs();
+	//Unmounts everything, spans from packs are invalid after this
+	void ShutdownVfs();
+
+	//Files under directory are found as mountPoint/relative/path. mountPoint "" mounts them at the root
+	bool MountDirectory(const char* directory, const char* mountPoint);
+	bool MountPack(const char* path);
+	//Re-indexes every directory mount
+	void RescanVfsDirectories();
+
+	//Canonical form of a runtime path: '\\' becomes '/', "./", repeated and leading separators are dropped. Writes it
+	//'\0' terminated to out and returns its length, 0 when it doesn't fit or is empty
+	size_t CanonicalizeVfsPath(const StringView path, char* out, const size_t capacity);
+	//StringId of the canonical path. Literals already in canonical form can use _sid directly
+	StringId MakeVfsPath(const StringView path);
+
+	bool VfsExists(const StringId path);
+	bool VfsOpen(VfsFile& file, const StringId path);
+	void VfsClose(VfsFile& file);
+
+}
+
+#endif // !RE_VFS_H
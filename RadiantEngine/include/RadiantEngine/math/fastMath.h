@@ -0,0 +1,226 @@
+//  Filename: fastMath 
+//	Author:	Daniel														
+//	Date: 18/10/2026 16:12:44		
+//  Sqwack-Studios													
+
+#ifndef RE_FAST_MATH_H
+#define RE_FAST_MATH_H
+
+#include "RadiantEngine/math/floatNx8.h"
+#include <bit>
+
+//Approximate variants of the exact functions in vectorAlgebra.h/<cmath>. Nothing in the engine uses them implicitly,
+//hot loops opt in by calling RE::fast:: explicitly. Error bounds were measured against the exact versions over the
+//documented input range (ulp = units in the last place, abs = absolute error), RadiantTests fast_math/* checks them.
+//Without SSE, rsqrt/rcp fall back to the exact computation.
+namespace RE
+{
+	namespace fast
+	{
+
+		/* API */
+
+		//rsqrtps + one Newton-Raphson step. max 4 ulp over [1e-30, 1e30]
+		fp32 rsqrt(const fp32);
+		//rcpps + one Newton-Raphson step. max 3 ulp over [1e-30, 1e30]
+		fp32 rcp(const fp32);
+
+		//v * rsqrt(lengthSq(v)). max 5 ulp per component vs RE::normalize. Zero vectors return NaN, same as the exact path
+		float3 normalize(const float3);
+		float4 normalize(const float4);
+
+		//Range reduced to [-pi/2, pi/2] + degree 11 polynomial. max abs error 3e-7 over [-1000, 1000],
+		//precision degrades with |x| as the reduction loses bits, same as any fp32 implementation
+		fp32 sin(const fp32);
+		fp32 cos(const fp32);
+		//Octant reduction + degree 11 polynomial. max abs error 2e-6 rad. Zeros keep their sign like std::atan2:
+		//atan2(+-0, -0) and atan2(+-0, x < 0) return +-pi, atan2(+-0, +0) returns +-0
+		fp32 atan2(const fp32 y, const fp32 x);
+		//2^n * e^f with |f| <= ln2/2, degree 6 polynomial for e^f. max relative error 3e-7 over [-87, 88], clamped outside.
+		//NaN returns NaN
+		fp32 exp(const fp32);
+
+		//8-wide, same bounds as the scalar versions
+		fp32x8 rsqrt(const fp32x8);
+		fp32x8 rcp(const fp32x8);
+		float3x8 normalize(const float3x8);
+
+
+
+		/* IMPLEMENTATIONS */
+
+		inline constexpr fp32 PI{ 3.14159265358979f };
+		inline constexpr fp32 HALF_PI{ 1.57079632679490f };
+		inline constexpr fp32 INV_TWO_PI{ 0.159154943091895f };
+		//2pi split in two parts so k * TWO_PI_HI stays exact for the range reduction (Cody-Waite)
+		inline constexpr fp32 TWO_PI_HI{ 6.28125f };
+		inline constexpr fp32 TWO_PI_LO{ 1.9353071795864769e-3f };
+
+#if RE_SIMD_SSE
+		RE_INLINE fp32 rsqrt(const fp32 x)
+		{
+			const __m128 v{ _mm_set_ss(x) };
+			const __m128 y{ _mm_rsqrt_ss(v) };
+			//y * (1.5 - 0.5 * x * y * y)
+			const __m128 yy{ _mm_mul_ss(_mm_mul_ss(v, y), y) };
+			return _mm_cvtss_f32(_mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), y), _mm_sub_ss(_mm_set_ss(3.f), yy)));
+		}
+
+		RE_INLINE fp32 rcp(const fp32 x)
+		{
+			const __m128 v{ _mm_set_ss(x) };
+			const __m128 y{ _mm_rcp_ss(v) };
+			//y * (2 - x * y)
+			return _mm_cvtss_f32(_mm_mul_ss(y, _mm_sub_ss(_mm_set_ss(2.f), _mm_mul_ss(v, y))));
+		}
+
+		RE_INLINE float3 normalize(const float3 a)
+		{
+			const __m128 r{ simd::load(a) };
+			const __m128 l2{ simd::Broadcast0(simd::Dot3(r, r)) };
+			const __m128 y{ _mm_rsqrt_ps(l2) };
+			const __m128 yy{ _mm_mul_ps(_mm_mul_ps(l2, y), y) };
+			const __m128 inv{ _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.f), yy)) };
+			return simd::store3(_mm_mul_ps(r, inv));
+		}
+
+		RE_INLINE float4 normalize(const float4 a)
+		{
+			const __m128 r{ simd::load(a) };
+			const __m128 l2{ simd::Broadcast0(simd::Dot4(r, r)) };
+			const __m128 y{ _mm_rsqrt_ps(l2) };
+			const __m128 yy{ _mm_mul_ps(_mm_mul_ps(l2, y), y) };
+			const __m128 inv{ _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.f), yy)) };
+			return simd::store4(_mm_mul_ps(r, inv));
+		}
+#else
+		RE_INLINE fp32 rsqrt(const fp32 x) { return 1.f / std::sqrt(x); }
+		RE_INLINE fp32 rcp(const fp32 x) { return 1.f / x; }
+		RE_INLINE float3 normalize(const float3 a) { return a * rsqrt(lengthSq(a)); }
+		RE_INLINE float4 normalize(const float4 a) { return a * rsqrt(lengthSq(a)); }
+#endif
+
+#if RE_SIMD_AVX
+		RE_INLINE fp32x8 rsqrt(const fp32x8 x)
+		{
+			const __m256 y{ _mm256_rsqrt_ps(x.v) };
+			const __m256 yy{ _mm256_mul_ps(_mm256_mul_ps(x.v, y), y) };
+			return { _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), y), _mm256_sub_ps(_mm256_set1_ps(3.f), yy)) };
+		}
+
+		RE_INLINE fp32x8 rcp(const fp32x8 x)
+		{
+			const __m256 y{ _mm256_rcp_ps(x.v) };
+			return { _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(2.f), _mm256_mul_ps(x.v, y))) };
+		}
+#elif RE_SIMD_SSE
+		RE_INLINE fp32x8 rsqrt(const fp32x8 x)
+		{
+			const __m128 half{ _mm_set1_ps(0.5f) }, three{ _mm_set1_ps(3.f) };
+			const __m128 ylo{ _mm_rsqrt_ps(x.lo) }, yhi{ _mm_rsqrt_ps(x.hi) };
+			const __m128 yylo{ _mm_mul_ps(_mm_mul_ps(x.lo, ylo), ylo) }, yyhi{ _mm_mul_ps(_mm_mul_ps(x.hi, yhi), yhi) };
+			return { _mm_mul_ps(_mm_mul_ps(half, ylo), _mm_sub_ps(three, yylo)), _mm_mul_ps(_mm_mul_ps(half, yhi), _mm_sub_ps(three, yyhi)) };
+		}
+
+		RE_INLINE fp32x8 rcp(const fp32x8 x)
+		{
+			const __m128 two{ _mm_set1_ps(2.f) };
+			const __m128 ylo{ _mm_rcp_ps(x.lo) }, yhi{ _mm_rcp_ps(x.hi) };
+			return { _mm_mul_ps(ylo, _mm_sub_ps(two, _mm_mul_ps(x.lo, ylo))), _mm_mul_ps(yhi, _mm_sub_ps(two, _mm_mul_ps(x.hi, yhi))) };
+		}
+#else
+		RE_INLINE fp32x8 rsqrt(const fp32x8 x) { return splat8(1.f) / sqrt(x); }
+		RE_INLINE fp32x8 rcp(const fp32x8 x) { return splat8(1.f) / x; }
+#endif
+
+		RE_INLINE float3x8 normalize(const float3x8 a) { return a * rsqrt(lengthSq(a)); }
+
+		//x - k * 2pi, in [-pi, pi]
+		RE_INLINE fp32 reduceAngle(const fp32 x)
+		{
+			const fp32 k{ std::nearbyint(x * INV_TWO_PI) };
+			return (x - k * TWO_PI_HI) - k * TWO_PI_LO;
+		}
+
+		//r in [-pi, pi]
+		RE_INLINE fp32 sinReduced(fp32 r)
+		{
+			//fold into [-pi/2, pi/2] with sin(x) = sin(pi - x)
+			if (r > HALF_PI)
+				r = PI - r;
+			else if (r < -HALF_PI)
+				r = -PI - r;
+
+			const fp32 r2{ r * r };
+			fp32 p{ -2.5052108385e-8f };
+			p = p * r2 + 2.7557319224e-6f;
+			p = p * r2 - 1.9841269841e-4f;
+			p = p * r2 + 8.3333333333e-3f;
+			p = p * r2 - 1.6666666667e-1f;
+			return r + r * r2 * p;
+		}
+
+		RE_INLINE fp32 sin(const fp32 x) { return sinReduced(reduceAngle(x)); }
+
+		RE_INLINE fp32 cos(const fp32 x)
+		{
+			//shift after reducing, x + pi/2 would round away the low bits of large angles
+			const fp32 r{ reduceAngle(x) + HALF_PI };
+			return sinReduced(r > PI ? r - 2.f * PI : r);
+		}
+
+		RE_INLINE fp32 atan2(const fp32 y, const fp32 x)
+		{
+			const fp32 ax{ std::fabs(x) }, ay{ std::fabs(y) };
+			const fp32 hi{ ax > ay ? ax : ay };
+			const fp32 lo{ ax > ay ? ay : ax };
+
+			//atan on [0, 1]. Both zero gives 0 here and the sign handling below picks 0 or pi
+			const fp32 t{ hi == 0.f ? 0.f : lo / hi };
+			const fp32 t2{ t * t };
+			fp32 p{ -0.01172120f };
+			p = p * t2 + 0.05265332f;
+			p = p * t2 - 0.11643287f;
+			p = p * t2 + 0.19354346f;
+			p = p * t2 - 0.33262347f;
+			p = p * t2 + 0.99997726f;
+			fp32 r{ t * p };
+
+			r = ay > ax ? HALF_PI - r : r;
+			//signbit and not < 0, so -0 counts as negative
+			r = std::signbit(x) ? PI - r : r;
+			return std::signbit(y) ? -r : r;
+		}
+
+		RE_INLINE fp32 exp(const fp32 x)
+		{
+			constexpr fp32 LOG2E{ 1.44269504089f };
+			constexpr fp32 LN2_HI{ 0.693359375f };
+			constexpr fp32 LN2_LO{ -2.12194440e-4f };
+
+			//NaN fails both clamps and would reach the int conversion below
+			if (std::isnan(x))
+				return x;
+
+			const fp32 cx{ x < -87.f ? -87.f : (x > 88.f ? 88.f : x) };
+			const fp32 n{ std::nearbyint(cx * LOG2E) };
+			//x = n * ln2 + f, ln2 split in two like the sin reduction
+			const fp32 f{ (cx - n * LN2_HI) - n * LN2_LO };
+
+			fp32 p{ 1.f / 720.f };
+			p = p * f + 1.f / 120.f;
+			p = p * f + 1.f / 24.f;
+			p = p * f + 1.f / 6.f;
+			p = p * f + 0.5f;
+			p = p * f + 1.f;
+			p = p * f + 1.f;
+
+			//2^n straight into the exponent bits
+			const fp32 scale{ std::bit_cast<fp32>(static_cast<uint32>(static_cast<int32>(n) + 127) << 23) };
+			return p * scale;
+		}
+
+	}
+}
+
+#endif // !RE_FAST_MATH_H
@@ -8,6 +8,7 @@
 
 #include "RadiantEngine/core/platform.h"
 #include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/simd.h"
 #include <cmath>
 
 namespace RE
@@ -86,7 +87,7 @@ namespace RE
 			return *this;
 		}
 
-		RE_INLINE float3 operator*=(const float3 other)
+		RE_INLINE float3& operator*=(const float3 other)
 		{
 			x *= other.x; y *= other.y; z *= other.z;
 			return *this;
@@ -128,16 +129,54 @@ namespace RE
 		fp32 x, y, z, w;
 	};
 
+#if RE_SIMD_SSE
+	//Register helpers. float3 is loaded as xy + z so we never read past the end of the struct; w is always 0. xy moves as one
+	//64 bit integer, the fp64 forms (_mm_load_sd) assume 8 byte alignment and float3 only has 4
+	namespace simd
+	{
+		RE_INLINE __m128 load(const float4& v) { return _mm_loadu_ps(&v.x); }
+		RE_INLINE __m128 load(const float3& v)
+		{
+			__m128 xy{ _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&v.x))) };
+			return _mm_movelh_ps(xy, _mm_load_ss(&v.z));
+		}
+
+		RE_INLINE float4 store4(const __m128 r) { float4 v; _mm_storeu_ps(&v.x, r); return v; }
+		RE_INLINE float3 store3(const __m128 r)
+		{
+			float3 v;
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(&v.x), _mm_castps_si128(r));
+			_mm_store_ss(&v.z, _mm_movehl_ps(r, r));
+			return v;
+		}
+	}
+
+	RE_INLINE float4 operator-(const float4 a) { return simd::store4(_mm_xor_ps(simd::load(a), _mm_set1_ps(-0.f))); }
+	RE_INLINE float4 operator+(const float4 a, const float4 b) { return simd::store4(_mm_add_ps(simd::load(a), simd::load(b))); }
+	RE_INLINE float4 operator-(const float4 a, const float4 b) { return simd::store4(_mm_sub_ps(simd::load(a), simd::load(b))); }
+	RE_INLINE float4 operator*(const float4 a, const float4 b) { return simd::store4(_mm_mul_ps(simd::load(a), simd::load(b))); }
+	RE_INLINE float4 operator*(const float4 v, const fp32 s) { return simd::store4(_mm_mul_ps(simd::load(v), _mm_set1_ps(s))); }
+	RE_INLINE float4 operator/(const float4 a, const float4 b) { return simd::store4(_mm_div_ps(simd::load(a), simd::load(b))); }
+	RE_INLINE float4 operator/(const fp32 s, const float4 v) { return simd::store4(_mm_div_ps(_mm_set1_ps(s), simd::load(v))); }
+#else
 	RE_INLINE float4 operator-(const float4 a) { return float4{ -a.x, -a.y, -a.z, -a.w }; }
 	RE_INLINE float4 operator+(const float4 a, const float4 b) { return float4{ a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; }
 	RE_INLINE float4 operator-(const float4 a, const float4 b) { return float4{ a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w }; }
 	RE_INLINE float4 operator*(const float4 a, const float4 b) { return float4{ a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w }; }
 	RE_INLINE float4 operator*(const float4 v, const fp32 s) { return float4{ s * v.x, s * v.y, s * v.z, s * v.w }; }
-	RE_INLINE float4 operator*(const fp32 s, const float4 v) { return v * s; }
 	RE_INLINE float4 operator/(const float4 a, const float4 b) { return float4{ a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w }; }
 	RE_INLINE float4 operator/(const fp32 s, const float4 v) { return float4{ s / v.x, s / v.y, s / v.z, s / v.w }; }
+#endif
+	RE_INLINE float4 operator*(const fp32 s, const float4 v) { return v * s; }
 	RE_INLINE float4 operator/(const float4 v, const fp32 s) { fp32 is{ 1.f / s }; return is * v; }
 
+	RE_INLINE float4& operator+=(float4& a, const float4 b) { a = a + b; return a; }
+	RE_INLINE float4& operator-=(float4& a, const float4 b) { a = a - b; return a; }
+	RE_INLINE float4& operator*=(float4& a, const float4 b) { a = a * b; return a; }
+	RE_INLINE float4& operator*=(float4& a, const fp32 s) { a = a * s; return a; }
+	RE_INLINE float4& operator/=(float4& a, const float4 b) { a = a / b; return a; }
+	RE_INLINE float4& operator/=(float4& a, const fp32 s) { a = a / s; return a; }
+
 
 
 	
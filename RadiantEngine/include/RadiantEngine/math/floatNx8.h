@@ -0,0 +1,422 @@
+//  Filename: floatNx8 
+//	Author:	Daniel														
+//	Date: 18/10/2026 11:02:47		
+//  Sqwack-Studios													
+
+#ifndef RE_FLOATNX8_H
+#define RE_FLOATNX8_H
+
+#include "RadiantEngine/math/vectorAlgebra.h"
+#include <cstddef>
+#include <bit>
+
+//Wide structure-of-arrays types. Each lane of fp32x8 holds a component of a different vector, so a float3x8 is 8 float3
+//processed at once. AVX2 uses one ymm register, SSE4.2 two xmm registers and scalar a plain array; the API is the same.
+//Batch functions walk SoA streams 8 elements at a time and finish the tail with RE::scalar.
+namespace RE
+{
+
+	struct fp32x8
+	{
+#if RE_SIMD_AVX
+		__m256 v;
+#elif RE_SIMD_SSE
+		__m128 lo, hi;
+#else
+		fp32 v[8];
+#endif
+	};
+
+	struct float3x8
+	{
+		fp32x8 x, y, z;
+	};
+
+	struct float4x8
+	{
+		fp32x8 x, y, z, w;
+	};
+
+	//SoA views over caller owned memory. Every pointer must address at least num elements.
+	struct float3SoA
+	{
+		fp32* x;
+		fp32* y;
+		fp32* z;
+	};
+
+	struct float4SoA
+	{
+		fp32* x;
+		fp32* y;
+		fp32* z;
+		fp32* w;
+	};
+
+	/* API */
+
+	fp32x8 splat8(const fp32);
+	fp32x8 load8(const fp32*);
+	void store8(fp32*, const fp32x8);
+
+	fp32x8 sqrt(const fp32x8);
+	fp32x8 min(const fp32x8, const fp32x8);
+	fp32x8 max(const fp32x8, const fp32x8);
+	//a * b + c, fused when the backend supports it
+	fp32x8 madd(const fp32x8, const fp32x8, const fp32x8);
+	fp32x8 abs(const fp32x8);
+
+	//Comparisons return a lane mask, all bits set where true. moveMask packs the sign bit of every lane, lane i -> bit i
+	fp32x8 cmpGt(const fp32x8, const fp32x8);
+	fp32x8 cmpGe(const fp32x8, const fp32x8);
+	fp32x8 operator&(const fp32x8, const fp32x8);
+	fp32x8 operator|(const fp32x8, const fp32x8);
+	uint32 moveMask(const fp32x8);
+
+	fp32x8 dot(const float3x8, const float3x8);
+	fp32x8 dot(const float4x8, const float4x8);
+	fp32x8 lengthSq(const float3x8);
+	fp32x8 lengthSq(const float4x8);
+	fp32x8 length(const float3x8);
+	fp32x8 length(const float4x8);
+	float3x8 normalize(const float3x8);
+	float4x8 normalize(const float4x8);
+	float3x8 cross(const float3x8, const float3x8);
+
+	float3x8 load8(const float3SoA, const size_t offset);
+	float4x8 load8(const float4SoA, const size_t offset);
+	void store8(const float3SoA, const size_t offset, const float3x8);
+	void store8(const float4SoA, const size_t offset, const float4x8);
+
+	//Batch kernels over num elements
+	void dot(const float3SoA a, const float3SoA b, fp32* out, const size_t num);
+	void dot(const float4SoA a, const float4SoA b, fp32* out, const size_t num);
+	void lengthSq(const float3SoA a, fp32* out, const size_t num);
+	void lengthSq(const float4SoA a, fp32* out, const size_t num);
+	void length(const float3SoA a, fp32* out, const size_t num);
+	void normalize(const float3SoA a, const float3SoA out, const size_t num);
+	void normalize(const float4SoA a, const float4SoA out, const size_t num);
+	void cross(const float3SoA a, const float3SoA b, const float3SoA out, const size_t num);
+
+	//AoS <-> SoA transposition
+	void transpose(const float3* src, const float3SoA dst, const size_t num);
+	void transpose(const float4* src, const float4SoA dst, const size_t num);
+	void transpose(const float3SoA src, float3* dst, const size_t num);
+	void transpose(const float4SoA src, float4* dst, const size_t num);
+
+
+
+	/* IMPLEMENTATIONS */
+
+#if RE_SIMD_AVX
+	RE_INLINE fp32x8 splat8(const fp32 s) { return { _mm256_set1_ps(s) }; }
+	RE_INLINE fp32x8 load8(const fp32* p) { return { _mm256_loadu_ps(p) }; }
+	RE_INLINE void store8(fp32* p, const fp32x8 a) { _mm256_storeu_ps(p, a.v); }
+
+	RE_INLINE fp32x8 operator+(const fp32x8 a, const fp32x8 b) { return { _mm256_add_ps(a.v, b.v) }; }
+	RE_INLINE fp32x8 operator-(const fp32x8 a, const fp32x8 b) { return { _mm256_sub_ps(a.v, b.v) }; }
+	RE_INLINE fp32x8 operator*(const fp32x8 a, const fp32x8 b) { return { _mm256_mul_ps(a.v, b.v) }; }
+	RE_INLINE fp32x8 operator/(const fp32x8 a, const fp32x8 b) { return { _mm256_div_ps(a.v, b.v) }; }
+	RE_INLINE fp32x8 operator-(const fp32x8 a) { return { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.f)) }; }
+
+	RE_INLINE fp32x8 sqrt(const fp32x8 a) { return { _mm256_sqrt_ps(a.v) }; }
+	RE_INLINE fp32x8 min(const fp32x8 a, const fp32x8 b) { return { _mm256_min_ps(a.v, b.v) }; }
+	RE_INLINE fp32x8 max(const fp32x8 a, const fp32x8 b) { return { _mm256_max_ps(a.v, b.v) }; }
+#if RE_SIMD_FMA
+	RE_INLINE fp32x8 madd(const fp32x8 a, const fp32x8 b, const fp32x8 c) { return { _mm256_fmadd_ps(a.v, b.v, c.v) }; }
+#else
+	RE_INLINE fp32x8 madd(const fp32x8 a, const fp32x8 b, const fp32x8 c) { return { _mm256_add_ps(_mm256_mul_ps(a.v, b.v), c.v) }; }
+#endif
+	RE_INLINE fp32x8 abs(const fp32x8 a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v) }; }
+
+	RE_INLINE fp32x8 cmpGt(const fp32x8 a, const fp32x8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+	RE_INLINE fp32x8 cmpGe(const fp32x8 a, const fp32x8 b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+	RE_INLINE fp32x8 operator&(const fp32x8 a, const fp32x8 b) { return { _mm256_and_ps(a.v, b.v) }; }
+	RE_INLINE fp32x8 operator|(const fp32x8 a, const fp32x8 b) { return { _mm256_or_ps(a.v, b.v) }; }
+	RE_INLINE uint32 moveMask(const fp32x8 a) { return static_cast<uint32>(_mm256_movemask_ps(a.v)); }
+
+#elif RE_SIMD_SSE
+	RE_INLINE fp32x8 splat8(const fp32 s) { __m128 r{ _mm_set1_ps(s) }; return { r, r }; }
+	RE_INLINE fp32x8 load8(const fp32* p) { return { _mm_loadu_ps(p), _mm_loadu_ps(p + 4) }; }
+	RE_INLINE void store8(fp32* p, const fp32x8 a) { _mm_storeu_ps(p, a.lo); _mm_storeu_ps(p + 4, a.hi); }
+
+	RE_INLINE fp32x8 operator+(const fp32x8 a, const fp32x8 b) { return { _mm_add_ps(a.lo, b.lo), _mm_add_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 operator-(const fp32x8 a, const fp32x8 b) { return { _mm_sub_ps(a.lo, b.lo), _mm_sub_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 operator*(const fp32x8 a, const fp32x8 b) { return { _mm_mul_ps(a.lo, b.lo), _mm_mul_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 operator/(const fp32x8 a, const fp32x8 b) { return { _mm_div_ps(a.lo, b.lo), _mm_div_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 operator-(const fp32x8 a) { __m128 s{ _mm_set1_ps(-0.f) }; return { _mm_xor_ps(a.lo, s), _mm_xor_ps(a.hi, s) }; }
+
+	RE_INLINE fp32x8 sqrt(const fp32x8 a) { return { _mm_sqrt_ps(a.lo), _mm_sqrt_ps(a.hi) }; }
+	RE_INLINE fp32x8 min(const fp32x8 a, const fp32x8 b) { return { _mm_min_ps(a.lo, b.lo), _mm_min_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 max(const fp32x8 a, const fp32x8 b) { return { _mm_max_ps(a.lo, b.lo), _mm_max_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 madd(const fp32x8 a, const fp32x8 b, const fp32x8 c) { return a * b + c; }
+	RE_INLINE fp32x8 abs(const fp32x8 a) { __m128 s{ _mm_set1_ps(-0.f) }; return { _mm_andnot_ps(s, a.lo), _mm_andnot_ps(s, a.hi) }; }
+
+	RE_INLINE fp32x8 cmpGt(const fp32x8 a, const fp32x8 b) { return { _mm_cmpgt_ps(a.lo, b.lo), _mm_cmpgt_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 cmpGe(const fp32x8 a, const fp32x8 b) { return { _mm_cmpge_ps(a.lo, b.lo), _mm_cmpge_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 operator&(const fp32x8 a, const fp32x8 b) { return { _mm_and_ps(a.lo, b.lo), _mm_and_ps(a.hi, b.hi) }; }
+	RE_INLINE fp32x8 operator|(const fp32x8 a, const fp32x8 b) { return { _mm_or_ps(a.lo, b.lo), _mm_or_ps(a.hi, b.hi) }; }
+	RE_INLINE uint32 moveMask(const fp32x8 a) { return static_cast<uint32>(_mm_movemask_ps(a.lo) | (_mm_movemask_ps(a.hi) << 4)); }
+
+#else
+	RE_INLINE fp32x8 splat8(const fp32 s) { return { s, s, s, s, s, s, s, s }; }
+	RE_INLINE fp32x8 load8(const fp32* p) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = p[i]; return r; }
+	RE_INLINE void store8(fp32* p, const fp32x8 a) { for (int32 i{}; i < 8; ++i) p[i] = a.v[i]; }
+
+	RE_INLINE fp32x8 operator+(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = a.v[i] + b.v[i]; return r; }
+	RE_INLINE fp32x8 operator-(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = a.v[i] - b.v[i]; return r; }
+	RE_INLINE fp32x8 operator*(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = a.v[i] * b.v[i]; return r; }
+	RE_INLINE fp32x8 operator/(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = a.v[i] / b.v[i]; return r; }
+	RE_INLINE fp32x8 operator-(const fp32x8 a) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = -a.v[i]; return r; }
+
+	RE_INLINE fp32x8 sqrt(const fp32x8 a) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = std::sqrt(a.v[i]); return r; }
+	RE_INLINE fp32x8 min(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return r; }
+	RE_INLINE fp32x8 max(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return r; }
+	RE_INLINE fp32x8 madd(const fp32x8 a, const fp32x8 b, const fp32x8 c) { return a * b + c; }
+	RE_INLINE fp32x8 abs(const fp32x8 a) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = std::fabs(a.v[i]); return r; }
+
+	//Scalar masks keep the same bit patterns as the SIMD ones, so & and | work on the raw bits
+	namespace scalar
+	{
+		RE_INLINE fp32 laneMask(const bool b) { return std::bit_cast<fp32>(b ? 0xFFFFFFFFu : 0u); }
+		RE_INLINE uint32 laneBits(const fp32 f) { return std::bit_cast<uint32>(f); }
+	}
+
+	RE_INLINE fp32x8 cmpGt(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = scalar::laneMask(a.v[i] > b.v[i]); return r; }
+	RE_INLINE fp32x8 cmpGe(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = scalar::laneMask(a.v[i] >= b.v[i]); return r; }
+	RE_INLINE fp32x8 operator&(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = std::bit_cast<fp32>(scalar::laneBits(a.v[i]) & scalar::laneBits(b.v[i])); return r; }
+	RE_INLINE fp32x8 operator|(const fp32x8 a, const fp32x8 b) { fp32x8 r; for (int32 i{}; i < 8; ++i) r.v[i] = std::bit_cast<fp32>(scalar::laneBits(a.v[i]) | scalar::laneBits(b.v[i])); return r; }
+	RE_INLINE uint32 moveMask(const fp32x8 a) { uint32 m{}; for (int32 i{}; i < 8; ++i) m |= (scalar::laneBits(a.v[i]) >> 31) << i; return m; }
+#endif
+
+	RE_INLINE fp32x8 operator*(const fp32x8 a, const fp32 s) { return a * splat8(s); }
+	RE_INLINE fp32x8 operator*(const fp32 s, const fp32x8 a) { return a * splat8(s); }
+
+	RE_INLINE float3x8 operator+(const float3x8 a, const float3x8 b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+	RE_INLINE float3x8 operator-(const float3x8 a, const float3x8 b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+	RE_INLINE float3x8 operator*(const float3x8 a, const float3x8 b) { return { a.x * b.x, a.y * b.y, a.z * b.z }; }
+	RE_INLINE float3x8 operator*(const float3x8 a, const fp32x8 s) { return { a.x * s, a.y * s, a.z * s }; }
+	RE_INLINE float3x8 operator-(const float3x8 a) { return { -a.x, -a.y, -a.z }; }
+
+	RE_INLINE float4x8 operator+(const float4x8 a, const float4x8 b) { return { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w }; }
+	RE_INLINE float4x8 operator-(const float4x8 a, const float4x8 b) { return { a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w }; }
+	RE_INLINE float4x8 operator*(const float4x8 a, const float4x8 b) { return { a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w }; }
+	RE_INLINE float4x8 operator*(const float4x8 a, const fp32x8 s) { return { a.x * s, a.y * s, a.z * s, a.w * s }; }
+	RE_INLINE float4x8 operator-(const float4x8 a) { return { -a.x, -a.y, -a.z, -a.w }; }
+
+	RE_INLINE fp32x8 dot(const float3x8 a, const float3x8 b) { return madd(a.z, b.z, madd(a.y, b.y, a.x * b.x)); }
+	RE_INLINE fp32x8 dot(const float4x8 a, const float4x8 b) { return madd(a.w, b.w, madd(a.z, b.z, madd(a.y, b.y, a.x * b.x))); }
+	RE_INLINE fp32x8 lengthSq(const float3x8 a) { return dot(a, a); }
+	RE_INLINE fp32x8 lengthSq(const float4x8 a) { return dot(a, a); }
+	RE_INLINE fp32x8 length(const float3x8 a) { return sqrt(dot(a, a)); }
+	RE_INLINE fp32x8 length(const float4x8 a) { return sqrt(dot(a, a)); }
+
+	RE_INLINE float3x8 normalize(const float3x8 a)
+	{
+		fp32x8 l{ length(a) };
+		return { a.x / l, a.y / l, a.z / l };
+	}
+
+	RE_INLINE float4x8 normalize(const float4x8 a)
+	{
+		fp32x8 l{ length(a) };
+		return { a.x / l, a.y / l, a.z / l, a.w / l };
+	}
+
+	RE_INLINE float3x8 cross(const float3x8 a, const float3x8 b)
+	{
+		return { a.y * b.z - a.z * b.y,
+				 a.z * b.x - a.x * b.z,
+				 a.x * b.y - a.y * b.x };
+	}
+
+	RE_INLINE float3x8 load8(const float3SoA s, const size_t offset) { return { load8(s.x + offset), load8(s.y + offset), load8(s.z + offset) }; }
+	RE_INLINE float4x8 load8(const float4SoA s, const size_t offset) { return { load8(s.x + offset), load8(s.y + offset), load8(s.z + offset), load8(s.w + offset) }; }
+
+	RE_INLINE void store8(const float3SoA s, const size_t offset, const float3x8 a)
+	{
+		store8(s.x + offset, a.x); store8(s.y + offset, a.y); store8(s.z + offset, a.z);
+	}
+
+	RE_INLINE void store8(const float4SoA s, const size_t offset, const float4x8 a)
+	{
+		store8(s.x + offset, a.x); store8(s.y + offset, a.y); store8(s.z + offset, a.z); store8(s.w + offset, a.w);
+	}
+
+	namespace soa
+	{
+		RE_INLINE float3 get(const float3SoA s, const size_t i) { return { s.x[i], s.y[i], s.z[i] }; }
+		RE_INLINE float4 get(const float4SoA s, const size_t i) { return { s.x[i], s.y[i], s.z[i], s.w[i] }; }
+		RE_INLINE void set(const float3SoA s, const size_t i, const float3 v) { s.x[i] = v.x; s.y[i] = v.y; s.z[i] = v.z; }
+		RE_INLINE void set(const float4SoA s, const size_t i, const float4 v) { s.x[i] = v.x; s.y[i] = v.y; s.z[i] = v.z; s.w[i] = v.w; }
+	}
+
+	inline void dot(const float3SoA a, const float3SoA b, fp32* out, const size_t num)
+	{
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+			store8(out + i, dot(load8(a, i), load8(b, i)));
+		for (size_t j{}; j < (num & 7); ++j)
+			out[body + j] = scalar::dot(soa::get(a, body + j), soa::get(b, body + j));
+	}
+
+	inline void dot(const float4SoA a, const float4SoA b, fp32* out, const size_t num)
+	{
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+			store8(out + i, dot(load8(a, i), load8(b, i)));
+		for (size_t j{}; j < (num & 7); ++j)
+			out[body + j] = scalar::dot(soa::get(a, body + j), soa::get(b, body + j));
+	}
+
+	inline void lengthSq(const float3SoA a, fp32* out, const size_t num)
+	{
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+			store8(out + i, lengthSq(load8(a, i)));
+		for (size_t j{}; j < (num & 7); ++j)
+			out[body + j] = scalar::lengthSq(soa::get(a, body + j));
+	}
+
+	inline void lengthSq(const float4SoA a, fp32* out, const size_t num)
+	{
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+			store8(out + i, lengthSq(load8(a, i)));
+		for (size_t j{}; j < (num & 7); ++j)
+			out[body + j] = scalar::lengthSq(soa::get(a, body + j));
+	}
+
+	inline void length(const float3SoA a, fp32* out, const size_t num)
+	{
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+			store8(out + i, length(load8(a, i)));
+		for (size_t j{}; j < (num & 7); ++j)
+			out[body + j] = scalar::length(soa::get(a, body + j));
+	}
+
+	inline void normalize(const float3SoA a, const float3SoA out, const size_t num)
+	{
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+			store8(out, i, normalize(load8(a, i)));
+		for (size_t j{}; j < (num & 7); ++j)
+			soa::set(out, body + j, scalar::normalize(soa::get(a, body + j)));
+	}
+
+	inline void normalize(const float4SoA a, const float4SoA out, const size_t num)
+	{
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+			store8(out, i, normalize(load8(a, i)));
+		for (size_t j{}; j < (num & 7); ++j)
+			soa::set(out, body + j, scalar::normalize(soa::get(a, body + j)));
+	}
+
+	inline void cross(const float3SoA a, const float3SoA b, const float3SoA out, const size_t num)
+	{
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+			store8(out, i, cross(load8(a, i), load8(b, i)));
+		for (size_t j{}; j < (num & 7); ++j)
+			soa::set(out, body + j, scalar::cross(soa::get(a, body + j), soa::get(b, body + j)));
+	}
+
+	//Transposes work on blocks of 4 vectors: 3 (float3) or 4 (float4) xmm loads, shuffles, one store per component.
+	//The tails count down what is left so the optimizer sees their bound, as the 8 wide ones above do with num & 7.
+	inline void transpose(const float3* src, const float3SoA dst, const size_t num)
+	{
+		size_t i{};
+#if RE_SIMD_SSE
+		const fp32* in{ &src->x };
+		for (; i + 4 <= num; i += 4, in += 12)
+		{
+			__m128 a{ _mm_loadu_ps(in) };		//x0 y0 z0 x1
+			__m128 b{ _mm_loadu_ps(in + 4) };	//y1 z1 x2 y2
+			__m128 c{ _mm_loadu_ps(in + 8) };	//z2 x3 y3 z3
+
+			__m128 x{ _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0)) };
+			__m128 y{ _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)) };
+			__m128 z{ _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)) };
+
+			_mm_storeu_ps(dst.x + i, x);
+			_mm_storeu_ps(dst.y + i, y);
+			_mm_storeu_ps(dst.z + i, z);
+		}
+#endif
+		for (size_t left{ num - i }; left > 0; --left, ++i)
+			soa::set(dst, i, src[i]);
+	}
+
+	inline void transpose(const float4* src, const float4SoA dst, const size_t num)
+	{
+		size_t i{};
+#if RE_SIMD_SSE
+		for (; i + 4 <= num; i += 4)
+		{
+			__m128 x{ simd::load(src[i]) };
+			__m128 y{ simd::load(src[i + 1]) };
+			__m128 z{ simd::load(src[i + 2]) };
+			__m128 w{ simd::load(src[i + 3]) };
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			_mm_storeu_ps(dst.x + i, x);
+			_mm_storeu_ps(dst.y + i, y);
+			_mm_storeu_ps(dst.z + i, z);
+			_mm_storeu_ps(dst.w + i, w);
+		}
+#endif
+		for (size_t left{ num - i }; left > 0; --left, ++i)
+			soa::set(dst, i, src[i]);
+	}
+
+	inline void transpose(const float3SoA src, float3* dst, const size_t num)
+	{
+		size_t i{};
+#if RE_SIMD_SSE
+		fp32* out{ &dst->x };
+		for (; i + 4 <= num; i += 4, out += 12)
+		{
+			__m128 x{ _mm_loadu_ps(src.x + i) };
+			__m128 y{ _mm_loadu_ps(src.y + i) };
+			__m128 z{ _mm_loadu_ps(src.z + i) };
+
+			__m128 a{ _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)) };
+			__m128 b{ _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)) };
+			__m128 c{ _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)) };
+
+			_mm_storeu_ps(out, a);
+			_mm_storeu_ps(out + 4, b);
+			_mm_storeu_ps(out + 8, c);
+		}
+#endif
+		for (size_t left{ num - i }; left > 0; --left, ++i)
+			dst[i] = soa::get(src, i);
+	}
+
+	inline void transpose(const float4SoA src, float4* dst, const size_t num)
+	{
+		size_t i{};
+#if RE_SIMD_SSE
+		for (; i + 4 <= num; i += 4)
+		{
+			__m128 x{ _mm_loadu_ps(src.x + i) };
+			__m128 y{ _mm_loadu_ps(src.y + i) };
+			__m128 z{ _mm_loadu_ps(src.z + i) };
+			__m128 w{ _mm_loadu_ps(src.w + i) };
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			_mm_storeu_ps(&dst[i].x, x);
+			_mm_storeu_ps(&dst[i + 1].x, y);
+			_mm_storeu_ps(&dst[i + 2].x, z);
+			_mm_storeu_ps(&dst[i + 3].x, w);
+		}
+#endif
+		for (size_t left{ num - i }; left > 0; --left, ++i)
+			dst[i] = soa::get(src, i);
+	}
+
+}
+
+#endif // !RE_FLOATNX8_H
@@ -0,0 +1,187 @@
+//  Filename: half 
+//	Author:	Daniel														
+//	Date: 18/10/2026 16:40:05		
+//  Sqwack-Studios													
+
+#ifndef RE_HALF_H
+#define RE_HALF_H
+
+#include "RadiantEngine/math/floatN.h"
+#include <cstddef>
+#include <bit>
+
+//IEEE 754 binary16 storage type. There is no arithmetic on it, values are converted to fp32 to operate and back to store.
+//Conversion rounds to nearest even, keeps denormals and saturates to infinity on overflow. NaNs stay NaN but the payload
+//is not preserved. All backends (F16C, SSE4.2, scalar) produce the same bits for non NaN inputs.
+namespace RE
+{
+
+	struct half
+	{
+		uint16 bits;
+	};
+
+	struct half2
+	{
+		half x, y;
+	};
+
+	/* API */
+
+	half toHalf(const fp32);
+	fp32 toFloat(const half);
+	half2 toHalf2(const float2);
+	float2 toFloat2(const half2);
+
+	//Batch conversion of num values. F16C converts 8 at a time, SSE 4 at a time.
+	void toHalf(half* out, const fp32* in, const size_t num);
+	void toFloat(fp32* out, const half* in, const size_t num);
+
+
+
+	/* IMPLEMENTATIONS */
+
+	//Bit tricks from Fabian Giesen's float <-> half conversions
+	RE_INLINE half toHalf(const fp32 f)
+	{
+		constexpr uint32 F32_INFINITY{ 255u << 23 };
+		constexpr uint32 F16_MAX{ (127u + 16u) << 23 };			//first fp32 that overflows to half infinity
+		constexpr uint32 DENORMAL_MAGIC{ ((127u - 15u) + (23u - 10u) + 1u) << 23 };
+		constexpr uint32 F16_MIN_NORMAL{ 113u << 23 };
+
+		uint32 u{ std::bit_cast<uint32>(f) };
+		const uint32 sign{ u & 0x80000000u };
+		u ^= sign;
+
+		uint32 h;
+		if (u >= F16_MAX)
+		{
+			h = u > F32_INFINITY ? 0x7E00u : 0x7C00u;
+		}
+		else if (u < F16_MIN_NORMAL)
+		{
+			//adding the magic lets the fpu do the denormal shift with correct rounding
+			h = std::bit_cast<uint32>(std::bit_cast<fp32>(u) + std::bit_cast<fp32>(DENORMAL_MAGIC)) - DENORMAL_MAGIC;
+		}
+		else
+		{
+			const uint32 mantissaOdd{ (u >> 13) & 1u };
+			u += (static_cast<uint32>(15 - 127) << 23) + 0xFFFu + mantissaOdd;
+			h = u >> 13;
+		}
+
+		return { static_cast<uint16>(h | (sign >> 16)) };
+	}
+
+	RE_INLINE fp32 toFloat(const half h)
+	{
+		constexpr uint32 SHIFTED_EXPONENT{ 0x7C00u << 13 };
+		constexpr uint32 MAGIC{ 113u << 23 };
+
+		uint32 u{ (h.bits & 0x7FFFu) << 13 };
+		const uint32 exponent{ u & SHIFTED_EXPONENT };
+		u += (127u - 15u) << 23;
+
+		if (exponent == SHIFTED_EXPONENT)
+		{
+			u += (128u - 16u) << 23;	//inf/nan
+		}
+		else if (exponent == 0)
+		{
+			u += 1u << 23;				//zero/denormal, renormalize
+			u = std::bit_cast<uint32>(std::bit_cast<fp32>(u) - std::bit_cast<fp32>(MAGIC));
+		}
+
+		return std::bit_cast<fp32>(u | (static_cast<uint32>(h.bits & 0x8000u) << 16));
+	}
+
+	RE_INLINE half2 toHalf2(const float2 v) { return { toHalf(v.x), toHalf(v.y) }; }
+	RE_INLINE float2 toFloat2(const half2 v) { return { toFloat(v.x), toFloat(v.y) }; }
+
+#if RE_SIMD_SSE
+	namespace simd
+	{
+		//Same algorithm as the scalar versions, 4 lanes at a time
+		RE_INLINE __m128i toHalf4(const __m128 f)
+		{
+			const __m128i F32_INFINITY{ _mm_set1_epi32(255 << 23) };
+			const __m128i F16_MAX{ _mm_set1_epi32((127 + 16) << 23) };
+			const __m128i DENORMAL_MAGIC{ _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23) };
+			const __m128i F16_MIN_NORMAL{ _mm_set1_epi32(113 << 23) };
+
+			const __m128i bits{ _mm_castps_si128(f) };
+			const __m128i sign{ _mm_and_si128(bits, _mm_set1_epi32(static_cast<int32>(0x80000000u))) };
+			const __m128i u{ _mm_xor_si128(bits, sign) };
+
+			//values are positive, signed compares are fine
+			const __m128i overflow{ _mm_cmpgt_epi32(u, _mm_sub_epi32(F16_MAX, _mm_set1_epi32(1))) };
+			const __m128i isNan{ _mm_cmpgt_epi32(u, F32_INFINITY) };
+			const __m128i infNan{ _mm_blendv_epi8(_mm_set1_epi32(0x7C00), _mm_set1_epi32(0x7E00), isNan) };
+
+			const __m128i denormal{ _mm_cmplt_epi32(u, F16_MIN_NORMAL) };
+			const __m128i denormalBits{ _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_castsi128_ps(DENORMAL_MAGIC))), DENORMAL_MAGIC) };
+
+			const __m128i mantissaOdd{ _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1)) };
+			__m128i normalBits{ _mm_add_epi32(u, _mm_set1_epi32(((15 - 127) << 23) + 0xFFF)) };
+			normalBits = _mm_srli_epi32(_mm_add_epi32(normalBits, mantissaOdd), 13);
+
+			__m128i h{ _mm_blendv_epi8(normalBits, denormalBits, denormal) };
+			h = _mm_blendv_epi8(h, infNan, overflow);
+			return _mm_or_si128(h, _mm_srli_epi32(sign, 16));
+		}
+
+		//h holds one half per 32 bit lane
+		RE_INLINE __m128 toFloat4(const __m128i h)
+		{
+			const __m128i SHIFTED_EXPONENT{ _mm_set1_epi32(0x7C00 << 13) };
+
+			__m128i u{ _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13) };
+			const __m128i exponent{ _mm_and_si128(u, SHIFTED_EXPONENT) };
+			u = _mm_add_epi32(u, _mm_set1_epi32((127 - 15) << 23));
+
+			const __m128i infNan{ _mm_cmpeq_epi32(exponent, SHIFTED_EXPONENT) };
+			u = _mm_add_epi32(u, _mm_and_si128(infNan, _mm_set1_epi32((128 - 16) << 23)));
+
+			const __m128i denormal{ _mm_cmpeq_epi32(exponent, _mm_setzero_si128()) };
+			const __m128 renormalized{ _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(u, _mm_set1_epi32(1 << 23))), _mm_castsi128_ps(_mm_set1_epi32(113 << 23))) };
+			const __m128 f{ _mm_blendv_ps(_mm_castsi128_ps(u), renormalized, _mm_castsi128_ps(denormal)) };
+
+			return _mm_or_ps(f, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16)));
+		}
+	}
+#endif
+
+	inline void toHalf(half* out, const fp32* in, const size_t num)
+	{
+		size_t i{};
+#if RE_SIMD_F16C
+		for (; i + 8 <= num; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+#elif RE_SIMD_SSE
+		for (; i + 4 <= num; i += 4)
+		{
+			const __m128i h{ simd::toHalf4(_mm_loadu_ps(in + i)) };
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi32(h, h));
+		}
+#endif
+		for (; i < num; ++i)
+			out[i] = toHalf(in[i]);
+	}
+
+	inline void toFloat(fp32* out, const half* in, const size_t num)
+	{
+		size_t i{};
+#if RE_SIMD_F16C
+		for (; i + 8 <= num; i += 8)
+			_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+#elif RE_SIMD_SSE
+		for (; i + 4 <= num; i += 4)
+			_mm_storeu_ps(out + i, simd::toFloat4(_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)))));
+#endif
+		for (; i < num; ++i)
+			out[i] = toFloat(in[i]);
+	}
+
+}
+
+#endif // !RE_HALF_H
@@ -0,0 +1,307 @@
+//  Filename: matrix 
+//	Author:	Daniel														
+//	Date: 18/10/2026 12:20:05		
+//  Sqwack-Studios													
+
+#ifndef RE_MATRIX_H
+#define RE_MATRIX_H
+
+#include "RadiantEngine/math/floatNx8.h"
+
+//Matrices are stored row by row and transform column vectors: v' = M * v, translation lives in the w column.
+//That is the same memory layout HLSL expects with row-major packing (-Zpr, which the ShaderCompiler passes by default)
+//and mul(M, v), so both types can be memcpy'd straight into a constant buffer. Shaders compiled with -Zpc need transpose().
+//float3x4 is an affine transform with an implicit { 0, 0, 0, 1 } last row, 48 bytes, same as HLSL row_major float3x4.
+//Projection follows D3D conventions: left handed, clip depth in [0, 1].
+namespace RE
+{
+
+	struct alignas(16) float4x4
+	{
+		float4 r[4];
+	};
+
+	struct alignas(16) float3x4
+	{
+		float4 r[3];
+	};
+
+	/* API */
+
+	float4x4 identity4x4();
+	float3x4 identity3x4();
+	float4x4 toFloat4x4(const float3x4&);
+	//drops the last row, only valid for affine matrices
+	float3x4 toFloat3x4(const float4x4&);
+
+	float4x4 mul(const float4x4&, const float4x4&);
+	float3x4 mul(const float3x4&, const float3x4&);
+	float4 mul(const float4x4&, const float4);
+
+	float3 transformPoint(const float3x4&, const float3);
+	float3 transformVector(const float3x4&, const float3);
+
+	float4x4 transpose(const float4x4&);
+	float4x4 transpose(const float3x4&);
+
+	//Handles rotation, scale and shear. Returns garbage if the 3x3 block is singular.
+	float3x4 inverseAffine(const float3x4&);
+	float4x4 inverseAffine(const float4x4&);
+	//Inverse-transpose of the 3x3 block with no translation, for normals under non-uniform scale
+	float3x4 normalMatrix(const float3x4&);
+
+	float3x4 translation(const float3);
+	float3x4 scaling(const float3);
+	float3x4 lookAtLH(const float3 eye, const float3 target, const float3 up);
+	//fovY in radians
+	float4x4 perspectiveFovLH(const fp32 fovY, const fp32 aspectRatio, const fp32 zNear, const fp32 zFar);
+
+	//Batch kernels. in and out may alias. Normals are renormalized; pass normalMatrix(world) when the scale is non-uniform.
+	void transformPoints(const float3x4& m, const float3* in, float3* out, const size_t num);
+	void transformNormals(const float3x4& m, const float3* in, float3* out, const size_t num);
+	void transformPoints(const float3x4& m, const float3SoA in, const float3SoA out, const size_t num);
+	void transformNormals(const float3x4& m, const float3SoA in, const float3SoA out, const size_t num);
+
+
+
+	/* IMPLEMENTATIONS */
+
+	RE_INLINE float4x4 identity4x4()
+	{
+		return { { { 1.f, 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f, 0.f }, { 0.f, 0.f, 1.f, 0.f }, { 0.f, 0.f, 0.f, 1.f } } };
+	}
+
+	RE_INLINE float3x4 identity3x4()
+	{
+		return { { { 1.f, 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f, 0.f }, { 0.f, 0.f, 1.f, 0.f } } };
+	}
+
+	RE_INLINE float4x4 toFloat4x4(const float3x4& m) { return { { m.r[0], m.r[1], m.r[2], { 0.f, 0.f, 0.f, 1.f } } }; }
+	RE_INLINE float3x4 toFloat3x4(const float4x4& m) { return { { m.r[0], m.r[1], m.r[2] } }; }
+
+#if RE_SIMD_SSE
+	namespace simd
+	{
+		//row * B, where row holds the coefficients of a row of A
+		RE_INLINE __m128 linearCombine(const __m128 row, const __m128 b0, const __m128 b1, const __m128 b2, const __m128 b3)
+		{
+			__m128 r{ _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b0) };
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+			return _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+		}
+	}
+
+	RE_INLINE float4x4 mul(const float4x4& a, const float4x4& b)
+	{
+		__m128 b0{ simd::load(b.r[0]) }, b1{ simd::load(b.r[1]) }, b2{ simd::load(b.r[2]) }, b3{ simd::load(b.r[3]) };
+		float4x4 c;
+		for (int32 i{}; i < 4; ++i)
+			c.r[i] = simd::store4(simd::linearCombine(simd::load(a.r[i]), b0, b1, b2, b3));
+		return c;
+	}
+
+	RE_INLINE float3x4 mul(const float3x4& a, const float3x4& b)
+	{
+		__m128 b0{ simd::load(b.r[0]) }, b1{ simd::load(b.r[1]) }, b2{ simd::load(b.r[2]) }, b3{ _mm_setr_ps(0.f, 0.f, 0.f, 1.f) };
+		float3x4 c;
+		for (int32 i{}; i < 3; ++i)
+			c.r[i] = simd::store4(simd::linearCombine(simd::load(a.r[i]), b0, b1, b2, b3));
+		return c;
+	}
+
+	RE_INLINE float4x4 transpose(const float4x4& m)
+	{
+		__m128 r0{ simd::load(m.r[0]) }, r1{ simd::load(m.r[1]) }, r2{ simd::load(m.r[2]) }, r3{ simd::load(m.r[3]) };
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		return { { simd::store4(r0), simd::store4(r1), simd::store4(r2), simd::store4(r3) } };
+	}
+#else
+	RE_INLINE float4x4 mul(const float4x4& a, const float4x4& b)
+	{
+		float4x4 c;
+		for (int32 i{}; i < 4; ++i)
+			c.r[i] = a.r[i].x * b.r[0] + a.r[i].y * b.r[1] + a.r[i].z * b.r[2] + a.r[i].w * b.r[3];
+		return c;
+	}
+
+	RE_INLINE float3x4 mul(const float3x4& a, const float3x4& b)
+	{
+		float3x4 c;
+		for (int32 i{}; i < 3; ++i)
+		{
+			c.r[i] = a.r[i].x * b.r[0] + a.r[i].y * b.r[1] + a.r[i].z * b.r[2];
+			c.r[i].w += a.r[i].w;
+		}
+		return c;
+	}
+
+	RE_INLINE float4x4 transpose(const float4x4& m)
+	{
+		return { { { m.r[0].x, m.r[1].x, m.r[2].x, m.r[3].x },
+				   { m.r[0].y, m.r[1].y, m.r[2].y, m.r[3].y },
+				   { m.r[0].z, m.r[1].z, m.r[2].z, m.r[3].z },
+				   { m.r[0].w, m.r[1].w, m.r[2].w, m.r[3].w } } };
+	}
+#endif
+
+	RE_INLINE float4 mul(const float4x4& m, const float4 v) { return { dot(m.r[0], v), dot(m.r[1], v), dot(m.r[2], v), dot(m.r[3], v) }; }
+	RE_INLINE float4x4 transpose(const float3x4& m) { return transpose(toFloat4x4(m)); }
+
+	RE_INLINE float3 transformPoint(const float3x4& m, const float3 p)
+	{
+		const float4 p4{ p.x, p.y, p.z, 1.f };
+		return { dot(m.r[0], p4), dot(m.r[1], p4), dot(m.r[2], p4) };
+	}
+
+	RE_INLINE float3 transformVector(const float3x4& m, const float3 v)
+	{
+		const float4 v4{ v.x, v.y, v.z, 0.f };
+		return { dot(m.r[0], v4), dot(m.r[1], v4), dot(m.r[2], v4) };
+	}
+
+	RE_INLINE float3x4 inverseAffine(const float3x4& m)
+	{
+		const float3 r0{ m.r[0].x, m.r[0].y, m.r[0].z };
+		const float3 r1{ m.r[1].x, m.r[1].y, m.r[1].z };
+		const float3 r2{ m.r[2].x, m.r[2].y, m.r[2].z };
+		const float3 t{ m.r[0].w, m.r[1].w, m.r[2].w };
+
+		//The columns of the inverse 3x3 are the cross products of the rows, scaled by 1/det
+		const float3 c0{ cross(r1, r2) };
+		const float3 c1{ cross(r2, r0) };
+		const float3 c2{ cross(r0, r1) };
+		const fp32 invDet{ 1.f / dot(r0, c0) };
+
+		const float3 i0{ float3{ c0.x, c1.x, c2.x } * invDet };
+		const float3 i1{ float3{ c0.y, c1.y, c2.y } * invDet };
+		const float3 i2{ float3{ c0.z, c1.z, c2.z } * invDet };
+
+		return { { { i0.x, i0.y, i0.z, -dot(i0, t) },
+				   { i1.x, i1.y, i1.z, -dot(i1, t) },
+				   { i2.x, i2.y, i2.z, -dot(i2, t) } } };
+	}
+
+	RE_INLINE float4x4 inverseAffine(const float4x4& m) { return toFloat4x4(inverseAffine(toFloat3x4(m))); }
+
+	RE_INLINE float3x4 normalMatrix(const float3x4& m)
+	{
+		const float3x4 inv{ inverseAffine(m) };
+		return { { { inv.r[0].x, inv.r[1].x, inv.r[2].x, 0.f },
+				   { inv.r[0].y, inv.r[1].y, inv.r[2].y, 0.f },
+				   { inv.r[0].z, inv.r[1].z, inv.r[2].z, 0.f } } };
+	}
+
+	RE_INLINE float3x4 translation(const float3 t)
+	{
+		return { { { 1.f, 0.f, 0.f, t.x }, { 0.f, 1.f, 0.f, t.y }, { 0.f, 0.f, 1.f, t.z } } };
+	}
+
+	RE_INLINE float3x4 scaling(const float3 s)
+	{
+		return { { { s.x, 0.f, 0.f, 0.f }, { 0.f, s.y, 0.f, 0.f }, { 0.f, 0.f, s.z, 0.f } } };
+	}
+
+	RE_INLINE float3x4 lookAtLH(const float3 eye, const float3 target, const float3 up)
+	{
+		const float3 zAxis{ normalize(target - eye) };
+		const float3 xAxis{ normalize(cross(up, zAxis)) };
+		const float3 yAxis{ cross(zAxis, xAxis) };
+
+		return { { { xAxis.x, xAxis.y, xAxis.z, -dot(xAxis, eye) },
+				   { yAxis.x, yAxis.y, yAxis.z, -dot(yAxis, eye) },
+				   { zAxis.x, zAxis.y, zAxis.z, -dot(zAxis, eye) } } };
+	}
+
+	RE_INLINE float4x4 perspectiveFovLH(const fp32 fovY, const fp32 aspectRatio, const fp32 zNear, const fp32 zFar)
+	{
+		const fp32 yScale{ 1.f / std::tan(fovY * 0.5f) };
+		const fp32 xScale{ yScale / aspectRatio };
+		const fp32 zRange{ zFar / (zFar - zNear) };
+
+		return { { { xScale, 0.f, 0.f, 0.f },
+				   { 0.f, yScale, 0.f, 0.f },
+				   { 0.f, 0.f, zRange, -zNear * zRange },
+				   { 0.f, 0.f, 1.f, 0.f } } };
+	}
+
+	//AoS kernels keep the matrix columns in registers and do p.x * c0 + p.y * c1 + p.z * c2 (+ c3), one point per iteration.
+	//SoA kernels splat each matrix element into a fp32x8 and process 8 points per iteration.
+	inline void transformPoints(const float3x4& m, const float3* in, float3* out, const size_t num)
+	{
+#if RE_SIMD_SSE
+		__m128 c0{ simd::load(m.r[0]) }, c1{ simd::load(m.r[1]) }, c2{ simd::load(m.r[2]) }, c3{ _mm_setzero_ps() };
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		for (size_t i{}; i < num; ++i)
+		{
+			__m128 p{ simd::load(in[i]) };
+			__m128 r{ _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)), c0), c3) };
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)), c1));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)), c2));
+			out[i] = simd::store3(r);
+		}
+#else
+		for (size_t i{}; i < num; ++i)
+			out[i] = transformPoint(m, in[i]);
+#endif
+	}
+
+	inline void transformNormals(const float3x4& m, const float3* in, float3* out, const size_t num)
+	{
+#if RE_SIMD_SSE
+		__m128 c0{ simd::load(m.r[0]) }, c1{ simd::load(m.r[1]) }, c2{ simd::load(m.r[2]) }, c3{ _mm_setzero_ps() };
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+		for (size_t i{}; i < num; ++i)
+		{
+			__m128 n{ simd::load(in[i]) };
+			__m128 r{ _mm_mul_ps(_mm_shuffle_ps(n, n, _MM_SHUFFLE(0, 0, 0, 0)), c0) };
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(n, n, _MM_SHUFFLE(1, 1, 1, 1)), c1));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(n, n, _MM_SHUFFLE(2, 2, 2, 2)), c2));
+			r = _mm_div_ps(r, _mm_sqrt_ps(simd::Broadcast0(simd::Dot3(r, r))));
+			out[i] = simd::store3(r);
+		}
+#else
+		for (size_t i{}; i < num; ++i)
+			out[i] = normalize(transformVector(m, in[i]));
+#endif
+	}
+
+	inline void transformPoints(const float3x4& m, const float3SoA in, const float3SoA out, const size_t num)
+	{
+		const fp32x8 m00{ splat8(m.r[0].x) }, m01{ splat8(m.r[0].y) }, m02{ splat8(m.r[0].z) }, m03{ splat8(m.r[0].w) };
+		const fp32x8 m10{ splat8(m.r[1].x) }, m11{ splat8(m.r[1].y) }, m12{ splat8(m.r[1].z) }, m13{ splat8(m.r[1].w) };
+		const fp32x8 m20{ splat8(m.r[2].x) }, m21{ splat8(m.r[2].y) }, m22{ splat8(m.r[2].z) }, m23{ splat8(m.r[2].w) };
+
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+		{
+			const float3x8 p{ load8(in, i) };
+			store8(out, i, float3x8{ madd(m02, p.z, madd(m01, p.y, madd(m00, p.x, m03))),
+									 madd(m12, p.z, madd(m11, p.y, madd(m10, p.x, m13))),
+									 madd(m22, p.z, madd(m21, p.y, madd(m20, p.x, m23))) });
+		}
+		for (size_t j{}; j < (num & 7); ++j)
+			soa::set(out, body + j, transformPoint(m, soa::get(in, body + j)));
+	}
+
+	inline void transformNormals(const float3x4& m, const float3SoA in, const float3SoA out, const size_t num)
+	{
+		const fp32x8 m00{ splat8(m.r[0].x) }, m01{ splat8(m.r[0].y) }, m02{ splat8(m.r[0].z) };
+		const fp32x8 m10{ splat8(m.r[1].x) }, m11{ splat8(m.r[1].y) }, m12{ splat8(m.r[1].z) };
+		const fp32x8 m20{ splat8(m.r[2].x) }, m21{ splat8(m.r[2].y) }, m22{ splat8(m.r[2].z) };
+
+		const size_t body{ num & ~size_t{ 7 } };
+		for (size_t i{}; i < body; i += 8)
+		{
+			const float3x8 n{ load8(in, i) };
+			store8(out, i, normalize(float3x8{ madd(m02, n.z, madd(m01, n.y, m00 * n.x)),
+											   madd(m12, n.z, madd(m11, n.y, m10 * n.x)),
+											   madd(m22, n.z, madd(m21, n.y, m20 * n.x)) }));
+		}
+		for (size_t j{}; j < (num & 7); ++j)
+			soa::set(out, body + j, normalize(transformVector(m, soa::get(in, body + j))));
+	}
+
+}
+
+#endif // !RE_MATRIX_H
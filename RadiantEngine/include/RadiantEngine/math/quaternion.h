@@ -0,0 +1,142 @@
+//  Filename: quaternion 
+//	Author:	Daniel														
+//	Date: 18/10/2026 13:34:10		
+//  Sqwack-Studios													
+
+#ifndef RE_QUATERNION_H
+#define RE_QUATERNION_H
+
+#include "RadiantEngine/math/matrix.h"
+
+//Unit quaternions for rotations, xyz is the vector part and w the scalar one. Same handedness as matrix.h (left handed),
+//mul(a, b) applies b first and then a, matching mul() on matrices.
+namespace RE
+{
+
+	struct quat
+	{
+		fp32 x, y, z, w;
+	};
+
+	/* API */
+
+	quat identityQuat();
+	//axis must be normalized, angle in radians
+	quat fromAxisAngle(const float3 axis, const fp32 angle);
+	//radians, applied roll (z) -> pitch (x) -> yaw (y)
+	quat fromEuler(const fp32 pitch, const fp32 yaw, const fp32 roll);
+
+	quat mul(const quat, const quat);
+	quat conjugate(const quat);
+	quat inverse(const quat);
+	fp32 dot(const quat, const quat);
+	quat normalize(const quat);
+
+	float3 rotate(const quat, const float3);
+	//normalized lerp along the shortest arc, cheap and good enough for small steps
+	quat nlerp(const quat, const quat, const fp32 t);
+	quat slerp(const quat, const quat, const fp32 t);
+
+	float3x4 toMatrix(const quat);
+	//T * R * S
+	float3x4 composeTRS(const float3 translation, const quat rotation, const float3 scale);
+
+
+
+	/* IMPLEMENTATIONS */
+
+	RE_INLINE quat identityQuat() { return { 0.f, 0.f, 0.f, 1.f }; }
+
+	RE_INLINE quat fromAxisAngle(const float3 axis, const fp32 angle)
+	{
+		const fp32 s{ std::sin(angle * 0.5f) };
+		return { axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f) };
+	}
+
+	RE_INLINE quat fromEuler(const fp32 pitch, const fp32 yaw, const fp32 roll)
+	{
+		const fp32 sp{ std::sin(pitch * 0.5f) }, cp{ std::cos(pitch * 0.5f) };
+		const fp32 sy{ std::sin(yaw * 0.5f) }, cy{ std::cos(yaw * 0.5f) };
+		const fp32 sr{ std::sin(roll * 0.5f) }, cr{ std::cos(roll * 0.5f) };
+
+		return { cr * sp * cy + sr * cp * sy,
+				 cr * cp * sy - sr * sp * cy,
+				 sr * cp * cy - cr * sp * sy,
+				 cr * cp * cy + sr * sp * sy };
+	}
+
+	RE_INLINE quat mul(const quat a, const quat b)
+	{
+		return { a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+				 a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+				 a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+				 a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z };
+	}
+
+	RE_INLINE quat conjugate(const quat q) { return { -q.x, -q.y, -q.z, q.w }; }
+	RE_INLINE fp32 dot(const quat a, const quat b) { return dot(float4{ a.x, a.y, a.z, a.w }, float4{ b.x, b.y, b.z, b.w }); }
+
+	RE_INLINE quat inverse(const quat q)
+	{
+		const fp32 is{ 1.f / dot(q, q) };
+		return { -q.x * is, -q.y * is, -q.z * is, q.w * is };
+	}
+
+	RE_INLINE quat normalize(const quat q)
+	{
+		const float4 n{ normalize(float4{ q.x, q.y, q.z, q.w }) };
+		return { n.x, n.y, n.z, n.w };
+	}
+
+	RE_INLINE float3 rotate(const quat q, const float3 v)
+	{
+		//v + 2w(u x v) + 2u x (u x v)
+		const float3 u{ q.x, q.y, q.z };
+		const float3 t{ 2.f * cross(u, v) };
+		return v + q.w * t + cross(u, t);
+	}
+
+	RE_INLINE quat nlerp(const quat a, const quat b, const fp32 t)
+	{
+		const fp32 s{ dot(a, b) < 0.f ? -t : t };
+		const fp32 is{ 1.f - t };
+		return normalize(quat{ a.x * is + b.x * s, a.y * is + b.y * s, a.z * is + b.z * s, a.w * is + b.w * s });
+	}
+
+	RE_INLINE quat slerp(const quat a, const quat b, const fp32 t)
+	{
+		fp32 cosTheta{ dot(a, b) };
+		const fp32 sign{ cosTheta < 0.f ? -1.f : 1.f };
+		cosTheta *= sign;
+
+		//close enough to be collinear, sin(theta) goes to 0
+		if (cosTheta > 0.9995f)
+			return nlerp(a, b, t);
+
+		const fp32 theta{ std::acos(cosTheta) };
+		const fp32 invSin{ 1.f / std::sin(theta) };
+		const fp32 wa{ std::sin((1.f - t) * theta) * invSin };
+		const fp32 wb{ std::sin(t * theta) * invSin * sign };
+		return { a.x * wa + b.x * wb, a.y * wa + b.y * wb, a.z * wa + b.z * wb, a.w * wa + b.w * wb };
+	}
+
+	RE_INLINE float3x4 toMatrix(const quat q)
+	{
+		return composeTRS(float3{ 0.f, 0.f, 0.f }, q, float3{ 1.f, 1.f, 1.f });
+	}
+
+	RE_INLINE float3x4 composeTRS(const float3 t, const quat q, const float3 s)
+	{
+		const fp32 xx{ q.x * q.x }, yy{ q.y * q.y }, zz{ q.z * q.z };
+		const fp32 xy{ q.x * q.y }, xz{ q.x * q.z }, yz{ q.y * q.z };
+		const fp32 wx{ q.w * q.x }, wy{ q.w * q.y }, wz{ q.w * q.z };
+
+		//columns of the rotation are scaled, rows get the translation
+		return { { { (1.f - 2.f * (yy + zz)) * s.x, 2.f * (xy - wz) * s.y, 2.f * (xz + wy) * s.z, t.x },
+				   { 2.f * (xy + wz) * s.x, (1.f - 2.f * (xx + zz)) * s.y, 2.f * (yz - wx) * s.z, t.y },
+				   { 2.f * (xz - wy) * s.x, 2.f * (yz + wx) * s.y, (1.f - 2.f * (xx + yy)) * s.z, t.z } } };
+	}
+
+}
+
+#endif // !RE_QUATERNION_H
@@ -8,7 +8,7 @@
 #include "floatN.h"
 #include <cmath>
 
-//Scalar implementation of common euclidean operations
+//Common euclidean operations. SIMD backend is selected at compile time (see core/simd.h), scalar is the fallback
 namespace RE
 {
 	
@@ -38,36 +38,122 @@ namespace RE
 
 	/* IMPLEMENTATIONS */
 
-
-	RE_INLINE fp32 dot(const float2 a, const float2 b) { return a.x * b.x + a.y * b.y; }
-	RE_INLINE fp32 dot(const float3 a, const float3 b) { return (a.x * b.x + a.y * b.y) + (a.z * b.z); }
-	RE_INLINE fp32 dot(const float4 a, const float4 b) { return (a.x * b.x + a.y * b.y) + (a.z * b.z + a.w * b.w); }
-
-
-
-	RE_INLINE fp32 lengthSq(const float2 a) { return a.x * a.x + a.y * a.y; }
-	RE_INLINE fp32 lengthSq(const float3 a) { return (a.x * a.x + a.y * a.y) + a.z * a.z; }
-	RE_INLINE fp32 lenghtSq(const float4 a) { return (a.x * a.x + a.y * a.y) + (a.z * a.z + a.w * a.w); }
-
-	RE_INLINE fp32 length(const float2 a) { return std::sqrtf(lengthSq(a)); }
-	RE_INLINE fp32 length(const float3 a) { return std::sqrtf(lengthSq(a)); }
-	RE_INLINE fp32 length(const float4 a) { return std::sqrtf(lengthSq(a)); }
-
-
-	RE_INLINE float cross(const float2 a, const float2 b) { return a.x * b.y - a.y * b.x; }
-	RE_INLINE float3 cross(const float3 a, const float3 b) 
+	//Scalar reference. Always compiled so SIMD backends can be checked against it.
+	namespace scalar
 	{
-		fp32 x{ a.y * b.z - a.z * b.y };
-		fp32 y{ a.z * b.x - a.x * b.z };
-		fp32 z{ a.x * b.y - a.y * b.x };
-
-		return { x, y, z };
+		RE_INLINE fp32 dot(const float2 a, const float2 b) { return a.x * b.x + a.y * b.y; }
+		RE_INLINE fp32 dot(const float3 a, const float3 b) { return (a.x * b.x + a.y * b.y) + (a.z * b.z); }
+		RE_INLINE fp32 dot(const float4 a, const float4 b) { return (a.x * b.x + a.y * b.y) + (a.z * b.z + a.w * b.w); }
+
+		RE_INLINE fp32 lengthSq(const float2 a) { return a.x * a.x + a.y * a.y; }
+		RE_INLINE fp32 lengthSq(const float3 a) { return (a.x * a.x + a.y * a.y) + a.z * a.z; }
+		RE_INLINE fp32 lengthSq(const float4 a) { return (a.x * a.x + a.y * a.y) + (a.z * a.z + a.w * a.w); }
+
+		RE_INLINE fp32 length(const float2 a) { return std::sqrt(scalar::lengthSq(a)); }
+		RE_INLINE fp32 length(const float3 a) { return std::sqrt(scalar::lengthSq(a)); }
+		RE_INLINE fp32 length(const float4 a) { return std::sqrt(scalar::lengthSq(a)); }
+
+		RE_INLINE fp32 cross(const float2 a, const float2 b) { return a.x * b.y - a.y * b.x; }
+		RE_INLINE float3 cross(const float3 a, const float3 b)
+		{
+			fp32 x{ a.y * b.z - a.z * b.y };
+			fp32 y{ a.z * b.x - a.x * b.z };
+			fp32 z{ a.x * b.y - a.y * b.x };
+
+			return { x, y, z };
+		}
+
+		RE_INLINE float2 normalize(const float2 a) { return a / scalar::length(a); }
+		RE_INLINE float3 normalize(const float3 a) { return a / scalar::length(a); }
+		RE_INLINE float4 normalize(const float4 a) { return a / scalar::length(a); }
 	}
 
-	RE_INLINE float2 normalize(const float2 a) { return a / lengthSq(a); }
-	RE_INLINE float3 normalize(const float3 a) { return a / lengthSq(a); }
-	RE_INLINE float4 normalize(const float4 a) { return a / lengthSq(a); }
-
+#if RE_SIMD_SSE
+	//float2 stays scalar, two lanes don't pay for the load/shuffle overhead.
+	//Horizontal sums add the lanes in the scalar order, (x + y) + (z + w), so without FMA both paths give the same bits.
+	//dpps isn't used: it is a 3 uop, 11+ cycle latency instruction on most cores, slower than the multiply and two adds.
+	namespace simd
+	{
+		//Sum in lane 0
+		RE_INLINE __m128 HorizontalSum3(const __m128 v)
+		{
+			return _mm_add_ss(_mm_add_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))), _mm_movehl_ps(v, v));
+		}
+		RE_INLINE __m128 HorizontalSum4(const __m128 v)
+		{
+			const __m128 pairs{ _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1))) };
+			return _mm_add_ss(pairs, _mm_movehl_ps(pairs, pairs));
+		}
+		RE_INLINE __m128 Broadcast0(const __m128 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)); }
+
+#if RE_SIMD_FMA
+		//AVX2: the upper half folds into the lower one with a single FMA, x*x' + z*z' and y*y' + w*w'
+		RE_INLINE __m128 Dot4(const __m128 a, const __m128 b)
+		{
+			const __m128 pairs{ _mm_fmadd_ps(_mm_movehl_ps(a, a), _mm_movehl_ps(b, b), _mm_mul_ps(a, b)) };
+			return _mm_add_ss(pairs, _mm_permute_ps(pairs, _MM_SHUFFLE(1, 1, 1, 1)));
+		}
+		RE_INLINE __m128 Dot3(const __m128 a, const __m128 b)
+		{
+			const __m128 xy{ _mm_mul_ps(a, b) };
+			return _mm_fmadd_ss(_mm_movehl_ps(a, a), _mm_movehl_ps(b, b), _mm_add_ss(xy, _mm_permute_ps(xy, _MM_SHUFFLE(1, 1, 1, 1))));
+		}
+#else
+		RE_INLINE __m128 Dot4(const __m128 a, const __m128 b) { return HorizontalSum4(_mm_mul_ps(a, b)); }
+		RE_INLINE __m128 Dot3(const __m128 a, const __m128 b) { return HorizontalSum3(_mm_mul_ps(a, b)); }
+#endif
+
+		RE_INLINE fp32 dot(const float3 a, const float3 b) { return _mm_cvtss_f32(Dot3(load(a), load(b))); }
+		RE_INLINE fp32 dot(const float4 a, const float4 b) { return _mm_cvtss_f32(Dot4(load(a), load(b))); }
+
+		RE_INLINE fp32 lengthSq(const float3 a) { const __m128 r{ load(a) }; return _mm_cvtss_f32(Dot3(r, r)); }
+		RE_INLINE fp32 lengthSq(const float4 a) { const __m128 r{ load(a) }; return _mm_cvtss_f32(Dot4(r, r)); }
+
+		RE_INLINE fp32 length(const float3 a) { const __m128 r{ load(a) }; return _mm_cvtss_f32(_mm_sqrt_ss(Dot3(r, r))); }
+		RE_INLINE fp32 length(const float4 a) { const __m128 r{ load(a) }; return _mm_cvtss_f32(_mm_sqrt_ss(Dot4(r, r))); }
+
+		RE_INLINE float3 cross(const float3 a, const float3 b)
+		{
+			//a * b.yzx - a.yzx * b, then swizzle back to xyz
+			const __m128 ra{ load(a) };
+			const __m128 rb{ load(b) };
+			const __m128 ayzx{ _mm_shuffle_ps(ra, ra, _MM_SHUFFLE(3, 0, 2, 1)) };
+			const __m128 byzx{ _mm_shuffle_ps(rb, rb, _MM_SHUFFLE(3, 0, 2, 1)) };
+#if RE_SIMD_FMA
+			const __m128 c{ _mm_fmsub_ps(ra, byzx, _mm_mul_ps(ayzx, rb)) };
+#else
+			const __m128 c{ _mm_sub_ps(_mm_mul_ps(ra, byzx), _mm_mul_ps(ayzx, rb)) };
+#endif
+			return store3(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+		}
+
+		RE_INLINE float3 normalize(const float3 a) { const __m128 r{ load(a) }; return store3(_mm_div_ps(r, _mm_sqrt_ps(Broadcast0(Dot3(r, r))))); }
+		RE_INLINE float4 normalize(const float4 a) { const __m128 r{ load(a) }; return store4(_mm_div_ps(r, _mm_sqrt_ps(Broadcast0(Dot4(r, r))))); }
+	}
+	namespace backend = simd;
+#else
+	namespace backend = scalar;
+#endif
+
+	RE_INLINE fp32 dot(const float2 a, const float2 b) { return scalar::dot(a, b); }
+	//float3 dot/length stay scalar: the 12 byte load costs more than the lanes save, and loops over scalar code vectorize
+	RE_INLINE fp32 dot(const float3 a, const float3 b) { return scalar::dot(a, b); }
+	RE_INLINE fp32 dot(const float4 a, const float4 b) { return backend::dot(a, b); }
+
+	RE_INLINE fp32 lengthSq(const float2 a) { return scalar::lengthSq(a); }
+	RE_INLINE fp32 lengthSq(const float3 a) { return scalar::lengthSq(a); }
+	RE_INLINE fp32 lengthSq(const float4 a) { return backend::lengthSq(a); }
+
+	RE_INLINE fp32 length(const float2 a) { return scalar::length(a); }
+	RE_INLINE fp32 length(const float3 a) { return scalar::length(a); }
+	RE_INLINE fp32 length(const float4 a) { return backend::length(a); }
+
+	RE_INLINE float cross(const float2 a, const float2 b) { return scalar::cross(a, b); }
+	RE_INLINE float3 cross(const float3 a, const float3 b) { return backend::cross(a, b); }
+
+	RE_INLINE float2 normalize(const float2 a) { return scalar::normalize(a); }
+	RE_INLINE float3 normalize(const float3 a) { return backend::normalize(a); }
+	RE_INLINE float4 normalize(const float4 a) { return backend::normalize(a); }
 
 }
 
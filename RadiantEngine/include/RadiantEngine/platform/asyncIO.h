@@ -0,0 +1,120 @@
+//  Filename: asyncIO 
+//	Author:	Daniel														
+//	Date: 19/10/2026 04:07:41		
+//  Sqwack-Studios													
+
+#ifndef RE_ASYNC_IO_H
+#define RE_ASYNC_IO_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include "RadiantEngine/platform/file.h"
+#include <atomic>
+
+//Asynchronous file reads straight into caller buffers.
+//
+//	IORequest reads[2]{};
+//	reads[0].file = vs;
+//	reads[0].size = vsSize;
+//	reads[0].dst = vsBlob;
+//	...same for reads[1]...
+//	SubmitIO(reads, 2);
+//	...other work...
+//	WaitIO(reads[0]);
+//	WaitIO(reads[1]);
+//
+//Requests are caller owned and must stay at the same address until their status is final. SubmitIO queues a whole batch
+//under one lock, they are started highest priority first and in submission order within a priority. Only a bounded
+//number are handed to the OS at once (queueDepth, or one per worker), so a burst of low priority streaming can't bury a
+//high priority read for long.
+//
+//Backends:
+//	io_uring (Linux): one thread owns the ring. Submitting fills the submission queue and enters the kernel once per
+//	batch, the thread reaps completions and refills the ring from the queues.
+//	Worker pool (Windows, or Linux when io_uring is unavailable or config.forceWorkerPool is set): numWorkers threads
+//	doing blocking positional reads, so up to numWorkers reads overlap.
+//
+//Completion is either polled (IsIODone, WaitIO) or pushed: callback runs on an I/O thread right after the read, keep it
+//short (store the result, kick a job). The request is still the I/O system's during the callback, don't resubmit it there.
+//
+//Only reads that haven't started can be cancelled, a read in flight always completes. CancelIO doesn't call the
+//callback, ShutdownAsyncIO does for everything it drops.
+namespace RE
+{
+
+	enum eIOPriority : uint8
+	{
+		IOPriorityHigh = 0,		//needed this frame
+		IOPriorityNormal,
+		IOPriorityLow,			//streaming, prefetch
+		NUM_IO_PRIORITIES
+	};
+
+	enum eIOStatus : uint32
+	{
+		IOStatusIdle = 0,		//never submitted
+		IOStatusQueued,
+		IOStatusReading,
+		IOStatusDone,			//bytesRead < size means the file ended first
+		IOStatusFailed,
+		IOStatusCancelled
+	};
+
+	enum eAsyncIOBackend : uint8
+	{
+		AsyncIOBackendNone = 0,
+		AsyncIOBackendIoUring,
+		AsyncIOBackendWorkerPool
+	};
+
+	struct IORequest;
+	//status is the final one, request.status only turns final once the callback returns
+	using IOCallback = void(*)(IORequest& request, const eIOStatus status);
+
+	struct IORequest
+	{
+		//filled by the caller
+		File file;				//stays open until the request completes
+		uint64 offset;
+		uint64 size;
+		void* dst;				//at least size bytes
+		eIOPriority priority;
+		IOCallback callback;	//optional
+		void* userData;
+
+		//written by the I/O system
+		std::atomic<uint32> status;
+		uint64 bytesRead;
+		IORequest* next;
+	};
+
+	struct AsyncIOConfig
+	{
+		uint32 numWorkers;		//worker pool threads, 0 for the default
+		uint32 queueDepth;		//reads in flight at once, 0 for the default
+		bool forceWorkerPool;
+	};
+
+	inline constexpr uint32 DEFAULT_IO_WORKERS{ 4 };
+	inline constexpr uint32 DEFAULT_IO_QUEUE_DEPTH{ 64 };
+	inline constexpr uint32 MAX_IO_WORKERS{ 16 };
+
+	bool InitAsyncIO(const AsyncIOConfig& config = {});
+	//Cancels everything still queued and waits for the reads in flight
+	void ShutdownAsyncIO();
+	eAsyncIOBackend GetAsyncIOBackend();
+
+	void SubmitIO(IORequest* requests, const uint32 num);
+	RE_INLINE void SubmitIO(IORequest& request) { SubmitIO(&request, 1); }
+
+	//Returns false when the read already started or finished
+	bool CancelIO(IORequest& request);
+
+	RE_INLINE eIOStatus GetIOStatus(const IORequest& request) { return static_cast<eIOStatus>(request.status.load(std::memory_order_acquire)); }
+	RE_INLINE bool IsIODone(const IORequest& request) { return GetIOStatus(request) >= IOStatusDone; }
+	//Blocks until the request is done, failed or cancelled
+	eIOStatus WaitIO(const IORequest& request);
+
+}
+
+#endif // !RE_ASYNC_IO_H
@@ -0,0 +1,79 @@
+//  Filename: file 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:15:20		
+//  Sqwack-Studios													
+
+#ifndef RE_FILE_H
+#define RE_FILE_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+#include "RadiantEngine/core/span.h"
+
+//Unbuffered file access on OS handles (CreateFileW, open). Paths are UTF-8 with '/' or '\\' separators, Windows
+//converts them to UTF-16. Reads and writes take an explicit offset and don't move a file pointer, so several threads can
+//share one handle.
+namespace RE
+{
+
+	struct Arena;
+
+	enum eFileAccess : uint8
+	{
+		FileAccessRead = 0,
+		FileAccessWrite,		//creates the file or truncates it
+		FileAccessReadWrite		//creates the file when missing, keeps its contents
+	};
+
+	struct File
+	{
+		uint64 handle;		//HANDLE or file descriptor
+		bool valid;
+	};
+
+	//Read only view of a whole file
+	struct MappedFile
+	{
+		const uint8* data;	//nullptr for an empty file
+		uint64 size;
+		uint64 handle;		//file mapping HANDLE, unused on Linux
+	};
+
+	struct DirectoryEntry
+	{
+		const char* name;	//UTF-8, no path
+		bool isDirectory;
+	};
+
+	using DirectoryFn = void(*)(const DirectoryEntry& entry, void* data);
+	using WalkFn = void(*)(const char* relativePath, void* data);
+
+	inline constexpr uint32 MAX_PLATFORM_PATH{ 1024 };	//UTF-16 code units after conversion, Windows only
+
+	bool FileOpen(File& file, const char* path, const eFileAccess access);
+	void FileClose(File& file);
+
+	uint64 FileSize(const File& file);
+	//Both return how many bytes were transferred, less than size on end of file or error
+	uint64 FileRead(const File& file, void* dst, const uint64 size, const uint64 offset);
+	uint64 FileWrite(const File& file, const void* src, const uint64 size, const uint64 offset);
+
+	//The view stays valid after the file is deleted or replaced on Linux, Windows refuses to while it's mapped
+	bool MapFile(MappedFile& file, const char* path);
+	void UnmapFile(MappedFile& file);
+
+	bool FileExists(const char* path);
+	//Creates every missing directory in path
+	bool MakeDirectories(const char* path);
+	//Calls fn for every file and directory directly inside path, "." and ".." excluded. Order is up to the OS
+	bool ListDirectory(const char* path, DirectoryFn fn, void* data);
+	//Calls fn for every file under path, subdirectories included, with its path relative to path and '/' separated
+	bool WalkDirectory(const char* path, WalkFn fn, void* data);
+
+	//Reads a whole file into arena. data is nullptr when it can't be opened or read
+	Span<uint8> ReadEntireFile(const char* path, Arena& arena);
+	bool WriteEntireFile(const char* path, const void* data, const uint64 size);
+
+}
+
+#endif // !RE_FILE_H
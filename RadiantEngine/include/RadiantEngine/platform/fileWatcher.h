@@ -0,0 +1,71 @@
+//  Filename: fileWatcher 
+//	Author:	Daniel														
+//	Date: 19/10/2026 06:48:33		
+//  Sqwack-Studios													
+
+#ifndef RE_FILE_WATCHER_H
+#define RE_FILE_WATCHER_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//Notifications when files under a directory change, for hot reloading (inotify, ReadDirectoryChangesW).
+//
+//	internal void OnShadersChanged(const FileChange* changes, const uint32 num, void* data)
+//	{
+//		for (uint32 i{}; i < num; ++i)
+//			if (changes[i].type != FileChangeRemoved) flag the reload of changes[i].path;
+//	}
+//
+//	InitFileWatcher();
+//	const uint32 watch{ WatchDirectory("../shaders", OnShadersChanged, nullptr) };
+//
+//Saving a file is rarely one event: editors write a temporary and rename it, compilers truncate and write in pieces, a
+//build touches dozens of files. Events are collected until the directory has been quiet for config.quietMs and then
+//merged, one entry per path: created then written is FileChangeAdded, removed then created again is FileChangeModified,
+//created then removed is nothing. Every watch gets all its changes in one call.
+//
+//Callbacks run on the watcher thread. Keep them short (set a flag, queue a job) and don't watch or unwatch from them.
+//Paths are relative to the watched directory, '/' separated and only valid during the call. Watches are recursive,
+//directories created later are watched too. Only files are reported, not directories, so a directory renamed out of the
+//tree reports nothing for the files in it (Windows reports the directory itself as removed).
+namespace RE
+{
+
+	enum eFileChange : uint8
+	{
+		FileChangeAdded = 0,		//created, or renamed into the directory
+		FileChangeModified,
+		FileChangeRemoved,			//deleted, or renamed out of the directory
+		FileChangeRescan			//the OS dropped events, anything may have changed. path is ""
+	};
+
+	struct FileChange
+	{
+		const char* path;
+		eFileChange type;
+	};
+
+	using FileChangeFn = void(*)(const FileChange* changes, const uint32 num, void* data);
+
+	struct FileWatcherConfig
+	{
+		uint32 quietMs;		//0 for the default
+	};
+
+	inline constexpr uint32 DEFAULT_FILE_WATCH_QUIET_MS{ 100 };
+	inline constexpr uint32 MAX_FILE_WATCHES{ 32 };
+	inline constexpr uint32 INVALID_FILE_WATCH{ 0 };
+
+	bool InitFileWatcher(const FileWatcherConfig& config = {});
+	//Drops changes not reported yet. Does nothing when InitFileWatcher failed
+	void ShutdownFileWatcher();
+
+	//Returns INVALID_FILE_WATCH when the watcher isn't running, the directory can't be watched or every watch is taken
+	uint32 WatchDirectory(const char* directory, FileChangeFn fn, void* data);
+	//fn isn't called anymore once this returns
+	void UnwatchDirectory(const uint32 watch);
+
+}
+
+#endif // !RE_FILE_WATCHER_H
@@ -0,0 +1,32 @@
+//  Filename: library 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:09:45		
+//  Sqwack-Studios													
+
+#ifndef RE_LIBRARY_H
+#define RE_LIBRARY_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//Dynamic libraries loaded at runtime (LoadLibraryW, dlopen), e.g. dxcompiler.dll in the shader compiler. Paths are UTF-8.
+namespace RE
+{
+
+	struct Library
+	{
+		void* handle;
+	};
+
+	bool OpenLibrary(Library& library, const char* path);
+	void CloseLibrary(Library& library);
+
+	//nullptr when the library doesn't export name
+	void* LibrarySymbol(const Library& library, const char* name);
+
+	template<typename Fn>
+	RE_INLINE Fn LibraryFunction(const Library& library, const char* name) { return reinterpret_cast<Fn>(LibrarySymbol(library, name)); }
+
+}
+
+#endif // !RE_LIBRARY_H
@@ -0,0 +1,48 @@
+//  Filename: thread 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:04:12		
+//  Sqwack-Studios													
+
+#ifndef RE_THREAD_H
+#define RE_THREAD_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//OS threads and semaphores (Win32, pthreads). Higher level code should prefer the job system, this is what it and the
+//few long lived threads (log backend, I/O) are built on.
+namespace RE
+{
+
+	using ThreadFn = void(*)(void* data);
+
+	struct Thread
+	{
+		uint64 handle;		//HANDLE or pthread_t
+		ThreadFn fn;
+		void* data;
+	};
+
+	//Counting semaphore. Storage is big enough for a sem_t, Windows only uses the first word as a HANDLE
+	struct Semaphore
+	{
+		alignas(8) uint8 storage[32];
+	};
+
+	//thread must stay at the same address until JoinThread, the new thread reads fn and data through it
+	bool StartThread(Thread& thread, const ThreadFn fn, void* data);
+	void JoinThread(Thread& thread);
+
+	//Gives the rest of the time slice to another ready thread
+	void YieldThread();
+	//Logical cores available to the process
+	uint32 GetNumCores();
+
+	bool InitSemaphore(Semaphore& semaphore, const uint32 initialCount);
+	void ShutdownSemaphore(Semaphore& semaphore);
+	void SignalSemaphore(Semaphore& semaphore, const uint32 count = 1);
+	void WaitSemaphore(Semaphore& semaphore);
+
+}
+
+#endif // !RE_THREAD_H
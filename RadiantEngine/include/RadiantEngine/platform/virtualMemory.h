@@ -0,0 +1,30 @@
+//  Filename: virtualMemory 
+//	Author:	Daniel														
+//	Date: 19/10/2026 02:58:37		
+//  Sqwack-Studios													
+
+#ifndef RE_VIRTUAL_MEMORY_H
+#define RE_VIRTUAL_MEMORY_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//Address space reservations (VirtualAlloc, mmap). Reserving costs no memory, pages only count once committed. Sizes
+//and pointers passed to commit/decommit must be multiples of GetPageSize(). Arenas are built on this.
+namespace RE
+{
+
+	uint64 GetPageSize();
+
+	//Returns nullptr on failure. The range is inaccessible until committed
+	void* ReserveMemory(const uint64 size);
+	//Commits zero filled pages inside a reservation
+	bool CommitMemory(void* p, const uint64 size);
+	//Gives the pages back to the OS, the range stays reserved
+	void DecommitMemory(void* p, const uint64 size);
+	//size must be the size given to ReserveMemory
+	void ReleaseMemory(void* p, const uint64 size);
+
+}
+
+#endif // !RE_VIRTUAL_MEMORY_H
@@ -0,0 +1,115 @@
+//  Filename: window 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:22:51		
+//  Sqwack-Studios													
+
+#ifndef RE_WINDOW_H
+#define RE_WINDOW_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//Main window and its event pump.
+//
+//	Window window;
+//	InitWindow(window, { .title = "Radiant", .width = 1280, .height = 720 });
+//	while (running)
+//	{
+//		WindowEvent events[32];
+//		const uint32 num{ PumpWindowEvents(window, events, 32) };
+//		for (uint32 i{}; i < num; ++i) ...
+//	}
+//
+//Events are queued while the OS dispatches messages and handed out by PumpWindowEvents, so they are handled at one point
+//of the frame instead of inside a window procedure. Consecutive resizes are merged into the last one.
+//
+//Headless windows have no OS window: they keep the requested size, pump no input and only report WindowEventClose after
+//RequestWindowClose. Benchmarks, tools and the Linux build farm run headless.
+//
+//Linux windows are X11, Wayland desktops run them through XWayland. libX11 is loaded at runtime, so InitWindow fails
+//without it or without a display, and only builds with the X11 headers have the backend. Keys without an eKey
+//equivalent arrive as KeyUnknown.
+namespace RE
+{
+
+	enum eWindowEvent : uint8
+	{
+		WindowEventClose = 0,
+		WindowEventResize,		//width, height: new client area
+		WindowEventKeyDown,		//key, repeat
+		WindowEventKeyUp,		//key
+		WindowEventFocus,		//focused
+	};
+
+	//Letters and digits are their uppercase ASCII code, the rest match Windows virtual keys
+	enum eKey : uint32
+	{
+		KeyUnknown = 0,
+		KeyBackspace = 0x08,
+		KeyTab = 0x09,
+		KeyEnter = 0x0D,
+		KeyEscape = 0x1B,
+		KeySpace = 0x20,
+		KeyLeft = 0x25,
+		KeyUp = 0x26,
+		KeyRight = 0x27,
+		KeyDown = 0x28,
+		KeyF1 = 0x70,		//F1 + n for F(n+1), up to F12
+	};
+
+	struct WindowEvent
+	{
+		eWindowEvent type;
+		bool repeat;
+		bool focused;
+		uint32 key;
+		uint32 width;
+		uint32 height;
+	};
+
+	inline constexpr uint32 WINDOW_EVENT_QUEUE_SIZE{ 256 };
+
+	struct WindowDesc
+	{
+		const char* title;		//UTF-8
+		uint32 width;			//client area
+		uint32 height;
+		bool headless;
+	};
+
+	struct Window
+	{
+		void* native;			//HWND or X11 Window, nullptr when headless
+		uint32 width;
+		uint32 height;
+		bool headless;
+		bool fullscreen;
+
+		//windowed placement to restore when leaving fullscreen, Win32 only
+		int32 restoreX;
+		int32 restoreY;
+		int32 restoreWidth;
+		int32 restoreHeight;
+
+		WindowEvent events[WINDOW_EVENT_QUEUE_SIZE];
+		uint32 numEvents;
+	};
+
+	//window must stay at the same address until ShutdownWindow, the OS window procedure points to it
+	bool InitWindow(Window& window, const WindowDesc& desc);
+	void ShutdownWindow(Window& window);
+
+	//Dispatches pending OS messages and copies up to max queued events into out. Returns how many were copied, the rest
+	//wait for the next call
+	uint32 PumpWindowEvents(Window& window, WindowEvent* out, const uint32 max);
+
+	//Windows are created hidden so the renderer can be set up first
+	void MakeWindowVisible(Window& window);
+	//Borderless window covering the monitor it's on
+	void SetWindowFullscreen(Window& window, const bool fullscreen);
+	//Queues a WindowEventClose, the way to end a headless run
+	void RequestWindowClose(Window& window);
+
+}
+
+#endif // !RE_WINDOW_H
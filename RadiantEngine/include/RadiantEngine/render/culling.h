@@ -0,0 +1,71 @@
+//  Filename: culling 
+//	Author:	Daniel														
+//	Date: 18/10/2026 15:07:52		
+//  Sqwack-Studios													
+
+#ifndef RE_CULLING_H
+#define RE_CULLING_H
+
+#include "RadiantEngine/math/matrix.h"
+
+//Frustum culling over SoA bounding volumes, 8 bounds per iteration with fp32x8.
+//Every kernel works on a [begin, end) range and writes the indices of the visible bounds (absolute, not relative to begin)
+//to out, in increasing order. out must hold (end - begin) indices. Ranges are independent: split a big array in chunks,
+//pass indices + begin as each chunk's out and gather them afterwards with MergeCullRanges.
+//The tests are conservative, a bound that intersects a plane is visible. One that only touches it from the outside
+//(distance == -radius) is culled.
+namespace RE
+{
+
+	//Planes point inwards: dot(plane.xyz, p) + plane.w >= 0 means p is on the visible side
+	struct Frustum
+	{
+		float4 planes[6];
+	};
+
+	enum eFrustumPlane : uint8
+	{
+		Left = 0,
+		Right,
+		Bottom,
+		Top,
+		Near,
+		Far
+	};
+
+	struct SphereSoA
+	{
+		const fp32* x;
+		const fp32* y;
+		const fp32* z;
+		const fp32* radius;
+	};
+
+	struct AABBSoA
+	{
+		const fp32* centerX;
+		const fp32* centerY;
+		const fp32* centerZ;
+		const fp32* extentX;
+		const fp32* extentY;
+		const fp32* extentZ;
+	};
+
+	struct CullResult
+	{
+		uint32 numVisible;
+		uint32 numRejected;
+	};
+
+	//viewProjection = projection * view, D3D clip space (0 <= z <= w). Planes come out normalized.
+	Frustum FrustumFromMatrix(const float4x4& viewProjection);
+
+	CullResult CullSpheres(const Frustum& frustum, const SphereSoA spheres, const uint32 begin, const uint32 end, uint32* out);
+	CullResult CullAABBs(const Frustum& frustum, const AABBSoA boxes, const uint32 begin, const uint32 end, uint32* out);
+
+	//Gathers the per-range outputs written at out + rangeBegins[i] into a single list at out. Returns the total count.
+	uint32 MergeCullRanges(uint32* out, const uint32* rangeBegins, const CullResult* results, const uint32 numRanges);
+
+}
+
+#endif // !RE_CULLING_H
@@ -0,0 +1,259 @@
+//  Filename: vertexPacking 
+//	Author:	Daniel														
+//	Date: 18/10/2026 17:05:21		
+//  Sqwack-Studios													
+
+#ifndef RE_VERTEX_PACKING_H
+#define RE_VERTEX_PACKING_H
+
+#include "RadiantEngine/math/half.h"
+#include "RadiantEngine/math/vectorAlgebra.h"
+
+//Compressed vertex attributes. Each packed type maps to a DXGI format, so the input assembler does the integer -> float
+//conversion and the shader only undoes the remaining transform with the helpers in assets/shaders/vertexPacking.hlsli.
+//
+//	position	snorm16x4	DXGI_FORMAT_R16G16B16A16_SNORM	relative to the mesh bounds, decode offset + q * scale
+//	position	unorm16x4	DXGI_FORMAT_R16G16B16A16_UNORM	same, q in [0, 1]
+//	normal		snorm16x2	DXGI_FORMAT_R16G16_SNORM		octahedral
+//	tangent		snorm16x2	DXGI_FORMAT_R16G16_SNORM		octahedral, bitangent sign stored in the lowest bit of y
+//	color		unorm8x4	DXGI_FORMAT_R8G8B8A8_UNORM
+//	uv			half2		DXGI_FORMAT_R16G16_FLOAT
+//
+//A float3 position + normal + float4 tangent + color + uv vertex goes from 64 to 24 bytes.
+namespace RE
+{
+
+	struct snorm16x2 { int16 x, y; };
+	struct snorm16x4 { int16 x, y, z, w; };
+	struct unorm16x4 { uint16 x, y, z, w; };
+	struct unorm8x4 { uint8 x, y, z, w; };
+
+	//Upload both float3 as root constants, decoded position = offset + q * scale
+	struct PositionQuantization
+	{
+		float3 offset;
+		float3 scale;
+	};
+
+	/* API */
+
+	void computeBounds(const float3* positions, const size_t num, float3& outMin, float3& outMax);
+	//Degenerate axes (min == max) get a scale of 1 so packing doesn't divide by 0
+	PositionQuantization snorm16Quantization(const float3 min, const float3 max);
+	PositionQuantization unorm16Quantization(const float3 min, const float3 max);
+
+	//Rounded to nearest, out of range values are clamped
+	int16 packSnorm16(const fp32);
+	uint16 packUnorm16(const fp32);
+	uint8 packUnorm8(const fp32);
+	fp32 unpackSnorm16(const int16);
+	fp32 unpackUnorm16(const uint16);
+
+	//n must be normalized. Result is in [-1, 1]^2
+	float2 octEncode(const float3 n);
+	float3 octDecode(const float2 e);
+
+	snorm16x4 packPositionSnorm16(const float3 p, const PositionQuantization& q);
+	unorm16x4 packPositionUnorm16(const float3 p, const PositionQuantization& q);
+	snorm16x2 packNormal(const float3 n);
+	float3 unpackNormal(const snorm16x2);
+	//xyz is the tangent, w the bitangent sign (+-1)
+	snorm16x2 packTangent(const float4 t);
+	float4 unpackTangent(const snorm16x2);
+	unorm8x4 packColor(const float4 rgba);
+
+	//Batch versions over num vertices
+	void packPositionsSnorm16(const float3* in, snorm16x4* out, const size_t num, const PositionQuantization& q);
+	void packPositionsUnorm16(const float3* in, unorm16x4* out, const size_t num, const PositionQuantization& q);
+	void packNormals(const float3* in, snorm16x2* out, const size_t num);
+	void packTangents(const float4* in, snorm16x2* out, const size_t num);
+	void packColors(const float4* in, unorm8x4* out, const size_t num);
+	void packUVs(const float2* in, half2* out, const size_t num);
+
+
+
+	/* IMPLEMENTATIONS */
+
+	inline void computeBounds(const float3* positions, const size_t num, float3& outMin, float3& outMax)
+	{
+		float3 mn{ positions[0] }, mx{ positions[0] };
+		for (size_t i{ 1 }; i < num; ++i)
+		{
+			const float3 p{ positions[i] };
+			mn = float3{ p.x < mn.x ? p.x : mn.x, p.y < mn.y ? p.y : mn.y, p.z < mn.z ? p.z : mn.z };
+			mx = float3{ p.x > mx.x ? p.x : mx.x, p.y > mx.y ? p.y : mx.y, p.z > mx.z ? p.z : mx.z };
+		}
+		outMin = mn;
+		outMax = mx;
+	}
+
+	RE_INLINE fp32 quantizationScale(const fp32 extent) { return extent > 0.f ? extent : 1.f; }
+
+	RE_INLINE PositionQuantization snorm16Quantization(const float3 min, const float3 max)
+	{
+		const float3 halfExtent{ (max - min) * 0.5f };
+		return { (min + max) * 0.5f, float3{ quantizationScale(halfExtent.x), quantizationScale(halfExtent.y), quantizationScale(halfExtent.z) } };
+	}
+
+	RE_INLINE PositionQuantization unorm16Quantization(const float3 min, const float3 max)
+	{
+		const float3 extent{ max - min };
+		return { min, float3{ quantizationScale(extent.x), quantizationScale(extent.y), quantizationScale(extent.z) } };
+	}
+
+	RE_INLINE fp32 clampf(const fp32 v, const fp32 lo, const fp32 hi) { return v < lo ? lo : (v > hi ? hi : v); }
+
+	//nearbyint instead of +0.5 so negative values round the same way as the SSE cvtps path
+	RE_INLINE int16 packSnorm16(const fp32 v) { return static_cast<int16>(std::nearbyint(clampf(v, -1.f, 1.f) * 32767.f)); }
+	RE_INLINE uint16 packUnorm16(const fp32 v) { return static_cast<uint16>(std::nearbyint(clampf(v, 0.f, 1.f) * 65535.f)); }
+	RE_INLINE uint8 packUnorm8(const fp32 v) { return static_cast<uint8>(std::nearbyint(clampf(v, 0.f, 1.f) * 255.f)); }
+	//matches the D3D conversion rules, -32768 and -32767 both map to -1
+	RE_INLINE fp32 unpackSnorm16(const int16 v) { const fp32 f{ v / 32767.f }; return f < -1.f ? -1.f : f; }
+	RE_INLINE fp32 unpackUnorm16(const uint16 v) { return v / 65535.f; }
+
+	RE_INLINE fp32 signNotZero(const fp32 v) { return v >= 0.f ? 1.f : -1.f; }
+
+	RE_INLINE float2 octEncode(const float3 n)
+	{
+		const fp32 invL1{ 1.f / (std::fabs(n.x) + std::fabs(n.y) + std::fabs(n.z)) };
+		const fp32 px{ n.x * invL1 }, py{ n.y * invL1 };
+
+		//lower hemisphere is folded over the diagonals
+		if (n.z < 0.f)
+			return { (1.f - std::fabs(py)) * signNotZero(px), (1.f - std::fabs(px)) * signNotZero(py) };
+
+		return { px, py };
+	}
+
+	RE_INLINE float3 octDecode(const float2 e)
+	{
+		float3 n{ e.x, e.y, 1.f - std::fabs(e.x) - std::fabs(e.y) };
+		const fp32 t{ n.z < 0.f ? -n.z : 0.f };
+		n.x += n.x >= 0.f ? -t : t;
+		n.y += n.y >= 0.f ? -t : t;
+		return normalize(n);
+	}
+
+	//Same operation order as the batch versions, so both produce the same bits
+	RE_INLINE int16 quantizeSnorm16(const fp32 v, const fp32 offset, const fp32 scale)
+	{
+		return static_cast<int16>(std::nearbyint(clampf((v - offset) * (32767.f / scale), -32767.f, 32767.f)));
+	}
+
+	RE_INLINE uint16 quantizeUnorm16(const fp32 v, const fp32 offset, const fp32 scale)
+	{
+		return static_cast<uint16>(std::nearbyint(clampf((v - offset) * (65535.f / scale), 0.f, 65535.f)));
+	}
+
+	RE_INLINE snorm16x4 packPositionSnorm16(const float3 p, const PositionQuantization& q)
+	{
+		return { quantizeSnorm16(p.x, q.offset.x, q.scale.x), quantizeSnorm16(p.y, q.offset.y, q.scale.y), quantizeSnorm16(p.z, q.offset.z, q.scale.z), 0 };
+	}
+
+	RE_INLINE unorm16x4 packPositionUnorm16(const float3 p, const PositionQuantization& q)
+	{
+		return { quantizeUnorm16(p.x, q.offset.x, q.scale.x), quantizeUnorm16(p.y, q.offset.y, q.scale.y), quantizeUnorm16(p.z, q.offset.z, q.scale.z), 0 };
+	}
+
+	RE_INLINE snorm16x2 packNormal(const float3 n)
+	{
+		const float2 e{ octEncode(n) };
+		return { packSnorm16(e.x), packSnorm16(e.y) };
+	}
+
+	RE_INLINE float3 unpackNormal(const snorm16x2 v) { return octDecode(float2{ unpackSnorm16(v.x), unpackSnorm16(v.y) }); }
+
+	RE_INLINE snorm16x2 packTangent(const float4 t)
+	{
+		const float2 e{ octEncode(float3{ t.x, t.y, t.z }) };
+		int32 y{ (packSnorm16(e.y) & ~1) | (t.w < 0.f ? 1 : 0) };
+		//-32768 would decode as -32767 and flip the sign bit
+		y = y == -32768 ? -32766 : y;
+		return { packSnorm16(e.x), static_cast<int16>(y) };
+	}
+
+	RE_INLINE float4 unpackTangent(const snorm16x2 v)
+	{
+		const float3 n{ octDecode(float2{ unpackSnorm16(v.x), unpackSnorm16(v.y) }) };
+		return { n.x, n.y, n.z, (v.y & 1) ? -1.f : 1.f };
+	}
+
+	RE_INLINE unorm8x4 packColor(const float4 c) { return { packUnorm8(c.x), packUnorm8(c.y), packUnorm8(c.z), packUnorm8(c.w) }; }
+
+	inline void packPositionsSnorm16(const float3* in, snorm16x4* out, const size_t num, const PositionQuantization& q)
+	{
+#if RE_SIMD_SSE
+		const __m128 offset{ simd::load(q.offset) };
+		const __m128 invScale{ _mm_div_ps(_mm_set1_ps(32767.f), _mm_setr_ps(q.scale.x, q.scale.y, q.scale.z, 1.f)) };
+		const __m128 lo{ _mm_set1_ps(-32767.f) }, hi{ _mm_set1_ps(32767.f) };
+		//simd::load(float3) zeroes w, so the padding lane packs to 0
+		for (size_t i{}; i < num; ++i)
+		{
+			__m128 v{ _mm_mul_ps(_mm_sub_ps(simd::load(in[i]), offset), invScale) };
+			v = _mm_min_ps(_mm_max_ps(v, lo), hi);
+			const __m128i r{ _mm_cvtps_epi32(v) };
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(r, r));
+		}
+#else
+		for (size_t i{}; i < num; ++i)
+			out[i] = packPositionSnorm16(in[i], q);
+#endif
+	}
+
+	inline void packPositionsUnorm16(const float3* in, unorm16x4* out, const size_t num, const PositionQuantization& q)
+	{
+#if RE_SIMD_SSE
+		const __m128 offset{ simd::load(q.offset) };
+		const __m128 invScale{ _mm_div_ps(_mm_set1_ps(65535.f), _mm_setr_ps(q.scale.x, q.scale.y, q.scale.z, 1.f)) };
+		const __m128 lo{ _mm_setzero_ps() }, hi{ _mm_set1_ps(65535.f) };
+		for (size_t i{}; i < num; ++i)
+		{
+			__m128 v{ _mm_mul_ps(_mm_sub_ps(simd::load(in[i]), offset), invScale) };
+			v = _mm_min_ps(_mm_max_ps(v, lo), hi);
+			//w lane is (0 - 0) * 65535
+			const __m128i r{ _mm_cvtps_epi32(v) };
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi32(r, r));
+		}
+#else
+		for (size_t i{}; i < num; ++i)
+			out[i] = packPositionUnorm16(in[i], q);
+#endif
+	}
+
+	inline void packNormals(const float3* in, snorm16x2* out, const size_t num)
+	{
+		for (size_t i{}; i < num; ++i)
+			out[i] = packNormal(in[i]);
+	}
+
+	inline void packTangents(const float4* in, snorm16x2* out, const size_t num)
+	{
+		for (size_t i{}; i < num; ++i)
+			out[i] = packTangent(in[i]);
+	}
+
+	inline void packColors(const float4* in, unorm8x4* out, const size_t num)
+	{
+#if RE_SIMD_SSE
+		const __m128 scale{ _mm_set1_ps(255.f) };
+		for (size_t i{}; i < num; ++i)
+		{
+			const __m128 v{ _mm_min_ps(_mm_max_ps(simd::load(in[i]), _mm_setzero_ps()), _mm_set1_ps(1.f)) };
+			const __m128i r{ _mm_cvtps_epi32(_mm_mul_ps(v, scale)) };
+			const __m128i r16{ _mm_packus_epi32(r, r) };
+			out[i] = std::bit_cast<unorm8x4>(_mm_cvtsi128_si32(_mm_packus_epi16(r16, r16)));
+		}
+#else
+		for (size_t i{}; i < num; ++i)
+			out[i] = packColor(in[i]);
+#endif
+	}
+
+	inline void packUVs(const float2* in, half2* out, const size_t num)
+	{
+		toHalf(reinterpret_cast<half*>(out), reinterpret_cast<const fp32*>(in), num * 2);
+	}
+
+}
+
+#endif // !RE_VERTEX_PACKING_H
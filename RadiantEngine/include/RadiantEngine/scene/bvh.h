@@ -0,0 +1,128 @@
+//  Filename: bvh 
+//	Author:	Daniel														
+//	Date: 18/10/2026 17:48:12		
+//  Sqwack-Studios													
+
+#ifndef RE_BVH_H
+#define RE_BVH_H
+
+#include "RadiantEngine/math/floatN.h"
+
+//Bounding volume hierarchy over static triangles or boxes, built with a binned SAH.
+//Nodes are 32 bytes and stored depth first, children always come after their parent and siblings are adjacent
+//(right = left + 1), so one cache line holds both children tested during traversal.
+//
+//The build is split in independent subtrees so it can run on several threads:
+//	numTasks = BeginBVHBuild(bvh, maxTasks)		serial, splits the top of the tree until there are enough subtrees
+//	BuildBVHTask(bvh, i) for i in [0, numTasks)	any thread, tasks touch disjoint ranges
+//	EndBVHBuild(bvh)							serial, packs the nodes written by each task
+//BuildBVH does the three steps itself. Called from a job thread it runs the tasks with ParallelFor, a few per thread,
+//anywhere else it builds on the calling thread.
+//
+//The BVH does not copy the geometry, the arrays passed to InitBVH must stay alive. When they move (skinned or animated
+//content with the same topology) RefitBVH recomputes every bound without changing the tree.
+namespace RE
+{
+
+	inline constexpr uint32 INVALID_PRIMITIVE{ 0xFFFFFFFF };
+	inline constexpr uint32 BVH_MAX_LEAF_PRIMITIVES{ 4 };
+	inline constexpr uint32 BVH_MAX_DEPTH{ 64 };
+
+	struct alignas(32) BVHNode
+	{
+		float3 min;
+		uint32 leftFirst;	//left child for interior nodes, first entry of primIndices for leaves
+		float3 max;
+		uint32 count;		//0 for interior nodes
+	};
+
+	struct BVHBuildTask
+	{
+		uint32 node;		//subtree root, already allocated by BeginBVHBuild
+		uint32 first;
+		uint32 count;
+		uint32 depth;
+		uint32 nodeBase;	//where the subtree writes its nodes, room for 2 * count - 2
+		uint32 numNodes;
+	};
+
+	struct BVH
+	{
+		BVHNode* nodes;
+		uint32 numNodes;
+
+		//primitives are referenced through primIndices, leaves own a contiguous range of it
+		uint32* primIndices;
+		float3* primMin;
+		float3* primMax;
+		float3* centroids;
+		uint32 numPrims;
+
+		//source geometry, either triangles (vertices + 3 indices per primitive) or boxes
+		const float3* vertices;
+		const uint32* indices;
+		const float3* boxMin;
+		const float3* boxMax;
+
+		BVHBuildTask* tasks;
+		uint32 numTasks;
+		uint32 numTopNodes;
+
+		void* memory;		//single allocation behind every array, nodes is aligned inside it
+	};
+
+	struct Ray
+	{
+		float3 origin;
+		float3 direction;	//doesn't need to be normalized, t is in units of direction
+		fp32 tMax;
+	};
+
+	struct RayHit
+	{
+		fp32 t;
+		uint32 prim;		//INVALID_PRIMITIVE on miss
+		fp32 u, v;			//barycentrics of the hit for triangles, 0 for boxes
+	};
+
+	struct Segment
+	{
+		float3 start;
+		float3 end;
+	};
+
+	struct BVHBox
+	{
+		float3 min;
+		float3 max;
+	};
+
+	//Allocates every array for numTriangles/numBoxes primitives
+	bool InitBVH(BVH& bvh, const float3* vertices, const uint32* indices, const uint32 numTriangles);
+	bool InitBVH(BVH& bvh, const float3* boxMin, const float3* boxMax, const uint32 numBoxes);
+	void ShutdownBVH(BVH& bvh);
+
+	//Returns the number of tasks, at most maxTasks. 0 when there are no primitives
+	uint32 BeginBVHBuild(BVH& bvh, const uint32 maxTasks);
+	void BuildBVHTask(BVH& bvh, const uint32 task);
+	void EndBVHBuild(BVH& bvh);
+	void BuildBVH(BVH& bvh);
+
+	//Recomputes primitive and node bounds from the source geometry, the topology must not have changed
+	void RefitBVH(BVH& bvh);
+
+	//Closest hit for each ray
+	void RaycastBVH(const BVH& bvh, const Ray* rays, RayHit* hits, const uint32 num);
+	//Same result as RaycastBVH up to a few ulps of t/u/v, traced in packets of 8 consecutive rays sharing one traversal.
+	//Pays off when neighbouring rays are coherent (a block of pixels, a picking grid). Incoherent rays visit the union of
+	//their paths and are faster with RaycastBVH.
+	void RaycastBVHPackets(const BVH& bvh, const Ray* rays, RayHit* hits, const uint32 num);
+	//Any hit, blocked[i] is 1 when something lies between start and end. Cheaper than a raycast, use it for visibility
+	void OccludedBVH(const BVH& bvh, const Segment* segments, uint8* blocked, const uint32 num);
+	//Primitives whose bounds overlap each box. Indices are written back to back to out, counts[i] holds how many belong
+	//to boxes[i]. Stops writing once maxOut is reached; returns the total that would have been written.
+	uint32 OverlapBVH(const BVH& bvh, const BVHBox* boxes, uint32* counts, const uint32 num, uint32* out, const uint32 maxOut);
+
+}
+
+#endif // !RE_BVH_H
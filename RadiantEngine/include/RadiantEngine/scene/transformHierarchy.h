@@ -0,0 +1,95 @@
+//  Filename: transformHierarchy 
+//	Author:	Daniel														
+//	Date: 18/10/2026 13:58:42		
+//  Sqwack-Studios													
+
+#ifndef RE_TRANSFORM_HIERARCHY_H
+#define RE_TRANSFORM_HIERARCHY_H
+
+#include "RadiantEngine/math/quaternion.h"
+
+//Transform hierarchy stored as SoA arrays sorted by depth: every node of depth d lives in [levelStart[d], levelStart[d + 1]).
+//World matrices are propagated one level at a time. Parents always belong to the previous level, so a level can be split
+//in any number of ranges and handed to different threads, the only sync point is between levels.
+//Only nodes whose local transform changed, or whose parent's world changed, recompute their matrix.
+//
+//Inside a level children are grouped by parent, in the order of their parents, so the descendants of a contiguous range
+//of slots are a contiguous range in every level below. PropagateTransforms uses that to visit only the subtrees of dirty
+//nodes instead of every slot.
+//
+//Nodes are referenced by a stable TransformId; slots move when the structure changes, ids don't.
+//Structural edits (add/remove) are O(num) and must not run while propagating.
+namespace RE
+{
+
+	using TransformId = uint32;
+	inline constexpr TransformId INVALID_TRANSFORM{ 0xFFFFFFFF };
+	inline constexpr uint32 MAX_TRANSFORM_DEPTH{ 32 };
+
+	enum eTransformFlags : uint8
+	{
+		LocalDirty = 0x1	//local TRS was modified since last propagation
+	};
+
+	struct TransformHierarchy
+	{
+		//per slot, sorted by depth
+		float3* localPosition;
+		quat* localRotation;
+		float3* localScale;
+		float3x4* world;
+		uint32* parent;		//parent slot, INVALID_TRANSFORM for roots
+		TransformId* idOf;
+		uint8* flags;
+		uint32* changedPass;	//pass in which the world matrix was last recomputed
+
+		//per id
+		uint32* slotOf;		//INVALID_TRANSFORM when the id is free
+
+		TransformId* freeIds;
+		uint32 numFreeIds;
+		uint32 nextId;
+
+		TransformId* dirtyIds;	//every node with LocalDirty set, once
+		uint32* scratch;		//capacity entries for RemoveTransform and PropagateTransforms
+
+		uint32 levelStart[MAX_TRANSFORM_DEPTH + 1];
+		uint32 numLevels;
+		uint32 num;
+		uint32 capacity;
+		uint32 numDirty;
+		uint32 pass;		//propagation being built, changedPass == pass - 1 means changed during the last one
+	};
+
+	//Allocates all arrays for capacity nodes up front
+	bool InitTransformHierarchy(TransformHierarchy& h, const uint32 capacity);
+	void ShutdownTransformHierarchy(TransformHierarchy& h);
+
+	//Returns INVALID_TRANSFORM when full or when the node would exceed MAX_TRANSFORM_DEPTH
+	TransformId AddTransform(TransformHierarchy& h, const TransformId parent, const float3 position, const quat rotation, const float3 scale);
+	//Removes the node and its whole subtree.
+	//Ids must be live in every call that takes one: never handed out or already removed ids assert.
+	void RemoveTransform(TransformHierarchy& h, const TransformId id);
+
+	void SetLocalTransform(TransformHierarchy& h, const TransformId id, const float3 position, const quat rotation, const float3 scale);
+	void SetLocalPosition(TransformHierarchy& h, const TransformId id, const float3 position);
+	void SetLocalRotation(TransformHierarchy& h, const TransformId id, const quat rotation);
+	void SetLocalScale(TransformHierarchy& h, const TransformId id, const float3 scale);
+
+	const float3x4& WorldMatrix(const TransformHierarchy& h, const TransformId id);
+	bool HasWorldChanged(const TransformHierarchy& h, const TransformId id);
+
+	//Recomputes slots [begin, end). The range must not straddle levels and every level before it must be finished.
+	void PropagateRange(TransformHierarchy& h, const uint32 begin, const uint32 end);
+	//Serial propagation of the subtrees of dirty nodes, O(dirty log dirty + changed) instead of O(num)
+	void PropagateTransforms(TransformHierarchy& h);
+	//Call once all levels have been propagated by hand with PropagateRange
+	void EndPropagation(TransformHierarchy& h);
+
+
+	RE_INLINE uint32 LevelBegin(const TransformHierarchy& h, const uint32 level) { return h.levelStart[level]; }
+	RE_INLINE uint32 LevelEnd(const TransformHierarchy& h, const uint32 level) { return h.levelStart[level + 1]; }
+
+}
+
+#endif // !RE_TRANSFORM_HIERARCHY_H
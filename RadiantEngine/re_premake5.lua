@@ -9,20 +9,10 @@ project "RadiantEngine"
 
 	warnings "High"
 	
-	links 
-	{
-		"quill",
-		"dxgi",
-		"d3d12",
-	}
-
-
 	includedirs
 	{
 		"include",
 		"source",
-		"../vendor/quill/include",
-		
 	}
 
 
@@ -45,10 +35,26 @@ project "RadiantEngine"
 
 	defines{"NOMINMAX"}
 
+	--optional DEFLATE codec for packs (core/compression.h), built in when libdeflate is vendored
+	if os.isdir(path.join(_SCRIPT_DIR, "../vendor/libdeflate")) then
+		defines{"RE_ENABLE_DEFLATE=1"}
+		includedirs{"../vendor/libdeflate"}
+		files{"../vendor/libdeflate/lib/**.c"}
+	end
+
+	--premake maps SSE4.2 to /arch:SSE2 on msvc, RE_ENABLE_SSE42 tells core/simd.h the SSE4 path is safe
+	vectorextensions "SSE4.2"
+	defines{"RE_ENABLE_SSE42"}
+
 	filter "system:windows"
 		systemversion "latest"
 		staticruntime "on"
 		flags {"MultiProcessorCompile"}
+		links {"dxgi", "d3d12"}
+
+	--platform/thread.cpp and platform/library.cpp
+	filter "system:linux"
+		links {"pthread", "dl"}
 
 
 	filter "configurations:Debug"
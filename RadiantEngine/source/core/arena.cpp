@@ -0,0 +1,126 @@
+//  Filename: arena 
+//	Author:	Daniel														
+//	Date: 18/10/2026 19:52:30		
+//  Sqwack-Studios													
+
+#include <cstring>
+
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/platform/virtualMemory.h"
+
+namespace RE
+{
+
+	internal constexpr uint32 NUM_SCRATCH_ARENAS{ 2 };
+
+	internal thread_local Arena scratchArenas[NUM_SCRATCH_ARENAS];
+
+	internal uint64 AlignUp(const uint64 v, const uint64 alignment) { return (v + alignment - 1) & ~(alignment - 1); }
+
+	bool InitArena(Arena& arena, const uint64 reserveSize, const eMemoryTag tag)
+	{
+		arena = {};
+		arena.tag = tag;
+
+		const uint64 reserved{ AlignUp(reserveSize > 0 ? reserveSize : 1, ARENA_COMMIT_GRANULARITY) };
+		void* base{ ReserveMemory(reserved) };
+		if (!base)
+			return false;
+
+		arena.base = static_cast<uint8*>(base);
+		arena.reserved = reserved;
+		return true;
+	}
+
+	void ShutdownArena(Arena& arena)
+	{
+		if (arena.base)
+		{
+			ReleaseMemory(arena.base, arena.reserved);
+			TrackCommit(arena.tag, -static_cast<int64>(arena.committed));
+		}
+
+		arena = {};
+	}
+
+	void* PushSize(Arena& arena, const uint64 size, const uint64 alignment)
+	{
+		//base is page aligned, aligning the offset aligns the address
+		const uint64 start{ AlignUp(arena.pos, alignment) };
+		const uint64 end{ start + size };
+
+		if (end > arena.reserved || end < start)
+			return nullptr;
+
+		if (end > arena.committed)
+		{
+			const uint64 committed{ AlignUp(end, ARENA_COMMIT_GRANULARITY) };
+			if (!CommitMemory(arena.base + arena.committed, committed - arena.committed))
+				return nullptr;
+
+			TrackCommit(arena.tag, static_cast<int64>(committed - arena.committed));
+			arena.committed = committed;
+		}
+
+		arena.pos = end;
+		arena.peak = end > arena.peak ? end : arena.peak;
+		return arena.base + start;
+	}
+
+	void* PushSizeZero(Arena& arena, const uint64 size, const uint64 alignment)
+	{
+		void* p{ PushSize(arena, size, alignment) };
+		if (p)
+			memset(p, 0, size);
+
+		return p;
+	}
+
+	ArenaMarker GetArenaMarker(Arena& arena)
+	{
+		return { .arena = &arena, .pos = arena.pos };
+	}
+
+	void RewindArena(const ArenaMarker marker)
+	{
+		marker.arena->pos = marker.pos;
+	}
+
+	void ResetArena(Arena& arena)
+	{
+		arena.pos = 0;
+	}
+
+	void DecommitArena(Arena& arena)
+	{
+		const uint64 keep{ AlignUp(arena.pos, ARENA_COMMIT_GRANULARITY) };
+		if (keep < arena.committed)
+		{
+			DecommitMemory(arena.base + keep, arena.committed - keep);
+			TrackCommit(arena.tag, -static_cast<int64>(arena.committed - keep));
+			arena.committed = keep;
+		}
+	}
+
+	ScratchArena BeginScratch(const Arena* conflict)
+	{
+		Arena* arena{ &scratchArenas[0] == conflict ? &scratchArenas[1] : &scratchArenas[0] };
+
+		if (!arena->base)
+			InitArena(*arena, SCRATCH_ARENA_RESERVE, MemoryTagScratch);
+
+		return GetArenaMarker(*arena);
+	}
+
+	void EndScratch(const ScratchArena scratch)
+	{
+		RewindArena(scratch);
+	}
+
+	void ReleaseScratchArenas()
+	{
+		for (Arena& arena : scratchArenas)
+			ShutdownArena(arena);
+	}
+
+}
@@ -0,0 +1,86 @@
+//  Filename: clock 
+//	Author:	Daniel														
+//	Date: 18/10/2026 23:53:40		
+//  Sqwack-Studios													
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <time.h>
+#include <errno.h>
+#endif
+
+#include "RadiantEngine/core/clock.h"
+
+namespace RE
+{
+
+#if defined(_WIN32)
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+	internal int64 QueryFrequency()
+	{
+		LARGE_INTEGER f;
+		QueryPerformanceFrequency(&f);
+		return f.QuadPart;
+	}
+
+	int64 GetTimeNs()
+	{
+		persistent const int64 frequency{ QueryFrequency() };
+
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+
+		//split so counter * 1e9 doesn't overflow after a few days of uptime
+		const int64 seconds{ counter.QuadPart / frequency };
+		const int64 rest{ counter.QuadPart % frequency };
+		return seconds * 1000000000ll + rest * 1000000000ll / frequency;
+	}
+
+	void SleepNs(const int64 ns)
+	{
+		if (ns <= 0)
+			return;
+
+		//one timer per thread, created on first use. Null before Windows 10 1803
+		persistent thread_local HANDLE timer{ CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS) };
+		if (timer)
+		{
+			//relative due time in 100ns units
+			LARGE_INTEGER due;
+			due.QuadPart = -(ns / 100);
+			if (SetWaitableTimer(timer, &due, 0, nullptr, nullptr, FALSE))
+			{
+				WaitForSingleObject(timer, INFINITE);
+				return;
+			}
+		}
+
+		Sleep(static_cast<DWORD>(ns / 1000000));
+	}
+
+#else
+
+	int64 GetTimeNs()
+	{
+		timespec t;
+		clock_gettime(CLOCK_MONOTONIC, &t);
+		return static_cast<int64>(t.tv_sec) * 1000000000ll + t.tv_nsec;
+	}
+
+	void SleepNs(const int64 ns)
+	{
+		if (ns <= 0)
+			return;
+
+		timespec t{ .tv_sec = static_cast<time_t>(ns / 1000000000ll), .tv_nsec = static_cast<long>(ns % 1000000000ll) };
+		while (nanosleep(&t, &t) != 0 && errno == EINTR) {}
+	}
+
+#endif
+
+}
@@ -0,0 +1,340 @@
+//  Filename: compression 
+//	Author:	Daniel														
+//	Date: 19/10/2026 05:56:40		
+//  Sqwack-Studios													
+
+#include <cstring>
+#include <bit>
+
+#include "RadiantEngine/core/compression.h"
+
+#if RE_ENABLE_DEFLATE
+#include "libdeflate.h"
+#endif
+
+namespace RE
+{
+
+	internal constexpr uint32 LZ_HASH_LOG{ 14 };
+	internal constexpr uint32 LZ_RUN_MASK{ 15 };
+	//misses before the search step grows, incompressible data is skipped faster and faster
+	internal constexpr uint32 LZ_SKIP_TRIGGER{ 6 };
+	internal constexpr int DEFLATE_LEVEL{ 9 };
+
+	internal RE_INLINE uint32 LoadLZ32(const uint8* p) { uint32 v; memcpy(&v, p, sizeof(v)); return v; }
+	internal RE_INLINE uint64 LoadLZ64(const uint8* p) { uint64 v; memcpy(&v, p, sizeof(v)); return v; }
+	internal RE_INLINE void Copy16(uint8* dst, const uint8* src) { memcpy(dst, src, 16); }
+
+	internal RE_INLINE uint32 HashLZ(const uint32 v) { return (v * 2654435761u) >> (32 - LZ_HASH_LOG); }
+
+	//Bytes that match at a and b, up to limit
+	internal RE_INLINE size_t CountLZMatch(const uint8* a, const uint8* b, const uint8* limit)
+	{
+		const uint8* start{ b };
+		while (b + 8 <= limit)
+		{
+			const uint64 diff{ LoadLZ64(a) ^ LoadLZ64(b) };
+			if (diff)
+				return static_cast<size_t>(b - start) + (std::countr_zero(diff) >> 3);
+			a += 8;
+			b += 8;
+		}
+		while (b < limit && *a == *b)
+		{
+			++a;
+			++b;
+		}
+		return static_cast<size_t>(b - start);
+	}
+
+	internal RE_INLINE uint8* WriteLZLength(uint8* op, size_t length)
+	{
+		for (; length >= 255; length -= 255)
+			*op++ = 255;
+		*op++ = static_cast<uint8>(length);
+		return op;
+	}
+
+	//match is 0 for the last sequence, literals only
+	internal uint8* WriteLZSequence(uint8* op, const uint8* opEnd, const uint8* literals, const size_t numLiterals, const uint32 offset, const size_t matchLength)
+	{
+		const size_t extra{ matchLength ? matchLength - LZ_MIN_MATCH : 0 };
+		const size_t worst{ 1 + numLiterals / 255 + 1 + numLiterals + 2 + extra / 255 + 1 };
+		if (worst > static_cast<size_t>(opEnd - op))
+			return nullptr;
+
+		uint8* token{ op++ };
+		*token = static_cast<uint8>((numLiterals < LZ_RUN_MASK ? numLiterals : LZ_RUN_MASK) << 4);
+		if (numLiterals >= LZ_RUN_MASK)
+			op = WriteLZLength(op, numLiterals - LZ_RUN_MASK);
+		if (numLiterals)
+			memcpy(op, literals, numLiterals);
+		op += numLiterals;
+
+		if (matchLength)
+		{
+			*op++ = static_cast<uint8>(offset);
+			*op++ = static_cast<uint8>(offset >> 8);
+			*token |= static_cast<uint8>(extra < LZ_RUN_MASK ? extra : LZ_RUN_MASK);
+			if (extra >= LZ_RUN_MASK)
+				op = WriteLZLength(op, extra - LZ_RUN_MASK);
+		}
+		return op;
+	}
+
+	internal size_t CompressLZ(const uint8* src, const size_t srcSize, uint8* dst, const size_t dstCapacity)
+	{
+		uint8* op{ dst };
+		const uint8* const opEnd{ dst + dstCapacity };
+		const uint8* anchor{ src };
+
+		//too short for a match that leaves LZ_LAST_LITERALS behind it
+		if (srcSize > LZ_LAST_LITERALS + LZ_MIN_MATCH)
+		{
+			uint32 table[1u << LZ_HASH_LOG];
+			memset(table, 0, sizeof(table));
+
+			const uint8* ip{ src + 1 };
+			const uint8* const matchLimit{ src + srcSize - LZ_LAST_LITERALS };
+			uint32 misses{};
+
+			while (ip + LZ_MIN_MATCH <= matchLimit)
+			{
+				const uint32 sequence{ LoadLZ32(ip) };
+				const uint32 h{ HashLZ(sequence) };
+				const uint8* ref{ src + table[h] };
+				table[h] = static_cast<uint32>(ip - src);
+
+				if (ref >= ip || static_cast<size_t>(ip - ref) > LZ_MAX_OFFSET || LoadLZ32(ref) != sequence)
+				{
+					ip += 1 + (misses++ >> LZ_SKIP_TRIGGER);
+					continue;
+				}
+				misses = 0;
+
+				//the bytes before often match too
+				while (ip > anchor && ref > src && ip[-1] == ref[-1])
+				{
+					--ip;
+					--ref;
+				}
+
+				const size_t length{ LZ_MIN_MATCH + CountLZMatch(ref + LZ_MIN_MATCH, ip + LZ_MIN_MATCH, matchLimit) };
+				op = WriteLZSequence(op, opEnd, anchor, static_cast<size_t>(ip - anchor), static_cast<uint32>(ip - ref), length);
+				if (!op)
+					return 0;
+
+				ip += length;
+				anchor = ip;
+				//the end of the match is the likeliest start of the next one
+				if (ip + LZ_MIN_MATCH <= matchLimit)
+					table[HashLZ(LoadLZ32(ip - 2))] = static_cast<uint32>(ip - 2 - src);
+			}
+		}
+
+		op = WriteLZSequence(op, opEnd, anchor, static_cast<size_t>(src + srcSize - anchor), 0, 0);
+		return op ? static_cast<size_t>(op - dst) : 0;
+	}
+
+	internal RE_INLINE bool ReadLZLength(const uint8*& ip, const uint8* ipEnd, size_t& length)
+	{
+		uint8 b;
+		do
+		{
+			if (ip == ipEnd)
+				return false;
+			b = *ip++;
+			length += b;
+		} while (b == 255);
+		return true;
+	}
+
+	//length bytes from offset back, may write up to 15 bytes past length
+	internal RE_INLINE void CopyLZMatch(uint8* op, const size_t offset, const size_t length)
+	{
+		const uint8* match{ op - offset };
+		if (offset >= 16)
+		{
+			for (size_t i{}; i < length; i += 16)
+				Copy16(op + i, match + i);
+			return;
+		}
+
+		//overlapping, the match repeats a short pattern. Once one whole number of periods of at least 16 bytes is
+		//written the rest can be copied 16 bytes at a time from that far back
+		const size_t period{ offset * ((15 + offset) / offset) };
+		const size_t head{ length < period ? length : period };
+		for (size_t i{}; i < head; ++i)
+			op[i] = match[i];
+		for (size_t i{ head }; i < length; i += 16)
+			Copy16(op + i, op + i - period);
+	}
+
+	internal bool DecompressLZ(const uint8* ip, const size_t srcSize, uint8* dst, const size_t dstSize)
+	{
+		const uint8* const ipEnd{ ip + srcSize };
+		uint8* op{ dst };
+		uint8* const opEnd{ dst + dstSize };
+
+		while (ip < ipEnd)
+		{
+			const uint32 token{ *ip++ };
+			size_t numLiterals{ token >> 4 };
+			size_t length{ token & LZ_RUN_MASK };
+
+			//most sequences are short: one 16 byte copy of literals and two of match, no length bytes, no bounds to check
+			//while both sides are far from the end
+			if (numLiterals < LZ_RUN_MASK && length < LZ_RUN_MASK && ipEnd - ip >= 32 && opEnd - op >= 64)
+			{
+				Copy16(op, ip);
+				op += numLiterals;
+				ip += numLiterals;
+
+				const size_t offset{ static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8) };
+				ip += 2;
+				if (offset == 0 || offset > static_cast<size_t>(op - dst))
+					return false;
+
+				length += LZ_MIN_MATCH;
+				if (offset >= 16)
+				{
+					Copy16(op, op - offset);
+					Copy16(op + 16, op - offset + 16);
+				}
+				else
+				{
+					CopyLZMatch(op, offset, length);
+				}
+				op += length;
+				continue;
+			}
+
+			if (numLiterals == LZ_RUN_MASK && !ReadLZLength(ip, ipEnd, numLiterals))
+				return false;
+			if (numLiterals > static_cast<size_t>(ipEnd - ip) || numLiterals > static_cast<size_t>(opEnd - op))
+				return false;
+
+			//overcopying is fine while both sides have room, the next sequence overwrites the excess
+			if (numLiterals + 16 <= static_cast<size_t>(opEnd - op) && numLiterals + 16 <= static_cast<size_t>(ipEnd - ip))
+			{
+				for (size_t i{}; i < numLiterals; i += 16)
+					Copy16(op + i, ip + i);
+			}
+			else
+			{
+				memcpy(op, ip, numLiterals);
+			}
+			op += numLiterals;
+			ip += numLiterals;
+
+			//the last sequence
+			if (ip == ipEnd)
+				break;
+
+			if (ipEnd - ip < 2)
+				return false;
+			const size_t offset{ static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8) };
+			ip += 2;
+			if (offset == 0 || offset > static_cast<size_t>(op - dst))
+				return false;
+
+			if (length == LZ_RUN_MASK && !ReadLZLength(ip, ipEnd, length))
+				return false;
+			length += LZ_MIN_MATCH;
+			//the format keeps LZ_LAST_LITERALS after every match, that's the room the 16 byte copies spill into
+			if (static_cast<size_t>(opEnd - op) < LZ_LAST_LITERALS || length > static_cast<size_t>(opEnd - op) - LZ_LAST_LITERALS)
+				return false;
+
+			CopyLZMatch(op, offset, length);
+			op += length;
+		}
+
+		return op == opEnd;
+	}
+
+	bool IsCompressionCodecAvailable(const eCompressionCodec codec)
+	{
+		return codec == CompressionNone || codec == CompressionLZ || (codec == CompressionDeflate && RE_ENABLE_DEFLATE);
+	}
+
+	const char* CompressionCodecName(const eCompressionCodec codec)
+	{
+		internal constexpr const char* NAMES[NUM_COMPRESSION_CODECS]{ "none", "lz", "deflate" };
+		return codec < NUM_COMPRESSION_CODECS ? NAMES[codec] : "?";
+	}
+
+	size_t CompressBound(const eCompressionCodec codec, const size_t size)
+	{
+		switch (codec)
+		{
+		case CompressionNone:		return size;
+		case CompressionLZ:			return size + size / 255 + 16;
+#if RE_ENABLE_DEFLATE
+		case CompressionDeflate:	return libdeflate_deflate_compress_bound(nullptr, size);
+#endif
+		default:					return 0;
+		}
+	}
+
+	size_t Compress(const eCompressionCodec codec, const void* src, const size_t srcSize, void* dst, const size_t dstCapacity)
+	{
+		switch (codec)
+		{
+		case CompressionNone:
+			if (srcSize > dstCapacity)
+				return 0;
+			memcpy(dst, src, srcSize);
+			return srcSize;
+
+		case CompressionLZ:
+			return CompressLZ(static_cast<const uint8*>(src), srcSize, static_cast<uint8*>(dst), dstCapacity);
+
+#if RE_ENABLE_DEFLATE
+		case CompressionDeflate:
+		{
+			libdeflate_compressor* compressor{ libdeflate_alloc_compressor(DEFLATE_LEVEL) };
+			if (!compressor)
+				return 0;
+			const size_t size{ libdeflate_deflate_compress(compressor, src, srcSize, dst, dstCapacity) };
+			libdeflate_free_compressor(compressor);
+			return size;
+		}
+#endif
+
+		default:
+			return 0;
+		}
+	}
+
+	bool Decompress(const eCompressionCodec codec, const void* src, const size_t srcSize, void* dst, const size_t dstSize)
+	{
+		switch (codec)
+		{
+		case CompressionNone:
+			if (srcSize != dstSize)
+				return false;
+			memcpy(dst, src, srcSize);
+			return true;
+
+		case CompressionLZ:
+			return DecompressLZ(static_cast<const uint8*>(src), srcSize, static_cast<uint8*>(dst), dstSize);
+
+#if RE_ENABLE_DEFLATE
+		case CompressionDeflate:
+		{
+			//a few KB, cheap next to inflating a whole block
+			libdeflate_decompressor* decompressor{ libdeflate_alloc_decompressor() };
+			if (!decompressor)
+				return false;
+			const libdeflate_result result{ libdeflate_deflate_decompress(decompressor, src, srcSize, dst, dstSize, nullptr) };
+			libdeflate_free_decompressor(decompressor);
+			return result == LIBDEFLATE_SUCCESS;
+		}
+#endif
+
+		default:
+			return false;
+		}
+	}
+
+}
@@ -0,0 +1,199 @@
+//  Filename: framePacer 
+//	Author:	Daniel														
+//	Date: 19/10/2026 00:19:55		
+//  Sqwack-Studios													
+
+#include <cmath>
+#include <cstdlib>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <sched.h>
+#endif
+
+#include "RadiantEngine/core/framePacer.h"
+#include "RadiantEngine/core/clock.h"
+
+namespace RE
+{
+
+	internal constexpr int64 MIN_SPIN_LEAD_NS{ 250000 };
+	internal constexpr int64 MAX_SPIN_LEAD_NS{ 4000000 };
+	internal constexpr int64 SPIN_LEAD_MARGIN_NS{ 200000 };
+	//adaptive mode steps down when average work goes over this fraction of the interval, and back up when it fits
+	//in the faster interval with the same margin
+	internal constexpr fp64 ADAPTIVE_HEADROOM{ 0.95 };
+
+	static_assert((FRAME_TIME_WINDOW & (FRAME_TIME_WINDOW - 1)) == 0, "FRAME_TIME_WINDOW must be a power of two");
+
+	internal void Relax()
+	{
+#if defined(_WIN32)
+		YieldProcessor();
+#else
+		sched_yield();
+#endif
+	}
+
+	internal uint32 WindowSize(const FramePacer& pacer)
+	{
+		return pacer.frameIndex < FRAME_TIME_WINDOW ? static_cast<uint32>(pacer.frameIndex) : FRAME_TIME_WINDOW;
+	}
+
+	internal int64 AverageWork(const FramePacer& pacer)
+	{
+		const uint32 n{ WindowSize(pacer) };
+		if (n == 0)
+			return 0;
+
+		int64 sum{};
+		for (uint32 i{}; i < n; ++i)
+			sum += pacer.workNs[i];
+
+		return sum / n;
+	}
+
+	//Sleeps until target minus the spin lead, then spins. Widens the lead when the OS wakes us late, narrows it slowly
+	//otherwise
+	internal void WaitUntil(FramePacer& pacer, const int64 target)
+	{
+		const int64 sleepEnd{ target - pacer.spinLeadNs };
+		int64 now{ GetTimeNs() };
+		if (sleepEnd > now)
+		{
+			SleepNs(sleepEnd - now);
+			now = GetTimeNs();
+
+			const int64 overshoot{ now - sleepEnd };
+			const int64 lead{ overshoot + SPIN_LEAD_MARGIN_NS > pacer.spinLeadNs ? overshoot + SPIN_LEAD_MARGIN_NS : pacer.spinLeadNs - pacer.spinLeadNs / 16 };
+			pacer.spinLeadNs = lead < MIN_SPIN_LEAD_NS ? MIN_SPIN_LEAD_NS : lead > MAX_SPIN_LEAD_NS ? MAX_SPIN_LEAD_NS : lead;
+		}
+
+		while (now < target)
+		{
+			Relax();
+			now = GetTimeNs();
+		}
+	}
+
+	internal void UpdateAdaptiveInterval(FramePacer& pacer)
+	{
+		const fp64 work{ static_cast<fp64>(AverageWork(pacer)) };
+		uint32 divider{ pacer.divider };
+
+		if (divider < MAX_ADAPTIVE_DIVIDER && work > static_cast<fp64>(pacer.baseIntervalNs * divider) * ADAPTIVE_HEADROOM)
+			divider++;
+		else if (divider > 1 && work < static_cast<fp64>(pacer.baseIntervalNs * (divider - 1)) * ADAPTIVE_HEADROOM * ADAPTIVE_HEADROOM)
+			divider--;
+
+		pacer.divider = divider;
+		pacer.intervalNs = pacer.baseIntervalNs * divider;
+	}
+
+	void InitFramePacer(FramePacer& pacer, const eFramePacing mode, const fp64 targetHz)
+	{
+		pacer = {};
+		pacer.spinLeadNs = 2000000;
+		pacer.lastFrame = GetTimeNs();
+		pacer.deadline = pacer.lastFrame;
+		SetFramePacing(pacer, mode, targetHz);
+	}
+
+	void SetFramePacing(FramePacer& pacer, const eFramePacing mode, const fp64 targetHz)
+	{
+		pacer.mode = mode;
+		pacer.baseIntervalNs = mode != PacingUnlocked && targetHz > 0.0 ? static_cast<int64>(1e9 / targetHz) : 0;
+		pacer.intervalNs = pacer.baseIntervalNs;
+		pacer.divider = 1;
+	}
+
+	fp64 PaceFrame(FramePacer& pacer)
+	{
+		const int64 waitStart{ GetTimeNs() };
+		const uint32 slot{ static_cast<uint32>(pacer.frameIndex & (FRAME_TIME_WINDOW - 1)) };
+		pacer.workNs[slot] = waitStart - pacer.lastFrame;
+
+		if (pacer.mode == PacingAdaptive && pacer.baseIntervalNs)
+			UpdateAdaptiveInterval(pacer);
+
+		int64 now{ waitStart };
+		if (pacer.mode != PacingUnlocked && pacer.intervalNs)
+		{
+			const int64 next{ pacer.deadline + pacer.intervalNs };
+			if (next > now)
+			{
+				WaitUntil(pacer, next);
+				pacer.deadline = next;
+				now = GetTimeNs();
+			}
+			else
+			{
+				//missed, restart the grid
+				pacer.deadline = now;
+			}
+		}
+		else
+		{
+			pacer.deadline = now;
+		}
+
+		pacer.frameNs[slot] = now - pacer.lastFrame;
+		pacer.lastFrame = now;
+		pacer.frameIndex++;
+
+		const uint32 n{ WindowSize(pacer) };
+		int64 sum{};
+		for (uint32 i{}; i < n; ++i)
+			sum += pacer.frameNs[i];
+
+		return NsToMs(sum / n);
+	}
+
+	internal int CompareNs(const void* a, const void* b)
+	{
+		const int64 x{ *static_cast<const int64*>(a) };
+		const int64 y{ *static_cast<const int64*>(b) };
+		return (x > y) - (x < y);
+	}
+
+	FrameStats GetFrameStats(const FramePacer& pacer)
+	{
+		FrameStats s{};
+		s.frameIndex = pacer.frameIndex;
+		s.targetMs = pacer.mode != PacingUnlocked ? NsToMs(pacer.intervalNs) : 0.0;
+
+		const uint32 n{ WindowSize(pacer) };
+		if (n == 0)
+			return s;
+
+		int64 sorted[FRAME_TIME_WINDOW];
+		fp64 sum{};
+		for (uint32 i{}; i < n; ++i)
+		{
+			sorted[i] = pacer.frameNs[i];
+			sum += NsToMs(pacer.frameNs[i]);
+		}
+
+		qsort(sorted, n, sizeof(int64), CompareNs);
+
+		s.averageMs = sum / n;
+		s.minMs = NsToMs(sorted[0]);
+		s.maxMs = NsToMs(sorted[n - 1]);
+		s.p99Ms = NsToMs(sorted[(n * 99 + 99) / 100 - 1]);
+		s.lastMs = NsToMs(pacer.frameNs[(pacer.frameIndex - 1) & (FRAME_TIME_WINDOW - 1)]);
+		s.workMs = NsToMs(AverageWork(pacer));
+		s.fps = s.averageMs > 0.0 ? 1000.0 / s.averageMs : 0.0;
+
+		fp64 variance{};
+		for (uint32 i{}; i < n; ++i)
+		{
+			const fp64 d{ NsToMs(pacer.frameNs[i]) - s.averageMs };
+			variance += d * d;
+		}
+		s.stdDevMs = sqrt(variance / n);
+
+		return s;
+	}
+
+}
@@ -0,0 +1,436 @@
+//  Filename: jobs 
+//	Author:	Daniel														
+//	Date: 18/10/2026 22:36:02		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstdlib>
+
+#include "RadiantEngine/core/jobs.h"
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/assert.h"
+#include "RadiantEngine/core/memoryTracker.h"
+#include "RadiantEngine/platform/thread.h"
+
+namespace RE
+{
+
+	//Chase-Lev needs every slot to be readable while the owner writes it: a thief may copy a slot that is being reused,
+	//it then loses the CAS on top and throws the copy away. Fields are relaxed atomics so that race is well defined.
+	struct JobSlot
+	{
+		std::atomic<JobFn> fn;
+		std::atomic<void*> data;
+		std::atomic<JobCounter*> counter;
+	};
+
+	struct QueuedJob
+	{
+		JobFn fn;
+		void* data;
+		JobCounter* counter;
+	};
+
+	//top and bottom on their own cache lines, thieves hammer top while the owner works on bottom
+	struct alignas(RE_CACHE_LINE_SIZE) JobDeque
+	{
+		alignas(RE_CACHE_LINE_SIZE) std::atomic<int64> top;
+		alignas(RE_CACHE_LINE_SIZE) std::atomic<int64> bottom;
+		alignas(RE_CACHE_LINE_SIZE) JobSlot slots[JOB_DEQUE_CAPACITY];
+	};
+
+	struct ParallelForRange
+	{
+		ParallelForFn fn;
+		void* data;
+		uint32 begin;
+		uint32 end;
+	};
+
+	struct JobSystem
+	{
+		JobDeque* deques;				//one per thread
+		uint32 numThreads;
+
+		//main thread jobs, multiple producers and one consumer behind a spinlock
+		QueuedJob* mainJobs;
+		uint32 mainHead;
+		uint32 mainTail;
+		std::atomic_flag mainLock;
+
+		std::atomic<uint32> numSleeping;
+		std::atomic<bool> quit;
+
+		Semaphore semaphore;
+		Thread threads[MAX_JOB_THREADS];
+	};
+
+	internal constexpr int64 DEQUE_MASK{ JOB_DEQUE_CAPACITY - 1 };
+	static_assert((JOB_DEQUE_CAPACITY & (JOB_DEQUE_CAPACITY - 1)) == 0, "deque capacity must be a power of two");
+
+	internal JobSystem jobs;
+	internal thread_local uint32 threadIndex{ INVALID_JOB_THREAD };
+	internal thread_local uint32 stealSeed;
+
+	/* Deque */
+
+	//Owner only. False when full
+	internal bool PushJob(JobDeque& d, const QueuedJob& job)
+	{
+		const int64 b{ d.bottom.load(std::memory_order_relaxed) };
+		const int64 t{ d.top.load(std::memory_order_acquire) };
+		if (b - t >= JOB_DEQUE_CAPACITY)
+			return false;
+
+		JobSlot& slot{ d.slots[b & DEQUE_MASK] };
+		slot.fn.store(job.fn, std::memory_order_relaxed);
+		slot.data.store(job.data, std::memory_order_relaxed);
+		slot.counter.store(job.counter, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		d.bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	internal QueuedJob LoadSlot(const JobSlot& slot)
+	{
+		return { .fn = slot.fn.load(std::memory_order_relaxed), .data = slot.data.load(std::memory_order_relaxed), .counter = slot.counter.load(std::memory_order_relaxed) };
+	}
+
+	//Owner only
+	internal bool PopJob(JobDeque& d, QueuedJob& job)
+	{
+		const int64 b{ d.bottom.load(std::memory_order_relaxed) - 1 };
+		d.bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64 t{ d.top.load(std::memory_order_relaxed) };
+
+		if (t > b)
+		{
+			d.bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		job = LoadSlot(d.slots[b & DEQUE_MASK]);
+		if (t == b)
+		{
+			//last job, race the thieves for it
+			const bool won{ d.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed) };
+			d.bottom.store(b + 1, std::memory_order_relaxed);
+			return won;
+		}
+
+		return true;
+	}
+
+	//Any thread
+	internal bool StealJob(JobDeque& d, QueuedJob& job)
+	{
+		int64 t{ d.top.load(std::memory_order_acquire) };
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64 b{ d.bottom.load(std::memory_order_acquire) };
+
+		if (t >= b)
+			return false;
+
+		job = LoadSlot(d.slots[t & DEQUE_MASK]);
+		return d.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+	}
+
+	/* Scheduling */
+
+	internal void Execute(const QueuedJob& job)
+	{
+		job.fn(job.data);
+		if (job.counter)
+			job.counter->value.fetch_sub(1, std::memory_order_acq_rel);
+	}
+
+	internal bool PopMainThreadJob(QueuedJob& job)
+	{
+		while (jobs.mainLock.test_and_set(std::memory_order_acquire)) {}
+
+		const bool found{ jobs.mainHead != jobs.mainTail };
+		if (found)
+			job = jobs.mainJobs[jobs.mainHead++ % MAIN_THREAD_JOB_CAPACITY];
+
+		jobs.mainLock.clear(std::memory_order_release);
+		return found;
+	}
+
+	//Own deque first, then the others starting at a random one so thieves spread out
+	internal bool FindJob(QueuedJob& job)
+	{
+		const uint32 self{ threadIndex };
+		if (PopJob(jobs.deques[self], job))
+			return true;
+
+		stealSeed = stealSeed * 1664525u + 1013904223u;
+		const uint32 start{ stealSeed % jobs.numThreads };
+		for (uint32 i{}; i < jobs.numThreads; ++i)
+		{
+			const uint32 victim{ (start + i) % jobs.numThreads };
+			if (victim != self && StealJob(jobs.deques[victim], job))
+				return true;
+		}
+
+		return false;
+	}
+
+	internal bool HasQueuedJobs()
+	{
+		for (uint32 i{}; i < jobs.numThreads; ++i)
+		{
+			const JobDeque& d{ jobs.deques[i] };
+			if (d.top.load(std::memory_order_relaxed) < d.bottom.load(std::memory_order_relaxed))
+				return true;
+		}
+
+		return false;
+	}
+
+	internal void NotifyWorkers(const uint32 numJobs)
+	{
+		//pairs with the fence in WorkerLoop: either the worker sees the new jobs or we see it sleeping
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const uint32 sleeping{ jobs.numSleeping.load(std::memory_order_relaxed) };
+		if (sleeping)
+			SignalSemaphore(jobs.semaphore, sleeping < numJobs ? sleeping : numJobs);
+	}
+
+	internal void WorkerLoop(const uint32 index)
+	{
+		threadIndex = index;
+		stealSeed = index * 0x9E3779B9u;
+
+		while (!jobs.quit.load(std::memory_order_acquire))
+		{
+			QueuedJob job;
+			if (FindJob(job))
+			{
+				Execute(job);
+				continue;
+			}
+
+			jobs.numSleeping.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (!HasQueuedJobs() && !jobs.quit.load(std::memory_order_acquire))
+				WaitSemaphore(jobs.semaphore);
+			jobs.numSleeping.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		ReleaseScratchArenas();
+	}
+
+	internal void WorkerEntry(void* param)
+	{
+		WorkerLoop(static_cast<uint32>(reinterpret_cast<uintptr_t>(param)));
+	}
+
+	internal void FreeJobSystem()
+	{
+		TrackedFree(jobs.deques);
+		TrackedFree(jobs.mainJobs);
+
+		jobs.deques = nullptr;
+		jobs.mainJobs = nullptr;
+		jobs.numThreads = 0;
+	}
+
+	//Threads [1, numStarted) are running workers
+	internal void StopWorkers(const uint32 numStarted)
+	{
+		jobs.quit.store(true, std::memory_order_release);
+		SignalSemaphore(jobs.semaphore, numStarted);
+
+		for (uint32 i{ 1 }; i < numStarted; ++i)
+			JoinThread(jobs.threads[i]);
+
+		ShutdownSemaphore(jobs.semaphore);
+	}
+
+	/* API */
+
+	bool InitJobSystem(const uint32 numThreads)
+	{
+		uint32 n{ numThreads ? numThreads : GetNumCores() };
+		n = n > MAX_JOB_THREADS ? MAX_JOB_THREADS : n;
+
+		//aligned for the cache line padding inside JobDeque
+		jobs.deques = static_cast<JobDeque*>(TrackedAlloc(MemoryTagJobs, sizeof(JobDeque) * n, alignof(JobDeque)));
+		jobs.mainJobs = static_cast<QueuedJob*>(TrackedAlloc(MemoryTagJobs, sizeof(QueuedJob) * MAIN_THREAD_JOB_CAPACITY));
+		if (!jobs.deques || !jobs.mainJobs || !InitSemaphore(jobs.semaphore, 0))
+		{
+			FreeJobSystem();
+			return false;
+		}
+
+		for (uint32 i{}; i < n; ++i)
+		{
+			jobs.deques[i].top.store(0, std::memory_order_relaxed);
+			jobs.deques[i].bottom.store(0, std::memory_order_relaxed);
+		}
+
+		jobs.numThreads = n;
+		jobs.mainHead = 0;
+		jobs.mainTail = 0;
+		jobs.numSleeping.store(0, std::memory_order_relaxed);
+		jobs.quit.store(false, std::memory_order_relaxed);
+
+		threadIndex = 0;
+		stealSeed = 1;
+
+		for (uint32 i{ 1 }; i < n; ++i)
+		{
+			if (!StartThread(jobs.threads[i], WorkerEntry, reinterpret_cast<void*>(static_cast<uintptr_t>(i))))
+			{
+				StopWorkers(i);
+				FreeJobSystem();
+				threadIndex = INVALID_JOB_THREAD;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void ShutdownJobSystem()
+	{
+		StopWorkers(jobs.numThreads);
+		FreeJobSystem();
+	}
+
+	uint32 GetNumJobThreads()
+	{
+		return jobs.numThreads;
+	}
+
+	uint32 GetJobThreadIndex()
+	{
+		return threadIndex;
+	}
+
+	void RunJobs(const Job* list, const uint32 num, JobCounter* counter)
+	{
+		RE_ASSERT(threadIndex != INVALID_JOB_THREAD);
+
+		if (counter)
+			counter->value.fetch_add(num, std::memory_order_relaxed);
+
+		JobDeque& d{ jobs.deques[threadIndex] };
+		for (uint32 i{}; i < num; ++i)
+		{
+			const QueuedJob job{ .fn = list[i].fn, .data = list[i].data, .counter = counter };
+			if (!PushJob(d, job))
+				Execute(job);
+		}
+
+		NotifyWorkers(num);
+	}
+
+	void RunMainThreadJobs(const Job* list, const uint32 num, JobCounter* counter)
+	{
+		if (counter)
+			counter->value.fetch_add(num, std::memory_order_relaxed);
+
+		for (uint32 i{}; i < num; )
+		{
+			while (jobs.mainLock.test_and_set(std::memory_order_acquire)) {}
+
+			for (; i < num && jobs.mainTail - jobs.mainHead < MAIN_THREAD_JOB_CAPACITY; ++i)
+				jobs.mainJobs[jobs.mainTail++ % MAIN_THREAD_JOB_CAPACITY] = { .fn = list[i].fn, .data = list[i].data, .counter = counter };
+
+			jobs.mainLock.clear(std::memory_order_release);
+
+			//full, the main thread has to catch up
+			if (i < num)
+			{
+				if (threadIndex == 0)
+					RunPendingMainThreadJobs();
+				else
+					YieldThread();
+			}
+		}
+	}
+
+	void RunPendingMainThreadJobs()
+	{
+		RE_ASSERT(threadIndex == 0);
+
+		QueuedJob job;
+		while (PopMainThreadJob(job))
+			Execute(job);
+	}
+
+	void WaitForCounter(const JobCounter* counter, const uint32 value)
+	{
+		RE_ASSERT(threadIndex != INVALID_JOB_THREAD);
+
+		uint32 spins{};
+		while (counter->value.load(std::memory_order_acquire) > value)
+		{
+			QueuedJob job;
+			if ((threadIndex == 0 && PopMainThreadJob(job)) || FindJob(job))
+			{
+				Execute(job);
+				spins = 0;
+			}
+			else if (++spins > 64)
+			{
+				//the remaining jobs are running somewhere else
+				YieldThread();
+			}
+		}
+	}
+
+	internal void RunParallelForRange(void* data)
+	{
+		const ParallelForRange& range{ *static_cast<const ParallelForRange*>(data) };
+		range.fn(range.data, range.begin, range.end);
+	}
+
+	void ParallelFor(const uint32 count, const uint32 minChunk, ParallelForFn fn, void* data)
+	{
+		if (count == 0)
+			return;
+
+		//nothing to spread the chunks over before InitJobSystem or after ShutdownJobSystem
+		if (jobs.numThreads == 0)
+		{
+			fn(data, 0, count);
+			return;
+		}
+		RE_ASSERT(threadIndex != INVALID_JOB_THREAD);
+
+		//a few chunks per thread so threads that finish early can steal the rest
+		const uint32 maxChunks{ jobs.numThreads * 4 };
+		uint32 chunk{ (count + maxChunks - 1) / maxChunks };
+		chunk = chunk < minChunk ? minChunk : chunk;
+		chunk = chunk ? chunk : 1;
+		const uint32 numChunks{ (count + chunk - 1) / chunk };
+
+		if (numChunks == 1)
+		{
+			fn(data, 0, count);
+			return;
+		}
+
+		//ranges live on the scratch arena until every chunk is done, jobs run while waiting rewind their own scratch
+		const ScratchArena scratch{ BeginScratch() };
+		ParallelForRange* ranges{ PushArray<ParallelForRange>(*scratch.arena, numChunks) };
+		Job* list{ PushArray<Job>(*scratch.arena, numChunks) };
+
+		for (uint32 i{}; i < numChunks; ++i)
+		{
+			const uint32 begin{ i * chunk };
+			ranges[i] = { .fn = fn, .data = data, .begin = begin, .end = begin + chunk < count ? begin + chunk : count };
+			list[i] = { .fn = RunParallelForRange, .data = &ranges[i] };
+		}
+
+		JobCounter counter{};
+		RunJobs(list, numChunks, &counter);
+		WaitForCounter(&counter);
+
+		EndScratch(scratch);
+	}
+
+}
@@ -0,0 +1,862 @@
+//  Filename: log 
+//	Author:	Daniel														
+//	Date: 19/10/2026 02:07:41		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include "RadiantEngine/core/log.h"
+#include "RadiantEngine/core/clock.h"
+#include "RadiantEngine/core/hashMap.h"
+#include "RadiantEngine/core/memoryTracker.h"
+#include "RadiantEngine/platform/thread.h"
+
+namespace RE
+{
+
+	//Records in a thread ring, 8 byte aligned. site == nullptr pads the end of the ring when a record doesn't fit there
+	struct LogRecordHeader
+	{
+		const LogSite* site;
+		uint64 ticks;
+		uint32 size;		//header included
+		uint32 numArgs;
+	};
+
+	//A slot is claimed by a thread's first message and retired when that thread exits. The backend writes what a retired
+	//slot still holds and frees it for the next thread; the ring buffer stays allocated until ShutdownLog
+	enum eLogSlot : uint32
+	{
+		LogSlotFree = 0,
+		LogSlotClaimed,		//being set up by its new owner
+		LogSlotOwned,
+		LogSlotRetired,
+	};
+
+	//Single producer (the owner) single consumer (the backend) byte ring
+	struct LogThread
+	{
+		alignas(RE_CACHE_LINE_SIZE) std::atomic<uint64> head;	//backend
+		alignas(RE_CACHE_LINE_SIZE) std::atomic<uint64> tail;	//owner
+		uint64 cachedHead;
+		uint8* buffer;
+		std::atomic<uint32> state;
+	};
+
+	struct Log
+	{
+		LogThread threads[MAX_LOG_THREADS];
+		std::atomic<uint32> session;		//bumped by InitLog, older thread registrations are stale
+
+		std::atomic<bool> running;
+		std::atomic<bool> quit;
+		std::atomic<uint64> flushRequests;
+		std::atomic<uint64> flushesDone;
+		eLogLevel minLevel;
+
+		Thread backend;
+
+		//backend only
+		bool console;
+		FILE* text;
+		FILE* binary;
+		HashMap<const LogSite*, uint32> siteIds;
+		uint32 numSites;
+		char* line;
+
+		//ticks -> ns calibration point
+		uint64 startTicks;
+		int64 startNs;
+		int64 startTimeOfDayNs;
+	};
+
+	internal constexpr uint64 LOG_BUFFER_MASK{ LOG_THREAD_BUFFER_SIZE - 1 };
+	static_assert((LOG_THREAD_BUFFER_SIZE & LOG_BUFFER_MASK) == 0, "LOG_THREAD_BUFFER_SIZE must be a power of two");
+
+	internal constexpr int64 NS_PER_DAY{ 86400ll * 1000000000ll };
+	internal constexpr int64 LOG_BACKEND_SLEEP_NS{ 1000000 };
+
+	internal constexpr uint32 MAX_LOG_RECORD_SIZE{ LOG_THREAD_BUFFER_SIZE / 2 };
+
+	internal Log logger;
+	internal LogThread noLogThread;
+
+	//The calling thread's slot, retired when the thread exits
+	struct LogThreadOwner
+	{
+		LogThread* thread;		//nullptr until the first message, &noLogThread when every slot is taken
+		uint32 session;
+
+		~LogThreadOwner()
+		{
+			if (thread && thread != &noLogThread && session == logger.session.load(std::memory_order_acquire) && logger.running.load(std::memory_order_acquire))
+				thread->state.store(LogSlotRetired, std::memory_order_release);
+		}
+	};
+
+	internal thread_local LogThreadOwner logThread;
+
+	internal RE_INLINE uint64 ReadLogTicks()
+	{
+#if defined(_MSC_VER) || defined(__x86_64__)
+		return __rdtsc();
+#else
+		return static_cast<uint64>(GetTimeNs());
+#endif
+	}
+
+
+	const char* LogLevelName(const eLogLevel level)
+	{
+		internal constexpr const char* NAMES[NUM_LOG_LEVELS]{ "TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "CRITICAL" };
+		return level < NUM_LOG_LEVELS ? NAMES[level] : "?";
+	}
+
+	/* Frontend */
+
+	//nullptr when no slot is free, &noLogThread when its ring can't be allocated
+	internal LogThread* ClaimLogSlot()
+	{
+		for (LogThread& t : logger.threads)
+		{
+			uint32 expected{ LogSlotFree };
+			if (t.state.load(std::memory_order_relaxed) != LogSlotFree || !t.state.compare_exchange_strong(expected, LogSlotClaimed, std::memory_order_acq_rel))
+				continue;
+
+			//the backend doesn't touch a claimed slot, a free one has been drained completely
+			if (!t.buffer)
+				t.buffer = static_cast<uint8*>(TrackedAlloc(MemoryTagLogging, LOG_THREAD_BUFFER_SIZE, RE_CACHE_LINE_SIZE));
+			if (!t.buffer)
+			{
+				t.state.store(LogSlotFree, std::memory_order_release);
+				return &noLogThread;
+			}
+
+			t.head.store(0, std::memory_order_relaxed);
+			t.tail.store(0, std::memory_order_relaxed);
+			t.cachedHead = 0;
+			t.state.store(LogSlotOwned, std::memory_order_release);
+			return &t;
+		}
+
+		return nullptr;
+	}
+
+	internal LogThread* RegisterLogThread()
+	{
+		for (;;)
+		{
+			LogThread* slot{ ClaimLogSlot() };
+			if (slot)
+				return slot;
+
+			//every slot is taken; a retired one is free again as soon as the backend writes it out
+			bool retired{};
+			for (const LogThread& t : logger.threads)
+				retired |= t.state.load(std::memory_order_relaxed) == LogSlotRetired;
+			if (!retired)
+				return &noLogThread;
+
+			YieldThread();
+		}
+	}
+
+	internal RE_INLINE uint32 ArgPayloadSize(const LogArg& arg)
+	{
+		switch (arg.type)
+		{
+		case LogArgString:	return 1 + sizeof(uint32) + arg.length;
+		case LogArgWString:	return 1 + sizeof(uint32) + arg.length * static_cast<uint32>(sizeof(wchar_t));
+		default:			return 1 + sizeof(uint64);
+		}
+	}
+
+	//Characters of a string argument that fit in budget bytes, budget shrinks by what they take
+	internal RE_INLINE uint32 FitArgLength(const LogArg& arg, uint32& budget)
+	{
+		const uint32 charSize{ arg.type == LogArgWString ? static_cast<uint32>(sizeof(wchar_t)) : 1u };
+		const uint32 length{ arg.length < budget / charSize ? arg.length : budget / charSize };
+		budget -= length * charSize;
+		return length;
+	}
+
+	//String arguments are cut to stringBudget bytes between them
+	internal LogArg FitArg(const LogArg& arg, uint32& stringBudget)
+	{
+		LogArg fitted{ arg };
+		if (arg.type == LogArgString || arg.type == LogArgWString)
+			fitted.length = FitArgLength(arg, stringBudget);
+		return fitted;
+	}
+
+	internal uint32 LogRecordSize(const LogArg* args, const uint32 numArgs, uint32 stringBudget)
+	{
+		uint32 size{ sizeof(LogRecordHeader) };
+		for (uint32 i{}; i < numArgs; ++i)
+			size += ArgPayloadSize(FitArg(args[i], stringBudget));
+		return size;
+	}
+
+	internal RE_INLINE uint8* EncodeArg(uint8* p, const LogArg& arg)
+	{
+		*p++ = arg.type;
+		switch (arg.type)
+		{
+		case LogArgString:
+			memcpy(p, &arg.length, sizeof(uint32));
+			memcpy(p + sizeof(uint32), arg.s, arg.length);
+			return p + sizeof(uint32) + arg.length;
+		case LogArgWString:
+			memcpy(p, &arg.length, sizeof(uint32));
+			memcpy(p + sizeof(uint32), arg.ws, arg.length * sizeof(wchar_t));
+			return p + sizeof(uint32) + arg.length * sizeof(wchar_t);
+		default:
+			memcpy(p, &arg.u, sizeof(uint64));
+			return p + sizeof(uint64);
+		}
+	}
+
+	internal void WaitForFlush()
+	{
+		const uint64 request{ logger.flushRequests.fetch_add(1, std::memory_order_acq_rel) + 1 };
+		while (logger.running.load(std::memory_order_acquire) && logger.flushesDone.load(std::memory_order_acquire) < request)
+			YieldThread();
+	}
+
+	void LogWriteArgs(const LogSite& site, const LogArg* args, const uint32 numArgs)
+	{
+		if (site.level < logger.minLevel || !logger.running.load(std::memory_order_relaxed))
+			return;
+
+		//first message of this thread, the first since a ShutdownLog/InitLog pair reset every slot, or every slot was taken
+		const uint32 session{ logger.session.load(std::memory_order_relaxed) };
+		if (!logThread.thread || logThread.thread == &noLogThread || logThread.session != session)
+		{
+			logThread.thread = RegisterLogThread();
+			logThread.session = session;
+		}
+
+		LogThread* t{ logThread.thread };
+		if (!t->buffer)
+			return;
+
+		const uint64 ticks{ ReadLogTicks() };
+
+		//a record over half the ring might never find room, its strings are cut to fit instead
+		uint32 stringBudget{ 0xFFFFFFFF };
+		uint32 size{ LogRecordSize(args, numArgs, stringBudget) };
+		if (size > MAX_LOG_RECORD_SIZE - 7)
+		{
+			const uint32 fixedSize{ LogRecordSize(args, numArgs, 0) };
+			if (fixedSize > MAX_LOG_RECORD_SIZE - 7)
+				return;
+
+			stringBudget = MAX_LOG_RECORD_SIZE - 7 - fixedSize;
+			size = LogRecordSize(args, numArgs, stringBudget);
+		}
+		size = (size + 7) & ~7u;
+
+		//a record never wraps, the end of the ring is padded instead
+		const uint64 tail{ t->tail.load(std::memory_order_relaxed) };
+		const uint32 offset{ static_cast<uint32>(tail & LOG_BUFFER_MASK) };
+		const uint32 untilEnd{ LOG_THREAD_BUFFER_SIZE - offset };
+		const uint32 padding{ untilEnd < size ? untilEnd : 0 };
+
+		while (tail + padding + size - t->cachedHead > LOG_THREAD_BUFFER_SIZE)
+		{
+			t->cachedHead = t->head.load(std::memory_order_acquire);
+			if (tail + padding + size - t->cachedHead <= LOG_THREAD_BUFFER_SIZE)
+				break;
+
+			if (!logger.running.load(std::memory_order_relaxed))
+				return;
+
+			YieldThread();
+		}
+
+		if (padding >= sizeof(LogRecordHeader))
+		{
+			const LogRecordHeader pad{ .site = nullptr, .ticks = 0, .size = padding, .numArgs = 0 };
+			memcpy(t->buffer + offset, &pad, sizeof(pad));
+		}
+
+		uint8* record{ t->buffer + ((tail + padding) & LOG_BUFFER_MASK) };
+		const LogRecordHeader header{ .site = &site, .ticks = ticks, .size = size, .numArgs = numArgs };
+		memcpy(record, &header, sizeof(header));
+
+		uint8* p{ record + sizeof(header) };
+		for (uint32 i{}; i < numArgs; ++i)
+			p = EncodeArg(p, FitArg(args[i], stringBudget));
+
+		t->tail.store(tail + padding + size, std::memory_order_release);
+
+		if (site.level == LogLevelCritical)
+			WaitForFlush();
+	}
+
+	/* Formatting */
+
+	struct LogLineWriter
+	{
+		char* data;
+		uint32 num;
+		uint32 cap;
+
+		RE_INLINE void put(const char c)
+		{
+			if (num + 1 < cap)
+				data[num++] = c;
+		}
+
+		RE_INLINE void put(const char* s, const size_t n)
+		{
+			const size_t count{ num + n + 1 < cap ? n : (cap > num + 1 ? cap - num - 1 : 0) };
+			memcpy(data + num, s, count);
+			num += static_cast<uint32>(count);
+		}
+
+		void print(const char* format, ...)
+		{
+			if (num + 1 >= cap)
+				return;
+
+			va_list args;
+			va_start(args, format);
+			const int n{ vsnprintf(data + num, cap - num, format, args) };
+			va_end(args);
+
+			if (n > 0)
+				num += static_cast<uint32>(n) < cap - num ? static_cast<uint32>(n) : cap - num - 1;
+		}
+	};
+
+	//UTF-16 (wcharSize 2) or UTF-32 (4) to UTF-8
+	internal void PutWide(LogLineWriter& out, const uint8* units, const uint32 count, const uint32 wcharSize)
+	{
+		for (uint32 i{}; i < count; ++i)
+		{
+			uint32 c{};
+			if (wcharSize == 2)
+			{
+				uint16 u;
+				memcpy(&u, units + i * 2, 2);
+				c = u;
+				if (c >= 0xD800 && c < 0xDC00 && i + 1 < count)
+				{
+					uint16 low;
+					memcpy(&low, units + (i + 1) * 2, 2);
+					if (low >= 0xDC00 && low < 0xE000)
+					{
+						c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+						++i;
+					}
+				}
+			}
+			else
+			{
+				memcpy(&c, units + i * 4, 4);
+			}
+
+			if (c < 0x80)
+			{
+				out.put(static_cast<char>(c));
+			}
+			else if (c < 0x800)
+			{
+				out.put(static_cast<char>(0xC0 | (c >> 6)));
+				out.put(static_cast<char>(0x80 | (c & 0x3F)));
+			}
+			else if (c < 0x10000)
+			{
+				out.put(static_cast<char>(0xE0 | (c >> 12)));
+				out.put(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+				out.put(static_cast<char>(0x80 | (c & 0x3F)));
+			}
+			else
+			{
+				out.put(static_cast<char>(0xF0 | (c >> 18)));
+				out.put(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+				out.put(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+				out.put(static_cast<char>(0x80 | (c & 0x3F)));
+			}
+		}
+	}
+
+	//Formats one argument and returns the payload past it, nullptr when the payload is malformed
+	internal const uint8* FormatArg(LogLineWriter& out, const uint8* p, const uint8* end, const uint32 wcharSize)
+	{
+		if (p >= end)
+			return nullptr;
+
+		const eLogArg type{ static_cast<eLogArg>(*p++) };
+		if (type == LogArgString || type == LogArgWString)
+		{
+			uint32 length;
+			if (end - p < static_cast<ptrdiff_t>(sizeof(uint32)))
+				return nullptr;
+
+			memcpy(&length, p, sizeof(uint32));
+			p += sizeof(uint32);
+
+			const uint64 bytes{ type == LogArgString ? length : static_cast<uint64>(length) * wcharSize };
+			if (static_cast<uint64>(end - p) < bytes)
+				return nullptr;
+
+			if (type == LogArgString)
+				out.put(reinterpret_cast<const char*>(p), length);
+			else
+				PutWide(out, p, length, wcharSize);
+
+			return p + bytes;
+		}
+
+		if (end - p < static_cast<ptrdiff_t>(sizeof(uint64)))
+			return nullptr;
+
+		uint64 u;
+		memcpy(&u, p, sizeof(uint64));
+
+		switch (type)
+		{
+		case LogArgInt:		out.print("%lld", static_cast<long long>(u)); break;
+		case LogArgUInt:	out.print("%llu", static_cast<unsigned long long>(u)); break;
+		case LogArgFloat:	{ fp64 f; memcpy(&f, &u, sizeof(f)); out.print("%g", f); } break;
+		case LogArgBool:	out.put(u ? "true" : "false", u ? 4 : 5); break;
+		case LogArgChar:	out.put(static_cast<char>(u)); break;
+		case LogArgPointer:	out.print("0x%016llx", static_cast<unsigned long long>(u)); break;
+		default:			return nullptr;
+		}
+
+		return p + sizeof(uint64);
+	}
+
+	//Replaces each {} (anything between the braces is ignored) with the next argument, {{ and }} are literal braces.
+	//Placeholders without an argument are printed as they are, extra arguments are dropped
+	internal void FormatMessage(LogLineWriter& out, const char* format, const uint8* payload, const uint32 payloadSize, const uint32 numArgs, const uint32 wcharSize)
+	{
+		const uint8* p{ payload };
+		const uint8* end{ payload + payloadSize };
+		uint32 argsLeft{ numArgs };
+
+		for (const char* c{ format }; *c; ++c)
+		{
+			if (c[0] == '{' && c[1] == '{')
+			{
+				out.put('{');
+				++c;
+				continue;
+			}
+
+			if (c[0] == '}' && c[1] == '}')
+			{
+				out.put('}');
+				++c;
+				continue;
+			}
+
+			const char* close{ c[0] == '{' ? strchr(c, '}') : nullptr };
+			if (!close || argsLeft == 0 || !p)
+			{
+				out.put(*c);
+				continue;
+			}
+
+			p = FormatArg(out, p, end, wcharSize);
+			--argsLeft;
+			c = close;
+		}
+	}
+
+	//"HH:MM:SS.mmm [thread] LEVEL message\n"
+	internal void FormatLine(LogLineWriter& out, const int64 timeOfDayNs, const uint32 thread, const eLogLevel level,
+		const char* format, const uint8* payload, const uint32 payloadSize, const uint32 numArgs, const uint32 wcharSize)
+	{
+		const int64 dayNs{ ((timeOfDayNs % NS_PER_DAY) + NS_PER_DAY) % NS_PER_DAY };
+		const int64 ms{ dayNs / 1000000 };
+		out.print("%02lld:%02lld:%02lld.%03lld [%u] %-8s ", ms / 3600000, (ms / 60000) % 60, (ms / 1000) % 60, ms % 1000, thread, LogLevelName(level));
+		FormatMessage(out, format, payload, payloadSize, numArgs, wcharSize);
+
+		//always room for the newline
+		if (out.num + 1 >= out.cap)
+			out.num = out.cap - 2;
+		out.put('\n');
+	}
+
+	/* Backend */
+
+	struct LogTickConversion
+	{
+		fp64 nsPerTick;
+	};
+
+	internal LogTickConversion CalibrateLogTicks()
+	{
+#if defined(_MSC_VER) || defined(__x86_64__)
+		const int64 nowNs{ GetTimeNs() };
+		const uint64 nowTicks{ ReadLogTicks() };
+		if (nowTicks == logger.startTicks)
+			return { 0.0 };
+
+		return { static_cast<fp64>(nowNs - logger.startNs) / static_cast<fp64>(nowTicks - logger.startTicks) };
+#else
+		return { 1.0 };
+#endif
+	}
+
+	internal void WriteSite(const LogSite* site, const uint32 id)
+	{
+		const uint32 fileLength{ static_cast<uint32>(strlen(site->file)) };
+		const uint32 formatLength{ static_cast<uint32>(strlen(site->format)) };
+		const LogFileSite record{ .kind = LogFileRecordSite, .id = id, .level = site->level, .line = site->line, .fileLength = fileLength, .formatLength = formatLength };
+		fwrite(&record, sizeof(record), 1, logger.binary);
+		fwrite(site->file, 1, fileLength, logger.binary);
+		fwrite(site->format, 1, formatLength, logger.binary);
+	}
+
+	internal void WriteRecord(const LogRecordHeader& header, const uint32 thread, const LogTickConversion conversion)
+	{
+		const int64 timeNs{ static_cast<int64>(static_cast<fp64>(static_cast<int64>(header.ticks - logger.startTicks)) * conversion.nsPerTick) };
+		const uint8* payload{ reinterpret_cast<const uint8*>(&header + 1) };
+
+		//the tail is padding, the payload ends at its last argument
+		uint32 payloadSize{};
+		{
+			const uint8* p{ payload };
+			for (uint32 i{}; i < header.numArgs; ++i)
+			{
+				const eLogArg type{ static_cast<eLogArg>(*p) };
+				uint32 length{};
+				if (type == LogArgString || type == LogArgWString)
+					memcpy(&length, p + 1, sizeof(uint32));
+
+				LogArg arg{};
+				arg.type = type;
+				arg.length = length;
+				p += ArgPayloadSize(arg);
+			}
+			payloadSize = static_cast<uint32>(p - payload);
+		}
+
+		if (logger.console || logger.text)
+		{
+			LogLineWriter out{ .data = logger.line, .num = 0, .cap = LOG_MAX_LINE_LENGTH };
+			FormatLine(out, logger.startTimeOfDayNs + timeNs, thread, header.site->level, header.site->format, payload, payloadSize, header.numArgs, sizeof(wchar_t));
+
+			if (logger.console)
+				fwrite(out.data, 1, out.num, header.site->level >= LogLevelError ? stderr : stdout);
+			if (logger.text)
+				fwrite(out.data, 1, out.num, logger.text);
+		}
+
+		if (logger.binary)
+		{
+			bool added;
+			uint32* id{ logger.siteIds.findOrAdd(header.site, added) };
+			if (!id)
+				return;
+
+			if (added)
+			{
+				*id = logger.numSites++;
+				WriteSite(header.site, *id);
+			}
+
+			const LogFileMessage record{ .kind = LogFileRecordMessage, .siteId = *id, .thread = thread, .numArgs = header.numArgs, .timeNs = timeNs, .payloadSize = payloadSize, .reserved = 0 };
+			fwrite(&record, sizeof(record), 1, logger.binary);
+			fwrite(payload, 1, payloadSize, logger.binary);
+		}
+	}
+
+	//Writes everything a thread queued so far. Returns how many records it wrote
+	internal uint32 DrainThread(LogThread& t, const uint32 thread, const LogTickConversion conversion)
+	{
+		uint64 head{ t.head.load(std::memory_order_relaxed) };
+		const uint64 tail{ t.tail.load(std::memory_order_acquire) };
+
+		uint32 num{};
+		while (head != tail)
+		{
+			const uint32 offset{ static_cast<uint32>(head & LOG_BUFFER_MASK) };
+			const uint32 untilEnd{ LOG_THREAD_BUFFER_SIZE - offset };
+			if (untilEnd < sizeof(LogRecordHeader))
+			{
+				head += untilEnd;
+				continue;
+			}
+
+			const LogRecordHeader& header{ *reinterpret_cast<const LogRecordHeader*>(t.buffer + offset) };
+			if (header.site)
+			{
+				WriteRecord(header, thread, conversion);
+				++num;
+			}
+
+			head += header.size;
+			t.head.store(head, std::memory_order_release);
+		}
+
+		t.head.store(head, std::memory_order_release);
+		return num;
+	}
+
+	internal uint32 DrainAll()
+	{
+		const LogTickConversion conversion{ CalibrateLogTicks() };
+
+		uint32 num{};
+		for (uint32 i{}; i < MAX_LOG_THREADS; ++i)
+		{
+			//a retired owner has exited, once drained nothing more can arrive
+			LogThread& t{ logger.threads[i] };
+			const uint32 state{ t.state.load(std::memory_order_acquire) };
+			if (state == LogSlotOwned || state == LogSlotRetired)
+				num += DrainThread(t, i, conversion);
+			if (state == LogSlotRetired)
+				t.state.store(LogSlotFree, std::memory_order_release);
+		}
+
+		if (num)
+		{
+			if (logger.console)
+			{
+				fflush(stdout);
+				fflush(stderr);
+			}
+			if (logger.text)
+				fflush(logger.text);
+			if (logger.binary)
+				fflush(logger.binary);
+		}
+
+		return num;
+	}
+
+	internal void RunBackend(void*)
+	{
+		//the tick rate is measured over the time since InitLog, give it a few ms before the first conversion
+		SleepNs(10000000);
+
+		for (;;)
+		{
+			//read before draining: everything logged before the request is in the rings by now
+			const uint64 requests{ logger.flushRequests.load(std::memory_order_acquire) };
+			const bool quit{ logger.quit.load(std::memory_order_acquire) };
+
+			const uint32 num{ DrainAll() };
+			logger.flushesDone.store(requests, std::memory_order_release);
+
+			if (quit)
+				break;
+
+			if (num == 0 && logger.flushRequests.load(std::memory_order_relaxed) == requests)
+				SleepNs(LOG_BACKEND_SLEEP_NS);
+		}
+	}
+
+	internal void CloseLogSinks()
+	{
+		if (logger.text)
+			fclose(logger.text);
+		if (logger.binary)
+			fclose(logger.binary);
+
+		TrackedFree(logger.line);
+		logger.siteIds.release();
+		logger.text = nullptr;
+		logger.binary = nullptr;
+		logger.line = nullptr;
+	}
+
+	bool InitLog(const LogConfig& config)
+	{
+		if (logger.running.load(std::memory_order_relaxed))
+			return false;
+
+		logger.console = config.console;
+		logger.text = config.textPath ? fopen(config.textPath, "wb") : nullptr;
+		logger.binary = config.binaryPath ? fopen(config.binaryPath, "wb") : nullptr;
+		logger.minLevel = config.minLevel;
+		logger.line = static_cast<char*>(TrackedAlloc(MemoryTagLogging, LOG_MAX_LINE_LENGTH));
+		logger.siteIds = {};
+		logger.siteIds.init(256, TaggedAllocator(MemoryTagLogging));
+		logger.numSites = 0;
+		if ((config.textPath && !logger.text) || (config.binaryPath && !logger.binary) || !logger.line)
+		{
+			CloseLogSinks();
+			return false;
+		}
+
+		logger.startTicks = ReadLogTicks();
+		logger.startNs = GetTimeNs();
+		{
+			timespec now;
+			timespec_get(&now, TIME_UTC);
+			const time_t seconds{ now.tv_sec };
+			const tm local{ *localtime(&seconds) };
+			logger.startTimeOfDayNs = (local.tm_hour * 3600ll + local.tm_min * 60ll + local.tm_sec) * 1000000000ll + now.tv_nsec;
+		}
+
+		if (logger.binary)
+		{
+			const LogFileHeader header{ .magic = LOG_FILE_MAGIC, .version = LOG_FILE_VERSION, .wcharSize = sizeof(wchar_t), .reserved = 0, .startTimeOfDayNs = logger.startTimeOfDayNs };
+			fwrite(&header, sizeof(header), 1, logger.binary);
+		}
+
+		logger.session.fetch_add(1, std::memory_order_relaxed);
+		logger.quit.store(false, std::memory_order_relaxed);
+		logger.flushRequests.store(0, std::memory_order_relaxed);
+		logger.flushesDone.store(0, std::memory_order_relaxed);
+
+		//producers only queue once running is set, so nothing is waiting on a backend that never started
+		if (!StartThread(logger.backend, RunBackend, nullptr))
+		{
+			CloseLogSinks();
+			return false;
+		}
+
+		logger.running.store(true, std::memory_order_release);
+		return true;
+	}
+
+	void ShutdownLog()
+	{
+		if (!logger.running.load(std::memory_order_relaxed))
+			return;
+
+		logger.quit.store(true, std::memory_order_release);
+		JoinThread(logger.backend);
+		logger.running.store(false, std::memory_order_release);
+
+		//threads that logged this session register again after the next InitLog, see logThread.session
+		for (LogThread& t : logger.threads)
+		{
+			TrackedFree(t.buffer);
+			t.buffer = nullptr;
+			t.state.store(LogSlotFree, std::memory_order_relaxed);
+		}
+
+		logThread.thread = nullptr;
+
+		CloseLogSinks();
+	}
+
+	void FlushLog()
+	{
+		if (logger.running.load(std::memory_order_relaxed))
+			WaitForFlush();
+	}
+
+	/* Decoding */
+
+	struct DecodedLogSite
+	{
+		eLogLevel level;
+		char* format;
+	};
+
+	bool DecodeBinaryLog(const char* inPath, FILE* out)
+	{
+		FILE* in{ fopen(inPath, "rb") };
+		if (!in)
+			return false;
+
+		LogFileHeader header;
+		if (fread(&header, sizeof(header), 1, in) != 1 || header.magic != LOG_FILE_MAGIC || header.version != LOG_FILE_VERSION ||
+			(header.wcharSize != 2 && header.wcharSize != 4))
+		{
+			fclose(in);
+			return false;
+		}
+
+		HashMap<uint32, DecodedLogSite> sites{};
+		sites.init(256, TaggedAllocator(MemoryTagLogging));
+
+		char* line{ static_cast<char*>(TrackedAlloc(MemoryTagLogging, LOG_MAX_LINE_LENGTH)) };
+		uint8* payload{ nullptr };
+		uint32 payloadCap{};
+		bool ok{ line != nullptr };
+
+		uint32 kind;
+		while (ok && fread(&kind, sizeof(kind), 1, in) == 1)
+		{
+			if (kind == LogFileRecordSite)
+			{
+				LogFileSite site{};
+				site.kind = kind;
+				if (fread(&site.id, sizeof(site) - sizeof(kind), 1, in) != 1 || fseek(in, site.fileLength, SEEK_CUR) != 0)
+				{
+					ok = false;
+					break;
+				}
+
+				char* format{ static_cast<char*>(TrackedAlloc(MemoryTagLogging, site.formatLength + 1)) };
+				bool added;
+				DecodedLogSite* decoded{ sites.findOrAdd(site.id, added) };
+				if (!format || !decoded || fread(format, 1, site.formatLength, in) != site.formatLength)
+				{
+					TrackedFree(format);
+					ok = false;
+					break;
+				}
+
+				format[site.formatLength] = '\0';
+				if (!added)
+					TrackedFree(decoded->format);
+
+				*decoded = { .level = static_cast<eLogLevel>(site.level), .format = format };
+			}
+			else if (kind == LogFileRecordMessage)
+			{
+				LogFileMessage message{};
+				message.kind = kind;
+				if (fread(&message.siteId, sizeof(message) - sizeof(kind), 1, in) != 1)
+				{
+					ok = false;
+					break;
+				}
+
+				if (message.payloadSize > payloadCap)
+				{
+					TrackedFree(payload);
+					payloadCap = message.payloadSize;
+					payload = static_cast<uint8*>(TrackedAlloc(MemoryTagLogging, payloadCap));
+				}
+
+				const DecodedLogSite* site{ sites.find(message.siteId) };
+				if ((message.payloadSize && !payload) || !site || fread(payload, 1, message.payloadSize, in) != message.payloadSize)
+				{
+					ok = false;
+					break;
+				}
+
+				LogLineWriter writer{ .data = line, .num = 0, .cap = LOG_MAX_LINE_LENGTH };
+				FormatLine(writer, header.startTimeOfDayNs + message.timeNs, message.thread, site->level, site->format, payload, message.payloadSize, message.numArgs, header.wcharSize);
+				fwrite(writer.data, 1, writer.num, out);
+			}
+			else
+			{
+				ok = false;
+			}
+		}
+
+		for (size_t i{}; i < sites.capacity; ++i)
+			if (sites.isFull(i)) TrackedFree(sites.values[i].format);
+
+		sites.release();
+		TrackedFree(payload);
+		TrackedFree(line);
+		fclose(in);
+		return ok;
+	}
+
+}
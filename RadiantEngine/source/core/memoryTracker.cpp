@@ -0,0 +1,182 @@
+//  Filename: memoryTracker 
+//	Author:	Daniel														
+//	Date: 19/10/2026 01:37:09		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstdlib>
+
+#include "RadiantEngine/core/memoryTracker.h"
+
+namespace RE
+{
+
+	internal constexpr const char* MEMORY_TAG_NAMES[NUM_MEMORY_TAGS]
+	{
+		"General",
+		"Scratch",
+		"Core",
+		"Jobs",
+		"Scene",
+		"Renderer",
+		"GpuAllocator",
+		"Assets",
+		"Shaders",
+		"Logging",
+		"Profiler",
+	};
+
+	const char* MemoryTagName(const eMemoryTag tag)
+	{
+		return tag < NUM_MEMORY_TAGS ? MEMORY_TAG_NAMES[tag] : "Unknown";
+	}
+
+	internal void* AlignedAlloc(const size_t size, const size_t alignment)
+	{
+#if defined(_MSC_VER)
+		return _aligned_malloc(size, alignment);
+#else
+		return aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+	}
+
+	internal void AlignedFree(void* p)
+	{
+#if defined(_MSC_VER)
+		_aligned_free(p);
+#else
+		free(p);
+#endif
+	}
+
+#if RE_ENABLE_MEMORY_TRACKING
+
+	//Sits right before the pointer returned by TrackedAlloc. The block starts headerSize bytes earlier, headerSize is
+	//the alignment so the user pointer keeps it
+	struct AllocationHeader
+	{
+		uint64 size;
+		uint32 headerSize;
+		uint8 tag;
+	};
+
+	struct TagCounters
+	{
+		std::atomic<int64> liveBytes;
+		std::atomic<int64> peakBytes;
+		std::atomic<int64> liveAllocations;
+		std::atomic<int64> numAllocations;
+		std::atomic<int64> numFrees;
+		std::atomic<int64> histogram[MEMORY_HISTOGRAM_BUCKETS];
+	};
+
+	internal TagCounters counters[NUM_MEMORY_TAGS];
+
+	internal void AddLiveBytes(TagCounters& c, const int64 delta)
+	{
+		const int64 live{ c.liveBytes.fetch_add(delta, std::memory_order_relaxed) + delta };
+		int64 peak{ c.peakBytes.load(std::memory_order_relaxed) };
+		while (live > peak && !c.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+	}
+
+	void TrackAllocation(const eMemoryTag tag, const size_t size)
+	{
+		TagCounters& c{ counters[tag] };
+		AddLiveBytes(c, static_cast<int64>(size));
+		c.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+		c.numAllocations.fetch_add(1, std::memory_order_relaxed);
+		c.histogram[MemoryHistogramBucket(size)].fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void TrackFree(const eMemoryTag tag, const size_t size)
+	{
+		TagCounters& c{ counters[tag] };
+		c.liveBytes.fetch_sub(static_cast<int64>(size), std::memory_order_relaxed);
+		c.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+		c.numFrees.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void TrackCommit(const eMemoryTag tag, const int64 delta)
+	{
+		AddLiveBytes(counters[tag], delta);
+	}
+
+	void* TrackedAlloc(const eMemoryTag tag, const size_t size, const size_t alignment)
+	{
+		const size_t headerSize{ alignment > sizeof(AllocationHeader) ? alignment : sizeof(AllocationHeader) };
+		uint8* block{ static_cast<uint8*>(AlignedAlloc(headerSize + size, alignment > alignof(AllocationHeader) ? alignment : alignof(AllocationHeader))) };
+		if (!block)
+			return nullptr;
+
+		AllocationHeader* header{ reinterpret_cast<AllocationHeader*>(block + headerSize) - 1 };
+		*header = { .size = size, .headerSize = static_cast<uint32>(headerSize), .tag = tag };
+		TrackAllocation(tag, size);
+		return block + headerSize;
+	}
+
+	void TrackedFree(void* p)
+	{
+		if (!p)
+			return;
+
+		const AllocationHeader* header{ static_cast<const AllocationHeader*>(p) - 1 };
+		TrackFree(static_cast<eMemoryTag>(header->tag), header->size);
+		AlignedFree(static_cast<uint8*>(p) - header->headerSize);
+	}
+
+	void TakeMemorySnapshot(MemorySnapshot& snapshot)
+	{
+		for (uint32 t{}; t < NUM_MEMORY_TAGS; ++t)
+		{
+			const TagCounters& c{ counters[t] };
+			MemoryTagStats& s{ snapshot.tags[t] };
+			s.liveBytes = c.liveBytes.load(std::memory_order_relaxed);
+			s.peakBytes = c.peakBytes.load(std::memory_order_relaxed);
+			s.liveAllocations = c.liveAllocations.load(std::memory_order_relaxed);
+			s.numAllocations = c.numAllocations.load(std::memory_order_relaxed);
+			s.numFrees = c.numFrees.load(std::memory_order_relaxed);
+			for (uint32 b{}; b < MEMORY_HISTOGRAM_BUCKETS; ++b)
+				s.histogram[b] = c.histogram[b].load(std::memory_order_relaxed);
+		}
+	}
+
+#else
+
+	void* TrackedAlloc(const eMemoryTag, const size_t size, const size_t alignment)
+	{
+		return AlignedAlloc(size, alignment);
+	}
+
+	void TrackedFree(void* p)
+	{
+		AlignedFree(p);
+	}
+
+	void TakeMemorySnapshot(MemorySnapshot& snapshot)
+	{
+		snapshot = {};
+	}
+
+#endif
+
+	MemorySnapshot DiffMemorySnapshots(const MemorySnapshot& before, const MemorySnapshot& after)
+	{
+		MemorySnapshot diff;
+		for (uint32 t{}; t < NUM_MEMORY_TAGS; ++t)
+		{
+			const MemoryTagStats& a{ before.tags[t] };
+			const MemoryTagStats& b{ after.tags[t] };
+			MemoryTagStats& d{ diff.tags[t] };
+			d.liveBytes = b.liveBytes - a.liveBytes;
+			d.peakBytes = b.peakBytes - a.peakBytes;
+			d.liveAllocations = b.liveAllocations - a.liveAllocations;
+			d.numAllocations = b.numAllocations - a.numAllocations;
+			d.numFrees = b.numFrees - a.numFrees;
+			for (uint32 i{}; i < MEMORY_HISTOGRAM_BUCKETS; ++i)
+				d.histogram[i] = b.histogram[i] - a.histogram[i];
+		}
+
+		return diff;
+	}
+
+}
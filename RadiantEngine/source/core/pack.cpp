@@ -0,0 +1,458 @@
+//  Filename: pack 
+//	Author:	Daniel														
+//	Date: 19/10/2026 05:03:11		
+//  Sqwack-Studios													
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+
+#include "RadiantEngine/core/pack.h"
+#include "RadiantEngine/core/vfs.h"
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/jobs.h"
+
+namespace RE
+{
+
+	internal constexpr uint64 PACK_COPY_CHUNK{ 1024 * 1024 };
+
+	internal RE_INLINE uint64 AlignPack(const uint64 v) { return (v + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1); }
+
+	internal bool ValidatePack(const Pack& pack)
+	{
+		const uint64 size{ pack.file.size };
+		if (size < sizeof(PackHeader))
+			return false;
+
+		const PackHeader& h{ *pack.header };
+		if (h.magic != PACK_MAGIC || h.version != PACK_VERSION || h.fileSize != size)
+			return false;
+		if (h.tocCapacity == 0 || (h.tocCapacity & (h.tocCapacity - 1)) != 0 || h.numEntries >= h.tocCapacity)
+			return false;
+
+		const uint64 tocSize{ static_cast<uint64>(h.tocCapacity) * sizeof(PackEntry) };
+		if (h.tocOffset % PACK_ALIGNMENT != 0 || h.tocOffset < sizeof(PackHeader) || h.tocOffset > size || tocSize > size - h.tocOffset)
+			return false;
+		if (h.namesOffset > size || h.namesSize > size - h.namesOffset)
+			return false;
+		//names are '\0' terminated, the last one included
+		return h.namesSize == 0 || pack.file.data[h.namesOffset + h.namesSize - 1] == 0;
+	}
+
+	bool OpenPack(Pack& pack, const char* path)
+	{
+		pack = {};
+		if (!MapFile(pack.file, path))
+			return false;
+
+		pack.header = reinterpret_cast<const PackHeader*>(pack.file.data);
+		if (!pack.file.data || !ValidatePack(pack))
+		{
+			ClosePack(pack);
+			return false;
+		}
+
+		pack.toc = reinterpret_cast<const PackEntry*>(pack.file.data + pack.header->tocOffset);
+		pack.names = reinterpret_cast<const char*>(pack.file.data + pack.header->namesOffset);
+		return true;
+	}
+
+	void ClosePack(Pack& pack)
+	{
+		UnmapFile(pack.file);
+		pack = {};
+	}
+
+	const PackEntry* FindPackEntry(const Pack& pack, const StringId path)
+	{
+		if (!pack.header || path.value == 0)
+			return nullptr;
+
+		const uint64 mask{ pack.header->tocCapacity - 1ull };
+		for (uint64 i{ path.value & mask }, probes{}; probes <= mask; i = (i + 1) & mask, ++probes)
+		{
+			const PackEntry& entry{ pack.toc[i] };
+			if (entry.pathHash == path.value)
+				return &entry;
+			if (entry.pathHash == 0)
+				return nullptr;
+		}
+		return nullptr;
+	}
+
+	Span<const uint8> PackEntryData(const Pack& pack, const PackEntry& entry)
+	{
+		if (entry.offset > pack.file.size || entry.storedSize > pack.file.size - entry.offset)
+			return {};
+
+		return { pack.file.data + entry.offset, entry.storedSize };
+	}
+
+	const char* PackEntryName(const Pack& pack, const PackEntry& entry)
+	{
+		return entry.nameOffset < pack.header->namesSize ? pack.names + entry.nameOffset : "";
+	}
+
+	struct PackBlocks
+	{
+		const uint32* ends;
+		const uint8* data;
+		uint64 size;
+		uint32 num;
+	};
+
+	internal bool GetPackBlocks(const Pack& pack, const PackEntry& entry, PackBlocks& blocks)
+	{
+		//the block table is read in place as uint32s, WritePack aligns every entry so anything else is a broken pack
+		if (entry.offset % PACK_ALIGNMENT != 0)
+			return false;
+
+		const Span<const uint8> stored{ PackEntryData(pack, entry) };
+		blocks.num = PackEntryBlocks(entry);
+		const uint64 tableSize{ blocks.num * sizeof(uint32) };
+		if (!stored.data || stored.num < tableSize)
+			return false;
+
+		blocks.ends = reinterpret_cast<const uint32*>(stored.data);
+		blocks.data = stored.data + tableSize;
+		blocks.size = stored.num - tableSize;
+		return true;
+	}
+
+	internal bool DecompressPackBlock(const PackEntry& entry, const PackBlocks& blocks, const uint32 block, uint8* dst)
+	{
+		const uint64 begin{ block ? blocks.ends[block - 1] : 0 };
+		const uint64 end{ blocks.ends[block] };
+		const uint64 remaining{ entry.size - static_cast<uint64>(block) * PACK_BLOCK_SIZE };
+		const uint64 rawSize{ remaining < PACK_BLOCK_SIZE ? remaining : PACK_BLOCK_SIZE };
+		if (end < begin || end > blocks.size)
+			return false;
+
+		if (end - begin == rawSize)
+		{
+			memcpy(dst, blocks.data + begin, rawSize);
+			return true;
+		}
+		return Decompress(static_cast<eCompressionCodec>(entry.codec), blocks.data + begin, end - begin, dst, rawSize);
+	}
+
+	bool DecompressPackBlocks(const Pack& pack, const PackEntry& entry, const uint32 first, const uint32 num, void* dst)
+	{
+		PackBlocks blocks;
+		if (!IsPackEntryCompressed(entry) || !GetPackBlocks(pack, entry, blocks) || first > blocks.num || num > blocks.num - first)
+			return false;
+
+		uint8* out{ static_cast<uint8*>(dst) };
+		for (uint32 i{}; i < num; ++i)
+		{
+			if (!DecompressPackBlock(entry, blocks, first + i, out + static_cast<uint64>(i) * PACK_BLOCK_SIZE))
+				return false;
+		}
+		return true;
+	}
+
+	struct PackEntryRead
+	{
+		const PackEntry* entry;
+		PackBlocks blocks;
+		uint8* dst;
+		std::atomic<bool> failed;
+	};
+
+	internal void DecompressPackRange(void* data, const uint32 begin, const uint32 end)
+	{
+		PackEntryRead& read{ *static_cast<PackEntryRead*>(data) };
+		for (uint32 i{ begin }; i < end; ++i)
+		{
+			if (!DecompressPackBlock(*read.entry, read.blocks, i, read.dst + static_cast<uint64>(i) * PACK_BLOCK_SIZE))
+				read.failed.store(true, std::memory_order_relaxed);
+		}
+	}
+
+	bool ReadPackEntry(const Pack& pack, const PackEntry& entry, void* dst)
+	{
+		if (!IsPackEntryCompressed(entry))
+		{
+			const Span<const uint8> stored{ PackEntryData(pack, entry) };
+			if (stored.num != entry.size || (!stored.data && entry.size))
+				return false;
+			if (entry.size)
+				memcpy(dst, stored.data, entry.size);
+			return true;
+		}
+
+		PackEntryRead read{};
+		read.entry = &entry;
+		read.dst = static_cast<uint8*>(dst);
+		if (!GetPackBlocks(pack, entry, read.blocks))
+			return false;
+
+		//ParallelFor needs a job thread, tools and loaders outside the job system decompress in place
+		if (read.blocks.num > 1 && GetJobThreadIndex() != INVALID_JOB_THREAD)
+			ParallelFor(read.blocks.num, 1, DecompressPackRange, &read);
+		else
+			DecompressPackRange(&read, 0, read.blocks.num);
+
+		return !read.failed.load(std::memory_order_relaxed);
+	}
+
+	internal bool CopyIntoPack(const File& out, const uint64 offset, const char* sourcePath, const uint64 size, uint8* buffer)
+	{
+		File source;
+		if (!FileOpen(source, sourcePath, FileAccessRead))
+			return false;
+
+		bool ok{ true };
+		for (uint64 done{}; done < size && ok;)
+		{
+			const uint64 chunk{ size - done < PACK_COPY_CHUNK ? size - done : PACK_COPY_CHUNK };
+			ok = FileRead(source, buffer, chunk, done) == chunk && FileWrite(out, buffer, chunk, offset + done) == chunk;
+			done += chunk;
+		}
+
+		FileClose(source);
+		return ok;
+	}
+
+	//Writes the block table and the blocks at entry.offset and sets storedSize. Stops early, with saved false, once the
+	//entry can't save enough; nothing is written past what the uncompressed entry covers. buffer holds two blocks
+	internal bool CompressIntoPack(const File& out, const char* sourcePath, PackEntry& entry, Arena& arena, uint8* buffer, bool& saved)
+	{
+		File source;
+		if (!FileOpen(source, sourcePath, FileAccessRead))
+			return false;
+
+		const ArenaMarker marker{ GetArenaMarker(arena) };
+		const uint32 numBlocks{ PackEntryBlocks(entry) };
+		const uint64 tableSize{ numBlocks * sizeof(uint32) };
+		uint32* ends{ PushArray<uint32>(arena, numBlocks) };
+		uint8* raw{ buffer };
+		uint8* compressed{ buffer + PACK_BLOCK_SIZE };
+		const eCompressionCodec codec{ static_cast<eCompressionCodec>(entry.codec) };
+
+		const uint64 limit{ entry.size - entry.size / PACK_MIN_SAVING };
+		bool ok{ ends != nullptr };
+		saved = true;
+		uint64 end{};
+		for (uint32 i{}; i < numBlocks && ok && saved; ++i)
+		{
+			const uint64 remaining{ entry.size - static_cast<uint64>(i) * PACK_BLOCK_SIZE };
+			const uint64 rawSize{ remaining < PACK_BLOCK_SIZE ? remaining : PACK_BLOCK_SIZE };
+			ok = FileRead(source, raw, rawSize, static_cast<uint64>(i) * PACK_BLOCK_SIZE) == rawSize;
+			if (!ok)
+				break;
+
+			//blocks that don't shrink are kept as they are
+			const uint64 size{ Compress(codec, raw, rawSize, compressed, rawSize - 1) };
+			const uint8* block{ size ? compressed : raw };
+			const uint64 blockSize{ size ? size : rawSize };
+			saved = tableSize + end + blockSize <= limit;
+			ok = !saved || FileWrite(out, block, blockSize, entry.offset + tableSize + end) == blockSize;
+			end += blockSize;
+			ends[i] = static_cast<uint32>(end);
+		}
+
+		ok = ok && (!saved || FileWrite(out, ends, tableSize, entry.offset) == tableSize);
+		entry.storedSize = tableSize + end;
+
+		RewindArena(marker);
+		FileClose(source);
+		return ok;
+	}
+
+	internal bool WritePackEntry(const File& out, const char* sourcePath, PackEntry& entry, Arena& arena, uint8* buffer)
+	{
+		if (IsPackEntryCompressed(entry))
+		{
+			bool saved;
+			if (!CompressIntoPack(out, sourcePath, entry, arena, buffer, saved))
+				return false;
+			//not worth a copy at load time, the entry is written again over what was compressed
+			if (saved)
+				return true;
+		}
+
+		entry.codec = CompressionNone;
+		entry.storedSize = entry.size;
+		return CopyIntoPack(out, entry.offset, sourcePath, entry.size, buffer);
+	}
+
+	bool WritePack(const char* outPath, const PackInput* inputs, const uint32 num)
+	{
+		uint32 capacity{ 16 };
+		while (capacity < num * 2ull)
+			capacity *= 2;
+
+		ScratchArena scratch{ BeginScratch() };
+		Arena& arena{ *scratch.arena };
+
+		PackEntry* toc{ PushArrayZero<PackEntry>(arena, capacity) };
+		PackEntry** slots{ PushArray<PackEntry*>(arena, num ? num : 1) };
+		char* names{ PushArray<char>(arena, static_cast<uint64>(num) * MAX_VFS_PATH) };
+		uint8* buffer{ PushArray<uint8>(arena, PACK_COPY_CHUNK) };
+		if (!toc || !slots || !names || !buffer)
+		{
+			EndScratch(scratch);
+			return false;
+		}
+
+		//table and names first, the data is written in input order after them
+		uint64 namesSize{};
+		bool ok{ true };
+		for (uint32 i{}; i < num && ok; ++i)
+		{
+			const size_t length{ CanonicalizeVfsPath(MakeStringView(inputs[i].path), names + namesSize, MAX_VFS_PATH) };
+			const StringId id{ MakeStringId({ names + namesSize, length }) };
+			const eCompressionCodec codec{ inputs[i].codec };
+
+			File source;
+			ok = length > 0 && id.value != 0 && IsCompressionCodecAvailable(codec) && FileOpen(source, inputs[i].sourcePath, FileAccessRead);
+			if (!ok)
+				break;
+			const uint64 size{ FileSize(source) };
+			FileClose(source);
+
+			uint64 slot{ id.value & (capacity - 1) };
+			while (toc[slot].pathHash != 0 && toc[slot].pathHash != id.value)
+				slot = (slot + 1) & (capacity - 1);
+			//the same path twice, or two paths with the same id
+			ok = toc[slot].pathHash == 0;
+
+			toc[slot].pathHash = id.value;
+			toc[slot].size = size;
+			toc[slot].nameOffset = static_cast<uint32>(namesSize);
+			//block ends are 32 bit
+			toc[slot].codec = size > 0 && size < (1ull << 32) ? codec : CompressionNone;
+			slots[i] = &toc[slot];
+			namesSize += length + 1;
+		}
+
+		PackHeader header{};
+		header.magic = PACK_MAGIC;
+		header.version = PACK_VERSION;
+		header.numEntries = num;
+		header.tocCapacity = capacity;
+		header.tocOffset = AlignPack(sizeof(PackHeader));
+		header.namesOffset = header.tocOffset + capacity * sizeof(PackEntry);
+		header.namesSize = namesSize;
+		header.dataOffset = AlignPack(header.namesOffset + namesSize);
+
+		File out;
+		ok = ok && FileOpen(out, outPath, FileAccessWrite);
+		if (ok)
+		{
+			uint64 offset{ header.dataOffset };
+			uint64 dataEnd{ offset };
+			for (uint32 i{}; i < num && ok; ++i)
+			{
+				slots[i]->offset = offset;
+				ok = WritePackEntry(out, inputs[i].sourcePath, *slots[i], arena, buffer);
+				dataEnd = offset + slots[i]->storedSize;
+				offset = AlignPack(dataEnd);
+			}
+			header.fileSize = offset;
+
+			//the padding after the last entry counts towards fileSize
+			const uint8 zero{};
+			if (ok && dataEnd < header.fileSize)
+				ok = FileWrite(out, &zero, 1, header.fileSize - 1) == 1;
+
+			//the header goes last, a pack cut short by a crash never validates
+			const uint64 tocSize{ capacity * sizeof(PackEntry) };
+			ok = ok && FileWrite(out, toc, tocSize, header.tocOffset) == tocSize;
+			ok = ok && FileWrite(out, names, namesSize, header.namesOffset) == namesSize;
+			ok = ok && FileWrite(out, &header, sizeof(header), 0) == sizeof(header);
+			FileClose(out);
+		}
+
+		EndScratch(scratch);
+		return ok;
+	}
+
+	struct PackDirectoryFile
+	{
+		const char* relativePath;
+		PackDirectoryFile* next;
+	};
+
+	struct PackDirectoryWalk
+	{
+		Arena* arena;
+		PackDirectoryFile* first;
+		uint32 num;
+		bool ok;
+	};
+
+	internal void CollectPackFile(const char* relativePath, void* data)
+	{
+		PackDirectoryWalk& walk{ *static_cast<PackDirectoryWalk*>(data) };
+		const size_t length{ StringLength(relativePath) };
+
+		PackDirectoryFile* file{ PushArray<PackDirectoryFile>(*walk.arena, 1) };
+		char* copy{ PushArray<char>(*walk.arena, length + 1) };
+		if (!file || !copy)
+		{
+			walk.ok = false;
+			return;
+		}
+
+		memcpy(copy, relativePath, length + 1);
+		file->relativePath = copy;
+		file->next = walk.first;
+		walk.first = file;
+		++walk.num;
+	}
+
+	internal int ComparePackPaths(const void* a, const void* b)
+	{
+		return strcmp(*static_cast<const char* const*>(a), *static_cast<const char* const*>(b));
+	}
+
+	bool WritePackFromDirectory(const char* outPath, const char* directory, const char* mountPoint, const eCompressionCodec codec)
+	{
+		ScratchArena scratch{ BeginScratch() };
+		Arena& arena{ *scratch.arena };
+
+		PackDirectoryWalk walk{ .arena = &arena, .first = nullptr, .num = 0, .ok = true };
+		bool ok{ WalkDirectory(directory, CollectPackFile, &walk) && walk.ok };
+
+		//sorted so the same directory always gives the same pack, whatever order the OS lists it in
+		const char** relativePaths{ PushArray<const char*>(arena, walk.num ? walk.num : 1) };
+		PackInput* inputs{ PushArray<PackInput>(arena, walk.num ? walk.num : 1) };
+		ok = ok && relativePaths && inputs;
+		if (ok)
+		{
+			uint32 i{};
+			for (const PackDirectoryFile* file{ walk.first }; file; file = file->next)
+				relativePaths[i++] = file->relativePath;
+			qsort(relativePaths, walk.num, sizeof(const char*), ComparePackPaths);
+		}
+
+		const bool hasMountPoint{ mountPoint && mountPoint[0] };
+		for (uint32 i{}; i < walk.num && ok; ++i)
+		{
+			const size_t sourceSize{ StringLength(directory) + 1 + StringLength(relativePaths[i]) + 1 };
+			const size_t pathSize{ (hasMountPoint ? StringLength(mountPoint) + 1 : 0) + StringLength(relativePaths[i]) + 1 };
+			char* sourcePath{ PushArray<char>(arena, sourceSize) };
+			char* path{ PushArray<char>(arena, pathSize) };
+			ok = sourcePath && path;
+			if (!ok)
+				break;
+
+			snprintf(sourcePath, sourceSize, "%s/%s", directory, relativePaths[i]);
+			if (hasMountPoint)
+				snprintf(path, pathSize, "%s/%s", mountPoint, relativePaths[i]);
+			else
+				memcpy(path, relativePaths[i], pathSize);
+
+			inputs[i] = { .path = path, .sourcePath = sourcePath, .codec = codec };
+		}
+
+		ok = ok && WritePack(outPath, inputs, walk.num);
+		EndScratch(scratch);
+		return ok;
+	}
+
+}
@@ -0,0 +1,426 @@
+//  Filename: profiler 
+//	Author:	Daniel														
+//	Date: 19/10/2026 00:58:03		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include "RadiantEngine/core/profiler.h"
+#include "RadiantEngine/core/clock.h"
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/hashMap.h"
+#include "RadiantEngine/core/memoryTracker.h"
+
+namespace RE
+{
+
+	//name == nullptr is an end event
+	struct ProfileEvent
+	{
+		uint64 ticks;
+		const char* name;
+	};
+
+	struct ProfileThread
+	{
+		ProfileEvent* events;
+		std::atomic<uint64> writePos;	//free running, written by the owner only
+		std::atomic<const char*> name;
+		std::atomic<bool> ready;
+	};
+
+	struct Profiler
+	{
+		ProfileThread threads[MAX_PROFILE_THREADS];
+		std::atomic<uint32> numThreads;
+		std::atomic<uint32> session;		//bumped by InitProfiler, older thread registrations are stale
+
+		//ticks -> ns calibration point
+		uint64 startTicks;
+		int64 startNs;
+	};
+
+	//a pair of events after matching
+	struct ProfileSpan
+	{
+		int64 startNs;
+		int64 endNs;
+		const char* name;
+		uint32 depth;
+	};
+
+	internal constexpr uint64 PROFILE_EVENT_MASK{ PROFILE_EVENTS_PER_THREAD - 1 };
+	static_assert((PROFILE_EVENTS_PER_THREAD & PROFILE_EVENT_MASK) == 0, "PROFILE_EVENTS_PER_THREAD must be a power of two");
+
+	internal Profiler profiler;
+	internal ProfileThread noThread;
+
+	struct ProfileThreadRef
+	{
+		ProfileThread* thread;		//nullptr until the first event, &noThread when every slot is taken
+		uint32 session;
+	};
+
+	internal thread_local ProfileThreadRef currentThread;
+
+	internal RE_INLINE uint64 ReadTicks()
+	{
+#if defined(_MSC_VER) || defined(__x86_64__)
+		return __rdtsc();
+#else
+		return static_cast<uint64>(GetTimeNs());
+#endif
+	}
+
+	internal ProfileThread* RegisterThread()
+	{
+		const uint32 index{ profiler.numThreads.fetch_add(1, std::memory_order_relaxed) };
+		if (index >= MAX_PROFILE_THREADS)
+			return &noThread;
+
+		ProfileThread& t{ profiler.threads[index] };
+		t.events = static_cast<ProfileEvent*>(TrackedAlloc(MemoryTagProfiler, sizeof(ProfileEvent) * PROFILE_EVENTS_PER_THREAD));
+		if (!t.events)
+			return &noThread;
+
+		t.writePos.store(0, std::memory_order_relaxed);
+		t.ready.store(true, std::memory_order_release);
+		return &t;
+	}
+
+	//A thread that recorded before ShutdownProfiler registers again, its old slot may belong to someone else by now
+	internal RE_INLINE ProfileThread* GetProfileThread()
+	{
+		const uint32 session{ profiler.session.load(std::memory_order_relaxed) };
+		if (!currentThread.thread || currentThread.session != session)
+		{
+			currentThread.thread = RegisterThread();
+			currentThread.session = session;
+		}
+		return currentThread.thread;
+	}
+
+	internal RE_INLINE void Record(const char* name)
+	{
+		ProfileThread* t{ GetProfileThread() };
+		if (!t->events)
+			return;
+
+		const uint64 pos{ t->writePos.load(std::memory_order_relaxed) };
+		t->events[pos & PROFILE_EVENT_MASK] = { .ticks = ReadTicks(), .name = name };
+		t->writePos.store(pos + 1, std::memory_order_release);
+	}
+
+	void InitProfiler()
+	{
+		profiler.startTicks = ReadTicks();
+		profiler.startNs = GetTimeNs();
+		profiler.session.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void ShutdownProfiler()
+	{
+		const uint32 num{ profiler.numThreads.load(std::memory_order_acquire) };
+		for (uint32 i{}; i < num && i < MAX_PROFILE_THREADS; ++i)
+		{
+			ProfileThread& t{ profiler.threads[i] };
+			TrackedFree(t.events);
+			t.events = nullptr;
+			t.ready.store(false, std::memory_order_relaxed);
+		}
+
+		profiler.numThreads.store(0, std::memory_order_relaxed);
+		//threads that recorded this session register again after the next InitProfiler, see currentThread.session
+		currentThread.thread = nullptr;
+	}
+
+	void SetProfileThreadName(const char* name)
+	{
+		ProfileThread* t{ GetProfileThread() };
+		t->name.store(name, std::memory_order_relaxed);
+	}
+
+	void ProfileBegin(const char* name)
+	{
+		Record(name);
+	}
+
+	void ProfileEnd()
+	{
+		Record(nullptr);
+	}
+
+	/* Capture */
+
+	//Converts ticks to the GetTimeNs timeline. Calibrated over the time since InitProfiler, which is seconds by the time
+	//anyone dumps a capture, so the rate is precise enough for microsecond scopes
+	struct TickConversion
+	{
+		fp64 nsPerTick;
+	};
+
+	internal TickConversion CalibrateTicks()
+	{
+#if defined(_MSC_VER) || defined(__x86_64__)
+		int64 nowNs{ GetTimeNs() };
+		if (nowNs - profiler.startNs < 10000000)
+		{
+			SleepNs(10000000);
+			nowNs = GetTimeNs();
+		}
+
+		const uint64 nowTicks{ ReadTicks() };
+		return { static_cast<fp64>(nowNs - profiler.startNs) / static_cast<fp64>(nowTicks - profiler.startTicks) };
+#else
+		return { 1.0 };
+#endif
+	}
+
+	internal RE_INLINE int64 TicksToNs(const TickConversion conversion, const uint64 ticks)
+	{
+		return profiler.startNs + static_cast<int64>(static_cast<fp64>(static_cast<int64>(ticks - profiler.startTicks)) * conversion.nsPerTick);
+	}
+
+	//Copies the events a thread still has. The owner may overwrite the oldest ones while we copy: the write position is
+	//read again afterwards and everything it may have reached is dropped
+	internal uint32 SnapshotThread(const ProfileThread& t, ProfileEvent* out)
+	{
+		const uint64 end{ t.writePos.load(std::memory_order_acquire) };
+		const uint64 begin{ end > PROFILE_EVENTS_PER_THREAD ? end - PROFILE_EVENTS_PER_THREAD : 0 };
+
+		for (uint64 i{ begin }; i < end; ++i)
+			out[i - begin] = t.events[i & PROFILE_EVENT_MASK];
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint64 after{ t.writePos.load(std::memory_order_relaxed) };
+		const uint64 firstValid{ after > PROFILE_EVENTS_PER_THREAD ? after - PROFILE_EVENTS_PER_THREAD : 0 };
+		const uint64 skip{ firstValid > begin ? firstValid - begin : 0 };
+		if (skip >= end - begin)
+			return 0;
+
+		memmove(out, out + skip, sizeof(ProfileEvent) * (end - begin - skip));
+		return static_cast<uint32>(end - begin - skip);
+	}
+
+	//Pairs begins with ends and keeps the spans overlapping [fromNs, toNs], clamped to it. Ends without a begin (their
+	//begin was overwritten) and begins still open are dropped
+	internal uint32 MatchSpans(const ProfileEvent* events, const uint32 num, const TickConversion conversion, const int64 fromNs, const int64 toNs, ProfileSpan* out)
+	{
+		uint32 stack[MAX_PROFILE_DEPTH];
+		uint32 depth{};
+		uint32 numSpans{};
+
+		for (uint32 i{}; i < num; ++i)
+		{
+			if (events[i].name)
+			{
+				if (depth < MAX_PROFILE_DEPTH)
+					stack[depth] = i;
+
+				depth++;
+				continue;
+			}
+
+			if (depth == 0)
+				continue;
+
+			depth--;
+			if (depth >= MAX_PROFILE_DEPTH)
+				continue;
+
+			const ProfileEvent& begin{ events[stack[depth]] };
+			const int64 startNs{ TicksToNs(conversion, begin.ticks) };
+			const int64 endNs{ TicksToNs(conversion, events[i].ticks) };
+			if (endNs < fromNs || startNs > toNs)
+				continue;
+
+			out[numSpans++] = { .startNs = startNs < fromNs ? fromNs : startNs, .endNs = endNs > toNs ? toNs : endNs, .name = begin.name, .depth = depth };
+		}
+
+		return numSpans;
+	}
+
+	internal int CompareSpans(const void* a, const void* b)
+	{
+		const ProfileSpan& x{ *static_cast<const ProfileSpan*>(a) };
+		const ProfileSpan& y{ *static_cast<const ProfileSpan*>(b) };
+		if (x.startNs != y.startNs)
+			return (x.startNs > y.startNs) - (x.startNs < y.startNs);
+
+		return (x.depth > y.depth) - (x.depth < y.depth);
+	}
+
+	struct ProfileCapture
+	{
+		ProfileSpan* spans;
+		uint32 threadBegin[MAX_PROFILE_THREADS + 1];	//spans of thread i are [threadBegin[i], threadBegin[i + 1])
+		const char* threadName[MAX_PROFILE_THREADS];
+		uint32 numThreads;
+	};
+
+	internal void Capture(Arena& arena, const int64 fromNs, const int64 toNs, ProfileCapture& capture)
+	{
+		const TickConversion conversion{ CalibrateTicks() };
+		const uint32 registered{ profiler.numThreads.load(std::memory_order_acquire) };
+
+		capture.numThreads = 0;
+		capture.threadBegin[0] = 0;
+		//every event can become at most one span
+		capture.spans = PushArray<ProfileSpan>(arena, static_cast<uint64>(PROFILE_EVENTS_PER_THREAD) * (registered < MAX_PROFILE_THREADS ? registered : MAX_PROFILE_THREADS));
+
+		ScratchArena scratch{ BeginScratch(&arena) };
+		ProfileEvent* events{ PushArray<ProfileEvent>(*scratch.arena, PROFILE_EVENTS_PER_THREAD) };
+
+		uint32 numSpans{};
+		for (uint32 i{}; i < registered && i < MAX_PROFILE_THREADS; ++i)
+		{
+			const ProfileThread& t{ profiler.threads[i] };
+			if (!t.ready.load(std::memory_order_acquire))
+				continue;
+
+			const uint32 numEvents{ SnapshotThread(t, events) };
+			const uint32 n{ MatchSpans(events, numEvents, conversion, fromNs, toNs, capture.spans + numSpans) };
+			qsort(capture.spans + numSpans, n, sizeof(ProfileSpan), CompareSpans);
+
+			numSpans += n;
+			capture.threadName[capture.numThreads] = t.name.load(std::memory_order_relaxed);
+			capture.threadBegin[++capture.numThreads] = numSpans;
+		}
+
+		EndScratch(scratch);
+	}
+
+	internal void WriteJsonString(FILE* file, const char* s)
+	{
+		fputc('"', file);
+		for (; *s; ++s)
+		{
+			if (*s == '"' || *s == '\\')
+				fputc('\\', file);
+
+			if (static_cast<uint8>(*s) >= 0x20)
+				fputc(*s, file);
+		}
+		fputc('"', file);
+	}
+
+	bool WriteProfileTrace(const char* path, const int64 fromNs, const int64 toNs)
+	{
+		FILE* file{ fopen(path, "wb") };
+		if (!file)
+			return false;
+
+		ScratchArena scratch{ BeginScratch() };
+		ProfileCapture capture;
+		Capture(*scratch.arena, fromNs, toNs, capture);
+
+		fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+
+		bool first{ true };
+		for (uint32 t{}; t < capture.numThreads; ++t)
+		{
+			fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", first ? "" : ",\n", t);
+			if (capture.threadName[t])
+				WriteJsonString(file, capture.threadName[t]);
+			else
+				fprintf(file, "\"Thread %u\"", t);
+			fputs("}}", file);
+			first = false;
+
+			for (uint32 i{ capture.threadBegin[t] }; i < capture.threadBegin[t + 1]; ++i)
+			{
+				const ProfileSpan& s{ capture.spans[i] };
+				//microseconds
+				fputs(",\n{\"name\":", file);
+				WriteJsonString(file, s.name);
+				fprintf(file, ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", t,
+					static_cast<fp64>(s.startNs - fromNs) * 1e-3, static_cast<fp64>(s.endNs - s.startNs) * 1e-3);
+			}
+		}
+
+		fputs("\n]}\n", file);
+
+		EndScratch(scratch);
+		return fclose(file) == 0;
+	}
+
+	bool WriteProfileBinary(const char* path, const int64 fromNs, const int64 toNs)
+	{
+		FILE* file{ fopen(path, "wb") };
+		if (!file)
+			return false;
+
+		ScratchArena scratch{ BeginScratch() };
+		ProfileCapture capture;
+		Capture(*scratch.arena, fromNs, toNs, capture);
+
+		//one table entry per distinct name pointer, scopes reference it by index
+		HashMap<const char*, uint32> nameIndex{};
+		nameIndex.init(256, ArenaAllocator(*scratch.arena));
+		const char** names{ PushArray<const char*>(*scratch.arena, capture.threadBegin[capture.numThreads] + capture.numThreads + 1) };
+		uint32 numNames{ 1 };
+		names[0] = "";
+
+		auto intern = [&](const char* name) -> uint32
+		{
+			if (!name)
+				return 0;
+
+			bool added;
+			uint32* index{ nameIndex.findOrAdd(name, added) };
+			if (added)
+			{
+				*index = numNames;
+				names[numNames++] = name;
+			}
+
+			return *index;
+		};
+
+		uint32* threadNameIndex{ PushArray<uint32>(*scratch.arena, capture.numThreads + 1) };
+		uint32* scopeNameIndex{ PushArray<uint32>(*scratch.arena, capture.threadBegin[capture.numThreads] + 1) };
+		for (uint32 t{}; t < capture.numThreads; ++t)
+		{
+			threadNameIndex[t] = intern(capture.threadName[t]);
+			for (uint32 i{ capture.threadBegin[t] }; i < capture.threadBegin[t + 1]; ++i)
+				scopeNameIndex[i] = intern(capture.spans[i].name);
+		}
+
+		const ProfileFileHeader header{ .magic = PROFILE_FILE_MAGIC, .version = PROFILE_FILE_VERSION, .numNames = numNames, .numThreads = capture.numThreads, .startNs = fromNs, .endNs = toNs };
+		fwrite(&header, sizeof(header), 1, file);
+
+		for (uint32 i{}; i < numNames; ++i)
+		{
+			const size_t length{ strlen(names[i]) };
+			const uint16 length16{ static_cast<uint16>(length > 0xFFFF ? 0xFFFF : length) };
+			fwrite(&length16, sizeof(length16), 1, file);
+			fwrite(names[i], 1, length16, file);
+		}
+
+		for (uint32 t{}; t < capture.numThreads; ++t)
+		{
+			const ProfileFileThread thread{ .nameIndex = threadNameIndex[t], .numScopes = capture.threadBegin[t + 1] - capture.threadBegin[t] };
+			fwrite(&thread, sizeof(thread), 1, file);
+
+			for (uint32 i{ capture.threadBegin[t] }; i < capture.threadBegin[t + 1]; ++i)
+			{
+				const ProfileSpan& s{ capture.spans[i] };
+				const ProfileFileScope scope{ .startNs = s.startNs - fromNs, .durationNs = s.endNs - s.startNs, .nameIndex = scopeNameIndex[i], .depth = s.depth };
+				fwrite(&scope, sizeof(scope), 1, file);
+			}
+		}
+
+		EndScratch(scratch);
+		return fclose(file) == 0;
+	}
+
+}
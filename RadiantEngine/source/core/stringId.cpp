@@ -0,0 +1,83 @@
+//  Filename: stringId 
+//	Author:	Daniel														
+//	Date: 18/10/2026 22:01:37		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstring>
+
+#include "RadiantEngine/core/stringId.h"
+#include "RadiantEngine/core/hashMap.h"
+#include "RadiantEngine/core/arena.h"
+
+namespace RE
+{
+
+#if RE_STRING_ID_NAMES
+
+	internal constexpr uint64 NAMES_RESERVE{ 64ull * 1024 * 1024 };
+
+	//names are copied once and never freed
+	internal Arena nameArena;
+	internal HashMap<StringId, const char*> names;
+	internal std::atomic_flag namesLock;
+
+	StringId InternStringId(const StringView s)
+	{
+		const StringId id{ MakeStringId(s) };
+
+		while (namesLock.test_and_set(std::memory_order_acquire)) {}
+
+		if (!nameArena.base)
+		{
+			InitArena(nameArena, NAMES_RESERVE, MemoryTagCore);
+			names.allocator = TaggedAllocator(MemoryTagCore);
+		}
+
+		bool added;
+		const char** name{ names.findOrAdd(id, added) };
+		if (name && added)
+		{
+			char* copy{ PushArray<char>(nameArena, s.num + 1) };
+			if (copy)
+			{
+				memcpy(copy, s.data, s.num);
+				copy[s.num] = '\0';
+			}
+			*name = copy;
+		}
+		else if (name && *name)
+		{
+			RE_ASSERT(MakeStringView(*name) == s); //two strings with the same id
+		}
+
+		namesLock.clear(std::memory_order_release);
+		return id;
+	}
+
+	const char* StringIdName(const StringId id)
+	{
+		while (namesLock.test_and_set(std::memory_order_acquire)) {}
+
+		const char* const* name{ names.find(id) };
+		const char* result{ name ? *name : nullptr };
+
+		namesLock.clear(std::memory_order_release);
+		return result;
+	}
+
+#else
+
+	StringId InternStringId(const StringView s)
+	{
+		return MakeStringId(s);
+	}
+
+	const char* StringIdName(const StringId)
+	{
+		return nullptr;
+	}
+
+#endif
+
+}
@@ -0,0 +1,267 @@
+//  Filename: vfs 
+//	Author:	Daniel														
+//	Date: 19/10/2026 05:14:47		
+//  Sqwack-Studios													
+
+#include <cstdio>
+#include <cstring>
+
+#include "RadiantEngine/core/vfs.h"
+#include "RadiantEngine/core/pack.h"
+#include "RadiantEngine/core/hashMap.h"
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/memoryTracker.h"
+
+namespace RE
+{
+
+	internal constexpr uint64 VFS_NAMES_RESERVE{ 256ull * 1024 * 1024 };
+
+	enum eVfsMountType : uint8
+	{
+		VfsMountDirectory = 0,
+		VfsMountPack
+	};
+
+	struct VfsMount
+	{
+		eVfsMountType type;
+		Pack pack;
+		//directories only: VFS path id -> path on disk, in Vfs::names
+		HashMap<StringId, const char*> files;
+		char directory[MAX_VFS_PATH];
+		char mountPoint[MAX_VFS_PATH];
+	};
+
+	struct Vfs
+	{
+		VfsMount mounts[MAX_VFS_MOUNTS];
+		uint32 numMounts;
+		Arena names;
+	};
+
+	internal Vfs vfs;
+
+	bool InitVfs()
+	{
+		vfs.numMounts = 0;
+		return InitArena(vfs.names, VFS_NAMES_RESERVE, MemoryTagAssets);
+	}
+
+	void ShutdownVfs()
+	{
+		for (uint32 i{}; i < vfs.numMounts; ++i)
+		{
+			VfsMount& mount{ vfs.mounts[i] };
+			if (mount.type == VfsMountPack)
+				ClosePack(mount.pack);
+			else
+				mount.files.release();
+		}
+
+		vfs.numMounts = 0;
+		ShutdownArena(vfs.names);
+	}
+
+	size_t CanonicalizeVfsPath(const StringView path, char* out, const size_t capacity)
+	{
+		size_t length{};
+		for (size_t i{}; i < path.num;)
+		{
+			if (path.data[i] == '/' || path.data[i] == '\\')
+			{
+				++i;
+				continue;
+			}
+
+			size_t end{ i };
+			while (end < path.num && path.data[end] != '/' && path.data[end] != '\\')
+				++end;
+
+			const size_t partLength{ end - i };
+			const char* part{ path.data + i };
+			i = end;
+			if (partLength == 1 && part[0] == '.')
+				continue;
+			//parents could climb out of the mount
+			if (partLength == 2 && part[0] == '.' && part[1] == '.')
+				return 0;
+
+			const size_t needed{ length + (length > 0) + partLength + 1 };
+			if (needed > capacity)
+				return 0;
+			if (length > 0)
+				out[length++] = '/';
+			memmove(out + length, part, partLength);
+			length += partLength;
+		}
+
+		if (length == 0 || length >= capacity)
+			return 0;
+		out[length] = '\0';
+		return length;
+	}
+
+	StringId MakeVfsPath(const StringView path)
+	{
+		char canonical[MAX_VFS_PATH];
+		const size_t length{ CanonicalizeVfsPath(path, canonical, sizeof(canonical)) };
+		return length ? MakeStringId({ canonical, length }) : StringId{};
+	}
+
+	struct VfsIndexWalk
+	{
+		VfsMount* mount;
+		bool ok;
+	};
+
+	internal void IndexVfsFile(const char* relativePath, void* data)
+	{
+		VfsIndexWalk& walk{ *static_cast<VfsIndexWalk*>(data) };
+		VfsMount& mount{ *walk.mount };
+
+		char path[MAX_VFS_PATH];
+		const int written{ mount.mountPoint[0] ? snprintf(path, sizeof(path), "%s/%s", mount.mountPoint, relativePath) : snprintf(path, sizeof(path), "%s", relativePath) };
+		const size_t length{ written > 0 && written < static_cast<int>(sizeof(path)) ? CanonicalizeVfsPath({ path, static_cast<size_t>(written) }, path, sizeof(path)) : 0 };
+		if (length == 0)
+		{
+			walk.ok = false;
+			return;
+		}
+
+		const size_t diskSize{ StringLength(mount.directory) + 1 + StringLength(relativePath) + 1 };
+		char* diskPath{ PushArray<char>(vfs.names, diskSize) };
+		bool added;
+		const char** file{ diskPath ? mount.files.findOrAdd(MakeStringId({ path, length }), added) : nullptr };
+		if (!file)
+		{
+			walk.ok = false;
+			return;
+		}
+
+		snprintf(diskPath, diskSize, "%s/%s", mount.directory, relativePath);
+		*file = diskPath;
+	}
+
+	internal bool IndexDirectory(VfsMount& mount)
+	{
+		mount.files.clear();
+		VfsIndexWalk walk{ .mount = &mount, .ok = true };
+		return WalkDirectory(mount.directory, IndexVfsFile, &walk) && walk.ok;
+	}
+
+	bool MountDirectory(const char* directory, const char* mountPoint)
+	{
+		if (vfs.numMounts == MAX_VFS_MOUNTS)
+			return false;
+
+		VfsMount& mount{ vfs.mounts[vfs.numMounts] };
+		mount = {};
+		mount.type = VfsMountDirectory;
+		mount.files.allocator = TaggedAllocator(MemoryTagAssets);
+
+		const size_t directoryLength{ StringLength(directory) };
+		const size_t mountPointLength{ StringLength(mountPoint) };
+		if (directoryLength == 0 || directoryLength >= MAX_VFS_PATH || mountPointLength >= MAX_VFS_PATH)
+			return false;
+		memcpy(mount.directory, directory, directoryLength + 1);
+		memcpy(mount.mountPoint, mountPoint, mountPointLength + 1);
+
+		if (!IndexDirectory(mount))
+		{
+			mount.files.release();
+			return false;
+		}
+
+		++vfs.numMounts;
+		return true;
+	}
+
+	bool MountPack(const char* path)
+	{
+		if (vfs.numMounts == MAX_VFS_MOUNTS)
+			return false;
+
+		VfsMount& mount{ vfs.mounts[vfs.numMounts] };
+		mount = {};
+		mount.type = VfsMountPack;
+		if (!OpenPack(mount.pack, path))
+			return false;
+
+		++vfs.numMounts;
+		return true;
+	}
+
+	void RescanVfsDirectories()
+	{
+		//every disk path lives in names, rebuilding them all is simpler than tracking which belong to whom
+		ResetArena(vfs.names);
+		for (uint32 i{}; i < vfs.numMounts; ++i)
+		{
+			if (vfs.mounts[i].type == VfsMountDirectory)
+				IndexDirectory(vfs.mounts[i]);
+		}
+	}
+
+	bool VfsExists(const StringId path)
+	{
+		for (uint32 i{ vfs.numMounts }; i-- > 0;)
+		{
+			const VfsMount& mount{ vfs.mounts[i] };
+			if (mount.type == VfsMountPack ? FindPackEntry(mount.pack, path) != nullptr : mount.files.find(path) != nullptr)
+				return true;
+		}
+		return false;
+	}
+
+	bool VfsOpen(VfsFile& file, const StringId path)
+	{
+		file = {};
+		for (uint32 i{ vfs.numMounts }; i-- > 0;)
+		{
+			const VfsMount& mount{ vfs.mounts[i] };
+			if (mount.type == VfsMountPack)
+			{
+				const PackEntry* entry{ FindPackEntry(mount.pack, path) };
+				if (!entry)
+					continue;
+
+				if (!IsPackEntryCompressed(*entry))
+				{
+					file.data = PackEntryData(mount.pack, *entry);
+					return file.data.data || entry->size == 0;
+				}
+
+				file.buffer = static_cast<uint8*>(TrackedAlloc(MemoryTagAssets, entry->size));
+				if (!file.buffer || !ReadPackEntry(mount.pack, *entry, file.buffer))
+				{
+					VfsClose(file);
+					return false;
+				}
+				file.data = { file.buffer, entry->size };
+				return true;
+			}
+
+			const char* const* diskPath{ mount.files.find(path) };
+			if (!diskPath)
+				continue;
+
+			//indexed but gone since, a rescan will drop it
+			if (!MapFile(file.mapping, *diskPath))
+				return false;
+
+			file.data = { file.mapping.data, file.mapping.size };
+			return true;
+		}
+		return false;
+	}
+
+	void VfsClose(VfsFile& file)
+	{
+		UnmapFile(file.mapping);
+		if (file.buffer)
+			TrackedFree(file.buffer);
+		file = {};
+	}
+
+}
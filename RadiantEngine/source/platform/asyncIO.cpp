@@ -0,0 +1,598 @@
+//  Filename: asyncIO 
+//	Author:	Daniel														
+//	Date: 19/10/2026 04:16:09		
+//  Sqwack-Studios													
+
+#include <atomic>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define RE_IO_URING 1
+#else
+#define RE_IO_URING 0
+#endif
+
+#include "RadiantEngine/platform/asyncIO.h"
+#include "RadiantEngine/platform/thread.h"
+#include "RadiantEngine/core/clock.h"
+
+namespace RE
+{
+
+#if RE_IO_URING
+	//The ring as mapped from the kernel, liburing isn't a dependency
+	struct IoUring
+	{
+		int fd;
+		uint32 entries;
+
+		void* sqMap;
+		size_t sqMapSize;
+		void* cqMap;
+		size_t cqMapSize;
+		io_uring_sqe* sqes;
+		size_t sqesSize;
+
+		uint32* sqHead;
+		uint32* sqTail;
+		uint32 sqMask;
+		uint32* sqArray;
+
+		uint32* cqHead;
+		uint32* cqTail;
+		uint32 cqMask;
+		io_uring_cqe* cqes;
+	};
+#endif
+
+	struct AsyncIO
+	{
+		eAsyncIOBackend backend;
+		uint32 maxInFlight;
+
+		//guards the queues, numInFlight and the submission ring
+		std::atomic_flag lock;
+		IORequest* heads[NUM_IO_PRIORITIES];
+		IORequest* tails[NUM_IO_PRIORITIES];
+		uint32 numInFlight;
+		std::atomic<bool> quit;
+
+		Semaphore semaphore;	//worker pool, one signal per queued request
+		Thread threads[MAX_IO_WORKERS];
+		uint32 numThreads;
+
+#if RE_IO_URING
+		IoUring ring;
+#endif
+	};
+
+	internal AsyncIO asyncIO;
+
+	//io_uring reads are capped like any read(), longer requests continue where the last part ended
+	internal constexpr uint64 MAX_IO_READ_CHUNK{ 1ull << 30 };
+	internal constexpr uint32 IO_WAIT_SPINS{ 64 };
+	internal constexpr int64 IO_WAIT_SLEEP_NS{ 100000 };
+
+	internal RE_INLINE void LockIO()
+	{
+		while (asyncIO.lock.test_and_set(std::memory_order_acquire)) {}
+	}
+
+	internal RE_INLINE void UnlockIO()
+	{
+		asyncIO.lock.clear(std::memory_order_release);
+	}
+
+	//Under the lock
+	internal void PushQueued(IORequest& request)
+	{
+		const uint32 priority{ request.priority < NUM_IO_PRIORITIES ? static_cast<uint32>(request.priority) : static_cast<uint32>(IOPriorityLow) };
+		request.next = nullptr;
+		request.bytesRead = 0;
+		request.status.store(IOStatusQueued, std::memory_order_relaxed);
+
+		if (asyncIO.tails[priority])
+			asyncIO.tails[priority]->next = &request;
+		else
+			asyncIO.heads[priority] = &request;
+		asyncIO.tails[priority] = &request;
+	}
+
+	//Under the lock. Highest priority first, marks the request as started so it can't be cancelled anymore
+	internal IORequest* PopQueued()
+	{
+		for (uint32 p{}; p < NUM_IO_PRIORITIES; ++p)
+		{
+			IORequest* request{ asyncIO.heads[p] };
+			if (!request)
+				continue;
+
+			asyncIO.heads[p] = request->next;
+			if (!asyncIO.heads[p])
+				asyncIO.tails[p] = nullptr;
+
+			request->next = nullptr;
+			request->status.store(IOStatusReading, std::memory_order_relaxed);
+			return request;
+		}
+
+		return nullptr;
+	}
+
+	//The request belongs to the caller again once the status is stored, don't touch it after
+	internal void CompleteRequest(IORequest& request, const eIOStatus status)
+	{
+		if (request.callback)
+			request.callback(request, status);
+		request.status.store(status, std::memory_order_release);
+	}
+
+	//A read that stopped early failed unless the file really ended there
+	internal eIOStatus ReadStatus(const IORequest& request)
+	{
+		if (!request.file.valid)
+			return IOStatusFailed;
+		if (request.bytesRead == request.size || request.offset + request.bytesRead >= FileSize(request.file))
+			return IOStatusDone;
+		return IOStatusFailed;
+	}
+
+	/* Worker pool */
+
+	internal void IOWorkerEntry(void*)
+	{
+		for (;;)
+		{
+			WaitSemaphore(asyncIO.semaphore);
+
+			LockIO();
+			IORequest* request{ PopQueued() };
+			UnlockIO();
+
+			if (!request)
+			{
+				//cancelled requests leave their signal behind, only quit once the queues are empty
+				if (asyncIO.quit.load(std::memory_order_acquire))
+					break;
+				continue;
+			}
+
+			request->bytesRead = FileRead(request->file, request->dst, request->size, request->offset);
+			CompleteRequest(*request, ReadStatus(*request));
+		}
+	}
+
+	internal bool InitWorkerPool(const uint32 numWorkers)
+	{
+		asyncIO.numThreads = numWorkers < MAX_IO_WORKERS ? numWorkers : MAX_IO_WORKERS;
+		asyncIO.maxInFlight = asyncIO.numThreads;
+		if (!InitSemaphore(asyncIO.semaphore, 0))
+			return false;
+
+		for (uint32 i{}; i < asyncIO.numThreads; ++i)
+			StartThread(asyncIO.threads[i], IOWorkerEntry, nullptr);
+
+		asyncIO.backend = AsyncIOBackendWorkerPool;
+		return true;
+	}
+
+	/* io_uring */
+
+#if RE_IO_URING
+
+	internal int IoUringSetup(const uint32 entries, io_uring_params& params)
+	{
+		return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+	}
+
+	internal int IoUringEnter(const int fd, const uint32 toSubmit, const uint32 minComplete, const uint32 flags)
+	{
+		for (;;)
+		{
+			const int result{ static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0)) };
+			if (result >= 0 || errno != EINTR)
+				return result;
+		}
+	}
+
+	//Hands every filled submission to the kernel, whichever thread filled it
+	internal void SubmitRing(const IoUring& ring)
+	{
+		IoUringEnter(ring.fd, ring.entries, 0, 0);
+	}
+
+	internal void ReleaseRing(IoUring& ring)
+	{
+		if (ring.sqes)
+			munmap(ring.sqes, ring.sqesSize);
+		if (ring.cqMap && ring.cqMap != ring.sqMap)
+			munmap(ring.cqMap, ring.cqMapSize);
+		if (ring.sqMap)
+			munmap(ring.sqMap, ring.sqMapSize);
+		if (ring.fd >= 0)
+			close(ring.fd);
+		ring = {};
+		ring.fd = -1;
+	}
+
+	internal bool InitRing(IoUring& ring, const uint32 entries)
+	{
+		ring = {};
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		ring.fd = IoUringSetup(entries, params);
+		if (ring.fd < 0)
+			return false;
+
+		ring.entries = params.sq_entries;
+		ring.sqMapSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+		ring.cqMapSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		const bool singleMap{ (params.features & IORING_FEAT_SINGLE_MMAP) != 0 };
+		if (singleMap)
+			ring.sqMapSize = ring.cqMapSize = ring.sqMapSize > ring.cqMapSize ? ring.sqMapSize : ring.cqMapSize;
+
+		ring.sqMap = mmap(nullptr, ring.sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQ_RING);
+		if (ring.sqMap == MAP_FAILED)
+		{
+			ring.sqMap = nullptr;
+			ReleaseRing(ring);
+			return false;
+		}
+
+		ring.cqMap = singleMap ? ring.sqMap : mmap(nullptr, ring.cqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_CQ_RING);
+		ring.sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+		void* sqes{ mmap(nullptr, ring.sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQES) };
+		if (ring.cqMap == MAP_FAILED || sqes == MAP_FAILED)
+		{
+			ring.cqMap = ring.cqMap == MAP_FAILED ? nullptr : ring.cqMap;
+			ring.sqes = sqes == MAP_FAILED ? nullptr : static_cast<io_uring_sqe*>(sqes);
+			ReleaseRing(ring);
+			return false;
+		}
+		ring.sqes = static_cast<io_uring_sqe*>(sqes);
+
+		uint8* sq{ static_cast<uint8*>(ring.sqMap) };
+		ring.sqHead = reinterpret_cast<uint32*>(sq + params.sq_off.head);
+		ring.sqTail = reinterpret_cast<uint32*>(sq + params.sq_off.tail);
+		ring.sqMask = *reinterpret_cast<uint32*>(sq + params.sq_off.ring_mask);
+		ring.sqArray = reinterpret_cast<uint32*>(sq + params.sq_off.array);
+
+		uint8* cq{ static_cast<uint8*>(ring.cqMap) };
+		ring.cqHead = reinterpret_cast<uint32*>(cq + params.cq_off.head);
+		ring.cqTail = reinterpret_cast<uint32*>(cq + params.cq_off.tail);
+		ring.cqMask = *reinterpret_cast<uint32*>(cq + params.cq_off.ring_mask);
+		ring.cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+		return true;
+	}
+
+	//Under the lock. Fills the next submission slot, nothing reaches the kernel until SubmitRing
+	internal void PushSubmission(IoUring& ring, const uint8 opcode, IORequest* request)
+	{
+		const uint32 tail{ *ring.sqTail };
+		const uint32 index{ tail & ring.sqMask };
+		io_uring_sqe& sqe{ ring.sqes[index] };
+		memset(&sqe, 0, sizeof(sqe));
+		sqe.opcode = opcode;
+		sqe.user_data = reinterpret_cast<uint64>(request);
+
+		if (request)
+		{
+			const uint64 remaining{ request->size - request->bytesRead };
+			sqe.fd = static_cast<int32>(request->file.handle);
+			sqe.off = request->offset + request->bytesRead;
+			sqe.addr = reinterpret_cast<uint64>(static_cast<uint8*>(request->dst) + request->bytesRead);
+			sqe.len = static_cast<uint32>(remaining < MAX_IO_READ_CHUNK ? remaining : MAX_IO_READ_CHUNK);
+		}
+		else
+		{
+			sqe.fd = -1;
+		}
+
+		ring.sqArray[index] = index;
+		//the kernel reads the entry once it sees the new tail
+		__atomic_store_n(ring.sqTail, tail + 1, __ATOMIC_RELEASE);
+	}
+
+	//Under the lock. Moves queued requests into the ring while there's room, returns how many
+	internal uint32 FillRing()
+	{
+		uint32 num{};
+		while (asyncIO.numInFlight < asyncIO.maxInFlight)
+		{
+			IORequest* request{ PopQueued() };
+			if (!request)
+				break;
+
+			if (!request->file.valid || request->size == 0)
+			{
+				//nothing to read, complete it on the ring thread like any other request
+				PushSubmission(asyncIO.ring, IORING_OP_NOP, request);
+			}
+			else
+			{
+				PushSubmission(asyncIO.ring, IORING_OP_READ, request);
+			}
+			++asyncIO.numInFlight;
+			++num;
+		}
+		return num;
+	}
+
+	//Handles one completion, returns true when the request needs another submission to finish
+	internal bool HandleCompletion(IORequest& request, const int32 result, eIOStatus& status)
+	{
+		if (!request.file.valid)
+		{
+			status = IOStatusFailed;
+			return false;
+		}
+
+		if (result == -EAGAIN || result == -EINTR)
+			return true;
+
+		if (result < 0)
+		{
+			status = IOStatusFailed;
+			return false;
+		}
+
+		request.bytesRead += static_cast<uint64>(result);
+		if (result > 0 && request.bytesRead < request.size)
+			return true;
+
+		status = ReadStatus(request);
+		return false;
+	}
+
+	internal void RingEntry(void*)
+	{
+		IoUring& ring{ asyncIO.ring };
+
+		for (;;)
+		{
+			LockIO();
+			const bool done{ asyncIO.quit.load(std::memory_order_acquire) && asyncIO.numInFlight == 0 };
+			UnlockIO();
+			if (done)
+				break;
+
+			IoUringEnter(ring.fd, 0, 1, IORING_ENTER_GETEVENTS);
+
+			uint32 head{ *ring.cqHead };
+			const uint32 tail{ __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE) };
+
+			//requests reach this thread through the kernel, the lock orders their fields after the submitter's writes
+			LockIO();
+			UnlockIO();
+			for (; head != tail; ++head)
+			{
+				const io_uring_cqe& cqe{ ring.cqes[head & ring.cqMask] };
+				IORequest* request{ reinterpret_cast<IORequest*>(cqe.user_data) };
+				const int32 result{ cqe.res };
+
+				//ShutdownAsyncIO's wake up
+				if (!request)
+					continue;
+
+				eIOStatus status{ IOStatusDone };
+				if (HandleCompletion(*request, result, status))
+				{
+					LockIO();
+					PushSubmission(ring, IORING_OP_READ, request);
+					UnlockIO();
+					SubmitRing(ring);
+					continue;
+				}
+
+				LockIO();
+				--asyncIO.numInFlight;
+				const uint32 submitted{ FillRing() };
+				UnlockIO();
+				if (submitted)
+					SubmitRing(ring);
+
+				CompleteRequest(*request, status);
+			}
+			__atomic_store_n(ring.cqHead, head, __ATOMIC_RELEASE);
+		}
+	}
+
+	internal bool InitIoUring(const uint32 queueDepth)
+	{
+		if (!InitRing(asyncIO.ring, queueDepth))
+			return false;
+
+		//one submission slot stays free for ShutdownAsyncIO's wake up. The completion ring is twice as big, it can't overflow
+		asyncIO.maxInFlight = queueDepth < asyncIO.ring.entries ? queueDepth : asyncIO.ring.entries - 1;
+		asyncIO.numThreads = 1;
+		if (!StartThread(asyncIO.threads[0], RingEntry, nullptr))
+		{
+			ReleaseRing(asyncIO.ring);
+			asyncIO.numThreads = 0;
+			return false;
+		}
+
+		asyncIO.backend = AsyncIOBackendIoUring;
+		return true;
+	}
+
+#endif
+
+	/* API */
+
+	bool InitAsyncIO(const AsyncIOConfig& config)
+	{
+		if (asyncIO.backend != AsyncIOBackendNone)
+			return false;
+
+		for (uint32 p{}; p < NUM_IO_PRIORITIES; ++p)
+		{
+			asyncIO.heads[p] = nullptr;
+			asyncIO.tails[p] = nullptr;
+		}
+		asyncIO.numInFlight = 0;
+		asyncIO.quit.store(false, std::memory_order_relaxed);
+
+#if RE_IO_URING
+		//older kernels or a seccomp policy (containers) can refuse the ring
+		if (!config.forceWorkerPool && InitIoUring(config.queueDepth ? config.queueDepth : DEFAULT_IO_QUEUE_DEPTH))
+			return true;
+#endif
+
+		return InitWorkerPool(config.numWorkers ? config.numWorkers : DEFAULT_IO_WORKERS);
+	}
+
+	void ShutdownAsyncIO()
+	{
+		if (asyncIO.backend == AsyncIOBackendNone)
+			return;
+
+		//drop everything that hasn't started
+		IORequest* dropped{};
+		LockIO();
+		for (uint32 p{}; p < NUM_IO_PRIORITIES; ++p)
+		{
+			while (IORequest* request{ asyncIO.heads[p] })
+			{
+				asyncIO.heads[p] = request->next;
+				request->next = dropped;
+				dropped = request;
+			}
+			asyncIO.tails[p] = nullptr;
+		}
+		asyncIO.quit.store(true, std::memory_order_release);
+		UnlockIO();
+
+		while (dropped)
+		{
+			IORequest* next{ dropped->next };
+			CompleteRequest(*dropped, IOStatusCancelled);
+			dropped = next;
+		}
+
+#if RE_IO_URING
+		if (asyncIO.backend == AsyncIOBackendIoUring)
+		{
+			//the ring thread may be blocked waiting for a completion that will never come
+			LockIO();
+			PushSubmission(asyncIO.ring, IORING_OP_NOP, nullptr);
+			UnlockIO();
+			SubmitRing(asyncIO.ring);
+
+			JoinThread(asyncIO.threads[0]);
+			ReleaseRing(asyncIO.ring);
+		}
+#endif
+
+		if (asyncIO.backend == AsyncIOBackendWorkerPool)
+		{
+			SignalSemaphore(asyncIO.semaphore, asyncIO.numThreads);
+			for (uint32 i{}; i < asyncIO.numThreads; ++i)
+				JoinThread(asyncIO.threads[i]);
+			ShutdownSemaphore(asyncIO.semaphore);
+		}
+
+		asyncIO.numThreads = 0;
+		asyncIO.backend = AsyncIOBackendNone;
+	}
+
+	eAsyncIOBackend GetAsyncIOBackend()
+	{
+		return asyncIO.backend;
+	}
+
+	void SubmitIO(IORequest* requests, const uint32 num)
+	{
+		if (num == 0)
+			return;
+
+		if (asyncIO.backend == AsyncIOBackendNone)
+		{
+			for (uint32 i{}; i < num; ++i)
+			{
+				requests[i].bytesRead = 0;
+				CompleteRequest(requests[i], IOStatusCancelled);
+			}
+			return;
+		}
+
+		LockIO();
+		for (uint32 i{}; i < num; ++i)
+			PushQueued(requests[i]);
+
+#if RE_IO_URING
+		if (asyncIO.backend == AsyncIOBackendIoUring)
+		{
+			//one kernel entry for the whole batch
+			const uint32 submitted{ FillRing() };
+			UnlockIO();
+			if (submitted)
+				SubmitRing(asyncIO.ring);
+			return;
+		}
+#endif
+
+		UnlockIO();
+		SignalSemaphore(asyncIO.semaphore, num);
+	}
+
+	bool CancelIO(IORequest& request)
+	{
+		LockIO();
+
+		bool cancelled{ false };
+		if (request.status.load(std::memory_order_relaxed) == IOStatusQueued)
+		{
+			for (uint32 p{}; p < NUM_IO_PRIORITIES && !cancelled; ++p)
+			{
+				IORequest* previous{};
+				for (IORequest* it{ asyncIO.heads[p] }; it; previous = it, it = it->next)
+				{
+					if (it != &request)
+						continue;
+
+					if (previous)
+						previous->next = it->next;
+					else
+						asyncIO.heads[p] = it->next;
+					if (asyncIO.tails[p] == it)
+						asyncIO.tails[p] = previous;
+
+					cancelled = true;
+					break;
+				}
+			}
+		}
+
+		if (cancelled)
+		{
+			request.next = nullptr;
+			request.status.store(IOStatusCancelled, std::memory_order_release);
+		}
+
+		UnlockIO();
+		return cancelled;
+	}
+
+	eIOStatus WaitIO(const IORequest& request)
+	{
+		//reads take from microseconds (page cache) to milliseconds (disk), spin a little before sleeping
+		for (uint32 spins{}; ; ++spins)
+		{
+			const eIOStatus status{ GetIOStatus(request) };
+			if (status >= IOStatusDone || status == IOStatusIdle)
+				return status;
+
+			if (spins < IO_WAIT_SPINS)
+				YieldThread();
+			else
+				SleepNs(IO_WAIT_SLEEP_NS);
+		}
+	}
+
+}
@@ -0,0 +1,496 @@
+//  Filename: file 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:47:02		
+//  Sqwack-Studios													
+
+#include <cstring>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#include "RadiantEngine/platform/file.h"
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/stringView.h"
+
+namespace RE
+{
+
+	//single Read/WriteFile calls are limited to 4GB, and Linux stops at ~2GB per call anyway
+	internal constexpr uint64 MAX_FILE_IO_CHUNK{ 1ull << 30 };
+
+#if defined(_WIN32)
+
+	internal bool ToWidePath(const char* path, wchar_t (&out)[MAX_PLATFORM_PATH])
+	{
+		return MultiByteToWideChar(CP_UTF8, 0, path, -1, out, MAX_PLATFORM_PATH) != 0;
+	}
+
+	bool FileOpen(File& file, const char* path, const eFileAccess access)
+	{
+		file = {};
+
+		wchar_t widePath[MAX_PLATFORM_PATH];
+		if (!ToWidePath(path, widePath))
+			return false;
+
+		DWORD desiredAccess{ GENERIC_READ };
+		DWORD creation{ OPEN_EXISTING };
+		if (access == FileAccessWrite)
+		{
+			desiredAccess = GENERIC_WRITE;
+			creation = CREATE_ALWAYS;
+		}
+		else if (access == FileAccessReadWrite)
+		{
+			desiredAccess = GENERIC_READ | GENERIC_WRITE;
+			creation = OPEN_ALWAYS;
+		}
+
+		const HANDLE handle{ CreateFileW(widePath, desiredAccess, FILE_SHARE_READ, nullptr, creation, FILE_ATTRIBUTE_NORMAL, nullptr) };
+		if (handle == INVALID_HANDLE_VALUE)
+			return false;
+
+		file.handle = reinterpret_cast<uint64>(handle);
+		file.valid = true;
+		return true;
+	}
+
+	void FileClose(File& file)
+	{
+		if (file.valid)
+			CloseHandle(reinterpret_cast<HANDLE>(file.handle));
+
+		file = {};
+	}
+
+	uint64 FileSize(const File& file)
+	{
+		LARGE_INTEGER size;
+		if (!file.valid || !GetFileSizeEx(reinterpret_cast<HANDLE>(file.handle), &size))
+			return 0;
+
+		return static_cast<uint64>(size.QuadPart);
+	}
+
+	uint64 FileRead(const File& file, void* dst, const uint64 size, const uint64 offset)
+	{
+		uint64 done{};
+		while (file.valid && done < size)
+		{
+			const uint64 chunk{ size - done < MAX_FILE_IO_CHUNK ? size - done : MAX_FILE_IO_CHUNK };
+			OVERLAPPED at{};
+			at.Offset = static_cast<DWORD>(offset + done);
+			at.OffsetHigh = static_cast<DWORD>((offset + done) >> 32);
+
+			DWORD read{};
+			if (!::ReadFile(reinterpret_cast<HANDLE>(file.handle), static_cast<uint8*>(dst) + done, static_cast<DWORD>(chunk), &read, &at) || read == 0)
+				break;
+
+			done += read;
+		}
+
+		return done;
+	}
+
+	uint64 FileWrite(const File& file, const void* src, const uint64 size, const uint64 offset)
+	{
+		uint64 done{};
+		while (file.valid && done < size)
+		{
+			const uint64 chunk{ size - done < MAX_FILE_IO_CHUNK ? size - done : MAX_FILE_IO_CHUNK };
+			OVERLAPPED at{};
+			at.Offset = static_cast<DWORD>(offset + done);
+			at.OffsetHigh = static_cast<DWORD>((offset + done) >> 32);
+
+			DWORD written{};
+			if (!::WriteFile(reinterpret_cast<HANDLE>(file.handle), static_cast<const uint8*>(src) + done, static_cast<DWORD>(chunk), &written, &at) || written == 0)
+				break;
+
+			done += written;
+		}
+
+		return done;
+	}
+
+	bool MapFile(MappedFile& mapped, const char* path)
+	{
+		mapped = {};
+
+		File file;
+		if (!FileOpen(file, path, FileAccessRead))
+			return false;
+
+		mapped.size = FileSize(file);
+		if (mapped.size == 0)
+		{
+			FileClose(file);
+			return true;
+		}
+
+		//the mapping keeps the file open, the handle can go
+		const HANDLE mapping{ CreateFileMappingW(reinterpret_cast<HANDLE>(file.handle), nullptr, PAGE_READONLY, 0, 0, nullptr) };
+		FileClose(file);
+		if (!mapping)
+		{
+			mapped = {};
+			return false;
+		}
+
+		mapped.data = static_cast<const uint8*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!mapped.data)
+		{
+			CloseHandle(mapping);
+			mapped = {};
+			return false;
+		}
+
+		mapped.handle = reinterpret_cast<uint64>(mapping);
+		return true;
+	}
+
+	void UnmapFile(MappedFile& mapped)
+	{
+		if (mapped.data)
+			UnmapViewOfFile(mapped.data);
+		if (mapped.handle)
+			CloseHandle(reinterpret_cast<HANDLE>(mapped.handle));
+
+		mapped = {};
+	}
+
+	bool FileExists(const char* path)
+	{
+		wchar_t widePath[MAX_PLATFORM_PATH];
+		return ToWidePath(path, widePath) && GetFileAttributesW(widePath) != INVALID_FILE_ATTRIBUTES;
+	}
+
+	bool ListDirectory(const char* path, DirectoryFn fn, void* data)
+	{
+		wchar_t pattern[MAX_PLATFORM_PATH];
+		if (!ToWidePath(path, pattern))
+			return false;
+
+		size_t length{ wcslen(pattern) };
+		if (length + 3 > MAX_PLATFORM_PATH)
+			return false;
+		if (length > 0 && pattern[length - 1] != L'/' && pattern[length - 1] != L'\\')
+			pattern[length++] = L'\\';
+		pattern[length++] = L'*';
+		pattern[length] = 0;
+
+		WIN32_FIND_DATAW found;
+		const HANDLE find{ FindFirstFileExW(pattern, FindExInfoBasic, &found, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH) };
+		if (find == INVALID_HANDLE_VALUE)
+			return false;
+
+		do
+		{
+			const wchar_t* name{ found.cFileName };
+			if (name[0] == L'.' && (name[1] == 0 || (name[1] == L'.' && name[2] == 0)))
+				continue;
+
+			char utf8[MAX_PATH * 3];
+			if (!WideCharToMultiByte(CP_UTF8, 0, name, -1, utf8, sizeof(utf8), nullptr, nullptr))
+				continue;
+
+			const DirectoryEntry entry{ .name = utf8, .isDirectory = (found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0 };
+			fn(entry, data);
+		} while (FindNextFileW(find, &found));
+
+		FindClose(find);
+		return true;
+	}
+
+	internal bool MakeDirectory(const wchar_t* path)
+	{
+		return CreateDirectoryW(path, nullptr) || GetLastError() == ERROR_ALREADY_EXISTS;
+	}
+
+#else
+
+	bool FileOpen(File& file, const char* path, const eFileAccess access)
+	{
+		file = {};
+
+		int flags{ O_RDONLY };
+		if (access == FileAccessWrite)
+			flags = O_WRONLY | O_CREAT | O_TRUNC;
+		else if (access == FileAccessReadWrite)
+			flags = O_RDWR | O_CREAT;
+
+		const int fd{ open(path, flags | O_CLOEXEC, 0644) };
+		if (fd < 0)
+			return false;
+
+		file.handle = static_cast<uint64>(fd);
+		file.valid = true;
+		return true;
+	}
+
+	void FileClose(File& file)
+	{
+		if (file.valid)
+			close(static_cast<int>(file.handle));
+
+		file = {};
+	}
+
+	uint64 FileSize(const File& file)
+	{
+		struct stat info;
+		if (!file.valid || fstat(static_cast<int>(file.handle), &info) != 0)
+			return 0;
+
+		return static_cast<uint64>(info.st_size);
+	}
+
+	uint64 FileRead(const File& file, void* dst, const uint64 size, const uint64 offset)
+	{
+		uint64 done{};
+		while (file.valid && done < size)
+		{
+			const uint64 chunk{ size - done < MAX_FILE_IO_CHUNK ? size - done : MAX_FILE_IO_CHUNK };
+			const ssize_t read{ pread(static_cast<int>(file.handle), static_cast<uint8*>(dst) + done, chunk, static_cast<off_t>(offset + done)) };
+			if (read < 0 && errno == EINTR)
+				continue;
+			if (read <= 0)
+				break;
+
+			done += static_cast<uint64>(read);
+		}
+
+		return done;
+	}
+
+	uint64 FileWrite(const File& file, const void* src, const uint64 size, const uint64 offset)
+	{
+		uint64 done{};
+		while (file.valid && done < size)
+		{
+			const uint64 chunk{ size - done < MAX_FILE_IO_CHUNK ? size - done : MAX_FILE_IO_CHUNK };
+			const ssize_t written{ pwrite(static_cast<int>(file.handle), static_cast<const uint8*>(src) + done, chunk, static_cast<off_t>(offset + done)) };
+			if (written < 0 && errno == EINTR)
+				continue;
+			if (written <= 0)
+				break;
+
+			done += static_cast<uint64>(written);
+		}
+
+		return done;
+	}
+
+	bool MapFile(MappedFile& mapped, const char* path)
+	{
+		mapped = {};
+
+		File file;
+		if (!FileOpen(file, path, FileAccessRead))
+			return false;
+
+		mapped.size = FileSize(file);
+		if (mapped.size == 0)
+		{
+			FileClose(file);
+			return true;
+		}
+
+		//the mapping keeps the file open, the descriptor can go
+		void* view{ mmap(nullptr, mapped.size, PROT_READ, MAP_SHARED, static_cast<int>(file.handle), 0) };
+		FileClose(file);
+		if (view == MAP_FAILED)
+		{
+			mapped = {};
+			return false;
+		}
+
+		mapped.data = static_cast<const uint8*>(view);
+		return true;
+	}
+
+	void UnmapFile(MappedFile& mapped)
+	{
+		if (mapped.data)
+			munmap(const_cast<uint8*>(mapped.data), mapped.size);
+
+		mapped = {};
+	}
+
+	bool FileExists(const char* path)
+	{
+		struct stat info;
+		return stat(path, &info) == 0;
+	}
+
+	bool ListDirectory(const char* path, DirectoryFn fn, void* data)
+	{
+		const int fd{ open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC) };
+		if (fd < 0)
+			return false;
+
+		DIR* dir{ fdopendir(fd) };
+		if (!dir)
+		{
+			close(fd);
+			return false;
+		}
+
+		while (const dirent* found{ readdir(dir) })
+		{
+			const char* name{ found->d_name };
+			if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
+				continue;
+
+			//some file systems don't fill d_type
+			bool isDirectory{ found->d_type == DT_DIR };
+			if (found->d_type == DT_UNKNOWN || found->d_type == DT_LNK)
+			{
+				struct stat info;
+				isDirectory = fstatat(fd, name, &info, 0) == 0 && S_ISDIR(info.st_mode);
+			}
+
+			const DirectoryEntry entry{ .name = name, .isDirectory = isDirectory };
+			fn(entry, data);
+		}
+
+		closedir(dir);
+		return true;
+	}
+
+	internal bool MakeDirectory(const char* path)
+	{
+		return mkdir(path, 0755) == 0 || errno == EEXIST;
+	}
+
+#endif
+
+	bool MakeDirectories(const char* path)
+	{
+#if defined(_WIN32)
+		wchar_t buffer[MAX_PLATFORM_PATH];
+		if (!ToWidePath(path, buffer))
+			return false;
+#else
+		char buffer[MAX_PLATFORM_PATH];
+		const size_t length{ StringLength(path) };
+		if (length >= MAX_PLATFORM_PATH)
+			return false;
+
+		for (size_t i{}; i <= length; ++i)
+			buffer[i] = path[i];
+#endif
+
+		//create every prefix ending at a separator, then the whole path. Skips the root ("/", "C:\")
+		for (uint32 i{ 1 }; buffer[i]; ++i)
+		{
+			if ((buffer[i] != '/' && buffer[i] != '\\') || buffer[i - 1] == ':')
+				continue;
+
+			const auto separator{ buffer[i] };
+			buffer[i] = 0;
+			const bool made{ MakeDirectory(buffer) };
+			buffer[i] = separator;
+			if (!made)
+				return false;
+		}
+
+		const uint32 last{ static_cast<uint32>(StringLength(buffer)) };
+		if (last > 0 && (buffer[last - 1] == '/' || buffer[last - 1] == '\\'))
+			return true;
+
+		return MakeDirectory(buffer);
+	}
+
+	struct DirectoryWalk
+	{
+		char path[MAX_PLATFORM_PATH];
+		size_t rootLength;		//path[rootLength] is the separator after the root
+		size_t length;
+		WalkFn fn;
+		void* data;
+		bool ok;
+	};
+
+	internal void WalkEntry(const DirectoryEntry& entry, void* data)
+	{
+		DirectoryWalk& walk{ *static_cast<DirectoryWalk*>(data) };
+		const size_t nameLength{ StringLength(entry.name) };
+		const size_t parentLength{ walk.length };
+		if (parentLength + 1 + nameLength >= MAX_PLATFORM_PATH)
+		{
+			walk.ok = false;
+			return;
+		}
+
+		walk.path[parentLength] = '/';
+		memcpy(walk.path + parentLength + 1, entry.name, nameLength + 1);
+		walk.length = parentLength + 1 + nameLength;
+
+		if (entry.isDirectory)
+			walk.ok = ListDirectory(walk.path, WalkEntry, &walk) && walk.ok;
+		else
+			walk.fn(walk.path + walk.rootLength + 1, walk.data);
+
+		walk.length = parentLength;
+		walk.path[parentLength] = 0;
+	}
+
+	bool WalkDirectory(const char* path, WalkFn fn, void* data)
+	{
+		DirectoryWalk walk;
+		walk.rootLength = StringLength(path);
+		while (walk.rootLength > 1 && (path[walk.rootLength - 1] == '/' || path[walk.rootLength - 1] == '\\'))
+			--walk.rootLength;
+		if (walk.rootLength == 0 || walk.rootLength >= MAX_PLATFORM_PATH)
+			return false;
+
+		memcpy(walk.path, path, walk.rootLength);
+		walk.path[walk.rootLength] = 0;
+		walk.length = walk.rootLength;
+		walk.fn = fn;
+		walk.data = data;
+		walk.ok = true;
+		return ListDirectory(walk.path, WalkEntry, &walk) && walk.ok;
+	}
+
+	Span<uint8> ReadEntireFile(const char* path, Arena& arena)
+	{
+		File file;
+		if (!FileOpen(file, path, FileAccessRead))
+			return {};
+
+		const ArenaMarker marker{ GetArenaMarker(arena) };
+		const uint64 size{ FileSize(file) };
+		uint8* data{ PushArray<uint8>(arena, size ? size : 1) };
+		const bool read{ data && FileRead(file, data, size, 0) == size };
+		FileClose(file);
+
+		if (!read)
+		{
+			RewindArena(marker);
+			return {};
+		}
+
+		return { data, static_cast<size_t>(size) };
+	}
+
+	bool WriteEntireFile(const char* path, const void* data, const uint64 size)
+	{
+		File file;
+		if (!FileOpen(file, path, FileAccessWrite))
+			return false;
+
+		const bool written{ FileWrite(file, data, size, 0) == size };
+		FileClose(file);
+		return written;
+	}
+
+}
@@ -0,0 +1,701 @@
+//  Filename: fileWatcher 
+//	Author:	Daniel														
+//	Date: 19/10/2026 07:12:40		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "RadiantEngine/platform/fileWatcher.h"
+#include "RadiantEngine/platform/file.h"
+#include "RadiantEngine/platform/thread.h"
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/clock.h"
+#include "RadiantEngine/core/hash.h"
+#include "RadiantEngine/core/hashMap.h"
+#include "RadiantEngine/core/memoryTracker.h"
+
+namespace RE
+{
+
+	//Changes waiting for the quiet period. Past this a watch is reported as FileChangeRescan instead
+	internal constexpr uint32 MAX_PENDING_FILE_CHANGES{ 4096 };
+	internal constexpr uint64 FILE_WATCH_PATHS_RESERVE{ 16ull * 1024 * 1024 };
+	internal constexpr uint32 FILE_WATCH_BUFFER_SIZE{ 64 * 1024 };
+
+	//Callers move a watch Free -> Adding and Active -> Removing, the watcher thread finishes both. Only the watcher
+	//thread touches the OS handles, so a callback can't run against a half built or half torn down watch
+	enum eFileWatchState : uint32
+	{
+		FileWatchFree = 0,
+		FileWatchAdding,
+		FileWatchActive,
+		FileWatchFailed,
+		FileWatchRemoving
+	};
+
+	struct DirectoryWatch
+	{
+		std::atomic<uint32> state;
+		FileChangeFn fn;
+		void* data;
+		char directory[MAX_PLATFORM_PATH];
+		bool rescan;		//events were lost since the last dispatch
+
+#if defined(_WIN32)
+		HANDLE handle;
+		OVERLAPPED overlapped;
+		uint8* buffer;		//FILE_WATCH_BUFFER_SIZE, FILE_NOTIFY_INFORMATION records
+		wchar_t wideDirectory[MAX_PLATFORM_PATH];
+#else
+		int fd;				//one inotify instance per watch, two watches over the same tree don't share descriptors
+		//watch descriptor -> directory relative to the watched one, in names
+		HashMap<int32, const char*> directories;
+		Arena names;
+#endif
+	};
+
+	struct PendingFileChange
+	{
+		uint32 watch;
+		const char* path;	//in FileWatcher::paths
+		eFileChange type;
+		bool dropped;		//created and removed again
+	};
+
+	struct FileWatcher
+	{
+		DirectoryWatch watches[MAX_FILE_WATCHES];
+		std::atomic_flag lock;		//slot allocation between callers
+		std::atomic<bool> quit;
+		int64 quietNs;
+		Thread thread;
+		bool running;				//between a successful InitFileWatcher and ShutdownFileWatcher
+
+		//watcher thread only
+		PendingFileChange* pending;	//MAX_PENDING_FILE_CHANGES
+		uint32 numPending;
+		HashMap<uint64, uint32> pendingIndex;	//Hash64 of the path seeded with the watch -> pending
+		Arena paths;
+		int64 lastEventNs;
+
+#if defined(_WIN32)
+		HANDLE wake;
+#else
+		int wake;		//eventfd
+#endif
+	};
+
+	internal FileWatcher fileWatcher;
+
+	internal void WakeFileWatcher()
+	{
+#if defined(_WIN32)
+		SetEvent(fileWatcher.wake);
+#else
+		const uint64 one{ 1 };
+		[[maybe_unused]] const ssize_t written{ write(fileWatcher.wake, &one, sizeof(one)) };
+#endif
+	}
+
+	internal RE_INLINE uint32 FileWatchIndex(const DirectoryWatch& watch)
+	{
+		return static_cast<uint32>(&watch - fileWatcher.watches);
+	}
+
+	//Merges type into what is already pending for the path
+	internal void MergeFileChange(PendingFileChange& change, const eFileChange type)
+	{
+		if (change.dropped)
+		{
+			//removed and created again before anyone saw it: still only created
+			if (type != FileChangeRemoved)
+			{
+				change.type = FileChangeAdded;
+				change.dropped = false;
+			}
+			return;
+		}
+
+		if (change.type == FileChangeAdded && type == FileChangeModified)
+			return;
+		if (change.type == FileChangeAdded && type == FileChangeRemoved)
+			change.dropped = true;
+		else if (change.type == FileChangeRemoved && type != FileChangeRemoved)
+			change.type = FileChangeModified;
+		else
+			change.type = type;
+	}
+
+	internal void AddFileChange(DirectoryWatch& watch, const char* path, const eFileChange type)
+	{
+		fileWatcher.lastEventNs = GetTimeNs();
+		if (watch.rescan)
+			return;
+
+		const uint32 index{ FileWatchIndex(watch) };
+		const size_t length{ strlen(path) };
+		const uint64 key{ Hash64(path, length, index) };
+		const uint32* existing{ fileWatcher.pendingIndex.find(key) };
+		if (existing && fileWatcher.pending[*existing].watch == index && !strcmp(fileWatcher.pending[*existing].path, path))
+		{
+			MergeFileChange(fileWatcher.pending[*existing], type);
+			return;
+		}
+
+		//a hash collision takes over the index, the older path is still reported, only not merged anymore
+		char* copy{ fileWatcher.numPending < MAX_PENDING_FILE_CHANGES ? static_cast<char*>(PushSize(fileWatcher.paths, length + 1, 1)) : nullptr };
+		bool added;
+		uint32* slot{ copy ? fileWatcher.pendingIndex.findOrAdd(key, added) : nullptr };
+		if (!slot)
+		{
+			watch.rescan = true;
+			return;
+		}
+		memcpy(copy, path, length + 1);
+		*slot = fileWatcher.numPending;
+		fileWatcher.pending[fileWatcher.numPending++] = { .watch = index, .path = copy, .type = type, .dropped = false };
+	}
+
+	internal bool HasPendingFileChanges()
+	{
+		if (fileWatcher.numPending)
+			return true;
+		for (const DirectoryWatch& watch : fileWatcher.watches)
+			if (watch.rescan)
+				return true;
+		return false;
+	}
+
+	internal void DispatchFileChanges()
+	{
+		ScratchArena scratch{ BeginScratch() };
+		FileChange* changes{ PushArray<FileChange>(*scratch.arena, fileWatcher.numPending + 1) };
+
+		for (DirectoryWatch& watch : fileWatcher.watches)
+		{
+			if (watch.state.load(std::memory_order_acquire) != FileWatchActive)
+				continue;
+
+			uint32 num{};
+			if (watch.rescan)
+			{
+				changes[num++] = { .path = "", .type = FileChangeRescan };
+			}
+			else
+			{
+				const uint32 index{ FileWatchIndex(watch) };
+				for (uint32 i{}; i < fileWatcher.numPending; ++i)
+				{
+					const PendingFileChange& change{ fileWatcher.pending[i] };
+					if (change.watch == index && !change.dropped)
+						changes[num++] = { .path = change.path, .type = change.type };
+				}
+			}
+
+			if (num)
+				watch.fn(changes, num, watch.data);
+		}
+
+		EndScratch(scratch);
+		for (DirectoryWatch& watch : fileWatcher.watches)
+			watch.rescan = false;
+		fileWatcher.numPending = 0;
+		fileWatcher.pendingIndex.clear();
+		ResetArena(fileWatcher.paths);
+	}
+
+#if defined(_WIN32)
+	internal bool IssueDirectoryRead(DirectoryWatch& watch)
+	{
+		internal constexpr DWORD FILTER{ FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE |
+			FILE_NOTIFY_CHANGE_SIZE };
+		return ReadDirectoryChangesW(watch.handle, watch.buffer, FILE_WATCH_BUFFER_SIZE, TRUE, FILTER, nullptr, &watch.overlapped, nullptr);
+	}
+
+	internal bool StartDirectoryWatch(DirectoryWatch& watch)
+	{
+		if (!MultiByteToWideChar(CP_UTF8, 0, watch.directory, -1, watch.wideDirectory, MAX_PLATFORM_PATH))
+			return false;
+
+		watch.handle = CreateFileW(watch.wideDirectory, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+			OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if (watch.handle == INVALID_HANDLE_VALUE)
+			return false;
+
+		watch.overlapped = {};
+		watch.overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+		watch.buffer = static_cast<uint8*>(TrackedAlloc(MemoryTagCore, FILE_WATCH_BUFFER_SIZE, alignof(DWORD)));
+		if (watch.overlapped.hEvent && watch.buffer && IssueDirectoryRead(watch))
+			return true;
+
+		if (watch.overlapped.hEvent)
+			CloseHandle(watch.overlapped.hEvent);
+		TrackedFree(watch.buffer);
+		CloseHandle(watch.handle);
+		return false;
+	}
+
+	internal void StopDirectoryWatch(DirectoryWatch& watch)
+	{
+		//the buffer belongs to the read until it has really finished
+		DWORD bytes;
+		if (CancelIoEx(watch.handle, &watch.overlapped) || GetLastError() != ERROR_NOT_FOUND)
+			GetOverlappedResult(watch.handle, &watch.overlapped, &bytes, TRUE);
+
+		CloseHandle(watch.overlapped.hEvent);
+		CloseHandle(watch.handle);
+		TrackedFree(watch.buffer);
+	}
+
+	internal void ReadDirectoryEvents(DirectoryWatch& watch)
+	{
+		DWORD bytes{};
+		if (!GetOverlappedResult(watch.handle, &watch.overlapped, &bytes, FALSE) || bytes == 0)
+		{
+			//ERROR_NOTIFY_ENUM_DIR or 0 bytes: the buffer overflowed and the events are gone
+			watch.rescan = true;
+			fileWatcher.lastEventNs = GetTimeNs();
+		}
+		else
+		{
+			const uint8* record{ watch.buffer };
+			for (;;)
+			{
+				const FILE_NOTIFY_INFORMATION& info{ *reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(record) };
+				const int nameLength{ static_cast<int>(info.FileNameLength / sizeof(wchar_t)) };
+
+				char path[MAX_PLATFORM_PATH];
+				const int length{ WideCharToMultiByte(CP_UTF8, 0, info.FileName, nameLength, path, MAX_PLATFORM_PATH - 1, nullptr, nullptr) };
+
+				//directories show up like files, whatever still exists can be asked. Removed ones can't and are reported
+				wchar_t fullPath[MAX_PLATFORM_PATH];
+				DWORD attributes{ INVALID_FILE_ATTRIBUTES };
+				if (_snwprintf_s(fullPath, MAX_PLATFORM_PATH, _TRUNCATE, L"%ls\\%.*ls", watch.wideDirectory, nameLength, info.FileName) > 0)
+					attributes = GetFileAttributesW(fullPath);
+				const bool isDirectory{ attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY) };
+
+				if (length > 0 && !isDirectory)
+				{
+					path[length] = '\0';
+					for (int i{}; i < length; ++i)
+						if (path[i] == '\\')
+							path[i] = '/';
+
+					switch (info.Action)
+					{
+					case FILE_ACTION_ADDED:
+					case FILE_ACTION_RENAMED_NEW_NAME:	AddFileChange(watch, path, FileChangeAdded); break;
+					case FILE_ACTION_MODIFIED:			AddFileChange(watch, path, FileChangeModified); break;
+					case FILE_ACTION_REMOVED:
+					case FILE_ACTION_RENAMED_OLD_NAME:	AddFileChange(watch, path, FileChangeRemoved); break;
+					default:							break;
+					}
+				}
+
+				if (!info.NextEntryOffset)
+					break;
+				record += info.NextEntryOffset;
+			}
+		}
+
+		//the directory itself went away when this fails, the watch stays silent until it's removed
+		if (!IssueDirectoryRead(watch))
+			watch.rescan = true;
+	}
+
+	internal void WaitFileWatchEvents(const int64 timeoutNs)
+	{
+		HANDLE handles[MAX_FILE_WATCHES + 1]{ fileWatcher.wake };
+		DirectoryWatch* owners[MAX_FILE_WATCHES + 1]{};
+		DWORD num{ 1 };
+		for (DirectoryWatch& watch : fileWatcher.watches)
+		{
+			if (watch.state.load(std::memory_order_acquire) == FileWatchActive)
+			{
+				owners[num] = &watch;
+				handles[num++] = watch.overlapped.hEvent;
+			}
+		}
+
+		const DWORD timeoutMs{ timeoutNs < 0 ? INFINITE : static_cast<DWORD>((timeoutNs + 999999) / 1000000) };
+		const DWORD result{ WaitForMultipleObjects(num, handles, FALSE, timeoutMs) };
+		//only the first signaled handle is returned, the others are still signaled on the next wait
+		if (result > WAIT_OBJECT_0 && result < WAIT_OBJECT_0 + num)
+			ReadDirectoryEvents(*owners[result - WAIT_OBJECT_0]);
+	}
+#else
+	internal constexpr uint32 INOTIFY_MASK{ IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_ONLYDIR | IN_EXCL_UNLINK };
+
+	struct InotifyWalk
+	{
+		DirectoryWatch* watch;
+		char relative[MAX_PLATFORM_PATH];
+		size_t length;
+		bool reportFiles;	//directories created after the watch started may have files in them before they are watched
+	};
+
+	internal bool AddInotifyDirectory(InotifyWalk& walk);
+
+	internal void InotifyWalkEntry(const DirectoryEntry& entry, void* data)
+	{
+		InotifyWalk& walk{ *static_cast<InotifyWalk*>(data) };
+		const size_t parentLength{ walk.length };
+		const int written{ snprintf(walk.relative + parentLength, MAX_PLATFORM_PATH - parentLength, parentLength ? "/%s" : "%s", entry.name) };
+		if (written < 0 || parentLength + static_cast<size_t>(written) >= MAX_PLATFORM_PATH)
+		{
+			walk.relative[parentLength] = '\0';
+			return;
+		}
+
+		walk.length += static_cast<size_t>(written);
+		if (entry.isDirectory)
+			AddInotifyDirectory(walk);
+		else if (walk.reportFiles)
+			AddFileChange(*walk.watch, walk.relative, FileChangeAdded);
+		walk.length = parentLength;
+		walk.relative[parentLength] = '\0';
+	}
+
+	//Watches walk.relative and everything under it
+	internal bool AddInotifyDirectory(InotifyWalk& walk)
+	{
+		DirectoryWatch& watch{ *walk.watch };
+		char fullPath[MAX_PLATFORM_PATH];
+		const int written{ snprintf(fullPath, MAX_PLATFORM_PATH, walk.length ? "%s/%s" : "%s", watch.directory, walk.relative) };
+		if (written < 0 || written >= static_cast<int>(MAX_PLATFORM_PATH))
+			return false;
+
+		const int wd{ inotify_add_watch(watch.fd, fullPath, INOTIFY_MASK) };
+		if (wd < 0)
+			return false;
+
+		char* name{ static_cast<char*>(PushSize(watch.names, walk.length + 1, 1)) };
+		bool added;
+		const char** slot{ name ? watch.directories.findOrAdd(wd, added) : nullptr };
+		if (!slot)
+		{
+			inotify_rm_watch(watch.fd, wd);
+			return false;
+		}
+		memcpy(name, walk.relative, walk.length + 1);
+		*slot = name;
+
+		return ListDirectory(fullPath, InotifyWalkEntry, &walk);
+	}
+
+	internal bool StartDirectoryWatch(DirectoryWatch& watch)
+	{
+		watch.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (watch.fd < 0)
+			return false;
+
+		watch.directories = {};
+		watch.directories.allocator = TaggedAllocator(MemoryTagCore);
+		if (InitArena(watch.names, FILE_WATCH_PATHS_RESERVE, MemoryTagCore))
+		{
+			InotifyWalk walk{ .watch = &watch, .relative = {}, .length = 0, .reportFiles = false };
+			if (AddInotifyDirectory(walk))
+				return true;
+			ShutdownArena(watch.names);
+		}
+
+		watch.directories.release();
+		close(watch.fd);
+		return false;
+	}
+
+	internal void StopDirectoryWatch(DirectoryWatch& watch)
+	{
+		//closing the instance drops every descriptor in it
+		close(watch.fd);
+		watch.directories.release();
+		ShutdownArena(watch.names);
+	}
+
+	//A directory moved away keeps its descriptors, they would report events under the old path
+	internal void RemoveInotifyDirectories(DirectoryWatch& watch, const char* relative)
+	{
+		const size_t length{ strlen(relative) };
+		for (size_t i{}; i < watch.directories.capacity; ++i)
+		{
+			if (!watch.directories.isFull(i))
+				continue;
+			const char* name{ watch.directories.values[i] };
+			if (!strncmp(name, relative, length) && (name[length] == '\0' || name[length] == '/'))
+				inotify_rm_watch(watch.fd, watch.directories.keys[i]);
+		}
+	}
+
+	internal void ReadDirectoryEvents(DirectoryWatch& watch)
+	{
+		alignas(inotify_event) uint8 buffer[FILE_WATCH_BUFFER_SIZE];
+		for (;;)
+		{
+			const ssize_t bytes{ read(watch.fd, buffer, sizeof(buffer)) };
+			if (bytes <= 0)
+				break;
+
+			for (ssize_t offset{}; offset < bytes;)
+			{
+				const inotify_event& event{ *reinterpret_cast<const inotify_event*>(buffer + offset) };
+				offset += static_cast<ssize_t>(sizeof(inotify_event) + event.len);
+
+				if (event.mask & IN_Q_OVERFLOW)
+				{
+					watch.rescan = true;
+					fileWatcher.lastEventNs = GetTimeNs();
+					continue;
+				}
+
+				if (event.mask & IN_IGNORED)
+				{
+					watch.directories.erase(event.wd);
+					continue;
+				}
+
+				const char* const* directory{ watch.directories.find(event.wd) };
+				if (!directory || !event.len)
+					continue;
+
+				InotifyWalk walk{ .watch = &watch, .relative = {}, .length = 0, .reportFiles = true };
+				const int written{ snprintf(walk.relative, MAX_PLATFORM_PATH, **directory ? "%s/%s" : "%s%s", *directory, event.name) };
+				if (written < 0 || written >= static_cast<int>(MAX_PLATFORM_PATH))
+					continue;
+				walk.length = static_cast<size_t>(written);
+
+				if (event.mask & IN_ISDIR)
+				{
+					if (event.mask & (IN_CREATE | IN_MOVED_TO))
+						AddInotifyDirectory(walk);
+					else if (event.mask & IN_MOVED_FROM)
+						RemoveInotifyDirectories(watch, walk.relative);
+					continue;
+				}
+
+				if (event.mask & (IN_CREATE | IN_MOVED_TO))
+					AddFileChange(watch, walk.relative, FileChangeAdded);
+				else if (event.mask & IN_CLOSE_WRITE)
+					AddFileChange(watch, walk.relative, FileChangeModified);
+				else if (event.mask & (IN_DELETE | IN_MOVED_FROM))
+					AddFileChange(watch, walk.relative, FileChangeRemoved);
+			}
+		}
+	}
+
+	internal void WaitFileWatchEvents(const int64 timeoutNs)
+	{
+		pollfd fds[MAX_FILE_WATCHES + 1]{ { .fd = fileWatcher.wake, .events = POLLIN, .revents = 0 } };
+		DirectoryWatch* owners[MAX_FILE_WATCHES + 1]{};
+		nfds_t num{ 1 };
+		for (DirectoryWatch& watch : fileWatcher.watches)
+		{
+			if (watch.state.load(std::memory_order_acquire) == FileWatchActive)
+			{
+				owners[num] = &watch;
+				fds[num++] = { .fd = watch.fd, .events = POLLIN, .revents = 0 };
+			}
+		}
+
+		const int timeoutMs{ timeoutNs < 0 ? -1 : static_cast<int>((timeoutNs + 999999) / 1000000) };
+		if (poll(fds, num, timeoutMs) <= 0)
+			return;
+
+		if (fds[0].revents & POLLIN)
+		{
+			uint64 count;
+			[[maybe_unused]] const ssize_t bytes{ read(fileWatcher.wake, &count, sizeof(count)) };
+		}
+		for (nfds_t i{ 1 }; i < num; ++i)
+			if (fds[i].revents & POLLIN)
+				ReadDirectoryEvents(*owners[i]);
+	}
+#endif
+
+	//Watches added and removed since the last pass, between dispatches so fn never races UnwatchDirectory
+	internal void ApplyFileWatchRequests()
+	{
+		for (DirectoryWatch& watch : fileWatcher.watches)
+		{
+			const uint32 state{ watch.state.load(std::memory_order_acquire) };
+			if (state == FileWatchAdding)
+			{
+				watch.rescan = false;
+				watch.state.store(StartDirectoryWatch(watch) ? FileWatchActive : FileWatchFailed, std::memory_order_release);
+			}
+			else if (state == FileWatchRemoving)
+			{
+				StopDirectoryWatch(watch);
+				const uint32 index{ FileWatchIndex(watch) };
+				for (uint32 i{}; i < fileWatcher.numPending; ++i)
+					if (fileWatcher.pending[i].watch == index)
+						fileWatcher.pending[i].dropped = true;
+				watch.rescan = false;
+				watch.state.store(FileWatchFree, std::memory_order_release);
+			}
+		}
+	}
+
+	internal void FileWatcherEntry(void*)
+	{
+		while (!fileWatcher.quit.load(std::memory_order_acquire))
+		{
+			//sleep until something happens, or until the pending changes have been quiet long enough
+			int64 timeoutNs{ -1 };
+			if (HasPendingFileChanges())
+			{
+				const int64 quietFor{ GetTimeNs() - fileWatcher.lastEventNs };
+				timeoutNs = quietFor < fileWatcher.quietNs ? fileWatcher.quietNs - quietFor : 0;
+			}
+			if (timeoutNs != 0)
+				WaitFileWatchEvents(timeoutNs);
+
+			ApplyFileWatchRequests();
+			if (HasPendingFileChanges() && GetTimeNs() - fileWatcher.lastEventNs >= fileWatcher.quietNs)
+				DispatchFileChanges();
+		}
+
+		for (DirectoryWatch& watch : fileWatcher.watches)
+		{
+			const uint32 state{ watch.state.load(std::memory_order_acquire) };
+			if (state == FileWatchActive || state == FileWatchRemoving)
+				StopDirectoryWatch(watch);
+			watch.state.store(state == FileWatchAdding ? FileWatchFailed : FileWatchFree, std::memory_order_release);
+		}
+		ReleaseScratchArenas();
+	}
+
+	bool InitFileWatcher(const FileWatcherConfig& config)
+	{
+		fileWatcher.quietNs = MsToNs(config.quietMs ? config.quietMs : DEFAULT_FILE_WATCH_QUIET_MS);
+		fileWatcher.quit.store(false, std::memory_order_relaxed);
+		fileWatcher.numPending = 0;
+		fileWatcher.lastEventNs = 0;
+		fileWatcher.pendingIndex = {};
+		fileWatcher.pendingIndex.allocator = TaggedAllocator(MemoryTagCore);
+		for (DirectoryWatch& watch : fileWatcher.watches)
+		{
+			watch.state.store(FileWatchFree, std::memory_order_relaxed);
+			watch.rescan = false;
+		}
+
+		fileWatcher.pending = static_cast<PendingFileChange*>(TrackedAlloc(MemoryTagCore, sizeof(PendingFileChange) * MAX_PENDING_FILE_CHANGES));
+		if (!fileWatcher.pending)
+			return false;
+		if (!InitArena(fileWatcher.paths, FILE_WATCH_PATHS_RESERVE, MemoryTagCore))
+		{
+			TrackedFree(fileWatcher.pending);
+			return false;
+		}
+
+#if defined(_WIN32)
+		fileWatcher.wake = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+		const bool wakeValid{ fileWatcher.wake != nullptr };
+#else
+		fileWatcher.wake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		const bool wakeValid{ fileWatcher.wake >= 0 };
+#endif
+		fileWatcher.running = wakeValid && StartThread(fileWatcher.thread, FileWatcherEntry, nullptr);
+		if (fileWatcher.running)
+			return true;
+
+		if (wakeValid)
+		{
+#if defined(_WIN32)
+			CloseHandle(fileWatcher.wake);
+#else
+			close(fileWatcher.wake);
+#endif
+		}
+		ShutdownArena(fileWatcher.paths);
+		TrackedFree(fileWatcher.pending);
+		return false;
+	}
+
+	void ShutdownFileWatcher()
+	{
+		if (!fileWatcher.running)
+			return;
+
+		fileWatcher.running = false;
+		fileWatcher.quit.store(true, std::memory_order_release);
+		WakeFileWatcher();
+		JoinThread(fileWatcher.thread);
+
+#if defined(_WIN32)
+		CloseHandle(fileWatcher.wake);
+#else
+		close(fileWatcher.wake);
+#endif
+		fileWatcher.pendingIndex.release();
+		ShutdownArena(fileWatcher.paths);
+		TrackedFree(fileWatcher.pending);
+		fileWatcher.pending = nullptr;
+	}
+
+	uint32 WatchDirectory(const char* directory, FileChangeFn fn, void* data)
+	{
+		//nobody would pick the watch up, it would stay in FileWatchAdding
+		if (!fileWatcher.running || !fn || strlen(directory) >= MAX_PLATFORM_PATH)
+			return INVALID_FILE_WATCH;
+
+		DirectoryWatch* watch{};
+		while (fileWatcher.lock.test_and_set(std::memory_order_acquire))
+			YieldThread();
+		for (DirectoryWatch& candidate : fileWatcher.watches)
+		{
+			if (candidate.state.load(std::memory_order_acquire) == FileWatchFree)
+			{
+				watch = &candidate;
+				watch->fn = fn;
+				watch->data = data;
+				strcpy(watch->directory, directory);
+				watch->state.store(FileWatchAdding, std::memory_order_release);
+				break;
+			}
+		}
+		fileWatcher.lock.clear(std::memory_order_release);
+		if (!watch)
+			return INVALID_FILE_WATCH;
+
+		//the watcher thread opens the directory, everything OS side stays on one thread
+		WakeFileWatcher();
+		uint32 state;
+		while ((state = watch->state.load(std::memory_order_acquire)) == FileWatchAdding)
+			YieldThread();
+
+		if (state == FileWatchFailed)
+		{
+			watch->state.store(FileWatchFree, std::memory_order_release);
+			return INVALID_FILE_WATCH;
+		}
+		return FileWatchIndex(*watch) + 1;
+	}
+
+	void UnwatchDirectory(const uint32 watch)
+	{
+		if (watch == INVALID_FILE_WATCH || watch > MAX_FILE_WATCHES)
+			return;
+
+		DirectoryWatch& w{ fileWatcher.watches[watch - 1] };
+		uint32 expected{ FileWatchActive };
+		if (!w.state.compare_exchange_strong(expected, FileWatchRemoving, std::memory_order_acq_rel))
+			return;
+
+		WakeFileWatcher();
+		while (w.state.load(std::memory_order_acquire) != FileWatchFree)
+			YieldThread();
+	}
+
+}
@@ -0,0 +1,69 @@
+//  Filename: library 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:41:19		
+//  Sqwack-Studios													
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include "RadiantEngine/platform/library.h"
+#include "RadiantEngine/platform/file.h"
+
+namespace RE
+{
+
+#if defined(_WIN32)
+
+	bool OpenLibrary(Library& library, const char* path)
+	{
+		wchar_t widePath[MAX_PLATFORM_PATH];
+		if (!MultiByteToWideChar(CP_UTF8, 0, path, -1, widePath, MAX_PLATFORM_PATH))
+		{
+			library.handle = nullptr;
+			return false;
+		}
+
+		library.handle = LoadLibraryW(widePath);
+		return library.handle != nullptr;
+	}
+
+	void CloseLibrary(Library& library)
+	{
+		if (library.handle)
+			FreeLibrary(static_cast<HMODULE>(library.handle));
+
+		library.handle = nullptr;
+	}
+
+	void* LibrarySymbol(const Library& library, const char* name)
+	{
+		return library.handle ? reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(library.handle), name)) : nullptr;
+	}
+
+#else
+
+	bool OpenLibrary(Library& library, const char* path)
+	{
+		library.handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+		return library.handle != nullptr;
+	}
+
+	void CloseLibrary(Library& library)
+	{
+		if (library.handle)
+			dlclose(library.handle);
+
+		library.handle = nullptr;
+	}
+
+	void* LibrarySymbol(const Library& library, const char* name)
+	{
+		return library.handle ? dlsym(library.handle, name) : nullptr;
+	}
+
+#endif
+
+}
@@ -0,0 +1,160 @@
+//  Filename: thread 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:36:48		
+//  Sqwack-Studios													
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#include "RadiantEngine/platform/thread.h"
+
+namespace RE
+{
+
+#if defined(_WIN32)
+
+	static_assert(sizeof(HANDLE) <= sizeof(Semaphore::storage), "Semaphore storage too small");
+
+	internal RE_INLINE HANDLE& SemaphoreHandle(Semaphore& semaphore) { return *reinterpret_cast<HANDLE*>(semaphore.storage); }
+
+	internal DWORD WINAPI ThreadEntry(void* param)
+	{
+		const Thread& thread{ *static_cast<const Thread*>(param) };
+		thread.fn(thread.data);
+		return 0;
+	}
+
+	bool StartThread(Thread& thread, const ThreadFn fn, void* data)
+	{
+		thread.fn = fn;
+		thread.data = data;
+		const HANDLE handle{ CreateThread(nullptr, 0, ThreadEntry, &thread, 0, nullptr) };
+		thread.handle = reinterpret_cast<uint64>(handle);
+		return handle != nullptr;
+	}
+
+	void JoinThread(Thread& thread)
+	{
+		const HANDLE handle{ reinterpret_cast<HANDLE>(thread.handle) };
+		if (!handle)
+			return;
+
+		WaitForSingleObject(handle, INFINITE);
+		CloseHandle(handle);
+		thread.handle = 0;
+	}
+
+	void YieldThread()
+	{
+		SwitchToThread();
+	}
+
+	uint32 GetNumCores()
+	{
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return info.dwNumberOfProcessors;
+	}
+
+	bool InitSemaphore(Semaphore& semaphore, const uint32 initialCount)
+	{
+		SemaphoreHandle(semaphore) = CreateSemaphoreW(nullptr, initialCount, LONG_MAX, nullptr);
+		return SemaphoreHandle(semaphore) != nullptr;
+	}
+
+	void ShutdownSemaphore(Semaphore& semaphore)
+	{
+		CloseHandle(SemaphoreHandle(semaphore));
+		SemaphoreHandle(semaphore) = nullptr;
+	}
+
+	void SignalSemaphore(Semaphore& semaphore, const uint32 count)
+	{
+		ReleaseSemaphore(SemaphoreHandle(semaphore), count, nullptr);
+	}
+
+	void WaitSemaphore(Semaphore& semaphore)
+	{
+		WaitForSingleObject(SemaphoreHandle(semaphore), INFINITE);
+	}
+
+#else
+
+	static_assert(sizeof(pthread_t) <= sizeof(uint64), "pthread_t doesn't fit Thread::handle");
+	static_assert(sizeof(sem_t) <= sizeof(Semaphore::storage) && alignof(sem_t) <= 8, "Semaphore storage too small");
+
+	internal RE_INLINE sem_t* SemaphoreHandle(Semaphore& semaphore) { return reinterpret_cast<sem_t*>(semaphore.storage); }
+
+	internal void* ThreadEntry(void* param)
+	{
+		const Thread& thread{ *static_cast<const Thread*>(param) };
+		thread.fn(thread.data);
+		return nullptr;
+	}
+
+	bool StartThread(Thread& thread, const ThreadFn fn, void* data)
+	{
+		thread.fn = fn;
+		thread.data = data;
+
+		pthread_t handle;
+		if (pthread_create(&handle, nullptr, ThreadEntry, &thread) != 0)
+		{
+			thread.handle = 0;
+			return false;
+		}
+
+		thread.handle = static_cast<uint64>(handle);
+		return true;
+	}
+
+	void JoinThread(Thread& thread)
+	{
+		if (!thread.handle)
+			return;
+
+		pthread_join(static_cast<pthread_t>(thread.handle), nullptr);
+		thread.handle = 0;
+	}
+
+	void YieldThread()
+	{
+		sched_yield();
+	}
+
+	uint32 GetNumCores()
+	{
+		const long n{ sysconf(_SC_NPROCESSORS_ONLN) };
+		return n > 0 ? static_cast<uint32>(n) : 1;
+	}
+
+	bool InitSemaphore(Semaphore& semaphore, const uint32 initialCount)
+	{
+		return sem_init(SemaphoreHandle(semaphore), 0, initialCount) == 0;
+	}
+
+	void ShutdownSemaphore(Semaphore& semaphore)
+	{
+		sem_destroy(SemaphoreHandle(semaphore));
+	}
+
+	void SignalSemaphore(Semaphore& semaphore, const uint32 count)
+	{
+		for (uint32 i{}; i < count; ++i)
+			sem_post(SemaphoreHandle(semaphore));
+	}
+
+	void WaitSemaphore(Semaphore& semaphore)
+	{
+		while (sem_wait(SemaphoreHandle(semaphore)) != 0) {}
+	}
+
+#endif
+
+}
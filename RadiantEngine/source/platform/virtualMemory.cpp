@@ -0,0 +1,79 @@
+//  Filename: virtualMemory 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:31:06		
+//  Sqwack-Studios													
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "RadiantEngine/platform/virtualMemory.h"
+
+namespace RE
+{
+
+#if defined(_WIN32)
+
+	uint64 GetPageSize()
+	{
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return info.dwPageSize;
+	}
+
+	void* ReserveMemory(const uint64 size)
+	{
+		return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+	}
+
+	bool CommitMemory(void* p, const uint64 size)
+	{
+		return VirtualAlloc(p, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+	}
+
+	void DecommitMemory(void* p, const uint64 size)
+	{
+		VirtualFree(p, size, MEM_DECOMMIT);
+	}
+
+	void ReleaseMemory(void* p, const uint64)
+	{
+		VirtualFree(p, 0, MEM_RELEASE);
+	}
+
+#else
+
+	uint64 GetPageSize()
+	{
+		const long size{ sysconf(_SC_PAGESIZE) };
+		return size > 0 ? static_cast<uint64>(size) : 4096;
+	}
+
+	void* ReserveMemory(const uint64 size)
+	{
+		void* p{ mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0) };
+		return p == MAP_FAILED ? nullptr : p;
+	}
+
+	bool CommitMemory(void* p, const uint64 size)
+	{
+		return mprotect(p, size, PROT_READ | PROT_WRITE) == 0;
+	}
+
+	void DecommitMemory(void* p, const uint64 size)
+	{
+		madvise(p, size, MADV_DONTNEED);
+		mprotect(p, size, PROT_NONE);
+	}
+
+	void ReleaseMemory(void* p, const uint64 size)
+	{
+		munmap(p, size);
+	}
+
+#endif
+
+}
@@ -0,0 +1,600 @@
+//  Filename: window 
+//	Author:	Daniel														
+//	Date: 19/10/2026 03:58:26		
+//  Sqwack-Studios													
+
+#include <cstring>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#endif
+
+#include "RadiantEngine/platform/window.h"
+
+//after the engine headers, Xlib defines macros such as None, Bool and Status, and XKBstr.h has a field called internal
+#if !defined(_WIN32) && defined(__linux__) && __has_include(<X11/Xlib.h>)
+#define RE_X11_WINDOW 1
+#include "RadiantEngine/platform/library.h"
+#pragma push_macro("internal")
+#undef internal
+#include <X11/Xlib.h>
+#include <X11/XKBlib.h>
+#include <X11/keysym.h>
+#pragma pop_macro("internal")
+#endif
+
+namespace RE
+{
+
+	internal WindowEvent MakeWindowEvent(const eWindowEvent type)
+	{
+		WindowEvent event{};
+		event.type = type;
+		return event;
+	}
+
+	internal void PushWindowEvent(Window& window, const WindowEvent& event)
+	{
+		//only the final size matters, dragging a border sends dozens
+		if (event.type == WindowEventResize && window.numEvents > 0 && window.events[window.numEvents - 1].type == WindowEventResize)
+		{
+			window.events[window.numEvents - 1] = event;
+			return;
+		}
+
+		if (window.numEvents < WINDOW_EVENT_QUEUE_SIZE)
+			window.events[window.numEvents++] = event;
+	}
+
+	internal void InitHeadless(Window& window, const WindowDesc& desc)
+	{
+		window = {};
+		window.width = desc.width ? desc.width : 1;
+		window.height = desc.height ? desc.height : 1;
+		window.headless = true;
+	}
+
+#if defined(_WIN32)
+
+	internal constexpr wchar_t WINDOW_CLASS_NAME[]{ L"RadiantWindow" };
+
+	internal LRESULT CALLBACK WindowProc(HWND hwnd, UINT message, WPARAM wParam, LPARAM lParam)
+	{
+		if (message == WM_NCCREATE)
+		{
+			const CREATESTRUCTW* create{ reinterpret_cast<const CREATESTRUCTW*>(lParam) };
+			SetWindowLongPtrW(hwnd, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(create->lpCreateParams));
+		}
+
+		Window* window{ reinterpret_cast<Window*>(GetWindowLongPtrW(hwnd, GWLP_USERDATA)) };
+		if (!window)
+			return DefWindowProcW(hwnd, message, wParam, lParam);
+
+		switch (message)
+		{
+		case WM_CLOSE:
+		{
+			//the application decides, ShutdownWindow destroys it
+			PushWindowEvent(*window, MakeWindowEvent(WindowEventClose));
+			return 0;
+		}
+		case WM_SIZE:
+		{
+			if (wParam == SIZE_MINIMIZED)
+				return 0;
+
+			const uint32 width{ LOWORD(lParam) > 0 ? LOWORD(lParam) : 1u };
+			const uint32 height{ HIWORD(lParam) > 0 ? HIWORD(lParam) : 1u };
+			if (width != window->width || height != window->height)
+			{
+				window->width = width;
+				window->height = height;
+				WindowEvent event{ MakeWindowEvent(WindowEventResize) };
+				event.width = width;
+				event.height = height;
+				PushWindowEvent(*window, event);
+			}
+			return 0;
+		}
+		case WM_KEYDOWN:
+		case WM_SYSKEYDOWN:
+		{
+			WindowEvent event{ MakeWindowEvent(WindowEventKeyDown) };
+			event.repeat = ((lParam >> 30) & 1) != 0;
+			event.key = static_cast<uint32>(wParam);
+			PushWindowEvent(*window, event);
+			//keeps Alt+F4 and friends working
+			if (message == WM_SYSKEYDOWN)
+				break;
+			return 0;
+		}
+		case WM_KEYUP:
+		case WM_SYSKEYUP:
+		{
+			WindowEvent event{ MakeWindowEvent(WindowEventKeyUp) };
+			event.key = static_cast<uint32>(wParam);
+			PushWindowEvent(*window, event);
+			if (message == WM_SYSKEYUP)
+				break;
+			return 0;
+		}
+		case WM_SETFOCUS:
+		case WM_KILLFOCUS:
+		{
+			WindowEvent event{ MakeWindowEvent(WindowEventFocus) };
+			event.focused = message == WM_SETFOCUS;
+			PushWindowEvent(*window, event);
+			return 0;
+		}
+		}
+
+		return DefWindowProcW(hwnd, message, wParam, lParam);
+	}
+
+	internal bool RegisterWindowClass(const HINSTANCE instance)
+	{
+		persistent bool registered{};
+		if (registered)
+			return true;
+
+		SetProcessDPIAware();
+
+		WNDCLASSEXW windowClass{};
+		windowClass.cbSize = sizeof(WNDCLASSEXW);
+		windowClass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
+		windowClass.lpfnWndProc = WindowProc;
+		windowClass.hInstance = instance;
+		windowClass.hIcon = LoadIcon(nullptr, IDI_APPLICATION);
+		windowClass.hCursor = LoadCursor(nullptr, IDC_ARROW);
+		windowClass.hbrBackground = reinterpret_cast<HBRUSH>(COLOR_WINDOW + 1);
+		windowClass.lpszClassName = WINDOW_CLASS_NAME;
+		windowClass.hIconSm = LoadIcon(nullptr, IDI_APPLICATION);
+
+		registered = RegisterClassExW(&windowClass) != 0;
+		return registered;
+	}
+
+	bool InitWindow(Window& window, const WindowDesc& desc)
+	{
+		InitHeadless(window, desc);
+		if (desc.headless)
+			return true;
+
+		window.headless = false;
+
+		const HINSTANCE instance{ GetModuleHandleW(nullptr) };
+		wchar_t title[256];
+		if (!RegisterWindowClass(instance) || !MultiByteToWideChar(CP_UTF8, 0, desc.title ? desc.title : "", -1, title, 256))
+			return false;
+
+		//size the frame so the client area is the requested one, centered on the primary monitor
+		RECT rect{ 0, 0, static_cast<LONG>(window.width), static_cast<LONG>(window.height) };
+		AdjustWindowRect(&rect, WS_OVERLAPPEDWINDOW, FALSE);
+		const int32 frameWidth{ rect.right - rect.left };
+		const int32 frameHeight{ rect.bottom - rect.top };
+		const int32 x{ (GetSystemMetrics(SM_CXSCREEN) - frameWidth) / 2 };
+		const int32 y{ (GetSystemMetrics(SM_CYSCREEN) - frameHeight) / 2 };
+
+		const HWND hwnd{ CreateWindowExW(0, WINDOW_CLASS_NAME, title, WS_OVERLAPPEDWINDOW, x > 0 ? x : 0, y > 0 ? y : 0,
+			frameWidth, frameHeight, nullptr, nullptr, instance, &window) };
+		if (!hwnd)
+			return false;
+
+		window.native = hwnd;
+		window.numEvents = 0;	//creation sizes aren't news
+		return true;
+	}
+
+	void ShutdownWindow(Window& window)
+	{
+		if (window.native)
+		{
+			const HWND hwnd{ static_cast<HWND>(window.native) };
+			SetWindowLongPtrW(hwnd, GWLP_USERDATA, 0);
+			DestroyWindow(hwnd);
+		}
+
+		window.native = nullptr;
+		window.numEvents = 0;
+	}
+
+	internal void DispatchMessages(Window& window)
+	{
+		if (!window.native)
+			return;
+
+		MSG message;
+		while (PeekMessageW(&message, nullptr, 0, 0, PM_REMOVE))
+		{
+			TranslateMessage(&message);
+			DispatchMessageW(&message);
+		}
+	}
+
+	void MakeWindowVisible(Window& window)
+	{
+		if (window.native)
+			::ShowWindow(static_cast<HWND>(window.native), SW_SHOW);
+	}
+
+	void SetWindowFullscreen(Window& window, const bool fullscreen)
+	{
+		if (window.fullscreen == fullscreen)
+			return;
+
+		window.fullscreen = fullscreen;
+		if (!window.native)
+			return;
+
+		const HWND hwnd{ static_cast<HWND>(window.native) };
+		if (fullscreen)
+		{
+			RECT rect;
+			GetWindowRect(hwnd, &rect);
+			window.restoreX = rect.left;
+			window.restoreY = rect.top;
+			window.restoreWidth = rect.right - rect.left;
+			window.restoreHeight = rect.bottom - rect.top;
+
+			const UINT style{ WS_OVERLAPPEDWINDOW & ~(WS_CAPTION | WS_BORDER | WS_SYSMENU | WS_THICKFRAME | WS_MAXIMIZEBOX | WS_MINIMIZEBOX) };
+			SetWindowLongW(hwnd, GWL_STYLE, style);
+
+			MONITORINFO monitorInfo{};
+			monitorInfo.cbSize = sizeof(MONITORINFO);
+			GetMonitorInfoW(MonitorFromWindow(hwnd, MONITOR_DEFAULTTONEAREST), &monitorInfo);
+			SetWindowPos(hwnd, HWND_TOP, monitorInfo.rcMonitor.left, monitorInfo.rcMonitor.top,
+				monitorInfo.rcMonitor.right - monitorInfo.rcMonitor.left, monitorInfo.rcMonitor.bottom - monitorInfo.rcMonitor.top,
+				SWP_FRAMECHANGED | SWP_NOACTIVATE);
+			::ShowWindow(hwnd, SW_MAXIMIZE);
+		}
+		else
+		{
+			SetWindowLongW(hwnd, GWL_STYLE, WS_OVERLAPPEDWINDOW);
+			SetWindowPos(hwnd, HWND_TOP, window.restoreX, window.restoreY, window.restoreWidth, window.restoreHeight, SWP_FRAMECHANGED | SWP_NOACTIVATE);
+			::ShowWindow(hwnd, SW_NORMAL);
+		}
+	}
+
+#elif defined(RE_X11_WINDOW)
+
+	//libX11 is loaded by the first windowed InitWindow, so headless runs don't need it installed. One display connection
+	//is shared by every window and closed with the last one
+	internal constexpr uint32 MAX_X11_WINDOWS{ 8 };
+
+	struct X11State
+	{
+		Library library;
+		Display* display;
+		Window* windows[MAX_X11_WINDOWS];
+		uint32 numWindows;
+		bool keysDown[256];		//by keycode, tells repeats from first presses
+
+		Atom wmProtocols;
+		Atom wmDeleteWindow;
+		Atom netWmName;
+		Atom netWmState;
+		Atom netWmStateFullscreen;
+		Atom utf8String;
+
+		decltype(&XOpenDisplay) OpenDisplay;
+		decltype(&XCloseDisplay) CloseDisplay;
+		decltype(&XInternAtom) InternAtom;
+		decltype(&XCreateSimpleWindow) CreateSimpleWindow;
+		decltype(&XDestroyWindow) DestroyWindow;
+		decltype(&XStoreName) StoreName;
+		decltype(&XChangeProperty) ChangeProperty;
+		decltype(&XSetWMProtocols) SetWMProtocols;
+		decltype(&XSelectInput) SelectInput;
+		decltype(&XMapWindow) MapWindow;
+		decltype(&XPending) Pending;
+		decltype(&XNextEvent) NextEvent;
+		decltype(&XLookupKeysym) LookupKeysym;
+		decltype(&XSendEvent) SendEvent;
+		decltype(&XFlush) Flush;
+		decltype(&XkbSetDetectableAutoRepeat) SetDetectableAutoRepeat;
+	};
+
+	internal X11State x11{};
+
+	internal bool OpenX11()
+	{
+		if (x11.display)
+			return true;
+
+		if (!OpenLibrary(x11.library, "libX11.so.6"))
+			return false;
+
+		x11.OpenDisplay = LibraryFunction<decltype(&XOpenDisplay)>(x11.library, "XOpenDisplay");
+		x11.CloseDisplay = LibraryFunction<decltype(&XCloseDisplay)>(x11.library, "XCloseDisplay");
+		x11.InternAtom = LibraryFunction<decltype(&XInternAtom)>(x11.library, "XInternAtom");
+		x11.CreateSimpleWindow = LibraryFunction<decltype(&XCreateSimpleWindow)>(x11.library, "XCreateSimpleWindow");
+		x11.DestroyWindow = LibraryFunction<decltype(&XDestroyWindow)>(x11.library, "XDestroyWindow");
+		x11.StoreName = LibraryFunction<decltype(&XStoreName)>(x11.library, "XStoreName");
+		x11.ChangeProperty = LibraryFunction<decltype(&XChangeProperty)>(x11.library, "XChangeProperty");
+		x11.SetWMProtocols = LibraryFunction<decltype(&XSetWMProtocols)>(x11.library, "XSetWMProtocols");
+		x11.SelectInput = LibraryFunction<decltype(&XSelectInput)>(x11.library, "XSelectInput");
+		x11.MapWindow = LibraryFunction<decltype(&XMapWindow)>(x11.library, "XMapWindow");
+		x11.Pending = LibraryFunction<decltype(&XPending)>(x11.library, "XPending");
+		x11.NextEvent = LibraryFunction<decltype(&XNextEvent)>(x11.library, "XNextEvent");
+		x11.LookupKeysym = LibraryFunction<decltype(&XLookupKeysym)>(x11.library, "XLookupKeysym");
+		x11.SendEvent = LibraryFunction<decltype(&XSendEvent)>(x11.library, "XSendEvent");
+		x11.Flush = LibraryFunction<decltype(&XFlush)>(x11.library, "XFlush");
+		x11.SetDetectableAutoRepeat = LibraryFunction<decltype(&XkbSetDetectableAutoRepeat)>(x11.library, "XkbSetDetectableAutoRepeat");
+
+		const bool loaded{ x11.OpenDisplay && x11.CloseDisplay && x11.InternAtom && x11.CreateSimpleWindow && x11.DestroyWindow &&
+			x11.StoreName && x11.ChangeProperty && x11.SetWMProtocols && x11.SelectInput && x11.MapWindow && x11.Pending &&
+			x11.NextEvent && x11.LookupKeysym && x11.SendEvent && x11.Flush && x11.SetDetectableAutoRepeat };
+
+		//no DISPLAY, or it can't be reached
+		x11.display = loaded ? x11.OpenDisplay(nullptr) : nullptr;
+		if (!x11.display)
+		{
+			CloseLibrary(x11.library);
+			return false;
+		}
+
+		x11.wmProtocols = x11.InternAtom(x11.display, "WM_PROTOCOLS", False);
+		x11.wmDeleteWindow = x11.InternAtom(x11.display, "WM_DELETE_WINDOW", False);
+		x11.netWmName = x11.InternAtom(x11.display, "_NET_WM_NAME", False);
+		x11.netWmState = x11.InternAtom(x11.display, "_NET_WM_STATE", False);
+		x11.netWmStateFullscreen = x11.InternAtom(x11.display, "_NET_WM_STATE_FULLSCREEN", False);
+		x11.utf8String = x11.InternAtom(x11.display, "UTF8_STRING", False);
+
+		//held keys send presses only, like WM_KEYDOWN, instead of release/press pairs
+		x11.SetDetectableAutoRepeat(x11.display, True, nullptr);
+		return true;
+	}
+
+	internal void CloseX11()
+	{
+		x11.CloseDisplay(x11.display);
+		CloseLibrary(x11.library);
+		x11.display = nullptr;
+	}
+
+	internal uint32 TranslateKeySym(const KeySym sym)
+	{
+		//XK_A..XK_Z and XK_0..XK_9 are their ASCII codes
+		if (sym >= XK_a && sym <= XK_z)
+			return static_cast<uint32>(sym - XK_a + 'A');
+		if ((sym >= XK_A && sym <= XK_Z) || (sym >= XK_0 && sym <= XK_9))
+			return static_cast<uint32>(sym);
+		if (sym >= XK_F1 && sym <= XK_F12)
+			return static_cast<uint32>(KeyF1 + (sym - XK_F1));
+
+		switch (sym)
+		{
+		case XK_BackSpace:	return KeyBackspace;
+		case XK_Tab:		return KeyTab;
+		case XK_Return:
+		case XK_KP_Enter:	return KeyEnter;
+		case XK_Escape:		return KeyEscape;
+		case XK_space:		return KeySpace;
+		case XK_Left:		return KeyLeft;
+		case XK_Up:			return KeyUp;
+		case XK_Right:		return KeyRight;
+		case XK_Down:		return KeyDown;
+		default:			return KeyUnknown;
+		}
+	}
+
+	internal RE_INLINE ::Window NativeX11Window(const Window& window) { return static_cast<::Window>(reinterpret_cast<uintptr_t>(window.native)); }
+
+	internal Window* FindX11Window(const ::Window xwindow)
+	{
+		for (uint32 i{}; i < x11.numWindows; ++i)
+		{
+			if (NativeX11Window(*x11.windows[i]) == xwindow)
+				return x11.windows[i];
+		}
+
+		return nullptr;
+	}
+
+	bool InitWindow(Window& window, const WindowDesc& desc)
+	{
+		InitHeadless(window, desc);
+		if (desc.headless)
+			return true;
+
+		window.headless = false;
+		if (x11.numWindows == MAX_X11_WINDOWS || !OpenX11())
+			return false;
+
+		//centered on the default screen, the window manager may place it elsewhere
+		const int screen{ DefaultScreen(x11.display) };
+		const int32 x{ (DisplayWidth(x11.display, screen) - static_cast<int32>(window.width)) / 2 };
+		const int32 y{ (DisplayHeight(x11.display, screen) - static_cast<int32>(window.height)) / 2 };
+		const ::Window xwindow{ x11.CreateSimpleWindow(x11.display, RootWindow(x11.display, screen), x > 0 ? x : 0, y > 0 ? y : 0,
+			window.width, window.height, 0, BlackPixel(x11.display, screen), BlackPixel(x11.display, screen)) };
+		if (!xwindow)
+		{
+			if (x11.numWindows == 0)
+				CloseX11();
+			return false;
+		}
+
+		//WM_NAME is Latin-1, _NET_WM_NAME carries the UTF-8 title for modern window managers
+		const char* title{ desc.title ? desc.title : "" };
+		x11.StoreName(x11.display, xwindow, title);
+		x11.ChangeProperty(x11.display, xwindow, x11.netWmName, x11.utf8String, 8, PropModeReplace,
+			reinterpret_cast<const unsigned char*>(title), static_cast<int>(strlen(title)));
+
+		//the close button sends WM_DELETE_WINDOW instead of killing the connection
+		Atom protocols[]{ x11.wmDeleteWindow };
+		x11.SetWMProtocols(x11.display, xwindow, protocols, 1);
+		x11.SelectInput(x11.display, xwindow, StructureNotifyMask | KeyPressMask | KeyReleaseMask | FocusChangeMask);
+
+		window.native = reinterpret_cast<void*>(static_cast<uintptr_t>(xwindow));
+		window.numEvents = 0;
+		x11.windows[x11.numWindows++] = &window;
+		return true;
+	}
+
+	void ShutdownWindow(Window& window)
+	{
+		if (window.native)
+		{
+			x11.DestroyWindow(x11.display, NativeX11Window(window));
+			for (uint32 i{}; i < x11.numWindows; ++i)
+			{
+				if (x11.windows[i] == &window)
+				{
+					x11.windows[i] = x11.windows[--x11.numWindows];
+					break;
+				}
+			}
+
+			if (x11.numWindows == 0)
+				CloseX11();
+		}
+
+		window.native = nullptr;
+		window.numEvents = 0;
+	}
+
+	internal void HandleX11Event(Window& window, const XEvent& event)
+	{
+		switch (event.type)
+		{
+		case ClientMessage:
+		{
+			//the application decides, ShutdownWindow destroys it
+			if (event.xclient.message_type == x11.wmProtocols && static_cast<Atom>(event.xclient.data.l[0]) == x11.wmDeleteWindow)
+				PushWindowEvent(window, MakeWindowEvent(WindowEventClose));
+			break;
+		}
+		case ConfigureNotify:
+		{
+			const uint32 width{ event.xconfigure.width > 0 ? static_cast<uint32>(event.xconfigure.width) : 1u };
+			const uint32 height{ event.xconfigure.height > 0 ? static_cast<uint32>(event.xconfigure.height) : 1u };
+			if (width != window.width || height != window.height)
+			{
+				window.width = width;
+				window.height = height;
+				WindowEvent resize{ MakeWindowEvent(WindowEventResize) };
+				resize.width = width;
+				resize.height = height;
+				PushWindowEvent(window, resize);
+			}
+			break;
+		}
+		case KeyPress:
+		case KeyRelease:
+		{
+			const bool down{ event.type == KeyPress };
+			bool& held{ x11.keysDown[event.xkey.keycode & 0xFF] };
+			WindowEvent key{ MakeWindowEvent(down ? WindowEventKeyDown : WindowEventKeyUp) };
+			key.repeat = down && held;
+			//unshifted keysym, so Shift+A is still 'A'
+			key.key = TranslateKeySym(x11.LookupKeysym(const_cast<XKeyEvent*>(&event.xkey), 0));
+			held = down;
+			PushWindowEvent(window, key);
+			break;
+		}
+		case FocusIn:
+		case FocusOut:
+		{
+			//releases that happen while unfocused are never seen
+			if (event.type == FocusOut)
+				memset(x11.keysDown, 0, sizeof(x11.keysDown));
+
+			WindowEvent focus{ MakeWindowEvent(WindowEventFocus) };
+			focus.focused = event.type == FocusIn;
+			PushWindowEvent(window, focus);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	internal void DispatchMessages(Window& window)
+	{
+		if (!window.native)
+			return;
+
+		//events go to the window they belong to, like the Win32 window procedure
+		while (x11.Pending(x11.display) > 0)
+		{
+			XEvent event;
+			x11.NextEvent(x11.display, &event);
+			if (Window* target{ FindX11Window(event.xany.window) })
+				HandleX11Event(*target, event);
+		}
+	}
+
+	void MakeWindowVisible(Window& window)
+	{
+		if (!window.native)
+			return;
+
+		x11.MapWindow(x11.display, NativeX11Window(window));
+		x11.Flush(x11.display);
+	}
+
+	//The window manager does the borderless monitor sized placement and restores the old one, restoreX... stay unused
+	void SetWindowFullscreen(Window& window, const bool fullscreen)
+	{
+		if (window.fullscreen == fullscreen)
+			return;
+
+		window.fullscreen = fullscreen;
+		if (!window.native)
+			return;
+
+		XEvent event{};
+		event.xclient.type = ClientMessage;
+		event.xclient.window = NativeX11Window(window);
+		event.xclient.message_type = x11.netWmState;
+		event.xclient.format = 32;
+		event.xclient.data.l[0] = fullscreen ? 1 : 0;		//_NET_WM_STATE_ADD / _NET_WM_STATE_REMOVE
+		event.xclient.data.l[1] = static_cast<long>(x11.netWmStateFullscreen);
+		event.xclient.data.l[3] = 1;						//request from a normal application
+
+		const ::Window root{ RootWindow(x11.display, DefaultScreen(x11.display)) };
+		x11.SendEvent(x11.display, root, False, SubstructureRedirectMask | SubstructureNotifyMask, &event);
+		x11.Flush(x11.display);
+	}
+
+#else
+
+	bool InitWindow(Window& window, const WindowDesc& desc)
+	{
+		InitHeadless(window, desc);
+		return desc.headless;
+	}
+
+	void ShutdownWindow(Window& window)
+	{
+		window.numEvents = 0;
+	}
+
+	internal void DispatchMessages(Window&) {}
+
+	void MakeWindowVisible(Window&) {}
+
+	void SetWindowFullscreen(Window& window, const bool fullscreen)
+	{
+		window.fullscreen = fullscreen;
+	}
+
+#endif
+
+	uint32 PumpWindowEvents(Window& window, WindowEvent* out, const uint32 max)
+	{
+		DispatchMessages(window);
+
+		const uint32 num{ window.numEvents < max ? window.numEvents : max };
+		memcpy(out, window.events, sizeof(WindowEvent) * num);
+		memmove(window.events, window.events + num, sizeof(WindowEvent) * (window.numEvents - num));
+		window.numEvents -= num;
+		return num;
+	}
+
+	void RequestWindowClose(Window& window)
+	{
+		PushWindowEvent(window, MakeWindowEvent(WindowEventClose));
+	}
+
+}
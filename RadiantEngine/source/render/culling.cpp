@@ -0,0 +1,197 @@
+//  Filename: culling 
+//	Author:	Daniel														
+//	Date: 18/10/2026 15:31:09		
+//  Sqwack-Studios													
+
+#include <bit>
+#include <cstring>
+
+#include "RadiantEngine/render/culling.h"
+
+namespace RE
+{
+
+	struct FrustumLanes
+	{
+		fp32x8 nx[6], ny[6], nz[6], d[6];
+		fp32x8 absNx[6], absNy[6], absNz[6];
+	};
+
+	internal float4 NormalizePlane(const float4 p)
+	{
+		const fp32 invLength{ 1.f / length(float3{ p.x, p.y, p.z }) };
+		return p * invLength;
+	}
+
+	internal void SplatFrustum(const Frustum& f, FrustumLanes& lanes)
+	{
+		for (int32 i{}; i < 6; ++i)
+		{
+			const float4 p{ f.planes[i] };
+			lanes.nx[i] = splat8(p.x);
+			lanes.ny[i] = splat8(p.y);
+			lanes.nz[i] = splat8(p.z);
+			lanes.d[i] = splat8(p.w);
+			lanes.absNx[i] = splat8(std::fabs(p.x));
+			lanes.absNy[i] = splat8(std::fabs(p.y));
+			lanes.absNz[i] = splat8(std::fabs(p.z));
+		}
+	}
+
+#if RE_SIMD_AVX
+	//Left-pack table: for every 8 bit mask, the lane indices of its set bits packed to the front
+	struct CompactLUT
+	{
+		uint8 lanes[256][8];
+	};
+
+	internal constexpr CompactLUT MakeCompactLUT()
+	{
+		CompactLUT lut{};
+		for (uint32 mask{}; mask < 256; ++mask)
+		{
+			uint32 n{};
+			for (uint32 j{}; j < 8; ++j)
+			{
+				if (mask & (1u << j))
+					lut.lanes[mask][n++] = static_cast<uint8>(j);
+			}
+		}
+		return lut;
+	}
+
+	internal constexpr CompactLUT compactLUT{ MakeCompactLUT() };
+
+	//Writes all 8 lanes and advances by the visible count. out needs room for 8 entries past cursor.
+	RE_INLINE uint32 EmitVisible(uint32* out, const uint32 cursor, const uint32 base, const uint32 mask)
+	{
+		const __m256i lanes{ _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(compactLUT.lanes[mask]))) };
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + cursor), _mm256_add_epi32(lanes, _mm256_set1_epi32(static_cast<int32>(base))));
+		return cursor + static_cast<uint32>(std::popcount(mask));
+	}
+#else
+	RE_INLINE uint32 EmitVisible(uint32* out, uint32 cursor, const uint32 base, uint32 mask)
+	{
+		while (mask)
+		{
+			out[cursor++] = base + static_cast<uint32>(std::countr_zero(mask));
+			mask &= mask - 1;
+		}
+		return cursor;
+	}
+#endif
+
+	internal bool SphereVisible(const Frustum& f, const float3 c, const fp32 r)
+	{
+		for (int32 i{}; i < 6; ++i)
+		{
+			const float4 p{ f.planes[i] };
+			if (p.x * c.x + p.y * c.y + p.z * c.z + p.w <= -r)
+				return false;
+		}
+		return true;
+	}
+
+	internal bool AABBVisible(const Frustum& f, const float3 c, const float3 e)
+	{
+		for (int32 i{}; i < 6; ++i)
+		{
+			const float4 p{ f.planes[i] };
+			const fp32 dist{ p.x * c.x + p.y * c.y + p.z * c.z + p.w };
+			const fp32 radius{ std::fabs(p.x) * e.x + std::fabs(p.y) * e.y + std::fabs(p.z) * e.z };
+			if (dist <= -radius)
+				return false;
+		}
+		return true;
+	}
+
+	Frustum FrustumFromMatrix(const float4x4& m)
+	{
+		const float4 r0{ m.r[0] }, r1{ m.r[1] }, r2{ m.r[2] }, r3{ m.r[3] };
+
+		Frustum f;
+		f.planes[eFrustumPlane::Left] = NormalizePlane(r3 + r0);
+		f.planes[eFrustumPlane::Right] = NormalizePlane(r3 - r0);
+		f.planes[eFrustumPlane::Bottom] = NormalizePlane(r3 + r1);
+		f.planes[eFrustumPlane::Top] = NormalizePlane(r3 - r1);
+		f.planes[eFrustumPlane::Near] = NormalizePlane(r2);
+		f.planes[eFrustumPlane::Far] = NormalizePlane(r3 - r2);
+		return f;
+	}
+
+	CullResult CullSpheres(const Frustum& frustum, const SphereSoA s, const uint32 begin, const uint32 end, uint32* out)
+	{
+		FrustumLanes lanes;
+		SplatFrustum(frustum, lanes);
+
+		uint32 cursor{};
+		uint32 i{ begin };
+		for (; i + 8 <= end; i += 8)
+		{
+			const fp32x8 x{ load8(s.x + i) }, y{ load8(s.y + i) }, z{ load8(s.z + i) };
+			const fp32x8 negRadius{ -load8(s.radius + i) };
+
+			fp32x8 inside{ cmpGt(madd(lanes.nz[0], z, madd(lanes.ny[0], y, madd(lanes.nx[0], x, lanes.d[0]))), negRadius) };
+			for (int32 p{ 1 }; p < 6; ++p)
+				inside = inside & cmpGt(madd(lanes.nz[p], z, madd(lanes.ny[p], y, madd(lanes.nx[p], x, lanes.d[p]))), negRadius);
+
+			cursor = EmitVisible(out, cursor, i, moveMask(inside));
+		}
+
+		for (; i < end; ++i)
+		{
+			out[cursor] = i;
+			cursor += SphereVisible(frustum, float3{ s.x[i], s.y[i], s.z[i] }, s.radius[i]) ? 1 : 0;
+		}
+
+		return { cursor, (end - begin) - cursor };
+	}
+
+	CullResult CullAABBs(const Frustum& frustum, const AABBSoA b, const uint32 begin, const uint32 end, uint32* out)
+	{
+		FrustumLanes lanes;
+		SplatFrustum(frustum, lanes);
+
+		uint32 cursor{};
+		uint32 i{ begin };
+		for (; i + 8 <= end; i += 8)
+		{
+			const fp32x8 cx{ load8(b.centerX + i) }, cy{ load8(b.centerY + i) }, cz{ load8(b.centerZ + i) };
+			const fp32x8 ex{ load8(b.extentX + i) }, ey{ load8(b.extentY + i) }, ez{ load8(b.extentZ + i) };
+
+			fp32x8 inside{ cmpGe(ex, ex) }; //all lanes set
+			for (int32 p{}; p < 6; ++p)
+			{
+				//projected extent onto the plane normal
+				const fp32x8 negRadius{ -madd(lanes.absNz[p], ez, madd(lanes.absNy[p], ey, lanes.absNx[p] * ex)) };
+				const fp32x8 dist{ madd(lanes.nz[p], cz, madd(lanes.ny[p], cy, madd(lanes.nx[p], cx, lanes.d[p]))) };
+				inside = inside & cmpGt(dist, negRadius);
+			}
+
+			cursor = EmitVisible(out, cursor, i, moveMask(inside));
+		}
+
+		for (; i < end; ++i)
+		{
+			out[cursor] = i;
+			cursor += AABBVisible(frustum, float3{ b.centerX[i], b.centerY[i], b.centerZ[i] }, float3{ b.extentX[i], b.extentY[i], b.extentZ[i] }) ? 1 : 0;
+		}
+
+		return { cursor, (end - begin) - cursor };
+	}
+
+	uint32 MergeCullRanges(uint32* out, const uint32* rangeBegins, const CullResult* results, const uint32 numRanges)
+	{
+		//ranges are in increasing order and every range writes at or after its begin, so moving down never overlaps a
+		//range that hasn't been copied yet
+		uint32 total{};
+		for (uint32 r{}; r < numRanges; ++r)
+		{
+			if (rangeBegins[r] != total)
+				memmove(out + total, out + rangeBegins[r], sizeof(uint32) * results[r].numVisible);
+			total += results[r].numVisible;
+		}
+		return total;
+	}
+
+}
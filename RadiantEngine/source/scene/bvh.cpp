@@ -0,0 +1,828 @@
+//  Filename: bvh 
+//	Author:	Daniel														
+//	Date: 18/10/2026 18:20:36		
+//  Sqwack-Studios													
+
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <cstdint>
+
+#include "RadiantEngine/scene/bvh.h"
+#include "RadiantEngine/core/memoryTracker.h"
+#include "RadiantEngine/core/jobs.h"
+#include "RadiantEngine/math/vectorAlgebra.h"
+#include "RadiantEngine/math/floatNx8.h"
+
+namespace RE
+{
+
+	internal constexpr uint32 NUM_BINS{ 16 };
+	//subtrees below this size are not worth a task of their own
+	internal constexpr uint32 MIN_TASK_PRIMITIVES{ 512 };
+	//subtrees are uneven, a few per thread lets stealing even them out
+	internal constexpr uint32 TASKS_PER_THREAD{ 4 };
+	//SAH cost of visiting a node relative to intersecting one primitive
+	internal constexpr fp32 TRAVERSAL_COST{ 1.f };
+	internal constexpr fp32 NO_HIT{ INFINITY };
+
+	struct Bin
+	{
+		float3 min;
+		float3 max;
+		uint32 count;
+	};
+
+	struct BuildEntry
+	{
+		uint32 node;
+		uint32 depth;
+	};
+
+	internal float3 Min3(const float3 a, const float3 b) { return { a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z }; }
+	internal float3 Max3(const float3 a, const float3 b) { return { a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z }; }
+	internal fp32 Axis(const float3& v, const uint32 axis) { return (&v.x)[axis]; }
+
+	internal fp32 HalfArea(const float3 mn, const float3 mx)
+	{
+		const float3 d{ mx - mn };
+		return d.x * d.y + d.y * d.z + d.z * d.x;
+	}
+
+	internal bool AllocateBVH(BVH& bvh, const uint32 numPrims)
+	{
+		bvh.numPrims = numPrims;
+		if (numPrims == 0)
+			return true;
+
+		//nodes go first so the other arrays don't break their 32 byte alignment. A binary tree with n leaves has at most 2n - 1 nodes
+		const size_t nodeBytes{ sizeof(BVHNode) * (2 * static_cast<size_t>(numPrims) - 1) };
+		const size_t bytes{ nodeBytes + numPrims * (sizeof(uint32) + sizeof(float3) * 3) + alignof(BVHNode) };
+		bvh.memory = TrackedAlloc(MemoryTagScene, bytes);
+
+		if (!bvh.memory)
+			return false;
+
+		uint8* block{ reinterpret_cast<uint8*>((reinterpret_cast<uintptr_t>(bvh.memory) + alignof(BVHNode) - 1) & ~(alignof(BVHNode) - 1)) };
+		bvh.nodes = reinterpret_cast<BVHNode*>(block);
+		bvh.primMin = reinterpret_cast<float3*>(block + nodeBytes);
+		bvh.primMax = bvh.primMin + numPrims;
+		bvh.centroids = bvh.primMax + numPrims;
+		bvh.primIndices = reinterpret_cast<uint32*>(bvh.centroids + numPrims);
+		return true;
+	}
+
+	bool InitBVH(BVH& bvh, const float3* vertices, const uint32* indices, const uint32 numTriangles)
+	{
+		bvh = {};
+		bvh.vertices = vertices;
+		bvh.indices = indices;
+		return AllocateBVH(bvh, numTriangles);
+	}
+
+	bool InitBVH(BVH& bvh, const float3* boxMin, const float3* boxMax, const uint32 numBoxes)
+	{
+		bvh = {};
+		bvh.boxMin = boxMin;
+		bvh.boxMax = boxMax;
+		return AllocateBVH(bvh, numBoxes);
+	}
+
+	void ShutdownBVH(BVH& bvh)
+	{
+		TrackedFree(bvh.memory);
+		TrackedFree(bvh.tasks);
+		bvh = {};
+	}
+
+	internal void ComputePrimitiveBounds(BVH& bvh)
+	{
+		if (bvh.vertices)
+		{
+			for (uint32 i{}; i < bvh.numPrims; ++i)
+			{
+				const float3 a{ bvh.vertices[bvh.indices[i * 3]] };
+				const float3 b{ bvh.vertices[bvh.indices[i * 3 + 1]] };
+				const float3 c{ bvh.vertices[bvh.indices[i * 3 + 2]] };
+				bvh.primMin[i] = Min3(a, Min3(b, c));
+				bvh.primMax[i] = Max3(a, Max3(b, c));
+			}
+		}
+		else
+		{
+			memcpy(bvh.primMin, bvh.boxMin, sizeof(float3) * bvh.numPrims);
+			memcpy(bvh.primMax, bvh.boxMax, sizeof(float3) * bvh.numPrims);
+		}
+
+		for (uint32 i{}; i < bvh.numPrims; ++i)
+			bvh.centroids[i] = (bvh.primMin[i] + bvh.primMax[i]) * 0.5f;
+	}
+
+	internal void MakeLeaf(const BVH& bvh, BVHNode& node, const uint32 first, const uint32 count)
+	{
+		float3 mn{ INFINITY, INFINITY, INFINITY };
+		float3 mx{ -INFINITY, -INFINITY, -INFINITY };
+		for (uint32 i{ first }; i < first + count; ++i)
+		{
+			const uint32 p{ bvh.primIndices[i] };
+			mn = Min3(mn, bvh.primMin[p]);
+			mx = Max3(mx, bvh.primMax[p]);
+		}
+
+		node.min = mn;
+		node.max = mx;
+		node.leftFirst = first;
+		node.count = count;
+	}
+
+	//Partitions the node's primitives on the cheapest SAH plane. Returns how many went to the left child, 0 when the
+	//node is better off as a leaf
+	internal uint32 SplitNode(BVH& bvh, const BVHNode& node)
+	{
+		const uint32 first{ node.leftFirst };
+		const uint32 count{ node.count };
+
+		if (count <= 1)
+			return 0;
+
+		float3 cmin{ INFINITY, INFINITY, INFINITY };
+		float3 cmax{ -INFINITY, -INFINITY, -INFINITY };
+		for (uint32 i{ first }; i < first + count; ++i)
+		{
+			cmin = Min3(cmin, bvh.centroids[bvh.primIndices[i]]);
+			cmax = Max3(cmax, bvh.centroids[bvh.primIndices[i]]);
+		}
+
+		fp32 bestCost{ INFINITY };
+		uint32 bestAxis{};
+		uint32 bestBin{};
+
+		for (uint32 axis{}; axis < 3; ++axis)
+		{
+			const fp32 lo{ Axis(cmin, axis) };
+			const fp32 extent{ Axis(cmax, axis) - lo };
+			if (extent <= 0.f)
+				continue;
+
+			Bin bins[NUM_BINS];
+			for (Bin& b : bins)
+				b = { { INFINITY, INFINITY, INFINITY }, { -INFINITY, -INFINITY, -INFINITY }, 0 };
+
+			const fp32 scale{ NUM_BINS / extent };
+			for (uint32 i{ first }; i < first + count; ++i)
+			{
+				const uint32 p{ bvh.primIndices[i] };
+				const uint32 b{ static_cast<uint32>((Axis(bvh.centroids[p], axis) - lo) * scale) };
+				Bin& bin{ bins[b < NUM_BINS ? b : NUM_BINS - 1] };
+				bin.min = Min3(bin.min, bvh.primMin[p]);
+				bin.max = Max3(bin.max, bvh.primMax[p]);
+				bin.count++;
+			}
+
+			//plane i sits between bin i and bin i + 1
+			fp32 leftCost[NUM_BINS - 1];
+			float3 mn{ INFINITY, INFINITY, INFINITY }, mx{ -INFINITY, -INFINITY, -INFINITY };
+			uint32 n{};
+			for (uint32 i{}; i < NUM_BINS - 1; ++i)
+			{
+				n += bins[i].count;
+				mn = Min3(mn, bins[i].min);
+				mx = Max3(mx, bins[i].max);
+				leftCost[i] = n ? n * HalfArea(mn, mx) : 0.f;
+			}
+
+			mn = { INFINITY, INFINITY, INFINITY };
+			mx = { -INFINITY, -INFINITY, -INFINITY };
+			n = 0;
+			for (uint32 i{ NUM_BINS - 1 }; i > 0; --i)
+			{
+				n += bins[i].count;
+				mn = Min3(mn, bins[i].min);
+				mx = Max3(mx, bins[i].max);
+				const fp32 cost{ leftCost[i - 1] + (n ? n * HalfArea(mn, mx) : 0.f) };
+				if (cost < bestCost && n != count && n != 0)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestBin = i - 1;
+				}
+			}
+		}
+
+		uint32 left{};
+		if (bestCost < INFINITY)
+		{
+			const fp32 nodeArea{ HalfArea(node.min, node.max) };
+			if (count <= BVH_MAX_LEAF_PRIMITIVES && TRAVERSAL_COST * nodeArea + bestCost >= count * nodeArea)
+				return 0;
+
+			const fp32 lo{ Axis(cmin, bestAxis) };
+			const fp32 scale{ NUM_BINS / (Axis(cmax, bestAxis) - lo) };
+
+			uint32 i{ first };
+			uint32 j{ first + count };
+			while (i < j)
+			{
+				const uint32 b{ static_cast<uint32>((Axis(bvh.centroids[bvh.primIndices[i]], bestAxis) - lo) * scale) };
+				if ((b < NUM_BINS ? b : NUM_BINS - 1) <= bestBin)
+				{
+					++i;
+				}
+				else
+				{
+					--j;
+					const uint32 t{ bvh.primIndices[i] };
+					bvh.primIndices[i] = bvh.primIndices[j];
+					bvh.primIndices[j] = t;
+				}
+			}
+			left = i - first;
+		}
+		else if (count <= BVH_MAX_LEAF_PRIMITIVES)
+		{
+			return 0;
+		}
+
+		//every centroid in the same spot, split in half to keep leaves small
+		if (left == 0 || left == count)
+			left = count / 2;
+
+		return left;
+	}
+
+	//Turns node into an interior node with two children at dst, dst + 1
+	internal bool SplitInto(BVH& bvh, const uint32 node, const uint32 dst)
+	{
+		BVHNode& n{ bvh.nodes[node] };
+		const uint32 left{ SplitNode(bvh, n) };
+		if (left == 0)
+			return false;
+
+		MakeLeaf(bvh, bvh.nodes[dst], n.leftFirst, left);
+		MakeLeaf(bvh, bvh.nodes[dst + 1], n.leftFirst + left, n.count - left);
+		n.leftFirst = dst;
+		n.count = 0;
+		return true;
+	}
+
+	uint32 BeginBVHBuild(BVH& bvh, const uint32 maxTasks)
+	{
+		TrackedFree(bvh.tasks);
+		bvh.tasks = nullptr;
+		bvh.numTasks = 0;
+		bvh.numNodes = 0;
+		bvh.numTopNodes = 0;
+
+		if (bvh.numPrims == 0 || maxTasks == 0)
+			return 0;
+
+		bvh.tasks = static_cast<BVHBuildTask*>(TrackedAlloc(MemoryTagScene, sizeof(BVHBuildTask) * maxTasks));
+		if (!bvh.tasks)
+			return 0;
+
+		ComputePrimitiveBounds(bvh);
+		for (uint32 i{}; i < bvh.numPrims; ++i)
+			bvh.primIndices[i] = i;
+
+		MakeLeaf(bvh, bvh.nodes[0], 0, bvh.numPrims);
+		bvh.numTopNodes = 1;
+		bvh.tasks[0] = { .node = 0, .first = 0, .count = bvh.numPrims, .depth = 0, .nodeBase = 0, .numNodes = 0 };
+		bvh.numTasks = 1;
+
+		//keep splitting the biggest subtree until there are enough of them
+		while (bvh.numTasks < maxTasks)
+		{
+			uint32 biggest{};
+			for (uint32 t{ 1 }; t < bvh.numTasks; ++t)
+			{
+				if (bvh.tasks[t].count > bvh.tasks[biggest].count)
+					biggest = t;
+			}
+
+			BVHBuildTask& task{ bvh.tasks[biggest] };
+			if (task.count < 2 * MIN_TASK_PRIMITIVES || task.depth + 1 >= BVH_MAX_DEPTH / 2)
+				break;
+
+			const uint32 dst{ bvh.numTopNodes };
+			if (!SplitInto(bvh, task.node, dst))
+				break;
+
+			bvh.numTopNodes += 2;
+			const uint32 depth{ task.depth + 1 };
+			const BVHNode& l{ bvh.nodes[dst] };
+			const BVHNode& r{ bvh.nodes[dst + 1] };
+			task = { .node = dst, .first = l.leftFirst, .count = l.count, .depth = depth, .nodeBase = 0, .numNodes = 0 };
+			bvh.tasks[bvh.numTasks++] = { .node = dst + 1, .first = r.leftFirst, .count = r.count, .depth = depth, .nodeBase = 0, .numNodes = 0 };
+		}
+
+		//each subtree gets room for its worst case, EndBVHBuild closes the gaps
+		uint32 base{ bvh.numTopNodes };
+		for (uint32 t{}; t < bvh.numTasks; ++t)
+		{
+			bvh.tasks[t].nodeBase = base;
+			base += 2 * bvh.tasks[t].count - 2;
+		}
+
+		return bvh.numTasks;
+	}
+
+	void BuildBVHTask(BVH& bvh, const uint32 taskIndex)
+	{
+		BVHBuildTask& task{ bvh.tasks[taskIndex] };
+
+		BuildEntry stack[BVH_MAX_DEPTH];
+		uint32 top{};
+		stack[top++] = { task.node, task.depth };
+
+		uint32 next{ task.nodeBase };
+		while (top > 0)
+		{
+			const BuildEntry e{ stack[--top] };
+
+			//depth limit keeps the traversal stacks bounded, deeper nodes stay as big leaves
+			if (e.depth + 1 >= BVH_MAX_DEPTH || !SplitInto(bvh, e.node, next))
+				continue;
+
+			//left is popped first so the layout is depth first
+			stack[top++] = { next + 1, e.depth + 1 };
+			stack[top++] = { next, e.depth + 1 };
+			next += 2;
+		}
+
+		task.numNodes = next - task.nodeBase;
+	}
+
+	void EndBVHBuild(BVH& bvh)
+	{
+		uint32 write{ bvh.numTopNodes };
+		for (uint32 t{}; t < bvh.numTasks; ++t)
+		{
+			const BVHBuildTask& task{ bvh.tasks[t] };
+			const uint32 shift{ task.nodeBase - write };
+
+			if (shift != 0)
+			{
+				memmove(bvh.nodes + write, bvh.nodes + task.nodeBase, sizeof(BVHNode) * task.numNodes);
+				for (uint32 n{ write }; n < write + task.numNodes; ++n)
+				{
+					if (bvh.nodes[n].count == 0)
+						bvh.nodes[n].leftFirst -= shift;
+				}
+
+				if (bvh.nodes[task.node].count == 0)
+					bvh.nodes[task.node].leftFirst -= shift;
+			}
+
+			write += task.numNodes;
+		}
+
+		bvh.numNodes = write;
+		TrackedFree(bvh.tasks);
+		bvh.tasks = nullptr;
+		bvh.numTasks = 0;
+	}
+
+	internal void BuildBVHTasks(void* data, const uint32 begin, const uint32 end)
+	{
+		BVH& bvh{ *static_cast<BVH*>(data) };
+		for (uint32 t{ begin }; t < end; ++t)
+			BuildBVHTask(bvh, t);
+	}
+
+	void BuildBVH(BVH& bvh)
+	{
+		//ParallelFor needs a job thread, anywhere else the tasks run here
+		const uint32 numThreads{ GetJobThreadIndex() == INVALID_JOB_THREAD ? 1 : GetNumJobThreads() };
+		const uint32 numTasks{ BeginBVHBuild(bvh, numThreads > 1 ? numThreads * TASKS_PER_THREAD : 1) };
+
+		if (numTasks > 1)
+			ParallelFor(numTasks, 1, BuildBVHTasks, &bvh);
+		else if (numTasks == 1)
+			BuildBVHTask(bvh, 0);
+
+		EndBVHBuild(bvh);
+	}
+
+	void RefitBVH(BVH& bvh)
+	{
+		ComputePrimitiveBounds(bvh);
+
+		//children are always stored after their parent
+		for (uint32 n{ bvh.numNodes }; n-- > 0;)
+		{
+			BVHNode& node{ bvh.nodes[n] };
+			if (node.count)
+			{
+				MakeLeaf(bvh, node, node.leftFirst, node.count);
+			}
+			else
+			{
+				const BVHNode& l{ bvh.nodes[node.leftFirst] };
+				const BVHNode& r{ bvh.nodes[node.leftFirst + 1] };
+				node.min = Min3(l.min, r.min);
+				node.max = Max3(l.max, r.max);
+			}
+		}
+	}
+
+	struct RayLanes
+	{
+		float3 origin;
+		float3 invDir;
+#if RE_SIMD_SSE
+		__m128 o;
+		__m128 id;
+#endif
+	};
+
+	internal RayLanes MakeRayLanes(const float3 origin, const float3 dir)
+	{
+		RayLanes r;
+		r.origin = origin;
+		r.invDir = float3{ 1.f / dir.x, 1.f / dir.y, 1.f / dir.z };
+#if RE_SIMD_SSE
+		r.o = simd::load(r.origin);
+		r.id = simd::load(r.invDir);
+#endif
+		return r;
+	}
+
+	//Entry distance of the ray into [mn, mx], NO_HIT when it misses or enters past tMax
+	internal fp32 IntersectBox(const RayLanes& r, const float3& mn, const float3& mx, const fp32 tMax)
+	{
+#if RE_SIMD_SSE
+		const __m128 t0{ _mm_mul_ps(_mm_sub_ps(simd::load(mn), r.o), r.id) };
+		const __m128 t1{ _mm_mul_ps(_mm_sub_ps(simd::load(mx), r.o), r.id) };
+		//w lanes are 0, they clamp tNear to 0 and get replaced by tMax for tFar
+		__m128 tNear{ _mm_min_ps(t0, t1) };
+		__m128 tFar{ _mm_blend_ps(_mm_max_ps(t0, t1), _mm_set1_ps(tMax), 0x8) };
+		tNear = _mm_max_ps(tNear, _mm_shuffle_ps(tNear, tNear, _MM_SHUFFLE(1, 0, 3, 2)));
+		tNear = _mm_max_ss(tNear, _mm_shuffle_ps(tNear, tNear, _MM_SHUFFLE(2, 3, 0, 1)));
+		tFar = _mm_min_ps(tFar, _mm_shuffle_ps(tFar, tFar, _MM_SHUFFLE(1, 0, 3, 2)));
+		tFar = _mm_min_ss(tFar, _mm_shuffle_ps(tFar, tFar, _MM_SHUFFLE(2, 3, 0, 1)));
+		const fp32 n{ _mm_cvtss_f32(tNear) };
+		return n <= _mm_cvtss_f32(tFar) ? n : NO_HIT;
+#else
+		const float3 t0{ (mn - r.origin) * r.invDir };
+		const float3 t1{ (mx - r.origin) * r.invDir };
+		const float3 tn{ Min3(t0, t1) };
+		const float3 tf{ Max3(t0, t1) };
+		fp32 n{ tn.x > tn.y ? tn.x : tn.y };
+		n = tn.z > n ? tn.z : n;
+		n = n > 0.f ? n : 0.f;
+		fp32 f{ tf.x < tf.y ? tf.x : tf.y };
+		f = tf.z < f ? tf.z : f;
+		f = tMax < f ? tMax : f;
+		return n <= f ? n : NO_HIT;
+#endif
+	}
+
+	//Moller-Trumbore, two sided. Returns t or NO_HIT
+	internal fp32 IntersectTriangle(const float3 origin, const float3 dir, const float3 a, const float3 b, const float3 c, fp32& u, fp32& v)
+	{
+		const float3 e1{ b - a };
+		const float3 e2{ c - a };
+		const float3 p{ cross(dir, e2) };
+		const fp32 det{ dot(e1, p) };
+
+		if (std::fabs(det) < 1e-12f)
+			return NO_HIT;
+
+		const fp32 invDet{ 1.f / det };
+		const float3 s{ origin - a };
+		u = dot(s, p) * invDet;
+		if (u < 0.f || u > 1.f)
+			return NO_HIT;
+
+		const float3 q{ cross(s, e1) };
+		v = dot(dir, q) * invDet;
+		if (v < 0.f || u + v > 1.f)
+			return NO_HIT;
+
+		const fp32 t{ dot(e2, q) * invDet };
+		return t >= 0.f ? t : NO_HIT;
+	}
+
+	internal fp32 IntersectPrimitive(const BVH& bvh, const RayLanes& r, const float3 dir, const uint32 p, const fp32 tMax, fp32& u, fp32& v)
+	{
+		if (bvh.vertices)
+		{
+			const fp32 t{ IntersectTriangle(r.origin, dir, bvh.vertices[bvh.indices[p * 3]], bvh.vertices[bvh.indices[p * 3 + 1]], bvh.vertices[bvh.indices[p * 3 + 2]], u, v) };
+			return t <= tMax ? t : NO_HIT;
+		}
+
+		u = 0.f;
+		v = 0.f;
+		return IntersectBox(r, bvh.primMin[p], bvh.primMax[p], tMax);
+	}
+
+	struct TraversalEntry
+	{
+		uint32 node;
+		fp32 t;
+	};
+
+	//Nearest child first. anyHit stops at the first primitive hit
+	internal RayHit TraceRay(const BVH& bvh, const float3 origin, const float3 dir, const fp32 tMax, const bool anyHit)
+	{
+		RayHit hit{ tMax, INVALID_PRIMITIVE, 0.f, 0.f };
+		if (bvh.numNodes == 0)
+			return hit;
+
+		const RayLanes r{ MakeRayLanes(origin, dir) };
+		if (IntersectBox(r, bvh.nodes[0].min, bvh.nodes[0].max, hit.t) == NO_HIT)
+			return hit;
+
+		TraversalEntry stack[BVH_MAX_DEPTH];
+		uint32 top{};
+		uint32 node{};
+
+		for (;;)
+		{
+			const BVHNode& n{ bvh.nodes[node] };
+			if (n.count)
+			{
+				for (uint32 i{ n.leftFirst }; i < n.leftFirst + n.count; ++i)
+				{
+					const uint32 p{ bvh.primIndices[i] };
+					fp32 u{}, v{};
+					const fp32 t{ IntersectPrimitive(bvh, r, dir, p, hit.t, u, v) };
+					//a hit exactly at tMax still counts
+					if (t != NO_HIT && (t < hit.t || hit.prim == INVALID_PRIMITIVE))
+					{
+						hit = { t, p, u, v };
+						if (anyHit)
+							return hit;
+					}
+				}
+			}
+			else
+			{
+				const uint32 l{ n.leftFirst };
+				fp32 tl{ IntersectBox(r, bvh.nodes[l].min, bvh.nodes[l].max, hit.t) };
+				fp32 tr{ IntersectBox(r, bvh.nodes[l + 1].min, bvh.nodes[l + 1].max, hit.t) };
+				uint32 nearChild{ l }, farChild{ l + 1 };
+				if (tr < tl)
+				{
+					const fp32 t{ tl }; tl = tr; tr = t;
+					nearChild = l + 1;
+					farChild = l;
+				}
+
+				if (tl != NO_HIT)
+				{
+					if (tr != NO_HIT)
+						stack[top++] = { farChild, tr };
+					node = nearChild;
+					continue;
+				}
+			}
+
+			//skip entries that start behind the closest hit found since they were pushed
+			for (;;)
+			{
+				if (top == 0)
+					return hit;
+				const TraversalEntry e{ stack[--top] };
+				if (e.t <= hit.t)
+				{
+					node = e.node;
+					break;
+				}
+			}
+		}
+	}
+
+	void RaycastBVH(const BVH& bvh, const Ray* rays, RayHit* hits, const uint32 num)
+	{
+		for (uint32 i{}; i < num; ++i)
+			hits[i] = TraceRay(bvh, rays[i].origin, rays[i].direction, rays[i].tMax, false);
+	}
+
+	//8 rays in SoA lanes. Lanes past the end of the batch get tMax -1 and never hit anything
+	struct RayPacket
+	{
+		float3x8 origin;
+		float3x8 dir;
+		float3x8 invDir;
+		fp32x8 tMax;			//closest hit so far, per lane
+		float3 leaderDir;		//first ray, orders the children for the whole packet
+
+		fp32 t[8];
+		fp32 u[8];
+		fp32 v[8];
+		uint32 prim[8];
+	};
+
+	internal float3x8 Splat3(const float3 a) { return { splat8(a.x), splat8(a.y), splat8(a.z) }; }
+
+	//Same slab test as IntersectBox on every lane. Returns the lanes that hit, entry distances in tNear
+	internal uint32 IntersectBoxPacket(const RayPacket& r, const float3& mn, const float3& mx, fp32x8& tNear)
+	{
+		const fp32x8 t0x{ (splat8(mn.x) - r.origin.x) * r.invDir.x }, t1x{ (splat8(mx.x) - r.origin.x) * r.invDir.x };
+		const fp32x8 t0y{ (splat8(mn.y) - r.origin.y) * r.invDir.y }, t1y{ (splat8(mx.y) - r.origin.y) * r.invDir.y };
+		const fp32x8 t0z{ (splat8(mn.z) - r.origin.z) * r.invDir.z }, t1z{ (splat8(mx.z) - r.origin.z) * r.invDir.z };
+
+		tNear = max(max(min(t0x, t1x), min(t0y, t1y)), max(min(t0z, t1z), splat8(0.f)));
+		const fp32x8 tFar{ min(min(max(t0x, t1x), max(t0y, t1y)), min(max(t0z, t1z), r.tMax)) };
+		return moveMask(cmpGe(tFar, tNear));
+	}
+
+	//Moller-Trumbore against every lane, the 8-wide version of IntersectTriangle. Returns the lanes that hit within tMax
+	internal uint32 IntersectTrianglePacket(const RayPacket& r, const float3 a, const float3 b, const float3 c, fp32x8& t, fp32x8& u, fp32x8& v)
+	{
+		const float3x8 e1{ Splat3(b - a) };
+		const float3x8 e2{ Splat3(c - a) };
+		const float3x8 p{ cross(r.dir, e2) };
+		const fp32x8 det{ dot(e1, p) };
+		const fp32x8 invDet{ splat8(1.f) / det };
+
+		const float3x8 pa{ Splat3(a) };
+		const float3x8 s{ r.origin.x - pa.x, r.origin.y - pa.y, r.origin.z - pa.z };
+		const float3x8 q{ cross(s, e1) };
+		u = dot(s, p) * invDet;
+		v = dot(r.dir, q) * invDet;
+		t = dot(e2, q) * invDet;
+
+		const fp32x8 zero{ splat8(0.f) }, one{ splat8(1.f) };
+		const fp32x8 inside{ cmpGe(u, zero) & cmpGe(one, u) & cmpGe(v, zero) & cmpGe(one, u + v) };
+		const fp32x8 inRange{ cmpGe(t, zero) & cmpGe(r.tMax, t) };
+		return moveMask(cmpGe(abs(det), splat8(1e-12f)) & inside & inRange);
+	}
+
+	//Same acceptance rule as TraceRay, lane by lane. Only runs when some lane hit, which is rare next to the box tests
+	internal void AcceptPacketHits(RayPacket& r, uint32 mask, const uint32 prim, const fp32x8 t, const fp32x8 u, const fp32x8 v)
+	{
+		fp32 tl[8], ul[8], vl[8];
+		store8(tl, t);
+		store8(ul, u);
+		store8(vl, v);
+
+		while (mask)
+		{
+			const uint32 l{ static_cast<uint32>(std::countr_zero(mask)) };
+			mask &= mask - 1;
+			if (tl[l] < r.t[l] || r.prim[l] == INVALID_PRIMITIVE)
+			{
+				r.t[l] = tl[l];
+				r.u[l] = ul[l];
+				r.v[l] = vl[l];
+				r.prim[l] = prim;
+			}
+		}
+		r.tMax = load8(r.t);
+	}
+
+	//One traversal for the whole packet: a node is visited when any lane hits it, leaves test every lane at once
+	internal void TracePacket(const BVH& bvh, const Ray* rays, RayHit* hits, const uint32 num)
+	{
+		RayPacket r;
+		fp32 ox[8], oy[8], oz[8], dx[8], dy[8], dz[8];
+		for (uint32 l{}; l < 8; ++l)
+		{
+			const bool active{ l < num };
+			const Ray ray{ active ? rays[l] : Ray{ { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f }, -1.f } };
+			ox[l] = ray.origin.x;
+			oy[l] = ray.origin.y;
+			oz[l] = ray.origin.z;
+			dx[l] = ray.direction.x;
+			dy[l] = ray.direction.y;
+			dz[l] = ray.direction.z;
+			r.t[l] = ray.tMax;
+			r.u[l] = 0.f;
+			r.v[l] = 0.f;
+			r.prim[l] = INVALID_PRIMITIVE;
+		}
+
+		r.origin = { load8(ox), load8(oy), load8(oz) };
+		r.dir = { load8(dx), load8(dy), load8(dz) };
+		r.invDir = { splat8(1.f) / r.dir.x, splat8(1.f) / r.dir.y, splat8(1.f) / r.dir.z };
+		r.tMax = load8(r.t);
+		r.leaderDir = rays[0].direction;
+
+		//both children are pushed, so the stack holds at most one entry per level plus the root
+		uint32 stack[BVH_MAX_DEPTH + 1];
+		uint32 top{};
+		if (bvh.numNodes)
+			stack[top++] = 0;
+
+		while (top > 0)
+		{
+			const BVHNode& n{ bvh.nodes[stack[--top]] };
+
+			//tested on pop, hits found since the push may cull it
+			fp32x8 tNear;
+			if (!IntersectBoxPacket(r, n.min, n.max, tNear))
+				continue;
+
+			if (n.count == 0)
+			{
+				//the child the leader reaches first is popped first
+				const uint32 l{ n.leftFirst };
+				const float3 d{ (bvh.nodes[l + 1].min + bvh.nodes[l + 1].max) - (bvh.nodes[l].min + bvh.nodes[l].max) };
+				const float3 ad{ std::fabs(d.x), std::fabs(d.y), std::fabs(d.z) };
+				const uint32 axis{ ad.x > ad.y ? (ad.x > ad.z ? 0u : 2u) : (ad.y > ad.z ? 1u : 2u) };
+				const bool leftFirst{ Axis(d, axis) * Axis(r.leaderDir, axis) >= 0.f };
+
+				stack[top++] = leftFirst ? l + 1 : l;
+				stack[top++] = leftFirst ? l : l + 1;
+				continue;
+			}
+
+			for (uint32 i{ n.leftFirst }; i < n.leftFirst + n.count; ++i)
+			{
+				const uint32 p{ bvh.primIndices[i] };
+				fp32x8 t, u, v;
+				uint32 mask;
+				if (bvh.vertices)
+				{
+					mask = IntersectTrianglePacket(r, bvh.vertices[bvh.indices[p * 3]], bvh.vertices[bvh.indices[p * 3 + 1]], bvh.vertices[bvh.indices[p * 3 + 2]], t, u, v);
+				}
+				else
+				{
+					mask = IntersectBoxPacket(r, bvh.primMin[p], bvh.primMax[p], t);
+					u = splat8(0.f);
+					v = u;
+				}
+
+				if (mask)
+					AcceptPacketHits(r, mask, p, t, u, v);
+			}
+		}
+
+		for (uint32 l{}; l < num; ++l)
+			hits[l] = { r.t[l], r.prim[l], r.u[l], r.v[l] };
+	}
+
+	void RaycastBVHPackets(const BVH& bvh, const Ray* rays, RayHit* hits, const uint32 num)
+	{
+		for (uint32 first{}; first < num; first += 8)
+			TracePacket(bvh, rays + first, hits + first, num - first < 8 ? num - first : 8);
+	}
+
+	void OccludedBVH(const BVH& bvh, const Segment* segments, uint8* blocked, const uint32 num)
+	{
+		for (uint32 i{}; i < num; ++i)
+		{
+			const RayHit hit{ TraceRay(bvh, segments[i].start, segments[i].end - segments[i].start, 1.f, true) };
+			blocked[i] = hit.prim != INVALID_PRIMITIVE;
+		}
+	}
+
+	internal bool Overlaps(const float3& amin, const float3& amax, const float3& bmin, const float3& bmax)
+	{
+		return amin.x <= bmax.x && amax.x >= bmin.x && amin.y <= bmax.y && amax.y >= bmin.y && amin.z <= bmax.z && amax.z >= bmin.z;
+	}
+
+	uint32 OverlapBVH(const BVH& bvh, const BVHBox* boxes, uint32* counts, const uint32 num, uint32* out, const uint32 maxOut)
+	{
+		uint32 total{};
+		for (uint32 b{}; b < num; ++b)
+		{
+			const float3 mn{ boxes[b].min }, mx{ boxes[b].max };
+			uint32 found{};
+
+			if (bvh.numNodes == 0 || !Overlaps(mn, mx, bvh.nodes[0].min, bvh.nodes[0].max))
+			{
+				counts[b] = 0;
+				continue;
+			}
+
+			uint32 stack[BVH_MAX_DEPTH];
+			uint32 top{};
+			stack[top++] = 0;
+
+			while (top > 0)
+			{
+				const BVHNode& n{ bvh.nodes[stack[--top]] };
+				if (n.count)
+				{
+					for (uint32 i{ n.leftFirst }; i < n.leftFirst + n.count; ++i)
+					{
+						const uint32 p{ bvh.primIndices[i] };
+						if (Overlaps(mn, mx, bvh.primMin[p], bvh.primMax[p]))
+						{
+							if (total + found < maxOut)
+								out[total + found] = p;
+							++found;
+						}
+					}
+					continue;
+				}
+
+				const uint32 l{ n.leftFirst };
+				if (Overlaps(mn, mx, bvh.nodes[l + 1].min, bvh.nodes[l + 1].max))
+					stack[top++] = l + 1;
+				if (Overlaps(mn, mx, bvh.nodes[l].min, bvh.nodes[l].max))
+					stack[top++] = l;
+			}
+
+			counts[b] = found;
+			total += found;
+		}
+
+		return total;
+	}
+
+}
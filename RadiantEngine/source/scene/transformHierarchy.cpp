@@ -0,0 +1,331 @@
+//  Filename: transformHierarchy 
+//	Author:	Daniel														
+//	Date: 18/10/2026 14:21:37		
+//  Sqwack-Studios													
+
+#include "RadiantEngine/scene/transformHierarchy.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "RadiantEngine/core/memoryTracker.h"
+#include "RadiantEngine/core/assert.h"
+
+namespace RE
+{
+
+	internal uint32 LevelOfSlot(const TransformHierarchy& h, const uint32 slot)
+	{
+		uint32 level{};
+		while (h.levelStart[level + 1] <= slot)
+			++level;
+		return level;
+	}
+
+	//Ids past nextId were never handed out and removed ids have no slot. A removed id handed out again can't be told apart.
+	internal uint32 SlotOf(const TransformHierarchy& h, const TransformId id)
+	{
+		RE_ASSERT(id < h.nextId && h.slotOf[id] != INVALID_TRANSFORM);
+		return h.slotOf[id];
+	}
+
+	//First slot of level whose parent slot is >= parentSlot. Parents are sorted inside a level, so this is a binary search.
+	internal uint32 FirstChildSlot(const TransformHierarchy& h, const uint32 level, const uint32 parentSlot)
+	{
+		uint32 first{ h.levelStart[level] };
+		uint32 count{ h.levelStart[level + 1] - first };
+		while (count > 0)
+		{
+			const uint32 half{ count / 2 };
+			if (h.parent[first + half] < parentSlot)
+			{
+				first += half + 1;
+				count -= half + 1;
+			}
+			else
+				count = half;
+		}
+		return first;
+	}
+
+	internal void MarkDirty(TransformHierarchy& h, const uint32 slot)
+	{
+		if (h.flags[slot] & eTransformFlags::LocalDirty)
+			return;
+
+		h.flags[slot] |= eTransformFlags::LocalDirty;
+		h.dirtyIds[h.numDirty++] = h.idOf[slot];
+	}
+
+	internal int CompareSlots(const void* a, const void* b)
+	{
+		const uint32 sa{ *static_cast<const uint32*>(a) };
+		const uint32 sb{ *static_cast<const uint32*>(b) };
+		return (sa > sb) - (sa < sb);
+	}
+
+	//Moves slots [first, num) one position up, leaving first free
+	internal void OpenSlot(TransformHierarchy& h, const uint32 first)
+	{
+		const uint32 count{ h.num - first };
+
+		memmove(h.localPosition + first + 1, h.localPosition + first, sizeof(float3) * count);
+		memmove(h.localRotation + first + 1, h.localRotation + first, sizeof(quat) * count);
+		memmove(h.localScale + first + 1, h.localScale + first, sizeof(float3) * count);
+		memmove(h.world + first + 1, h.world + first, sizeof(float3x4) * count);
+		memmove(h.parent + first + 1, h.parent + first, sizeof(uint32) * count);
+		memmove(h.idOf + first + 1, h.idOf + first, sizeof(TransformId) * count);
+		memmove(h.flags + first + 1, h.flags + first, sizeof(uint8) * count);
+		memmove(h.changedPass + first + 1, h.changedPass + first, sizeof(uint32) * count);
+
+		for (uint32 s{ first + 1 }; s <= h.num; ++s)
+		{
+			if (h.parent[s] != INVALID_TRANSFORM && h.parent[s] >= first)
+				h.parent[s]++;
+			h.slotOf[h.idOf[s]] = s;
+		}
+	}
+
+	internal void CopySlot(TransformHierarchy& h, const uint32 dst, const uint32 src)
+	{
+		h.localPosition[dst] = h.localPosition[src];
+		h.localRotation[dst] = h.localRotation[src];
+		h.localScale[dst] = h.localScale[src];
+		h.world[dst] = h.world[src];
+		h.idOf[dst] = h.idOf[src];
+		h.flags[dst] = h.flags[src];
+		h.changedPass[dst] = h.changedPass[src];
+	}
+
+	bool InitTransformHierarchy(TransformHierarchy& h, const uint32 capacity)
+	{
+		h = {};
+
+		//world goes first so it keeps the 16 byte alignment of the block
+		const size_t bytes{ capacity * (sizeof(float3x4) + sizeof(quat) + 2 * sizeof(float3) + sizeof(uint32) * 7 + sizeof(uint8)) };
+		uint8* block{ static_cast<uint8*>(TrackedAlloc(MemoryTagScene, bytes)) };
+
+		if (!block)
+			return false;
+
+		h.world = reinterpret_cast<float3x4*>(block);
+		h.localRotation = reinterpret_cast<quat*>(h.world + capacity);
+		h.localPosition = reinterpret_cast<float3*>(h.localRotation + capacity);
+		h.localScale = h.localPosition + capacity;
+		h.parent = reinterpret_cast<uint32*>(h.localScale + capacity);
+		h.idOf = h.parent + capacity;
+		h.slotOf = h.idOf + capacity;
+		h.freeIds = h.slotOf + capacity;
+		h.changedPass = h.freeIds + capacity;
+		h.dirtyIds = h.changedPass + capacity;
+		h.scratch = h.dirtyIds + capacity;
+		h.flags = reinterpret_cast<uint8*>(h.scratch + capacity);
+		h.capacity = capacity;
+		//new nodes start at pass 0, which never reads as changed
+		h.pass = 2;
+
+		return true;
+	}
+
+	void ShutdownTransformHierarchy(TransformHierarchy& h)
+	{
+		TrackedFree(h.world);
+		h = {};
+	}
+
+	TransformId AddTransform(TransformHierarchy& h, const TransformId parent, const float3 position, const quat rotation, const float3 scale)
+	{
+		if (h.num == h.capacity)
+			return INVALID_TRANSFORM;
+
+		const uint32 parentSlot{ parent == INVALID_TRANSFORM ? INVALID_TRANSFORM : SlotOf(h, parent) };
+		const uint32 depth{ parentSlot == INVALID_TRANSFORM ? 0 : LevelOfSlot(h, parentSlot) + 1 };
+
+		if (depth >= MAX_TRANSFORM_DEPTH)
+			return INVALID_TRANSFORM;
+
+		//new node goes after its last sibling (roots at the end of level 0), everything after it shifts one slot
+		const uint32 slot{ depth == 0 ? h.levelStart[1] : FirstChildSlot(h, depth, parentSlot + 1) };
+		OpenSlot(h, slot);
+
+		for (uint32 l{ depth + 1 }; l <= MAX_TRANSFORM_DEPTH; ++l)
+			h.levelStart[l]++;
+
+		h.numLevels = depth + 1 > h.numLevels ? depth + 1 : h.numLevels;
+
+		const TransformId id{ h.numFreeIds > 0 ? h.freeIds[--h.numFreeIds] : h.nextId++ };
+
+		h.localPosition[slot] = position;
+		h.localRotation[slot] = rotation;
+		h.localScale[slot] = scale;
+		h.parent[slot] = parentSlot;
+		h.idOf[slot] = id;
+		h.flags[slot] = 0;
+		h.changedPass[slot] = 0;
+		h.slotOf[id] = slot;
+		MarkDirty(h, slot);
+
+		h.num++;
+
+		return id;
+	}
+
+	void RemoveTransform(TransformHierarchy& h, const TransformId id)
+	{
+		RE_ASSERT(id < h.nextId && h.slotOf[id] != INVALID_TRANSFORM);
+		if (id >= h.nextId || h.slotOf[id] == INVALID_TRANSFORM)
+			return;
+
+		//remap[old slot] = new slot. Parents come before their children, so a node is removed when it is the root
+		//or when its parent has already been removed.
+		const uint32 root{ h.slotOf[id] };
+		uint32* remap{ h.scratch };
+		uint32 oldLevelStart[MAX_TRANSFORM_DEPTH + 1];
+		memcpy(oldLevelStart, h.levelStart, sizeof(oldLevelStart));
+
+		uint32 write{};
+		uint32 level{};
+		for (uint32 s{}; s < h.num; ++s)
+		{
+			while (level <= MAX_TRANSFORM_DEPTH && oldLevelStart[level] == s)
+				h.levelStart[level++] = write;
+
+			const uint32 p{ h.parent[s] };
+			const bool removed{ s == root || (p != INVALID_TRANSFORM && remap[p] == INVALID_TRANSFORM) };
+
+			if (removed)
+			{
+				remap[s] = INVALID_TRANSFORM;
+				h.slotOf[h.idOf[s]] = INVALID_TRANSFORM;
+				h.freeIds[h.numFreeIds++] = h.idOf[s];
+				continue;
+			}
+
+			remap[s] = write;
+			CopySlot(h, write, s);
+			h.parent[write] = p == INVALID_TRANSFORM ? INVALID_TRANSFORM : remap[p];
+			h.slotOf[h.idOf[write]] = write;
+			++write;
+		}
+
+		while (level <= MAX_TRANSFORM_DEPTH)
+			h.levelStart[level++] = write;
+
+		h.num = write;
+
+		uint32 numDirty{};
+		for (uint32 i{}; i < h.numDirty; ++i)
+		{
+			if (h.slotOf[h.dirtyIds[i]] != INVALID_TRANSFORM)
+				h.dirtyIds[numDirty++] = h.dirtyIds[i];
+		}
+		h.numDirty = numDirty;
+		h.numLevels = 0;
+		for (uint32 l{}; l < MAX_TRANSFORM_DEPTH; ++l)
+		{
+			if (h.levelStart[l + 1] > h.levelStart[l])
+				h.numLevels = l + 1;
+		}
+	}
+
+	void SetLocalTransform(TransformHierarchy& h, const TransformId id, const float3 position, const quat rotation, const float3 scale)
+	{
+		const uint32 slot{ SlotOf(h, id) };
+		h.localPosition[slot] = position;
+		h.localRotation[slot] = rotation;
+		h.localScale[slot] = scale;
+		MarkDirty(h, slot);
+	}
+
+	void SetLocalPosition(TransformHierarchy& h, const TransformId id, const float3 position)
+	{
+		const uint32 slot{ SlotOf(h, id) };
+		h.localPosition[slot] = position;
+		MarkDirty(h, slot);
+	}
+
+	void SetLocalRotation(TransformHierarchy& h, const TransformId id, const quat rotation)
+	{
+		const uint32 slot{ SlotOf(h, id) };
+		h.localRotation[slot] = rotation;
+		MarkDirty(h, slot);
+	}
+
+	void SetLocalScale(TransformHierarchy& h, const TransformId id, const float3 scale)
+	{
+		const uint32 slot{ SlotOf(h, id) };
+		h.localScale[slot] = scale;
+		MarkDirty(h, slot);
+	}
+
+	const float3x4& WorldMatrix(const TransformHierarchy& h, const TransformId id)
+	{
+		return h.world[SlotOf(h, id)];
+	}
+
+	bool HasWorldChanged(const TransformHierarchy& h, const TransformId id)
+	{
+		return h.changedPass[SlotOf(h, id)] == h.pass - 1;
+	}
+
+	void PropagateRange(TransformHierarchy& h, const uint32 begin, const uint32 end)
+	{
+		//Every slot only writes its own state, parents are only read. Parent state was written by the previous level.
+		for (uint32 s{ begin }; s < end; ++s)
+		{
+			const uint32 p{ h.parent[s] };
+			const bool parentChanged{ p != INVALID_TRANSFORM && h.changedPass[p] == h.pass };
+
+			if (!(h.flags[s] & eTransformFlags::LocalDirty) && !parentChanged)
+				continue;
+
+			const float3x4 local{ composeTRS(h.localPosition[s], h.localRotation[s], h.localScale[s]) };
+			h.world[s] = p == INVALID_TRANSFORM ? local : mul(h.world[p], local);
+			h.flags[s] = 0;
+			h.changedPass[s] = h.pass;
+		}
+	}
+
+	void PropagateTransforms(TransformHierarchy& h)
+	{
+		//Sorted slots visit ancestors before their descendants, and levels in order
+		uint32* roots{ h.scratch };
+		for (uint32 i{}; i < h.numDirty; ++i)
+			roots[i] = h.slotOf[h.dirtyIds[i]];
+		qsort(roots, h.numDirty, sizeof(uint32), CompareSlots);
+
+		uint32 level{};
+		for (uint32 i{}; i < h.numDirty; ++i)
+		{
+			const uint32 root{ roots[i] };
+
+			//already recomputed as part of a dirty ancestor's subtree
+			if (!(h.flags[root] & eTransformFlags::LocalDirty))
+				continue;
+
+			while (h.levelStart[level + 1] <= root)
+				++level;
+
+			//the children of [begin, end) are the slots of the next level whose parent falls in [begin, end)
+			uint32 begin{ root };
+			uint32 end{ root + 1 };
+			for (uint32 l{ level }; begin < end; )
+			{
+				PropagateRange(h, begin, end);
+				if (++l == h.numLevels)
+					break;
+				begin = FirstChildSlot(h, l, begin);
+				end = FirstChildSlot(h, l, end);
+			}
+		}
+
+		EndPropagation(h);
+	}
+
+	void EndPropagation(TransformHierarchy& h)
+	{
+		h.numDirty = 0;
+		h.pass++;
+	}
+
+}
@@ -0,0 +1,109 @@
+//  Filename: main 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:08:51		
+//  Sqwack-Studios													
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "test.h"
+#include "RadiantEngine/core/jobs.h"
+#include "RadiantEngine/platform/thread.h"
+
+using namespace RE;
+
+// Arguments:
+/*
+* --filter <text>		Only run tests whose name contains text
+* --list				Print the test names and exit
+*/
+
+internal const TestGroup* GROUPS[]{ &MATH_TESTS, &FAST_MATH_TESTS, &SCENE_TESTS, &QUEUE_TESTS, &LOG_TESTS, &CULLING_TESTS, &COMPRESSION_TESTS, &PROFILER_TESTS, &HASH_MAP_TESTS, &HANDLE_POOL_TESTS };
+
+namespace RE
+{
+
+	bool ReportCheck(Test& t, const bool passed, const char* expression, const char* file, const int line)
+	{
+		t.checks++;
+		if (passed)
+			return true;
+
+		if (t.failures++ < MAX_REPORTED_FAILURES)
+			printf("  %s(%d): %s\n", file, line, expression);
+		return false;
+	}
+
+	bool ReportCheckNear(Test& t, const fp64 actual, const fp64 expected, const fp64 tolerance, const char* expression, const char* file, const int line)
+	{
+		t.checks++;
+		const bool passed{ std::isnan(actual) || std::isnan(expected) ? std::isnan(actual) && std::isnan(expected) : fabs(actual - expected) <= tolerance };
+		if (passed)
+			return true;
+
+		if (t.failures++ < MAX_REPORTED_FAILURES)
+			printf("  %s(%d): %s is %.9g, expected %.9g +- %.3g\n", file, line, expression, actual, expected, tolerance);
+		return false;
+	}
+
+}
+
+int main(int argc, char* argv[])
+{
+	const char* filter{};
+	bool list{};
+	for (int i{ 1 }; i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "--list"))
+			list = true;
+		else if (!strcmp(argv[i], "--filter") && i + 1 < argc)
+			filter = argv[++i];
+		else
+		{
+			fprintf(stderr, "Unknown argument \"%s\"\n", argv[i]);
+			return 2;
+		}
+	}
+
+	//at least 4 threads, so the threaded paths are exercised on small machines too
+	const uint32 numCores{ GetNumCores() };
+	if (!InitJobSystem(numCores < 4 ? 4 : numCores))
+	{
+		fprintf(stderr, "Couldn't start the job system\n");
+		return 2;
+	}
+
+	uint32 numRun{};
+	uint32 numFailed{};
+	for (const TestGroup* group : GROUPS)
+	{
+		for (uint32 i{}; i < group->num; ++i)
+		{
+			const TestEntry& entry{ group->entries[i] };
+			if (filter && !strstr(entry.name, filter))
+				continue;
+
+			if (list)
+			{
+				printf("%s\n", entry.name);
+				continue;
+			}
+
+			Test t{ .name = entry.name, .checks = 0, .failures = 0 };
+			entry.fn(t);
+			numRun++;
+			numFailed += t.failures != 0;
+			if (t.failures)
+				printf("FAIL %-40s %u of %u checks\n", entry.name, t.failures, t.checks);
+			else
+				printf("ok   %-40s %u checks\n", entry.name, t.checks);
+		}
+	}
+
+	if (!list)
+		printf("\n%u of %u tests failed\n", numFailed, numRun);
+
+	ShutdownJobSystem();
+	return numFailed ? 1 : 0;
+}
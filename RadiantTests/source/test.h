@@ -0,0 +1,70 @@
+//  Filename: test 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:02:18		
+//  Sqwack-Studios													
+
+#ifndef RE_TEST_H
+#define RE_TEST_H
+
+#include "RadiantEngine/core/types.h"
+#include "RadiantEngine/core/platform.h"
+
+//Tiny test harness, the same shape as RadiantBench. A test runs its checks and keeps going after a failure, so one run
+//shows every broken case:
+//
+//	void TestDot(Test& t)
+//	{
+//		RE_CHECK(t, dot(a, b) == scalar::dot(a, b));
+//		RE_CHECK_NEAR(t, fast::sin(x), sin(x), 2e-7);
+//	}
+//
+//Failures print the expression and where it is, RE_CHECK_NEAR also the values. The first MAX_REPORTED_FAILURES of a test
+//are printed, the rest are only counted. The exit code is 1 when any test failed.
+namespace RE
+{
+
+	inline constexpr uint32 MAX_REPORTED_FAILURES{ 8 };
+
+	struct Test
+	{
+		const char* name;
+		uint32 checks;
+		uint32 failures;
+	};
+
+	using TestFn = void(*)(Test&);
+
+	struct TestEntry
+	{
+		const char* name;
+		TestFn fn;
+	};
+
+	struct TestGroup
+	{
+		const TestEntry* entries;
+		uint32 num;
+	};
+
+	bool ReportCheck(Test& t, const bool passed, const char* expression, const char* file, const int line);
+	bool ReportCheckNear(Test& t, const fp64 actual, const fp64 expected, const fp64 tolerance, const char* expression, const char* file, const int line);
+
+	//One per source file, referenced from main.cpp
+	extern const TestGroup MATH_TESTS;
+	extern const TestGroup FAST_MATH_TESTS;
+	extern const TestGroup SCENE_TESTS;
+	extern const TestGroup QUEUE_TESTS;
+	extern const TestGroup LOG_TESTS;
+	extern const TestGroup CULLING_TESTS;
+	extern const TestGroup COMPRESSION_TESTS;
+	extern const TestGroup PROFILER_TESTS;
+	extern const TestGroup HASH_MAP_TESTS;
+	extern const TestGroup HANDLE_POOL_TESTS;
+
+}
+
+#define RE_CHECK(t, condition) RE::ReportCheck(t, (condition), #condition, __FILE__, __LINE__)
+//|actual - expected| <= tolerance, NaN only matches NaN
+#define RE_CHECK_NEAR(t, actual, expected, tolerance) RE::ReportCheckNear(t, (actual), (expected), (tolerance), #actual, __FILE__, __LINE__)
+
+#endif // !RE_TEST_H
@@ -0,0 +1,428 @@
+//  Filename: testCompression 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:58:14		
+//  Sqwack-Studios													
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "test.h"
+#include "RadiantEngine/core/compression.h"
+#include "RadiantEngine/core/pack.h"
+
+//The LZ codec and pack archives. Round trips run over data the codec finds easy (runs, short periods, text) and hard
+//(noise), at sizes around the 16 byte copies, the last literals and PACK_BLOCK_SIZE. Truncated and corrupted input must
+//be refused or at least decoded without touching memory outside the buffers, which every buffer here is sized exactly
+//for so the sanitizers catch it.
+//Pack tests write their sources and packs to the working directory and remove them afterwards.
+namespace RE
+{
+
+	enum eTestData : uint8
+	{
+		TestDataZeros = 0,
+		TestDataPeriod,
+		TestDataText,
+		TestDataNoise,
+		NUM_TEST_DATA
+	};
+
+	internal constexpr size_t LZ_TEST_SIZES[]{ 0, 1, 15, 16, 17, 20, 21, 31, 33, 64, 100, 1000, 4096, 65535, PACK_BLOCK_SIZE, 200000 };
+
+	internal uint32 NextCompressionRandom(uint32& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	internal uint8* MakeTestData(const eTestData kind, const size_t size, uint32 seed)
+	{
+		internal constexpr const char* WORDS[]{ "mesh ", "texture ", "shader ", "material ", "bone ", "frame\n", "light ", "the " };
+
+		uint8* data{ static_cast<uint8*>(malloc(size ? size : 1)) };
+		for (size_t i{}; i < size;)
+		{
+			switch (kind)
+			{
+			case TestDataZeros:
+				data[i++] = 0;
+				break;
+			case TestDataPeriod:
+				data[i] = static_cast<uint8>("abcdefg"[i % 7]);
+				++i;
+				break;
+			case TestDataText:
+			{
+				const char* word{ WORDS[NextCompressionRandom(seed) % (sizeof(WORDS) / sizeof(WORDS[0]))] };
+				for (; *word && i < size; ++word)
+					data[i++] = static_cast<uint8>(*word);
+				break;
+			}
+			default:
+				data[i++] = static_cast<uint8>(NextCompressionRandom(seed) >> 24);
+				break;
+			}
+		}
+		return data;
+	}
+
+	//Returns the compressed block, malloc'ed to its exact size
+	internal uint8* CompressTestData(const uint8* data, const size_t size, size_t& compressedSize)
+	{
+		const size_t bound{ CompressBound(CompressionLZ, size) };
+		uint8* scratch{ static_cast<uint8*>(malloc(bound)) };
+		compressedSize = Compress(CompressionLZ, data, size, scratch, bound);
+
+		uint8* compressed{ static_cast<uint8*>(malloc(compressedSize ? compressedSize : 1)) };
+		memcpy(compressed, scratch, compressedSize);
+		free(scratch);
+		return compressed;
+	}
+
+	internal void TestLZRoundTrip(Test& t)
+	{
+		for (uint32 kind{}; kind < NUM_TEST_DATA; ++kind)
+		{
+			for (const size_t size : LZ_TEST_SIZES)
+			{
+				uint8* data{ MakeTestData(static_cast<eTestData>(kind), size, 0x1234567 + kind) };
+				size_t compressedSize;
+				uint8* compressed{ CompressTestData(data, size, compressedSize) };
+				RE_CHECK(t, compressedSize > 0 && compressedSize <= CompressBound(CompressionLZ, size));
+				if (kind != TestDataNoise && size >= 1000)
+					RE_CHECK(t, compressedSize < size / 2);
+
+				uint8* out{ static_cast<uint8*>(malloc(size ? size : 1)) };
+				RE_CHECK(t, Decompress(CompressionLZ, compressed, compressedSize, out, size) && memcmp(out, data, size) == 0);
+
+				//the size is part of the contract, one byte off either way is corrupt input
+				if (size)
+					RE_CHECK(t, !Decompress(CompressionLZ, compressed, compressedSize, out, size - 1));
+				uint8* bigger{ static_cast<uint8*>(malloc(size + 1)) };
+				RE_CHECK(t, !Decompress(CompressionLZ, compressed, compressedSize, bigger, size + 1));
+
+				free(bigger);
+				free(out);
+				free(compressed);
+				free(data);
+			}
+		}
+	}
+
+	//Output that doesn't fit the capacity is refused, not cut
+	internal void TestLZCapacity(Test& t)
+	{
+		const size_t size{ 4096 };
+		uint8* data{ MakeTestData(TestDataNoise, size, 77) };
+		uint8* dst{ static_cast<uint8*>(malloc(size - 1)) };
+		RE_CHECK(t, Compress(CompressionLZ, data, size, dst, size - 1) == 0);
+		RE_CHECK(t, Compress(CompressionNone, data, size, dst, size - 1) == 0);
+		RE_CHECK(t, !Decompress(CompressionNone, data, size, dst, size - 1));
+
+		free(dst);
+		free(data);
+	}
+
+	internal void TestLZTruncated(Test& t)
+	{
+		for (uint32 kind{}; kind < NUM_TEST_DATA; ++kind)
+		{
+			const size_t size{ kind == TestDataText ? PACK_BLOCK_SIZE : 4096 };
+			uint8* data{ MakeTestData(static_cast<eTestData>(kind), size, 99 + kind) };
+			size_t compressedSize;
+			uint8* compressed{ CompressTestData(data, size, compressedSize) };
+			uint8* out{ static_cast<uint8*>(malloc(size)) };
+
+			//every prefix of the small blocks, a spread of them for the big one. Each is copied to its own allocation
+			const size_t step{ compressedSize > 4096 ? size_t{ 97 } : size_t{ 1 } };
+			uint32 accepted{};
+			for (size_t n{}; n < compressedSize; n += step)
+			{
+				uint8* prefix{ static_cast<uint8*>(malloc(n ? n : 1)) };
+				memcpy(prefix, compressed, n);
+				accepted += Decompress(CompressionLZ, prefix, n, out, size);
+				free(prefix);
+			}
+			RE_CHECK(t, accepted == 0);
+
+			free(out);
+			free(compressed);
+			free(data);
+		}
+	}
+
+	internal void TestLZCorrupted(Test& t)
+	{
+		//offset 0, and an offset reaching before the start of the output
+		const uint8 zeroOffset[]{ 0x10, 'a', 0x00, 0x00, 0x00 };
+		const uint8 farOffset[]{ 0x10, 'a', 0x02, 0x00, 0x00 };
+		uint8 small[32];
+		RE_CHECK(t, !Decompress(CompressionLZ, zeroOffset, sizeof(zeroOffset), small, 5));
+		RE_CHECK(t, !Decompress(CompressionLZ, farOffset, sizeof(farOffset), small, 5));
+
+		//random damage decodes to garbage or fails, it must never leave the buffers
+		uint32 state{ 0xC0FFEE };
+		for (uint32 kind{}; kind < NUM_TEST_DATA; ++kind)
+		{
+			const size_t size{ 20000 };
+			uint8* data{ MakeTestData(static_cast<eTestData>(kind), size, 5 + kind) };
+			size_t compressedSize;
+			uint8* compressed{ CompressTestData(data, size, compressedSize) };
+			uint8* damaged{ static_cast<uint8*>(malloc(compressedSize)) };
+			uint8* out{ static_cast<uint8*>(malloc(size)) };
+
+			uint32 accepted{};
+			for (uint32 round{}; round < 2000; ++round)
+			{
+				memcpy(damaged, compressed, compressedSize);
+				const uint32 numFlips{ 1 + NextCompressionRandom(state) % 4 };
+				for (uint32 i{}; i < numFlips; ++i)
+					damaged[NextCompressionRandom(state) % compressedSize] ^= static_cast<uint8>(1 + NextCompressionRandom(state) % 255);
+				accepted += Decompress(CompressionLZ, damaged, compressedSize, out, size);
+			}
+			//most damage changes a length or an offset and is caught by the size or bounds checks
+			RE_CHECK(t, accepted < 2000);
+
+			free(out);
+			free(damaged);
+			free(compressed);
+			free(data);
+		}
+	}
+
+	internal constexpr char TEST_PACK_PATH[]{ "radiant_tests.pack" };
+	internal constexpr char TEST_DAMAGED_PACK_PATH[]{ "radiant_tests_damaged.pack" };
+
+	struct TestPackFile
+	{
+		const char* path;
+		const char* sourcePath;
+		StringId id;
+		eCompressionCodec codec;
+		eTestData kind;
+		size_t size;
+	};
+
+	internal const TestPackFile TEST_PACK_FILES[]
+	{
+		{ "test/empty.bin",		"radiant_tests_empty.bin",		"test/empty.bin"_sid,	CompressionLZ,		TestDataText,	0 },
+		{ "test/small.txt",		"radiant_tests_small.txt",		"test/small.txt"_sid,	CompressionLZ,		TestDataText,	100 },
+		{ "test/blocks.txt",	"radiant_tests_blocks.txt",		"test/blocks.txt"_sid,	CompressionLZ,		TestDataText,	PACK_BLOCK_SIZE * 3 + PACK_BLOCK_SIZE / 2 },
+		{ "test/noise.bin",		"radiant_tests_noise.bin",		"test/noise.bin"_sid,	CompressionLZ,		TestDataNoise,	100000 },
+		{ "test/raw.txt",		"radiant_tests_raw.txt",		"test/raw.txt"_sid,		CompressionNone,	TestDataText,	5000 },
+	};
+
+	internal constexpr uint32 NUM_TEST_PACK_FILES{ sizeof(TEST_PACK_FILES) / sizeof(TEST_PACK_FILES[0]) };
+	internal constexpr uint32 TEST_PACK_BLOCKS{ 2 };	//TEST_PACK_FILES index of the multi block entry
+
+	internal uint8* MakePackFileData(const uint32 i) { return MakeTestData(TEST_PACK_FILES[i].kind, TEST_PACK_FILES[i].size, 1000 + i); }
+
+	internal bool WriteTestPack()
+	{
+		PackInput inputs[NUM_TEST_PACK_FILES];
+		bool ok{ true };
+		for (uint32 i{}; i < NUM_TEST_PACK_FILES; ++i)
+		{
+			const TestPackFile& f{ TEST_PACK_FILES[i] };
+			uint8* data{ MakePackFileData(i) };
+			ok = WriteEntireFile(f.sourcePath, data, f.size) && ok;
+			free(data);
+			inputs[i] = { f.path, f.sourcePath, f.codec };
+		}
+		return ok && WritePack(TEST_PACK_PATH, inputs, NUM_TEST_PACK_FILES);
+	}
+
+	internal void RemoveTestPack()
+	{
+		for (const TestPackFile& f : TEST_PACK_FILES)
+			remove(f.sourcePath);
+		remove(TEST_PACK_PATH);
+		remove(TEST_DAMAGED_PACK_PATH);
+	}
+
+	//Reads the entry into an exact size buffer and compares it with the source, false when it can't be read
+	internal bool ReadTestPackEntry(const Pack& pack, const PackEntry& entry, const uint8* expected, bool& same)
+	{
+		uint8* out{ static_cast<uint8*>(malloc(entry.size ? entry.size : 1)) };
+		const bool ok{ ReadPackEntry(pack, entry, out) };
+		same = ok && memcmp(out, expected, entry.size) == 0;
+		free(out);
+		return ok;
+	}
+
+	internal void TestPackRoundTrip(Test& t)
+	{
+		if (!RE_CHECK(t, WriteTestPack()))
+		{
+			RemoveTestPack();
+			return;
+		}
+
+		Pack pack;
+		if (!RE_CHECK(t, OpenPack(pack, TEST_PACK_PATH)))
+		{
+			RemoveTestPack();
+			return;
+		}
+
+		RE_CHECK(t, pack.header->numEntries == NUM_TEST_PACK_FILES);
+		RE_CHECK(t, FindPackEntry(pack, "test/missing.bin"_sid) == nullptr);
+		for (uint32 i{}; i < NUM_TEST_PACK_FILES; ++i)
+		{
+			const TestPackFile& f{ TEST_PACK_FILES[i] };
+			const PackEntry* entry{ FindPackEntry(pack, f.id) };
+			if (!RE_CHECK(t, entry != nullptr))
+				continue;
+
+			RE_CHECK(t, entry->size == f.size && entry->offset % PACK_ALIGNMENT == 0);
+			RE_CHECK(t, strcmp(PackEntryName(pack, *entry), f.path) == 0);
+
+			uint8* data{ MakePackFileData(i) };
+			bool same;
+			RE_CHECK(t, ReadTestPackEntry(pack, *entry, data, same) && same);
+			free(data);
+		}
+
+		//text shrinks and stays compressed, noise doesn't and is stored as is
+		RE_CHECK(t, IsPackEntryCompressed(*FindPackEntry(pack, "test/blocks.txt"_sid)));
+		RE_CHECK(t, !IsPackEntryCompressed(*FindPackEntry(pack, "test/noise.bin"_sid)));
+		RE_CHECK(t, !IsPackEntryCompressed(*FindPackEntry(pack, "test/raw.txt"_sid)));
+
+		//streaming: the middle blocks, then the short last one alone
+		const PackEntry& blocks{ *FindPackEntry(pack, "test/blocks.txt"_sid) };
+		uint8* data{ MakePackFileData(TEST_PACK_BLOCKS) };
+		uint8* out{ static_cast<uint8*>(malloc(PACK_BLOCK_SIZE * 2)) };
+		RE_CHECK(t, PackEntryBlocks(blocks) == 4);
+		RE_CHECK(t, DecompressPackBlocks(pack, blocks, 1, 2, out) && memcmp(out, data + PACK_BLOCK_SIZE, PACK_BLOCK_SIZE * 2) == 0);
+		RE_CHECK(t, DecompressPackBlocks(pack, blocks, 3, 1, out) && memcmp(out, data + PACK_BLOCK_SIZE * 3, PACK_BLOCK_SIZE / 2) == 0);
+		RE_CHECK(t, !DecompressPackBlocks(pack, blocks, 3, 2, out));
+		free(out);
+		free(data);
+
+		ClosePack(pack);
+		RemoveTestPack();
+	}
+
+	//Writes bytes as the damaged pack and opens it
+	internal bool OpenDamagedPack(Pack& pack, const uint8* bytes, const uint64 size)
+	{
+		return WriteEntireFile(TEST_DAMAGED_PACK_PATH, bytes, size) && OpenPack(pack, TEST_DAMAGED_PACK_PATH);
+	}
+
+	internal bool DamagedPackOpens(const uint8* bytes, const uint64 size)
+	{
+		Pack damaged;
+		if (!OpenDamagedPack(damaged, bytes, size))
+			return false;
+		ClosePack(damaged);
+		return true;
+	}
+
+	//Opens bytes as a pack and reads the multi block entry, same tells whether it still matches data
+	internal bool ReadDamagedBlocks(const uint8* bytes, const uint64 size, const uint8* data, bool& same)
+	{
+		Pack damaged;
+		if (!OpenDamagedPack(damaged, bytes, size))
+			return false;
+
+		const PackEntry* entry{ FindPackEntry(damaged, "test/blocks.txt"_sid) };
+		const bool ok{ entry && ReadTestPackEntry(damaged, *entry, data, same) };
+		ClosePack(damaged);
+		return ok;
+	}
+
+	internal void TestPackCorrupted(Test& t)
+	{
+		Pack pack;
+		if (!RE_CHECK(t, WriteTestPack() && OpenPack(pack, TEST_PACK_PATH)))
+		{
+			RemoveTestPack();
+			return;
+		}
+
+		//a private copy, the mapping goes away before the damaged packs are written
+		const uint64 size{ pack.file.size };
+		uint8* good{ static_cast<uint8*>(malloc(size)) };
+		memcpy(good, pack.file.data, size);
+		const PackEntry& entry{ *FindPackEntry(pack, "test/blocks.txt"_sid) };
+		const uint64 entryOffset{ pack.header->tocOffset + static_cast<uint64>(&entry - pack.toc) * sizeof(PackEntry) };
+		const uint64 dataOffset{ entry.offset };
+		const uint64 tableSize{ PackEntryBlocks(entry) * sizeof(uint32) };
+		const uint64 storedSize{ entry.storedSize };
+		ClosePack(pack);
+
+		uint8* bytes{ static_cast<uint8*>(malloc(size)) };
+		uint8* data{ MakePackFileData(TEST_PACK_BLOCKS) };
+		bool same;
+
+		//truncated anywhere, and a header that isn't a pack's
+		const uint64 cuts[]{ 0, sizeof(PackHeader) - 1, sizeof(PackHeader), size / 2, size - 1 };
+		for (const uint64 cut : cuts)
+			RE_CHECK(t, !DamagedPackOpens(good, cut));
+
+		memcpy(bytes, good, size);
+		bytes[0] ^= 0xFF;
+		RE_CHECK(t, !DamagedPackOpens(bytes, size));
+
+		//the entry points past the end of the pack, or off the alignment its block table is read with
+		PackEntry e;
+		memcpy(&e, good + entryOffset, sizeof(e));
+		const PackEntry badEntries[]
+		{
+			{ e.pathHash, e.offset, e.size, size, e.nameOffset, e.codec, 0 },
+			{ e.pathHash, size - 8, e.size, e.storedSize, e.nameOffset, e.codec, 0 },
+			{ e.pathHash, e.offset + 4, e.size, e.storedSize - 4, e.nameOffset, e.codec, 0 },
+			{ e.pathHash, e.offset, e.size, tableSize - 1, e.nameOffset, e.codec, 0 },
+		};
+		for (const PackEntry& bad : badEntries)
+		{
+			memcpy(bytes, good, size);
+			memcpy(bytes + entryOffset, &bad, sizeof(bad));
+			RE_CHECK(t, !ReadDamagedBlocks(bytes, size, data, same));
+		}
+
+		//block ends past the blocks, or going backwards
+		const uint32 badEnds[][2]{ { 0xFFFFFFFF, 0 }, { static_cast<uint32>(storedSize - tableSize + 1), 0 }, { 100, 50 } };
+		for (const uint32* ends : badEnds)
+		{
+			memcpy(bytes, good, size);
+			memcpy(bytes + dataOffset + sizeof(uint32) * 2, &ends[0], sizeof(uint32));
+			if (ends[1])
+				memcpy(bytes + dataOffset + sizeof(uint32) * 3, &ends[1], sizeof(uint32));
+			RE_CHECK(t, !ReadDamagedBlocks(bytes, size, data, same));
+		}
+
+		//damaged block contents decode to garbage or fail, never past the entry
+		uint32 state{ 0xBADC0DE };
+		uint32 accepted{};
+		for (uint32 round{}; round < 64; ++round)
+		{
+			memcpy(bytes, good, size);
+			const uint64 at{ dataOffset + tableSize + NextCompressionRandom(state) % (storedSize - tableSize) };
+			bytes[at] ^= static_cast<uint8>(1 + NextCompressionRandom(state) % 255);
+			accepted += ReadDamagedBlocks(bytes, size, data, same) && same;
+		}
+		RE_CHECK(t, accepted < 64);
+
+		free(data);
+		free(bytes);
+		free(good);
+		RemoveTestPack();
+	}
+
+	internal constexpr TestEntry COMPRESSION_ENTRIES[]
+	{
+		{ "compression/lz_roundtrip",	TestLZRoundTrip },
+		{ "compression/lz_capacity",	TestLZCapacity },
+		{ "compression/lz_truncated",	TestLZTruncated },
+		{ "compression/lz_corrupted",	TestLZCorrupted },
+		{ "compression/pack_roundtrip",	TestPackRoundTrip },
+		{ "compression/pack_corrupted",	TestPackCorrupted },
+	};
+
+	const TestGroup COMPRESSION_TESTS{ COMPRESSION_ENTRIES, sizeof(COMPRESSION_ENTRIES) / sizeof(COMPRESSION_ENTRIES[0]) };
+
+}
@@ -0,0 +1,220 @@
+//  Filename: testCulling 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:52:37		
+//  Sqwack-Studios													
+
+#include <cmath>
+#include <cstdlib>
+
+#include "test.h"
+#include "RadiantEngine/render/culling.h"
+
+//CullSpheres and CullAABBs against brute force over every bound. Coordinates are multiples of 1/4 and the plane normals
+//multiples of 1/2, so every distance is exact with or without FMA and both sides must agree on the bounds that only touch
+//a plane, which the random data hits often.
+//Counts and range begins that aren't multiples of 8 go through the scalar tail, split ranges through MergeCullRanges.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_CULL_BOUNDS{ 1001 };
+	internal constexpr uint32 CULL_COUNTS[]{ 0, 1, 7, 8, 9, 16, 23, 64, 100, NUM_CULL_BOUNDS };
+	internal constexpr uint32 CULL_SPLITS[]{ 1, 13, 8, 37, 64, 3 };
+
+	struct CullingSet
+	{
+		fp32* memory;
+		SphereSoA spheres;
+		AABBSoA boxes;
+	};
+
+	//A box around the +z axis with a tilted far plane, normals not normalized on purpose: the kernels don't need it
+	internal constexpr Frustum TEST_FRUSTUM
+	{ {
+		{ 1.f, 0.f, 0.f, 8.f },
+		{ -1.f, 0.f, 0.f, 8.f },
+		{ 0.f, 1.f, 0.f, 8.f },
+		{ 0.f, -1.f, 0.f, 8.f },
+		{ 0.f, 0.f, 1.f, -1.f },
+		{ -0.5f, 0.f, -0.5f, 16.f },
+	} };
+
+	internal uint32 NextCullRandom(uint32& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	//multiple of 1/4 in [min, min + steps / 4)
+	internal fp32 NextCullQuarter(uint32& state, const fp32 min, const uint32 steps)
+	{
+		return min + static_cast<fp32>(NextCullRandom(state) % steps) * 0.25f;
+	}
+
+	internal CullingSet MakeCullingSet()
+	{
+		CullingSet set{};
+		set.memory = static_cast<fp32*>(malloc(sizeof(fp32) * NUM_CULL_BOUNDS * 7));
+		fp32* x{ set.memory };
+		fp32* y{ set.memory + NUM_CULL_BOUNDS };
+		fp32* z{ set.memory + NUM_CULL_BOUNDS * 2 };
+		fp32* radius{ set.memory + NUM_CULL_BOUNDS * 3 };
+		fp32* extentX{ set.memory + NUM_CULL_BOUNDS * 4 };
+		fp32* extentY{ set.memory + NUM_CULL_BOUNDS * 5 };
+		fp32* extentZ{ set.memory + NUM_CULL_BOUNDS * 6 };
+
+		uint32 state{ 0x9E3779B9 };
+		for (uint32 i{}; i < NUM_CULL_BOUNDS; ++i)
+		{
+			x[i] = NextCullQuarter(state, -12.f, 96);
+			y[i] = NextCullQuarter(state, -12.f, 96);
+			z[i] = NextCullQuarter(state, -4.f, 112);
+			radius[i] = NextCullQuarter(state, 0.f, 16);
+			extentX[i] = NextCullQuarter(state, 0.f, 12);
+			extentY[i] = NextCullQuarter(state, 0.f, 12);
+			extentZ[i] = NextCullQuarter(state, 0.f, 12);
+		}
+
+		//the first bounds touch the left plane from outside, then cross it by a quarter, then touch the tilted far plane
+		x[0] = -10.f; y[0] = 0.f; z[0] = 4.f; radius[0] = 2.f; extentX[0] = 2.f;
+		x[1] = -10.f; y[1] = 0.f; z[1] = 4.f; radius[1] = 2.25f; extentX[1] = 2.25f;
+		x[2] = 0.f; y[2] = 0.f; z[2] = 36.f; radius[2] = 2.f; extentX[2] = 0.f; extentZ[2] = 4.f;
+		x[3] = 0.f; y[3] = 0.f; z[3] = 35.5f; radius[3] = 2.f; extentX[3] = 0.f; extentZ[3] = 4.f;
+
+		set.spheres = { x, y, z, radius };
+		set.boxes = { x, y, z, extentX, extentY, extentZ };
+		return set;
+	}
+
+	internal bool SphereVisibleReference(const Frustum& f, const SphereSoA s, const uint32 i)
+	{
+		for (const float4& p : f.planes)
+		{
+			if (!(p.x * s.x[i] + p.y * s.y[i] + p.z * s.z[i] + p.w > -s.radius[i]))
+				return false;
+		}
+		return true;
+	}
+
+	internal bool AABBVisibleReference(const Frustum& f, const AABBSoA b, const uint32 i)
+	{
+		for (const float4& p : f.planes)
+		{
+			const fp32 distance{ p.x * b.centerX[i] + p.y * b.centerY[i] + p.z * b.centerZ[i] + p.w };
+			const fp32 reach{ std::fabs(p.x) * b.extentX[i] + std::fabs(p.y) * b.extentY[i] + std::fabs(p.z) * b.extentZ[i] };
+			if (!(distance > -reach))
+				return false;
+		}
+		return true;
+	}
+
+	internal uint32 CullReference(const CullingSet& set, const bool boxes, const uint32 begin, const uint32 end, uint32* out)
+	{
+		uint32 num{};
+		for (uint32 i{ begin }; i < end; ++i)
+		{
+			if (boxes ? AABBVisibleReference(TEST_FRUSTUM, set.boxes, i) : SphereVisibleReference(TEST_FRUSTUM, set.spheres, i))
+				out[num++] = i;
+		}
+		return num;
+	}
+
+	internal CullResult CullKernel(const CullingSet& set, const bool boxes, const uint32 begin, const uint32 end, uint32* out)
+	{
+		return boxes ? CullAABBs(TEST_FRUSTUM, set.boxes, begin, end, out) : CullSpheres(TEST_FRUSTUM, set.spheres, begin, end, out);
+	}
+
+	internal bool SameIndices(const uint32* a, const uint32* b, const uint32 num)
+	{
+		for (uint32 i{}; i < num; ++i)
+		{
+			if (a[i] != b[i])
+				return false;
+		}
+		return true;
+	}
+
+	//out is exactly end - begin entries, so the sanitizers catch a kernel writing past it
+	internal void CheckCullRange(Test& t, const CullingSet& set, const bool boxes, const uint32 begin, const uint32 end)
+	{
+		const uint32 num{ end - begin };
+		uint32* out{ static_cast<uint32*>(malloc(sizeof(uint32) * (num ? num : 1))) };
+		uint32* expected{ static_cast<uint32*>(malloc(sizeof(uint32) * (num ? num : 1))) };
+
+		const CullResult r{ CullKernel(set, boxes, begin, end, out) };
+		const uint32 numExpected{ CullReference(set, boxes, begin, end, expected) };
+		RE_CHECK(t, r.numVisible == numExpected);
+		RE_CHECK(t, r.numVisible + r.numRejected == num);
+		RE_CHECK(t, r.numVisible == numExpected && SameIndices(out, expected, numExpected));
+
+		free(expected);
+		free(out);
+	}
+
+	internal void CheckCullRanges(Test& t, const bool boxes)
+	{
+		const CullingSet set{ MakeCullingSet() };
+
+		for (const uint32 num : CULL_COUNTS)
+		{
+			CheckCullRange(t, set, boxes, 0, num);
+			if (num + 3 <= NUM_CULL_BOUNDS)
+				CheckCullRange(t, set, boxes, 3, num + 3);
+		}
+
+		//the bounds built to touch a plane
+		uint32 edge[4];
+		const CullResult r{ CullKernel(set, boxes, 0, 4, edge) };
+		RE_CHECK(t, r.numVisible == 2 && edge[0] == 1 && edge[1] == 3);
+
+		free(set.memory);
+	}
+
+	//Chunks of uneven sizes, each culled into its own part of a shared list and merged
+	internal void CheckCullMerge(Test& t, const bool boxes)
+	{
+		const CullingSet set{ MakeCullingSet() };
+		uint32* out{ static_cast<uint32*>(malloc(sizeof(uint32) * NUM_CULL_BOUNDS)) };
+		uint32* expected{ static_cast<uint32*>(malloc(sizeof(uint32) * NUM_CULL_BOUNDS)) };
+
+		constexpr uint32 MAX_RANGES{ 64 };
+		uint32 rangeBegins[MAX_RANGES];
+		CullResult results[MAX_RANGES];
+		uint32 numRanges{};
+		for (uint32 begin{}; begin < NUM_CULL_BOUNDS; ++numRanges)
+		{
+			const uint32 end{ begin + CULL_SPLITS[numRanges % (sizeof(CULL_SPLITS) / sizeof(CULL_SPLITS[0]))] * 3 };
+			const uint32 clamped{ end < NUM_CULL_BOUNDS && numRanges + 1 < MAX_RANGES ? end : NUM_CULL_BOUNDS };
+			rangeBegins[numRanges] = begin;
+			results[numRanges] = CullKernel(set, boxes, begin, clamped, out + begin);
+			begin = clamped;
+		}
+
+		const uint32 total{ MergeCullRanges(out, rangeBegins, results, numRanges) };
+		const uint32 numExpected{ CullReference(set, boxes, 0, NUM_CULL_BOUNDS, expected) };
+		RE_CHECK(t, numRanges > 2);
+		RE_CHECK(t, total == numExpected);
+		RE_CHECK(t, total == numExpected && SameIndices(out, expected, numExpected));
+
+		free(expected);
+		free(out);
+		free(set.memory);
+	}
+
+	internal void TestCullSpheres(Test& t) { CheckCullRanges(t, false); }
+	internal void TestCullAABBs(Test& t) { CheckCullRanges(t, true); }
+	internal void TestCullSpheresMerge(Test& t) { CheckCullMerge(t, false); }
+	internal void TestCullAABBsMerge(Test& t) { CheckCullMerge(t, true); }
+
+	internal constexpr TestEntry CULLING_ENTRIES[]
+	{
+		{ "culling/spheres",		TestCullSpheres },
+		{ "culling/aabbs",			TestCullAABBs },
+		{ "culling/spheres_merge",	TestCullSpheresMerge },
+		{ "culling/aabbs_merge",	TestCullAABBsMerge },
+	};
+
+	const TestGroup CULLING_TESTS{ CULLING_ENTRIES, sizeof(CULLING_ENTRIES) / sizeof(CULLING_ENTRIES[0]) };
+
+}
@@ -0,0 +1,179 @@
+//  Filename: testFastMath 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:33:48		
+//  Sqwack-Studios													
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "test.h"
+#include "RadiantEngine/math/fastMath.h"
+
+//The error bounds documented in fastMath.h, checked against <cmath> in double precision over the documented ranges.
+//ulp bounds are distances to the correctly rounded fp32 result.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_FAST_MATH_CASES{ 200000 };
+
+	internal uint32 NextFastMathRandom(uint32& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	//[-1, 1)
+	internal fp32 NextUnit(uint32& state) { return static_cast<fp32>(NextFastMathRandom(state) >> 8) * (2.f / 16777216.f) - 1.f; }
+
+	//log-uniform over [1e-30, 1e30]
+	internal fp32 NextMagnitude(uint32& state)
+	{
+		const fp32 mantissa{ 1.f + static_cast<fp32>(NextFastMathRandom(state) >> 8) * (1.f / 16777216.f) };
+		return ldexpf(mantissa, static_cast<int>(NextFastMathRandom(state) % 196) - 98);
+	}
+
+	//Distance in representable fp32 values, only meaningful for a and b of the same sign
+	internal fp64 UlpDistance(const fp32 a, const fp64 exact)
+	{
+		const fp32 b{ static_cast<fp32>(exact) };
+		int32 ia, ib;
+		memcpy(&ia, &a, sizeof(ia));
+		memcpy(&ib, &b, sizeof(ib));
+		return std::fabs(static_cast<fp64>(ia) - static_cast<fp64>(ib));
+	}
+
+	internal void TestFastReciprocals(Test& t)
+	{
+		uint32 state{ 0x6A09E667 };
+		for (uint32 i{}; i < NUM_FAST_MATH_CASES && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			const fp32 x{ NextMagnitude(state) };
+			RE_CHECK_NEAR(t, UlpDistance(fast::rsqrt(x), 1.0 / std::sqrt(static_cast<fp64>(x))), 0.0, 4.0);
+			RE_CHECK_NEAR(t, UlpDistance(fast::rcp(x), 1.0 / static_cast<fp64>(x)), 0.0, 3.0);
+		}
+	}
+
+	internal void TestFastNormalize(Test& t)
+	{
+		uint32 state{ 0xBB67AE85 };
+		for (uint32 i{}; i < NUM_FAST_MATH_CASES && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			const float3 a3{ NextUnit(state), NextUnit(state), NextUnit(state) };
+			const float4 a4{ NextUnit(state), NextUnit(state), NextUnit(state), NextUnit(state) };
+			const float3 f3{ fast::normalize(a3) };
+			const float3 e3{ normalize(a3) };
+			const float4 f4{ fast::normalize(a4) };
+			const float4 e4{ normalize(a4) };
+
+			RE_CHECK_NEAR(t, UlpDistance(f3.x, e3.x), 0.0, 5.0);
+			RE_CHECK_NEAR(t, UlpDistance(f3.y, e3.y), 0.0, 5.0);
+			RE_CHECK_NEAR(t, UlpDistance(f3.z, e3.z), 0.0, 5.0);
+			RE_CHECK_NEAR(t, UlpDistance(f4.x, e4.x), 0.0, 5.0);
+			RE_CHECK_NEAR(t, UlpDistance(f4.y, e4.y), 0.0, 5.0);
+			RE_CHECK_NEAR(t, UlpDistance(f4.z, e4.z), 0.0, 5.0);
+			RE_CHECK_NEAR(t, UlpDistance(f4.w, e4.w), 0.0, 5.0);
+		}
+	}
+
+	internal void TestFastX8(Test& t)
+	{
+		uint32 state{ 0x3C6EF372 };
+		for (uint32 i{}; i < NUM_FAST_MATH_CASES / 8 && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			fp32 x[8], y[8], z[8], w[8];
+			for (uint32 l{}; l < 8; ++l)
+			{
+				x[l] = NextUnit(state);
+				y[l] = NextUnit(state);
+				z[l] = NextUnit(state);
+				w[l] = NextMagnitude(state);
+			}
+
+			fp32 rsqrt[8], rcp[8], nx[8], ny[8], nz[8];
+			store8(rsqrt, fast::rsqrt(load8(w)));
+			store8(rcp, fast::rcp(load8(w)));
+			const float3x8 n{ fast::normalize(float3x8{ load8(x), load8(y), load8(z) }) };
+			store8(nx, n.x);
+			store8(ny, n.y);
+			store8(nz, n.z);
+
+			for (uint32 l{}; l < 8; ++l)
+			{
+				RE_CHECK_NEAR(t, UlpDistance(rsqrt[l], 1.0 / std::sqrt(static_cast<fp64>(w[l]))), 0.0, 4.0);
+				RE_CHECK_NEAR(t, UlpDistance(rcp[l], 1.0 / static_cast<fp64>(w[l])), 0.0, 3.0);
+
+				const float3 e{ normalize(float3{ x[l], y[l], z[l] }) };
+				RE_CHECK_NEAR(t, UlpDistance(nx[l], e.x), 0.0, 5.0);
+				RE_CHECK_NEAR(t, UlpDistance(ny[l], e.y), 0.0, 5.0);
+				RE_CHECK_NEAR(t, UlpDistance(nz[l], e.z), 0.0, 5.0);
+			}
+		}
+	}
+
+	internal void TestFastTrigonometry(Test& t)
+	{
+		uint32 state{ 0xA54FF53A };
+		for (uint32 i{}; i < NUM_FAST_MATH_CASES && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			const fp32 x{ NextUnit(state) * 1000.f };
+			RE_CHECK_NEAR(t, fast::sin(x), std::sin(static_cast<fp64>(x)), 3e-7);
+			RE_CHECK_NEAR(t, fast::cos(x), std::cos(static_cast<fp64>(x)), 3e-7);
+
+			//every octant, magnitudes 2^-10 .. 2^10
+			const fp32 ay{ ldexpf(NextUnit(state), static_cast<int>(NextFastMathRandom(state) % 21) - 10) };
+			const fp32 ax{ ldexpf(NextUnit(state), static_cast<int>(NextFastMathRandom(state) % 21) - 10) };
+			RE_CHECK_NEAR(t, fast::atan2(ay, ax), std::atan2(static_cast<fp64>(ay), static_cast<fp64>(ax)), 2e-6);
+		}
+
+		//signed zeros and the axes follow std::atan2
+		const fp32 ys[]{ 0.f, -0.f };
+		const fp32 xs[]{ 0.f, -0.f, 1.f, -1.f };
+		for (const fp32 y : ys)
+		{
+			for (const fp32 x : xs)
+			{
+				const fp32 r{ fast::atan2(y, x) };
+				const fp32 e{ std::atan2(y, x) };
+				RE_CHECK_NEAR(t, r, e, 1e-6);
+				RE_CHECK(t, std::signbit(r) == std::signbit(e));
+			}
+		}
+		RE_CHECK_NEAR(t, fast::atan2(-0.f, -1.f), -3.14159265358979, 1e-6);
+		RE_CHECK_NEAR(t, fast::atan2(1.f, 0.f), 1.5707963267949, 1e-6);
+		RE_CHECK_NEAR(t, fast::atan2(-1.f, -0.f), -1.5707963267949, 1e-6);
+	}
+
+	internal void TestFastExp(Test& t)
+	{
+		uint32 state{ 0x510E527F };
+		for (uint32 i{}; i < NUM_FAST_MATH_CASES && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			const fp32 x{ (NextUnit(state) + 1.f) * 87.5f - 87.f };
+			const fp64 e{ std::exp(static_cast<fp64>(x)) };
+			RE_CHECK_NEAR(t, fast::exp(x), e, 3e-7 * e);
+		}
+
+		RE_CHECK(t, std::isnan(fast::exp(NAN)));
+		RE_CHECK(t, std::isnan(fast::exp(-NAN)));
+		//clamped to [-87, 88]
+		RE_CHECK(t, fast::exp(-1000.f) == fast::exp(-87.f));
+		RE_CHECK(t, fast::exp(1000.f) == fast::exp(88.f));
+		RE_CHECK(t, fast::exp(-INFINITY) == fast::exp(-87.f));
+		RE_CHECK(t, fast::exp(0.f) == 1.f);
+	}
+
+	internal constexpr TestEntry FAST_MATH_ENTRIES[]
+	{
+		{ "fast_math/rsqrt_rcp",		TestFastReciprocals },
+		{ "fast_math/normalize",		TestFastNormalize },
+		{ "fast_math/x8",				TestFastX8 },
+		{ "fast_math/trigonometry",		TestFastTrigonometry },
+		{ "fast_math/exp",				TestFastExp },
+	};
+
+	const TestGroup FAST_MATH_TESTS{ FAST_MATH_ENTRIES, sizeof(FAST_MATH_ENTRIES) / sizeof(FAST_MATH_ENTRIES[0]) };
+
+}
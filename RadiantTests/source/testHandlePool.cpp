@@ -0,0 +1,255 @@
+//  Filename: testHandlePool 
+//	Author:	Daniel														
+//	Date: 19/10/2026 10:14:08		
+//  Sqwack-Studios													
+
+#include <cstdlib>
+
+#include "test.h"
+#include "RadiantEngine/core/handlePool.h"
+
+//HandlePool against a list of live handles and the value each was created with. After every step the dense array must
+//hold exactly the live objects, HandleAt must give back a handle that resolves to the same dense position, and every
+//released handle must stay invalid until its slot's generation comes around again.
+//ResolveHandle only refuses stale handles with RE_HANDLE_VALIDATION, those checks are compiled in when it is on.
+namespace RE
+{
+
+	internal constexpr uint32 HANDLE_POOL_CAPACITY{ 256 };
+	internal constexpr uint32 NUM_HANDLE_POOL_STEPS{ 50000 };
+
+	struct PooledObject
+	{
+		uint32 id;
+		fp32 payload;
+	};
+
+	using TestHandle = Handle<PooledObject>;
+
+	struct ReleasedHandle
+	{
+		TestHandle handle;
+		uint32 slotReleases;	//releases of its slot before this one
+	};
+
+	internal uint32 NextHandlePoolRandom(uint32& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	internal bool ResolvesTo(HandlePool<PooledObject>& pool, const TestHandle handle, const uint32 id)
+	{
+		const PooledObject* object{ ResolveHandle(pool, handle) };
+		return IsHandleValid(pool, handle) && object && object->id == id;
+	}
+
+	internal void TestHandlePoolBasic(Test& t)
+	{
+		HandlePool<PooledObject> pool;
+		RE_CHECK(t, !InitHandlePool(pool, 0));
+		RE_CHECK(t, !InitHandlePool(pool, MAX_HANDLE_POOL_CAPACITY + 1));
+		if (!RE_CHECK(t, InitHandlePool(pool, 4)))
+			return;
+
+		TestHandle handles[4];
+		for (uint32 i{}; i < 4; ++i)
+		{
+			handles[i] = CreateHandle(pool, PooledObject{ i, static_cast<fp32>(i) });
+			RE_CHECK(t, handles[i].value != 0);
+		}
+
+		//full
+		RE_CHECK(t, CreateHandle(pool, PooledObject{ 9, 0.f }).value == 0);
+		RE_CHECK(t, pool.num == 4);
+		RE_CHECK(t, handles[0] != handles[1] && handles[2] != handles[3]);
+		for (uint32 i{}; i < 4; ++i)
+			RE_CHECK(t, ResolvesTo(pool, handles[i], i));
+
+		RE_CHECK(t, !IsHandleValid(pool, TestHandle{}));
+		RE_CHECK(t, !IsHandleValid(pool, TestHandle{ (1u << HANDLE_INDEX_BITS) | 4 }));
+
+		ReleaseHandle(pool, handles[2]);
+		RE_CHECK(t, pool.num == 3 && !IsHandleValid(pool, handles[2]));
+		RE_CHECK(t, ResolvesTo(pool, handles[0], 0) && ResolvesTo(pool, handles[1], 1) && ResolvesTo(pool, handles[3], 3));
+
+		//released twice, zero handle: both ignored
+		ReleaseHandle(pool, handles[2]);
+		ReleaseHandle(pool, TestHandle{});
+		RE_CHECK(t, pool.num == 3);
+
+		ShutdownHandlePool(pool);
+		RE_CHECK(t, pool.capacity == 0 && pool.memory == nullptr);
+	}
+
+	//A released slot is the next one handed out, with the next generation: same index, different handle
+	internal void TestHandlePoolStale(Test& t)
+	{
+		HandlePool<PooledObject> pool;
+		if (!RE_CHECK(t, InitHandlePool(pool, 8)))
+			return;
+
+		const TestHandle a{ CreateHandle(pool, PooledObject{ 1, 0.f }) };
+		const TestHandle keep{ CreateHandle(pool, PooledObject{ 2, 0.f }) };
+		ReleaseHandle(pool, a);
+		const TestHandle b{ CreateHandle(pool, PooledObject{ 3, 0.f }) };
+
+		RE_CHECK(t, HandleIndex(a.value) == HandleIndex(b.value));
+		RE_CHECK(t, HandleGeneration(b.value) == HandleGeneration(a.value) + 1);
+		RE_CHECK(t, a != b);
+		RE_CHECK(t, !IsHandleValid(pool, a));
+		RE_CHECK(t, ResolvesTo(pool, b, 3) && ResolvesTo(pool, keep, 2));
+#if RE_HANDLE_VALIDATION
+		RE_CHECK(t, ResolveHandle(pool, a) == nullptr);
+#endif
+
+		//the stale handle can't release the slot's new owner
+		ReleaseHandle(pool, a);
+		RE_CHECK(t, pool.num == 2 && ResolvesTo(pool, b, 3));
+
+		ShutdownHandlePool(pool);
+	}
+
+	//One slot, released over and over: generations run 1..HANDLE_GENERATION_MASK and start again at 1, never 0, so no
+	//handle is ever the zero handle
+	internal void TestHandlePoolGenerationWrap(Test& t)
+	{
+		HandlePool<PooledObject> pool;
+		if (!RE_CHECK(t, InitHandlePool(pool, 1)))
+			return;
+
+		const TestHandle first{ CreateHandle(pool, PooledObject{ 0, 0.f }) };
+		RE_CHECK(t, first.value != 0 && HandleIndex(first.value) == 0 && HandleGeneration(first.value) == 1);
+
+		TestHandle previous{ first };
+		uint32 wrongGenerations{};
+		for (uint32 i{ 1 }; i <= HANDLE_GENERATION_MASK; ++i)
+		{
+			ReleaseHandle(pool, previous);
+			const TestHandle h{ CreateHandle(pool, PooledObject{ i, 0.f }) };
+			const uint32 expected{ i < HANDLE_GENERATION_MASK ? i + 1 : 1 };
+			wrongGenerations += h.value == 0 || HandleGeneration(h.value) != expected || !ResolvesTo(pool, h, i);
+			previous = h;
+		}
+
+		RE_CHECK(t, wrongGenerations == 0);
+		//a full cycle later the first handle matches again, what the generation bits can tell apart is finite
+		RE_CHECK(t, previous == first && IsHandleValid(pool, first));
+
+		ShutdownHandlePool(pool);
+	}
+
+	//The last object fills the hole a release leaves: its handle must now map to the hole and HandleAt must agree
+	internal void TestHandlePoolSwapRemove(Test& t)
+	{
+		HandlePool<PooledObject> pool;
+		if (!RE_CHECK(t, InitHandlePool(pool, 8)))
+			return;
+
+		TestHandle handles[5];
+		for (uint32 i{}; i < 5; ++i)
+			handles[i] = CreateHandle(pool, PooledObject{ i, 0.f });
+
+		ReleaseHandle(pool, handles[1]);
+		RE_CHECK(t, pool.num == 4 && pool.objects[1].id == 4);
+		RE_CHECK(t, HandleAt(pool, 1) == handles[4] && ResolveHandle(pool, handles[4]) == &pool.objects[1]);
+
+		//releasing the last dense object moves nothing
+		ReleaseHandle(pool, handles[4]);
+		RE_CHECK(t, pool.num == 3 && pool.objects[0].id == 0 && pool.objects[1].id == 3 && pool.objects[2].id == 2);
+		RE_CHECK(t, HandleAt(pool, 0) == handles[0] && HandleAt(pool, 1) == handles[3] && HandleAt(pool, 2) == handles[2]);
+
+		ReleaseHandle(pool, handles[0]);
+		RE_CHECK(t, pool.objects[0].id == 2 && HandleAt(pool, 0) == handles[2] && HandleAt(pool, 1) == handles[3]);
+
+		ShutdownHandlePool(pool);
+	}
+
+	//Random creates and releases against the list of live handles, with the dense array checked after every step
+	internal void TestHandlePoolRandom(Test& t)
+	{
+		HandlePool<PooledObject> pool;
+		if (!RE_CHECK(t, InitHandlePool(pool, HANDLE_POOL_CAPACITY)))
+			return;
+
+		TestHandle* live{ static_cast<TestHandle*>(malloc(sizeof(TestHandle) * HANDLE_POOL_CAPACITY)) };
+		uint32* liveIds{ static_cast<uint32*>(malloc(sizeof(uint32) * HANDLE_POOL_CAPACITY)) };
+		ReleasedHandle* released{ static_cast<ReleasedHandle*>(malloc(sizeof(ReleasedHandle) * NUM_HANDLE_POOL_STEPS)) };
+		uint32* slotReleases{ static_cast<uint32*>(calloc(HANDLE_POOL_CAPACITY, sizeof(uint32))) };
+		uint32 numLive{};
+		uint32 numReleased{};
+		uint32 wrongDense{};
+		uint32 wrongLive{};
+		uint32 wrongCreates{};
+
+		uint32 state{ 0x6A09E667 };
+		for (uint32 step{}; step < NUM_HANDLE_POOL_STEPS; ++step)
+		{
+			//drifts between empty and full so both ends get hit
+			const uint32 bias{ (step / 5000) % 2 ? 3u : 7u };
+			if (numLive < HANDLE_POOL_CAPACITY && (numLive == 0 || NextHandlePoolRandom(state) % 10 < bias))
+			{
+				const TestHandle h{ CreateHandle(pool, PooledObject{ step, static_cast<fp32>(step) }) };
+				wrongCreates += h.value == 0;
+				live[numLive] = h;
+				liveIds[numLive++] = step;
+			}
+			else if (numLive)
+			{
+				const uint32 i{ NextHandlePoolRandom(state) % numLive };
+				ReleaseHandle(pool, live[i]);
+				released[numReleased++] = { live[i], slotReleases[HandleIndex(live[i].value)]++ };
+				live[i] = live[--numLive];
+				liveIds[i] = liveIds[numLive];
+			}
+
+			wrongDense += pool.num != numLive;
+			for (uint32 d{}; d < pool.num; ++d)
+			{
+				const TestHandle h{ HandleAt(pool, d) };
+				wrongDense += !IsHandleValid(pool, h) || ResolveHandle(pool, h) != &pool.objects[d];
+			}
+			for (uint32 i{}; i < numLive; ++i)
+				wrongLive += !ResolvesTo(pool, live[i], liveIds[i]);
+		}
+
+		//the free list hands the last released slot out first, so a few slots go through whole generation cycles. A
+		//released handle matches again exactly when its slot was released a multiple of HANDLE_GENERATION_MASK times since
+		uint32 wrongReleased{};
+		uint32 numWrapped{};
+		for (uint32 i{}; i < numReleased; ++i)
+		{
+			const ReleasedHandle& r{ released[i] };
+			const uint32 since{ slotReleases[HandleIndex(r.handle.value)] - r.slotReleases };
+			const bool wrapped{ since % HANDLE_GENERATION_MASK == 0 };
+			wrongReleased += IsHandleValid(pool, r.handle) != wrapped;
+			numWrapped += wrapped;
+		}
+
+		RE_CHECK(t, wrongCreates == 0);
+		RE_CHECK(t, wrongDense == 0);
+		RE_CHECK(t, wrongLive == 0);
+		RE_CHECK(t, wrongReleased == 0);
+		RE_CHECK(t, numWrapped < numReleased);
+
+		free(slotReleases);
+		free(released);
+		free(liveIds);
+		free(live);
+		ShutdownHandlePool(pool);
+	}
+
+	internal constexpr TestEntry HANDLE_POOL_ENTRIES[]
+	{
+		{ "handlepool/basic",			TestHandlePoolBasic },
+		{ "handlepool/stale",			TestHandlePoolStale },
+		{ "handlepool/generation_wrap",	TestHandlePoolGenerationWrap },
+		{ "handlepool/swap_remove",		TestHandlePoolSwapRemove },
+		{ "handlepool/random",			TestHandlePoolRandom },
+	};
+
+	const TestGroup HANDLE_POOL_TESTS{ HANDLE_POOL_ENTRIES, sizeof(HANDLE_POOL_ENTRIES) / sizeof(HANDLE_POOL_ENTRIES[0]) };
+
+}
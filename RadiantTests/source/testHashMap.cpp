@@ -0,0 +1,327 @@
+//  Filename: testHashMap 
+//	Author:	Daniel														
+//	Date: 19/10/2026 10:09:33		
+//  Sqwack-Studios													
+
+#include <cstdlib>
+#include <cstring>
+
+#include "test.h"
+#include "RadiantEngine/core/hashMap.h"
+#include "RadiantEngine/core/arena.h"
+
+//HashMap against a plain array indexed by key, over random inserts, overwrites and erases. Tombstone reuse is checked
+//with a hasher that sends every key to the same group, so groups fill up and erases have to leave DELETED markers.
+//The arena tests grow a map inside an Arena until the reservation runs out: the failed insert must leave the map as it was.
+namespace RE
+{
+
+	internal constexpr uint32 HASH_MAP_KEY_RANGE{ 4096 };
+	internal constexpr uint32 NUM_HASH_MAP_STEPS{ 200000 };
+
+	//Every key probes the same groups in the same order
+	struct CollidingHash
+	{
+		RE_INLINE uint64 operator()(const uint32) const { return 0; }
+	};
+
+	using CollidingMap = HashMap<uint32, uint32, CollidingHash>;
+
+	internal uint32 NextHashMapRandom(uint32& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	template<typename Map>
+	internal bool SlotOfKeyIs(const Map& map, const uint32 key, const size_t slot)
+	{
+		return map.isFull(slot) && map.keys[slot] == key;
+	}
+
+	template<typename Map>
+	internal size_t CountFull(const Map& map)
+	{
+		size_t num{};
+		for (size_t i{}; i < map.capacity; ++i)
+			num += map.isFull(i);
+		return num;
+	}
+
+	internal void TestHashMapBasic(Test& t)
+	{
+		HashMap<uint32, uint32> map{};
+		RE_CHECK(t, map.find(1) == nullptr && !map.contains(1) && !map.erase(1));
+
+		RE_CHECK(t, map.insert(1, 10) && map.insert(2, 20) && map.insert(3, 30));
+		RE_CHECK(t, map.num == 3 && map.capacity == HASH_MAP_GROUP_WIDTH);
+		RE_CHECK(t, map.find(2) && *map.find(2) == 20);
+
+		//overwrite in place
+		RE_CHECK(t, map.insert(2, 21) && *map.find(2) == 21 && map.num == 3);
+
+		bool added;
+		uint32* v{ map.findOrAdd(3, added) };
+		RE_CHECK(t, v && !added && *v == 30);
+		v = map.findOrAdd(4, added);
+		RE_CHECK(t, v && added && map.num == 4);
+		*v = 40;
+		RE_CHECK(t, *map.find(4) == 40);
+
+		RE_CHECK(t, map.erase(2) && !map.contains(2) && !map.erase(2) && map.num == 3);
+		RE_CHECK(t, map.contains(1) && map.contains(3) && map.contains(4));
+
+		const HashMap<uint32, uint32>& constMap{ map };
+		RE_CHECK(t, constMap.find(3) && *constMap.find(3) == 30 && constMap.find(2) == nullptr);
+
+		map.clear();
+		RE_CHECK(t, map.num == 0 && !map.contains(1) && CountFull(map) == 0);
+		RE_CHECK(t, map.insert(5, 50) && *map.find(5) == 50);
+
+		map.release();
+		RE_CHECK(t, map.capacity == 0 && map.num == 0 && !map.contains(5));
+	}
+
+	//Random inserts, overwrites and erases against an array, with the whole table compared every so often
+	internal void TestHashMapRandom(Test& t)
+	{
+		HashMap<uint32, uint32> map{};
+		uint32* reference{ static_cast<uint32*>(malloc(sizeof(uint32) * HASH_MAP_KEY_RANGE)) };
+		bool* present{ static_cast<bool*>(calloc(HASH_MAP_KEY_RANGE, sizeof(bool))) };
+		uint32 numPresent{};
+		uint32 wrongFinds{};
+		uint32 wrongOps{};
+		uint32 wrongTables{};
+
+		uint32 state{ 0x51ED270B };
+		for (uint32 step{}; step < NUM_HASH_MAP_STEPS; ++step)
+		{
+			//the key range is small, so the same keys come and go through the whole run
+			const uint32 key{ NextHashMapRandom(state) % HASH_MAP_KEY_RANGE };
+			const uint32 op{ NextHashMapRandom(state) % 8 };
+			if (op < 4)
+			{
+				const uint32 value{ NextHashMapRandom(state) };
+				wrongOps += map.insert(key, value) == nullptr;
+				numPresent += !present[key];
+				present[key] = true;
+				reference[key] = value;
+			}
+			else if (op < 7)
+			{
+				wrongOps += map.erase(key) != present[key];
+				numPresent -= present[key];
+				present[key] = false;
+			}
+			else
+			{
+				const uint32* v{ map.find(key) };
+				wrongFinds += present[key] ? !v || *v != reference[key] : v != nullptr;
+			}
+
+			if (step % 4096 == 0)
+			{
+				uint32 numFound{};
+				for (size_t i{}; i < map.capacity; ++i)
+				{
+					if (!map.isFull(i))
+						continue;
+					numFound++;
+					wrongTables += !present[map.keys[i]] || map.values[i] != reference[map.keys[i]];
+				}
+				wrongTables += numFound != numPresent || map.num != numPresent;
+			}
+		}
+
+		RE_CHECK(t, wrongFinds == 0);
+		RE_CHECK(t, wrongOps == 0);
+		RE_CHECK(t, wrongTables == 0);
+		RE_CHECK(t, map.num == numPresent);
+
+		map.release();
+		free(present);
+		free(reference);
+	}
+
+	//Every key wants the first group. Once it's full, erasing from it leaves a DELETED marker that the next insert takes
+	//back without spending growth, and lookups keep probing past it
+	internal void TestHashMapTombstones(Test& t)
+	{
+		CollidingMap map{};
+		if (!RE_CHECK(t, map.init(20)))
+			return;
+		RE_CHECK(t, map.capacity == HASH_MAP_GROUP_WIDTH * 2);
+
+		for (uint32 key{}; key < 20; ++key)
+			map.insert(key, key * 10);
+
+		//keys 0..15 went to the first group in order, 16..19 spilled into the second
+		RE_CHECK(t, SlotOfKeyIs(map, 5, 5) && SlotOfKeyIs(map, 16, HASH_MAP_GROUP_WIDTH));
+
+		const size_t growthLeft{ map.growthLeft };
+		RE_CHECK(t, map.erase(5));
+		RE_CHECK(t, map.ctrl[5] == CollidingMap::DELETED);
+		RE_CHECK(t, map.growthLeft == growthLeft);
+		RE_CHECK(t, map.find(16) && *map.find(16) == 160 && map.find(19) && *map.find(19) == 190);
+		RE_CHECK(t, !map.contains(5));
+
+		RE_CHECK(t, map.insert(100, 1000) && SlotOfKeyIs(map, 100, 5));
+		RE_CHECK(t, map.growthLeft == growthLeft && map.num == 20);
+
+		//the second group still has EMPTY slots, erasing there makes the slot EMPTY and gives the growth back
+		RE_CHECK(t, map.erase(19));
+		RE_CHECK(t, map.ctrl[HASH_MAP_GROUP_WIDTH + 3] == CollidingMap::EMPTY);
+		RE_CHECK(t, map.growthLeft == growthLeft + 1);
+
+		for (uint32 key{}; key < 20; ++key)
+			RE_CHECK(t, map.contains(key) == (key != 5 && key != 19));
+		RE_CHECK(t, map.find(100) && *map.find(100) == 1000);
+
+		map.release();
+	}
+
+	//A fixed number of live keys with a stream of new ones in and old ones out: tombstones build up and the table has to
+	//be rebuilt at the same size, not doubled over and over
+	internal void TestHashMapChurn(Test& t)
+	{
+		constexpr uint32 NUM_LIVE{ 20 };
+		HashMap<uint32, uint32> map{};
+		if (!RE_CHECK(t, map.init(NUM_LIVE)))
+			return;
+
+		const size_t capacity{ map.capacity };
+		uint32 missing{};
+		for (uint32 key{}; key < 100000; ++key)
+		{
+			map.insert(key, key);
+			if (key >= NUM_LIVE)
+				map.erase(key - NUM_LIVE);
+			missing += !map.contains(key);
+		}
+
+		RE_CHECK(t, missing == 0);
+		RE_CHECK(t, map.num == NUM_LIVE);
+		RE_CHECK(t, map.capacity <= capacity * 2);
+
+		map.release();
+	}
+
+	//Growth happens exactly past the 7/8 load, keeps every entry and the capacity a power of two
+	internal void TestHashMapGrowth(Test& t)
+	{
+		HashMap<uint32, uint32> map{};
+		size_t lastCapacity{};
+		uint32 wrongCapacity{};
+		uint32 numGrowths{};
+		for (uint32 key{}; key < 50000; ++key)
+		{
+			const uint32 k{ key * 2654435761u };
+			map.insert(k, key);
+			if (map.capacity != lastCapacity)
+			{
+				//the insert that grew it didn't fit in the last table
+				wrongCapacity += lastCapacity && map.num <= lastCapacity - lastCapacity / 8;
+				lastCapacity = map.capacity;
+				numGrowths++;
+			}
+			wrongCapacity += (map.capacity & (map.capacity - 1)) != 0 || map.num > map.capacity - map.capacity / 8;
+		}
+
+		RE_CHECK(t, wrongCapacity == 0);
+		RE_CHECK(t, numGrowths > 10);
+		RE_CHECK(t, map.num == 50000 && CountFull(map) == 50000);
+
+		uint32 wrongValues{};
+		for (uint32 key{}; key < 50000; ++key)
+		{
+			const uint32* v{ map.find(key * 2654435761u) };
+			wrongValues += !v || *v != key;
+		}
+		RE_CHECK(t, wrongValues == 0);
+
+		//rehash to a smaller count never drops entries
+		RE_CHECK(t, map.rehash(0) && map.num == 50000 && map.contains(49999 * 2654435761u));
+
+		map.release();
+	}
+
+	internal void TestHashMapArena(Test& t)
+	{
+		Arena arena{};
+		if (!RE_CHECK(t, InitArena(arena, 64ull * 1024 * 1024)))
+			return;
+
+		HashMap<uint64, uint32> map{};
+		RE_CHECK(t, map.init(0, ArenaAllocator(arena)));
+		for (uint32 i{}; i < 100000; ++i)
+			map.insert(MixHash(i), i);
+
+		uint32 wrongValues{};
+		for (uint32 i{}; i < 100000; ++i)
+		{
+			const uint32* v{ map.find(MixHash(i)) };
+			wrongValues += !v || *v != i;
+		}
+		RE_CHECK(t, wrongValues == 0);
+		RE_CHECK(t, map.num == 100000);
+
+		//the tables live in the arena
+		const uint8* ctrl{ reinterpret_cast<const uint8*>(map.ctrl) };
+		RE_CHECK(t, ctrl >= arena.base && ctrl + map.capacity <= arena.base + arena.pos);
+
+		//release hands the table back to the allocator, which for an arena is a no op until it's reset
+		map.release();
+		RE_CHECK(t, map.capacity == 0 && map.allocator.context == &arena);
+
+		ShutdownArena(arena);
+	}
+
+	//Old tables stay in the arena after a rehash, a small one runs out while growing. The insert that can't grow fails
+	//and everything inserted before it is still there
+	internal void TestHashMapArenaExhausted(Test& t)
+	{
+		Arena arena{};
+		if (!RE_CHECK(t, InitArena(arena, ARENA_COMMIT_GRANULARITY)))
+			return;
+
+		HashMap<uint32, uint32> map{};
+		RE_CHECK(t, map.init(0, ArenaAllocator(arena)));
+
+		uint32 numInserted{};
+		while (numInserted < 100000 && map.insert(numInserted, numInserted * 3))
+			numInserted++;
+
+		RE_CHECK(t, numInserted > 1000 && numInserted < 100000);
+		RE_CHECK(t, map.num == numInserted && !map.contains(numInserted));
+
+		uint32 wrongValues{};
+		for (uint32 i{}; i < numInserted; ++i)
+		{
+			const uint32* v{ map.find(i) };
+			wrongValues += !v || *v != i * 3;
+		}
+		RE_CHECK(t, wrongValues == 0);
+
+		//overwrites and erases don't need to grow
+		RE_CHECK(t, map.insert(0, 7) && *map.find(0) == 7);
+		RE_CHECK(t, map.erase(1) && map.insert(1, 9) && *map.find(1) == 9);
+
+		ShutdownArena(arena);
+	}
+
+	internal constexpr TestEntry HASH_MAP_ENTRIES[]
+	{
+		{ "hashmap/basic",				TestHashMapBasic },
+		{ "hashmap/random",				TestHashMapRandom },
+		{ "hashmap/tombstones",			TestHashMapTombstones },
+		{ "hashmap/churn",				TestHashMapChurn },
+		{ "hashmap/growth",				TestHashMapGrowth },
+		{ "hashmap/arena",				TestHashMapArena },
+		{ "hashmap/arena_exhausted",	TestHashMapArenaExhausted },
+	};
+
+	const TestGroup HASH_MAP_TESTS{ HASH_MAP_ENTRIES, sizeof(HASH_MAP_ENTRIES) / sizeof(HASH_MAP_ENTRIES[0]) };
+
+}
@@ -0,0 +1,186 @@
+//  Filename: testLog 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:47:22		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "test.h"
+#include "RadiantEngine/core/log.h"
+
+//The logger's thread rings: slots recycled as threads exit, registrations from before a ShutdownLog/InitLog pair, and
+//messages too big for a ring. Each test logs to a text file and reads it back after ShutdownLog, which writes everything.
+//Warning level, so the messages exist in every configuration.
+namespace RE
+{
+
+	internal constexpr char TEST_LOG_PATH[]{ "radiant_tests_log.txt" };
+
+	internal bool StartTestLog()
+	{
+		return InitLog({ .console = false, .textPath = TEST_LOG_PATH, .binaryPath = nullptr, .minLevel = LogLevelTrace });
+	}
+
+	//The whole file, '\0' terminated. Free it with free
+	internal char* ReadTestLog()
+	{
+		FILE* f{ fopen(TEST_LOG_PATH, "rb") };
+		if (!f)
+			return nullptr;
+
+		fseek(f, 0, SEEK_END);
+		const long size{ ftell(f) };
+		fseek(f, 0, SEEK_SET);
+		char* text{ static_cast<char*>(malloc(size + 1)) };
+		const size_t read{ text ? fread(text, 1, size, f) : 0 };
+		fclose(f);
+		if (text)
+			text[read] = '\0';
+		return text;
+	}
+
+	internal uint32 CountOccurrences(const char* text, const char* pattern)
+	{
+		uint32 num{};
+		for (const char* p{ strstr(text, pattern) }; p; p = strstr(p + 1, pattern))
+			++num;
+		return num;
+	}
+
+	//The [thread] column of the line containing pattern, -1 when there is none
+	internal int32 LogLineThread(const char* text, const char* pattern)
+	{
+		const char* p{ strstr(text, pattern) };
+		if (!p)
+			return -1;
+
+		while (p > text && p[-1] != '\n')
+			--p;
+		const char* bracket{ strchr(p, '[') };
+		return bracket ? atoi(bracket + 1) : -1;
+	}
+
+	//Many more threads than slots over the run, one at a time: every one of them must get a recycled slot
+	internal void TestLogSlotsRecycled(Test& t)
+	{
+		constexpr uint32 NUM_THREADS{ MAX_LOG_THREADS * 3 };
+		if (!RE_CHECK(t, StartTestLog()))
+			return;
+
+		for (uint32 i{}; i < NUM_THREADS; ++i)
+		{
+			std::thread thread{ [i]() { RE_LOG_WARNING("recycled thread <{}>", i); } };
+			thread.join();
+		}
+
+		ShutdownLog();
+		char* text{ ReadTestLog() };
+		if (!RE_CHECK(t, text != nullptr))
+			return;
+
+		for (uint32 i{}; i < NUM_THREADS; ++i)
+		{
+			char pattern[32];
+			snprintf(pattern, sizeof(pattern), "<%u>\n", i);
+			RE_CHECK(t, CountOccurrences(text, pattern) == 1);
+		}
+
+		free(text);
+		remove(TEST_LOG_PATH);
+	}
+
+	//A thread that logged before ShutdownLog must not keep writing to the slot the next session hands to someone else
+	internal void TestLogReinit(Test& t)
+	{
+		if (!RE_CHECK(t, StartTestLog()))
+			return;
+
+		std::atomic<uint32> step{};
+		std::thread worker{ [&step]()
+		{
+			RE_LOG_WARNING("worker before");
+			step.store(1, std::memory_order_release);
+			while (step.load(std::memory_order_acquire) != 2)
+				std::this_thread::yield();
+
+			RE_LOG_WARNING("worker after");
+		} };
+
+		while (step.load(std::memory_order_acquire) != 1)
+			std::this_thread::yield();
+
+		ShutdownLog();
+		RE_CHECK(t, StartTestLog());
+
+		//takes the first free slot, the one the worker had last session, and keeps it while the worker logs again
+		std::thread other{ [&step]()
+		{
+			RE_LOG_WARNING("other thread");
+			step.store(2, std::memory_order_release);
+			while (step.load(std::memory_order_acquire) != 3)
+				std::this_thread::yield();
+		} };
+
+		while (step.load(std::memory_order_acquire) != 2)
+			std::this_thread::yield();
+
+		RE_LOG_WARNING("main thread");
+		worker.join();
+		step.store(3, std::memory_order_release);
+		other.join();
+
+		ShutdownLog();
+		char* text{ ReadTestLog() };
+		if (!RE_CHECK(t, text != nullptr))
+			return;
+
+		RE_CHECK(t, !strstr(text, "worker before"));
+		const int32 workerThread{ LogLineThread(text, "worker after") };
+		const int32 otherThread{ LogLineThread(text, "other thread") };
+		const int32 mainThread{ LogLineThread(text, "main thread") };
+		RE_CHECK(t, workerThread >= 0 && otherThread >= 0 && mainThread >= 0);
+		RE_CHECK(t, workerThread != otherThread && workerThread != mainThread && otherThread != mainThread);
+
+		free(text);
+		remove(TEST_LOG_PATH);
+	}
+
+	//More string bytes than half a ring: the strings are cut and the message still arrives
+	internal void TestLogOversizeRecord(Test& t)
+	{
+		if (!RE_CHECK(t, StartTestLog()))
+			return;
+
+		char* big{ static_cast<char*>(malloc(LOG_MAX_STRING_LENGTH + 1)) };
+		memset(big, 'x', LOG_MAX_STRING_LENGTH);
+		big[LOG_MAX_STRING_LENGTH] = '\0';
+		RE_LOG_WARNING("oversize {}{}{}{}{}{}{}{}{}{}{}{}", big, big, big, big, big, big, big, big, big, big, big, big);
+		RE_LOG_WARNING("after oversize");
+		free(big);
+
+		ShutdownLog();
+		char* text{ ReadTestLog() };
+		if (!RE_CHECK(t, text != nullptr))
+			return;
+
+		RE_CHECK(t, strstr(text, "oversize xxxx") != nullptr);
+		RE_CHECK(t, strstr(text, "after oversize") != nullptr);
+
+		free(text);
+		remove(TEST_LOG_PATH);
+	}
+
+	internal constexpr TestEntry LOG_ENTRIES[]
+	{
+		{ "log/slots_recycled",		TestLogSlotsRecycled },
+		{ "log/reinit",				TestLogReinit },
+		{ "log/oversize_record",	TestLogOversizeRecord },
+	};
+
+	const TestGroup LOG_TESTS{ LOG_ENTRIES, sizeof(LOG_ENTRIES) / sizeof(LOG_ENTRIES[0]) };
+
+}
@@ -0,0 +1,142 @@
+//  Filename: testMath 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:15:37		
+//  Sqwack-Studios													
+
+#include <cfloat>
+#include <cmath>
+
+#include "test.h"
+#include "RadiantEngine/math/vectorAlgebra.h"
+
+//The SIMD backend of floatN / vectorAlgebra against RE::scalar. Horizontal sums add lanes in the scalar order, so
+//without FMA both paths must give the same bits. With FMA (AVX2) a product is no longer rounded before the add and
+//results may differ by a few ulps of the summed magnitudes, never more.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_MATH_CASES{ 100000 };
+	internal constexpr fp64 SUM_TOLERANCE{ RE_SIMD_FMA ? 4.0 * FLT_EPSILON : 0.0 };
+
+	//deterministic values in [-1, 1) scaled by 2^-10 .. 2^10, so sums cancel and magnitudes differ
+	internal fp32 NextMathValue(uint32& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		const fp32 unit{ static_cast<fp32>(state >> 8) * (2.f / 16777216.f) - 1.f };
+		return ldexpf(unit, static_cast<int>(state % 21) - 10);
+	}
+
+	internal float3 NextFloat3(uint32& state) { return { NextMathValue(state), NextMathValue(state), NextMathValue(state) }; }
+	internal float4 NextFloat4(uint32& state) { return { NextMathValue(state), NextMathValue(state), NextMathValue(state), NextMathValue(state) }; }
+
+	internal fp64 AbsDot(const float3 a, const float3 b) { return fabs(a.x * b.x) + fabs(a.y * b.y) + fabs(a.z * b.z); }
+	internal fp64 AbsDot(const float4 a, const float4 b) { return fabs(a.x * b.x) + fabs(a.y * b.y) + fabs(a.z * b.z) + fabs(a.w * b.w); }
+
+	internal void TestDot(Test& t)
+	{
+		uint32 state{ 0x2545F491 };
+		for (uint32 i{}; i < NUM_MATH_CASES && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			const float3 a3{ NextFloat3(state) };
+			const float3 b3{ NextFloat3(state) };
+			const float4 a4{ NextFloat4(state) };
+			const float4 b4{ NextFloat4(state) };
+
+			RE_CHECK_NEAR(t, dot(a3, b3), scalar::dot(a3, b3), SUM_TOLERANCE * AbsDot(a3, b3));
+			RE_CHECK_NEAR(t, dot(a4, b4), scalar::dot(a4, b4), SUM_TOLERANCE * AbsDot(a4, b4));
+			RE_CHECK_NEAR(t, lengthSq(a3), scalar::lengthSq(a3), SUM_TOLERANCE * AbsDot(a3, a3));
+			RE_CHECK_NEAR(t, lengthSq(a4), scalar::lengthSq(a4), SUM_TOLERANCE * AbsDot(a4, a4));
+			//sqrt halves the relative error of its input
+			RE_CHECK_NEAR(t, length(a3), scalar::length(a3), SUM_TOLERANCE * scalar::length(a3));
+			RE_CHECK_NEAR(t, length(a4), scalar::length(a4), SUM_TOLERANCE * scalar::length(a4));
+		}
+
+		//orthogonal and zero vectors sum to exactly 0 on both paths
+		RE_CHECK(t, dot(float4{ 1.f, 0.f, 0.f, 0.f }, float4{ 0.f, 1.f, 0.f, 0.f }) == 0.f);
+		RE_CHECK(t, length(float4{ 0.f, 0.f, 0.f, 0.f }) == 0.f);
+		RE_CHECK(t, dot(float4{ 1.f, 2.f, 3.f, 4.f }, float4{ 5.f, 6.f, 7.f, 8.f }) == 70.f);
+	}
+
+	internal void TestCross(Test& t)
+	{
+		uint32 state{ 0x9E3779B9 };
+		for (uint32 i{}; i < NUM_MATH_CASES && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			const float3 a{ NextFloat3(state) };
+			const float3 b{ NextFloat3(state) };
+			const float3 c{ cross(a, b) };
+			const float3 r{ scalar::cross(a, b) };
+
+			RE_CHECK_NEAR(t, c.x, r.x, SUM_TOLERANCE * (fabs(a.y * b.z) + fabs(a.z * b.y)));
+			RE_CHECK_NEAR(t, c.y, r.y, SUM_TOLERANCE * (fabs(a.z * b.x) + fabs(a.x * b.z)));
+			RE_CHECK_NEAR(t, c.z, r.z, SUM_TOLERANCE * (fabs(a.x * b.y) + fabs(a.y * b.x)));
+		}
+	}
+
+	internal void TestNormalize(Test& t)
+	{
+		//RE::scalar multiplies by 1 / length, the SIMD path divides: 2 ulps of a unit vector on top of the sum
+		constexpr fp64 TOLERANCE{ 2.0 * FLT_EPSILON };
+
+		uint32 state{ 0x85EBCA6B };
+		for (uint32 i{}; i < NUM_MATH_CASES && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			const float3 a3{ NextFloat3(state) };
+			const float4 a4{ NextFloat4(state) };
+			const float3 n3{ normalize(a3) };
+			const float3 r3{ scalar::normalize(a3) };
+			const float4 n4{ normalize(a4) };
+			const float4 r4{ scalar::normalize(a4) };
+
+			RE_CHECK_NEAR(t, n3.x, r3.x, TOLERANCE + SUM_TOLERANCE);
+			RE_CHECK_NEAR(t, n3.y, r3.y, TOLERANCE + SUM_TOLERANCE);
+			RE_CHECK_NEAR(t, n3.z, r3.z, TOLERANCE + SUM_TOLERANCE);
+			RE_CHECK_NEAR(t, n4.x, r4.x, TOLERANCE + SUM_TOLERANCE);
+			RE_CHECK_NEAR(t, n4.y, r4.y, TOLERANCE + SUM_TOLERANCE);
+			RE_CHECK_NEAR(t, n4.z, r4.z, TOLERANCE + SUM_TOLERANCE);
+			RE_CHECK_NEAR(t, n4.w, r4.w, TOLERANCE + SUM_TOLERANCE);
+		}
+	}
+
+	//Per lane operations are single IEEE operations on both paths, always the same bits
+	internal void TestFloat4Operators(Test& t)
+	{
+		uint32 state{ 0xC2B2AE35 };
+		for (uint32 i{}; i < NUM_MATH_CASES && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			const float4 a{ NextFloat4(state) };
+			const float4 b{ NextFloat4(state) };
+			const fp32 s{ NextMathValue(state) };
+
+			const float4 sum{ a + b };
+			const float4 difference{ a - b };
+			const float4 product{ a * b };
+			const float4 quotient{ a / b };
+			const float4 scaled{ a * s };
+			const float4 negated{ -a };
+
+			RE_CHECK(t, sum.x == a.x + b.x && sum.y == a.y + b.y && sum.z == a.z + b.z && sum.w == a.w + b.w);
+			RE_CHECK(t, difference.x == a.x - b.x && difference.y == a.y - b.y && difference.z == a.z - b.z && difference.w == a.w - b.w);
+			RE_CHECK(t, product.x == a.x * b.x && product.y == a.y * b.y && product.z == a.z * b.z && product.w == a.w * b.w);
+			RE_CHECK(t, quotient.x == a.x / b.x && quotient.y == a.y / b.y && quotient.z == a.z / b.z && quotient.w == a.w / b.w);
+			RE_CHECK(t, scaled.x == a.x * s && scaled.y == a.y * s && scaled.z == a.z * s && scaled.w == a.w * s);
+			RE_CHECK(t, negated.x == -a.x && negated.y == -a.y && negated.z == -a.z && negated.w == -a.w);
+		}
+
+		//negation flips the sign of zero too
+		RE_CHECK(t, std::signbit((-float4{ 0.f, 0.f, 0.f, 0.f }).x));
+	}
+
+	internal constexpr TestEntry MATH_ENTRIES[]
+	{
+		{ "math/dot_length",		TestDot },
+		{ "math/cross",				TestCross },
+		{ "math/normalize",			TestNormalize },
+		{ "math/float4_operators",	TestFloat4Operators },
+	};
+
+	const TestGroup MATH_TESTS{ MATH_ENTRIES, sizeof(MATH_ENTRIES) / sizeof(MATH_ENTRIES[0]) };
+
+}
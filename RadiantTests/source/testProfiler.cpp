@@ -0,0 +1,217 @@
+//  Filename: testProfiler 
+//	Author:	Daniel														
+//	Date: 19/10/2026 10:04:51		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "test.h"
+#include "RadiantEngine/core/profiler.h"
+#include "RadiantEngine/core/clock.h"
+
+//The profiler through its binary capture: scopes come back with their names and depths, and a thread that recorded
+//before a ShutdownProfiler/InitProfiler pair doesn't keep writing to the slot the next session hands to someone else.
+//ProfileBegin/ProfileEnd are called directly so the tests run whatever RE_ENABLE_PROFILER is.
+namespace RE
+{
+
+	internal constexpr char TEST_PROFILE_PATH[]{ "radiant_tests_profile.bin" };
+	//ticks convert to ns within microseconds, a window that tight could cut the scopes it is meant to hold
+	internal constexpr int64 TEST_PROFILE_SLACK_NS{ 1000000000 };
+
+	//A capture read back: the name of every scope, and the thread it was recorded on
+	struct TestCapture
+	{
+		uint8* file;
+		const char* scopeNames[64];
+		uint32 scopeDepths[64];
+		uint32 scopeThreads[64];
+		uint32 numScopes;
+	};
+
+	//Reads TEST_PROFILE_PATH, false when it's malformed. Free capture.file afterwards
+	internal bool ReadTestCapture(TestCapture& capture)
+	{
+		capture = {};
+		FILE* f{ fopen(TEST_PROFILE_PATH, "rb") };
+		if (!f)
+			return false;
+
+		fseek(f, 0, SEEK_END);
+		const long size{ ftell(f) };
+		fseek(f, 0, SEEK_SET);
+		capture.file = static_cast<uint8*>(malloc(size + 1));
+		const size_t read{ capture.file ? fread(capture.file, 1, size, f) : 0 };
+		fclose(f);
+		if (read != static_cast<size_t>(size) || read < sizeof(ProfileFileHeader))
+			return false;
+
+		ProfileFileHeader header;
+		memcpy(&header, capture.file, sizeof(header));
+		if (header.magic != PROFILE_FILE_MAGIC || header.version != PROFILE_FILE_VERSION)
+			return false;
+
+		//each name moves down over its length prefix, which leaves room for a '\0' in place
+		const char* names[256];
+		size_t at{ sizeof(header) };
+		for (uint32 i{}; i < header.numNames && i < 256; ++i)
+		{
+			uint16 length;
+			if (at + sizeof(length) > read)
+				return false;
+			memcpy(&length, capture.file + at, sizeof(length));
+			if (at + sizeof(length) + length > read)
+				return false;
+
+			char* name{ reinterpret_cast<char*>(capture.file + at) };
+			memmove(name, name + sizeof(length), length);
+			name[length] = '\0';
+			names[i] = name;
+			at += sizeof(length) + length;
+		}
+
+		for (uint32 t{}; t < header.numThreads; ++t)
+		{
+			ProfileFileThread thread;
+			if (at + sizeof(thread) > read)
+				return false;
+			memcpy(&thread, capture.file + at, sizeof(thread));
+			at += sizeof(thread);
+
+			for (uint32 i{}; i < thread.numScopes; ++i)
+			{
+				ProfileFileScope scope;
+				if (at + sizeof(scope) > read)
+					return false;
+				memcpy(&scope, capture.file + at, sizeof(scope));
+				at += sizeof(scope);
+				if (scope.nameIndex >= header.numNames || scope.nameIndex >= 256)
+					return false;
+
+				if (capture.numScopes < 64)
+				{
+					capture.scopeNames[capture.numScopes] = names[scope.nameIndex];
+					capture.scopeDepths[capture.numScopes] = scope.depth;
+					capture.scopeThreads[capture.numScopes++] = t;
+				}
+			}
+		}
+		return at == read;
+	}
+
+	//Index of the scope called name, numScopes when there is none
+	internal uint32 FindTestScope(const TestCapture& capture, const char* name)
+	{
+		uint32 i{};
+		while (i < capture.numScopes && strcmp(capture.scopeNames[i], name) != 0)
+			++i;
+		return i;
+	}
+
+	internal void TestProfilerScopes(Test& t)
+	{
+		InitProfiler();
+		const int64 fromNs{ GetTimeNs() };
+		ProfileBegin("outer");
+		ProfileBegin("inner");
+		ProfileEnd();
+		ProfileBegin("second inner");
+		ProfileEnd();
+		ProfileEnd();
+		//still open at capture time, dropped
+		ProfileBegin("open");
+
+		RE_CHECK(t, WriteProfileBinary(TEST_PROFILE_PATH, fromNs - TEST_PROFILE_SLACK_NS, GetTimeNs() + TEST_PROFILE_SLACK_NS));
+		ProfileEnd();
+		ShutdownProfiler();
+
+		TestCapture capture;
+		if (RE_CHECK(t, ReadTestCapture(capture)))
+		{
+			const uint32 outer{ FindTestScope(capture, "outer") };
+			const uint32 inner{ FindTestScope(capture, "inner") };
+			const uint32 second{ FindTestScope(capture, "second inner") };
+			RE_CHECK(t, outer < capture.numScopes && inner < capture.numScopes && second < capture.numScopes);
+			RE_CHECK(t, FindTestScope(capture, "open") == capture.numScopes);
+			if (outer < capture.numScopes && inner < capture.numScopes && second < capture.numScopes)
+			{
+				RE_CHECK(t, capture.scopeDepths[outer] == 0 && capture.scopeDepths[inner] == 1 && capture.scopeDepths[second] == 1);
+				//sorted by start time within a thread
+				RE_CHECK(t, outer < inner && inner < second);
+			}
+		}
+
+		free(capture.file);
+		remove(TEST_PROFILE_PATH);
+	}
+
+	//A thread that recorded before ShutdownProfiler must get a new slot, not write into the one another thread now owns
+	internal void TestProfilerReinit(Test& t)
+	{
+		InitProfiler();
+
+		std::atomic<uint32> step{};
+		std::thread workerThread{ [&step]()
+		{
+			ProfileBegin("worker before");
+			ProfileEnd();
+			step.store(1, std::memory_order_release);
+			while (step.load(std::memory_order_acquire) != 2)
+				std::this_thread::yield();
+
+			ProfileBegin("worker after");
+			ProfileEnd();
+			step.store(3, std::memory_order_release);
+		} };
+
+		while (step.load(std::memory_order_acquire) != 1)
+			std::this_thread::yield();
+
+		ShutdownProfiler();
+		InitProfiler();
+		const int64 fromNs{ GetTimeNs() };
+
+		//registers first this session, the slot the worker had last session
+		std::thread otherThread{ [&step]()
+		{
+			ProfileBegin("other thread");
+			ProfileEnd();
+			step.store(2, std::memory_order_release);
+			while (step.load(std::memory_order_acquire) != 3)
+				std::this_thread::yield();
+		} };
+
+		workerThread.join();
+		otherThread.join();
+
+		RE_CHECK(t, WriteProfileBinary(TEST_PROFILE_PATH, fromNs - TEST_PROFILE_SLACK_NS, GetTimeNs() + TEST_PROFILE_SLACK_NS));
+		ShutdownProfiler();
+
+		TestCapture capture;
+		if (RE_CHECK(t, ReadTestCapture(capture)))
+		{
+			const uint32 worker{ FindTestScope(capture, "worker after") };
+			const uint32 other{ FindTestScope(capture, "other thread") };
+			RE_CHECK(t, FindTestScope(capture, "worker before") == capture.numScopes);
+			RE_CHECK(t, worker < capture.numScopes && other < capture.numScopes);
+			if (worker < capture.numScopes && other < capture.numScopes)
+				RE_CHECK(t, capture.scopeThreads[worker] != capture.scopeThreads[other]);
+		}
+
+		free(capture.file);
+		remove(TEST_PROFILE_PATH);
+	}
+
+	internal constexpr TestEntry PROFILER_ENTRIES[]
+	{
+		{ "profiler/scopes",		TestProfilerScopes },
+		{ "profiler/reinit",		TestProfilerReinit },
+	};
+
+	const TestGroup PROFILER_TESTS{ PROFILER_ENTRIES, sizeof(PROFILER_ENTRIES) / sizeof(PROFILER_ENTRIES[0]) };
+
+}
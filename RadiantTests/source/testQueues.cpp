@@ -0,0 +1,206 @@
+//  Filename: testQueues 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:44:10		
+//  Sqwack-Studios													
+
+#include <atomic>
+#include <thread>
+
+#include "test.h"
+#include "RadiantEngine/core/spscQueue.h"
+#include "RadiantEngine/core/mpmcQueue.h"
+
+//SpscQueue and MpmcQueue under real threads. Messages are (producer << 32) | sequence, so a consumer can check that
+//every producer's messages reach it in the order they were pushed. A flag per message catches loss and duplicates.
+//Queues are kept small so the full and empty paths run all the time.
+//
+//Threads only count errors, the checks run on the test thread after they are joined.
+namespace RE
+{
+
+	internal constexpr uint32 NUM_QUEUE_MESSAGES{ 1 << 17 };
+	internal constexpr size_t TEST_QUEUE_CAPACITY{ 64 };
+	internal constexpr uint32 TEST_BATCH_SIZE{ 7 };
+	internal constexpr uint32 NUM_MPMC_PRODUCERS{ 3 };
+	internal constexpr uint32 NUM_MPMC_CONSUMERS{ 3 };
+
+	struct QueueCheck
+	{
+		std::atomic<uint8>* seen;		//one per message of every producer
+		std::atomic<uint32> outOfOrder;
+		std::atomic<uint32> duplicates;
+		std::atomic<uint32> unknown;
+	};
+
+	internal RE_INLINE uint64 MakeMessage(const uint32 producer, const uint32 sequence) { return static_cast<uint64>(producer) << 32 | sequence; }
+
+	//last holds the next sequence this consumer may see from each producer
+	internal void ReceiveMessage(QueueCheck& check, uint32* last, const uint32 numProducers, const uint64 message)
+	{
+		const uint32 producer{ static_cast<uint32>(message >> 32) };
+		const uint32 sequence{ static_cast<uint32>(message) };
+		if (producer >= numProducers || sequence >= NUM_QUEUE_MESSAGES)
+		{
+			check.unknown.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		if (sequence < last[producer])
+			check.outOfOrder.fetch_add(1, std::memory_order_relaxed);
+		last[producer] = sequence + 1;
+
+		if (check.seen[producer * NUM_QUEUE_MESSAGES + sequence].exchange(1, std::memory_order_relaxed))
+			check.duplicates.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	internal void CheckQueueRun(Test& t, QueueCheck& check, const uint32 numProducers)
+	{
+		uint32 missing{};
+		for (uint32 i{}; i < numProducers * NUM_QUEUE_MESSAGES; ++i)
+			missing += check.seen[i].load(std::memory_order_relaxed) == 0;
+
+		RE_CHECK(t, missing == 0);
+		RE_CHECK(t, check.duplicates.load() == 0);
+		RE_CHECK(t, check.outOfOrder.load() == 0);
+		RE_CHECK(t, check.unknown.load() == 0);
+	}
+
+	internal void RunSpsc(Test& t, const bool batched)
+	{
+		SpscQueue<uint64> q{};
+		if (!RE_CHECK(t, q.init(TEST_QUEUE_CAPACITY)))
+			return;
+
+		QueueCheck check{ .seen = new std::atomic<uint8>[NUM_QUEUE_MESSAGES]{}, .outOfOrder = 0, .duplicates = 0, .unknown = 0 };
+
+		std::thread producer{ [&q, batched]()
+		{
+			uint64 batch[TEST_BATCH_SIZE];
+			for (uint32 i{}; i < NUM_QUEUE_MESSAGES; )
+			{
+				if (batched)
+				{
+					uint32 num{};
+					for (; num < TEST_BATCH_SIZE && i + num < NUM_QUEUE_MESSAGES; ++num)
+						batch[num] = MakeMessage(0, i + num);
+
+					//a partial push leaves the rest for the next round, in order
+					const uint32 pushed{ static_cast<uint32>(q.pushBatch(batch, num)) };
+					i += pushed;
+					if (pushed == 0)
+						std::this_thread::yield();
+				}
+				else if (q.push(MakeMessage(0, i)))
+					++i;
+				else
+					std::this_thread::yield();
+			}
+		} };
+
+		uint32 last[1]{};
+		uint64 batch[TEST_BATCH_SIZE];
+		for (uint32 received{}; received < NUM_QUEUE_MESSAGES; )
+		{
+			const size_t num{ batched ? q.popBatch(batch, TEST_BATCH_SIZE) : q.pop(batch[0]) };
+			for (size_t i{}; i < num; ++i)
+				ReceiveMessage(check, last, 1, batch[i]);
+
+			received += static_cast<uint32>(num);
+			if (num == 0)
+				std::this_thread::yield();
+		}
+
+		producer.join();
+
+		uint64 extra;
+		RE_CHECK(t, !q.pop(extra));
+		CheckQueueRun(t, check, 1);
+
+		delete[] check.seen;
+		q.release();
+	}
+
+	//Every consumer must see each producer's messages in increasing order, whichever subset of them it gets
+	internal void RunMpmc(Test& t, const bool batched)
+	{
+		MpmcQueue<uint64> q{};
+		if (!RE_CHECK(t, q.init(TEST_QUEUE_CAPACITY)))
+			return;
+
+		QueueCheck check{ .seen = new std::atomic<uint8>[NUM_MPMC_PRODUCERS * NUM_QUEUE_MESSAGES]{}, .outOfOrder = 0, .duplicates = 0, .unknown = 0 };
+		std::atomic<uint32> received{};
+		std::thread threads[NUM_MPMC_PRODUCERS + NUM_MPMC_CONSUMERS];
+
+		for (uint32 p{}; p < NUM_MPMC_PRODUCERS; ++p)
+		{
+			threads[p] = std::thread{ [&q, p, batched]()
+			{
+				uint64 batch[TEST_BATCH_SIZE];
+				for (uint32 i{}; i < NUM_QUEUE_MESSAGES; )
+				{
+					uint32 pushed{};
+					if (batched)
+					{
+						uint32 num{};
+						for (; num < TEST_BATCH_SIZE && i + num < NUM_QUEUE_MESSAGES; ++num)
+							batch[num] = MakeMessage(p, i + num);
+
+						pushed = static_cast<uint32>(q.pushBatch(batch, num));
+					}
+					else
+						pushed = q.push(MakeMessage(p, i));
+
+					i += pushed;
+					if (pushed == 0)
+						std::this_thread::yield();
+				}
+			} };
+		}
+
+		for (uint32 c{}; c < NUM_MPMC_CONSUMERS; ++c)
+		{
+			threads[NUM_MPMC_PRODUCERS + c] = std::thread{ [&q, &check, &received, batched]()
+			{
+				uint32 last[NUM_MPMC_PRODUCERS]{};
+				uint64 batch[TEST_BATCH_SIZE];
+				while (received.load(std::memory_order_relaxed) < NUM_MPMC_PRODUCERS * NUM_QUEUE_MESSAGES)
+				{
+					const size_t num{ batched ? q.popBatch(batch, TEST_BATCH_SIZE) : q.pop(batch[0]) };
+					for (size_t i{}; i < num; ++i)
+						ReceiveMessage(check, last, NUM_MPMC_PRODUCERS, batch[i]);
+
+					received.fetch_add(static_cast<uint32>(num), std::memory_order_relaxed);
+					if (num == 0)
+						std::this_thread::yield();
+				}
+			} };
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+
+		uint64 extra;
+		RE_CHECK(t, !q.pop(extra));
+		RE_CHECK(t, received.load() == NUM_MPMC_PRODUCERS * NUM_QUEUE_MESSAGES);
+		CheckQueueRun(t, check, NUM_MPMC_PRODUCERS);
+
+		delete[] check.seen;
+		q.release();
+	}
+
+	internal void TestSpsc(Test& t) { RunSpsc(t, false); }
+	internal void TestSpscBatch(Test& t) { RunSpsc(t, true); }
+	internal void TestMpmc(Test& t) { RunMpmc(t, false); }
+	internal void TestMpmcBatch(Test& t) { RunMpmc(t, true); }
+
+	internal constexpr TestEntry QUEUE_ENTRIES[]
+	{
+		{ "queues/spsc",			TestSpsc },
+		{ "queues/spsc_batch",		TestSpscBatch },
+		{ "queues/mpmc",			TestMpmc },
+		{ "queues/mpmc_batch",		TestMpmcBatch },
+	};
+
+	const TestGroup QUEUE_TESTS{ QUEUE_ENTRIES, sizeof(QUEUE_ENTRIES) / sizeof(QUEUE_ENTRIES[0]) };
+
+}
@@ -0,0 +1,328 @@
+//  Filename: testScene 
+//	Author:	Daniel														
+//	Date: 19/10/2026 09:21:04		
+//  Sqwack-Studios													
+
+#include <cmath>
+#include <cstring>
+
+#include "test.h"
+#include "RadiantEngine/scene/transformHierarchy.h"
+#include "RadiantEngine/scene/bvh.h"
+
+//TransformHierarchy against a plain per id model that recomputes every world matrix from scratch. Both run the same
+//composeTRS / mul, so the matrices must match bit for bit.
+//BVH queries against brute force over every primitive, again with the same arithmetic. Packets compute in fp32x8, which
+//only matches the scalar path bit for bit without FMA.
+namespace RE
+{
+
+	internal constexpr uint32 HIERARCHY_CAPACITY{ 512 };
+	internal constexpr uint32 NUM_HIERARCHY_STEPS{ 400 };
+
+	struct ReferenceNode
+	{
+		TransformId parent;
+		float3 position;
+		quat rotation;
+		float3 scale;
+		bool live;
+		bool dirty;
+	};
+
+	internal uint32 NextSceneRandom(uint32& state)
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	internal fp32 NextSceneValue(uint32& state) { return static_cast<fp32>(NextSceneRandom(state) >> 8) * (2.f / 16777216.f) - 1.f; }
+
+	internal float3x4 ReferenceWorld(const ReferenceNode* nodes, const TransformId id)
+	{
+		const ReferenceNode& n{ nodes[id] };
+		const float3x4 local{ composeTRS(n.position, n.rotation, n.scale) };
+		return n.parent == INVALID_TRANSFORM ? local : mul(ReferenceWorld(nodes, n.parent), local);
+	}
+
+	internal bool ReferenceChanged(const ReferenceNode* nodes, const TransformId id)
+	{
+		for (TransformId a{ id }; a != INVALID_TRANSFORM; a = nodes[a].parent)
+		{
+			if (nodes[a].dirty)
+				return true;
+		}
+		return false;
+	}
+
+	internal TransformId RandomLiveId(const ReferenceNode* nodes, uint32& state)
+	{
+		const uint32 start{ NextSceneRandom(state) % HIERARCHY_CAPACITY };
+		for (uint32 i{}; i < HIERARCHY_CAPACITY; ++i)
+		{
+			const TransformId id{ (start + i) % HIERARCHY_CAPACITY };
+			if (nodes[id].live)
+				return id;
+		}
+		return INVALID_TRANSFORM;
+	}
+
+	internal void RemoveReferenceSubtree(ReferenceNode* nodes, const TransformId id)
+	{
+		nodes[id].live = false;
+		for (TransformId c{}; c < HIERARCHY_CAPACITY; ++c)
+		{
+			if (nodes[c].live && nodes[c].parent == id)
+				RemoveReferenceSubtree(nodes, c);
+		}
+	}
+
+	internal void TestTransformHierarchy(Test& t)
+	{
+		TransformHierarchy h;
+		if (!RE_CHECK(t, InitTransformHierarchy(h, HIERARCHY_CAPACITY)))
+			return;
+
+		persistent ReferenceNode nodes[HIERARCHY_CAPACITY];
+		memset(nodes, 0, sizeof(nodes));
+
+		uint32 state{ 0x27D4EB2F };
+		for (uint32 step{}; step < NUM_HIERARCHY_STEPS && t.failures < MAX_REPORTED_FAILURES; ++step)
+		{
+			//a burst of edits, mostly small so most of the tree stays clean
+			const uint32 numEdits{ NextSceneRandom(state) % 8 };
+			for (uint32 e{}; e < numEdits; ++e)
+			{
+				const uint32 op{ NextSceneRandom(state) % 16 };
+				const TransformId target{ RandomLiveId(nodes, state) };
+
+				if (op < 6 && h.num < HIERARCHY_CAPACITY)
+				{
+					const TransformId parent{ op < 1 ? INVALID_TRANSFORM : target };
+					const float3 position{ NextSceneValue(state), NextSceneValue(state), NextSceneValue(state) };
+					const quat rotation{ fromAxisAngle(float3{ 0.f, 1.f, 0.f }, NextSceneValue(state)) };
+					const float3 scale{ 1.f, 1.f, 1.f };
+
+					const TransformId id{ AddTransform(h, parent, position, rotation, scale) };
+					if (id == INVALID_TRANSFORM)
+						continue;
+
+					RE_CHECK(t, id < HIERARCHY_CAPACITY && !nodes[id].live);
+					nodes[id] = { .parent = parent, .position = position, .rotation = rotation, .scale = scale, .live = true, .dirty = true };
+				}
+				else if (op < 7 && target != INVALID_TRANSFORM)
+				{
+					RemoveTransform(h, target);
+					RemoveReferenceSubtree(nodes, target);
+				}
+				else if (target != INVALID_TRANSFORM)
+				{
+					const float3 position{ NextSceneValue(state), NextSceneValue(state), NextSceneValue(state) };
+					SetLocalPosition(h, target, position);
+					nodes[target].position = position;
+					nodes[target].dirty = true;
+				}
+			}
+
+			PropagateTransforms(h);
+
+			uint32 numLive{};
+			for (TransformId id{}; id < HIERARCHY_CAPACITY; ++id)
+			{
+				if (!nodes[id].live)
+					continue;
+
+				numLive++;
+				const float3x4 expected{ ReferenceWorld(nodes, id) };
+				RE_CHECK(t, memcmp(&WorldMatrix(h, id), &expected, sizeof(float3x4)) == 0);
+				RE_CHECK(t, HasWorldChanged(h, id) == ReferenceChanged(nodes, id));
+			}
+			RE_CHECK(t, numLive == h.num);
+
+			for (TransformId id{}; id < HIERARCHY_CAPACITY; ++id)
+				nodes[id].dirty = false;
+
+			//nothing dirty: the next propagation changes nothing
+			if (step % 32 == 0)
+			{
+				PropagateTransforms(h);
+				for (TransformId id{}; id < HIERARCHY_CAPACITY; ++id)
+				{
+					if (nodes[id].live)
+						RE_CHECK(t, !HasWorldChanged(h, id));
+				}
+			}
+		}
+
+		ShutdownTransformHierarchy(h);
+	}
+
+	internal constexpr uint32 NUM_BVH_TRIANGLES{ 3000 };
+	internal constexpr uint32 BVH_GRID{ 48 };
+	internal constexpr uint32 NUM_BVH_RAYS{ BVH_GRID * BVH_GRID * 2 };
+	internal constexpr fp64 PACKET_TOLERANCE{ RE_SIMD_FMA ? 1e-5 : 0.0 };
+
+	struct BVHScene
+	{
+		float3 vertices[NUM_BVH_TRIANGLES * 3];
+		uint32 indices[NUM_BVH_TRIANGLES * 3];
+		float3 boxMin[NUM_BVH_TRIANGLES];
+		float3 boxMax[NUM_BVH_TRIANGLES];
+		Ray rays[NUM_BVH_RAYS];
+		RayHit hits[NUM_BVH_RAYS];
+		RayHit packetHits[NUM_BVH_RAYS];
+	};
+
+	//Small triangles and boxes in [-1, 1]^3. Half the rays are a camera grid (coherent), half random (incoherent), some
+	//with a tMax that ends inside the scene
+	internal BVHScene& GetBVHScene()
+	{
+		persistent BVHScene s;
+		uint32 state{ 0x1F83D9AB };
+		for (uint32 i{}; i < NUM_BVH_TRIANGLES; ++i)
+		{
+			const float3 c{ NextSceneValue(state), NextSceneValue(state), NextSceneValue(state) };
+			for (uint32 v{}; v < 3; ++v)
+			{
+				s.vertices[i * 3 + v] = c + float3{ NextSceneValue(state), NextSceneValue(state), NextSceneValue(state) } * 0.1f;
+				s.indices[i * 3 + v] = i * 3 + v;
+			}
+			const float3 e{ std::fabs(NextSceneValue(state)) * 0.05f, std::fabs(NextSceneValue(state)) * 0.05f, std::fabs(NextSceneValue(state)) * 0.05f };
+			s.boxMin[i] = c - e;
+			s.boxMax[i] = c + e;
+		}
+
+		for (uint32 i{}; i < BVH_GRID * BVH_GRID; ++i)
+		{
+			const fp32 x{ (static_cast<fp32>(i % BVH_GRID) + 0.5f) / BVH_GRID * 2.f - 1.f };
+			const fp32 y{ (static_cast<fp32>(i / BVH_GRID) + 0.5f) / BVH_GRID * 2.f - 1.f };
+			s.rays[i] = { .origin = { 0.f, 0.f, -3.f }, .direction = { x * 0.4f, y * 0.4f, 1.f }, .tMax = i % 7 ? 1e30f : 3.f };
+		}
+		for (uint32 i{ BVH_GRID * BVH_GRID }; i < NUM_BVH_RAYS; ++i)
+		{
+			const float3 origin{ float3{ NextSceneValue(state), NextSceneValue(state), NextSceneValue(state) } * 2.f };
+			const float3 target{ NextSceneValue(state), NextSceneValue(state), NextSceneValue(state) };
+			s.rays[i] = { .origin = origin, .direction = target - origin, .tMax = i % 5 ? 1e30f : 0.5f };
+		}
+		return s;
+	}
+
+	//Same Moller-Trumbore and acceptance rule as bvh.cpp, over every triangle
+	internal RayHit BruteForceRaycast(const BVHScene& s, const Ray& ray)
+	{
+		RayHit hit{ ray.tMax, INVALID_PRIMITIVE, 0.f, 0.f };
+		for (uint32 p{}; p < NUM_BVH_TRIANGLES; ++p)
+		{
+			const float3 a{ s.vertices[p * 3] }, b{ s.vertices[p * 3 + 1] }, c{ s.vertices[p * 3 + 2] };
+			const float3 e1{ b - a }, e2{ c - a };
+			const float3 pv{ cross(ray.direction, e2) };
+			const fp32 det{ dot(e1, pv) };
+			if (std::fabs(det) < 1e-12f)
+				continue;
+
+			const fp32 invDet{ 1.f / det };
+			const float3 sv{ ray.origin - a };
+			const fp32 u{ dot(sv, pv) * invDet };
+			if (u < 0.f || u > 1.f)
+				continue;
+			const float3 q{ cross(sv, e1) };
+			const fp32 v{ dot(ray.direction, q) * invDet };
+			if (v < 0.f || u + v > 1.f)
+				continue;
+			const fp32 t{ dot(e2, q) * invDet };
+			if (t >= 0.f && t <= hit.t && (t < hit.t || hit.prim == INVALID_PRIMITIVE))
+				hit = { t, p, u, v };
+		}
+		return hit;
+	}
+
+	internal void CheckPacketHits(Test& t, const RayHit* hits, const RayHit* packetHits)
+	{
+		for (uint32 i{}; i < NUM_BVH_RAYS && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			RE_CHECK(t, (packetHits[i].prim == INVALID_PRIMITIVE) == (hits[i].prim == INVALID_PRIMITIVE));
+			RE_CHECK_NEAR(t, packetHits[i].t, hits[i].t, PACKET_TOLERANCE * hits[i].t);
+		}
+	}
+
+	internal void TestBVHRaycast(Test& t)
+	{
+		BVHScene& s{ GetBVHScene() };
+
+		//BuildBVH runs the subtrees through the job system here, the reference build is a single task
+		BVH bvh, serial;
+		if (!RE_CHECK(t, InitBVH(bvh, s.vertices, s.indices, NUM_BVH_TRIANGLES)) || !RE_CHECK(t, InitBVH(serial, s.vertices, s.indices, NUM_BVH_TRIANGLES)))
+			return;
+
+		BuildBVH(bvh);
+		const uint32 numTasks{ BeginBVHBuild(serial, 1) };
+		for (uint32 i{}; i < numTasks; ++i)
+			BuildBVHTask(serial, i);
+		EndBVHBuild(serial);
+		RE_CHECK(t, bvh.numNodes == serial.numNodes);
+
+		const BVH* builds[]{ &bvh, &serial };
+		for (const BVH* b : builds)
+		{
+			RaycastBVH(*b, s.rays, s.hits, NUM_BVH_RAYS);
+			for (uint32 i{}; i < NUM_BVH_RAYS && t.failures < MAX_REPORTED_FAILURES; ++i)
+			{
+				const RayHit expected{ BruteForceRaycast(s, s.rays[i]) };
+				RE_CHECK(t, s.hits[i].prim == expected.prim || s.hits[i].t == expected.t);
+				RE_CHECK(t, s.hits[i].t == expected.t);
+			}
+		}
+
+		uint32 numHits{};
+		for (uint32 i{}; i < NUM_BVH_RAYS; ++i)
+			numHits += s.hits[i].prim != INVALID_PRIMITIVE;
+		RE_CHECK(t, numHits > NUM_BVH_RAYS / 4 && numHits < NUM_BVH_RAYS);
+
+		RaycastBVHPackets(bvh, s.rays, s.packetHits, NUM_BVH_RAYS);
+		CheckPacketHits(t, s.hits, s.packetHits);
+
+		//a batch that doesn't fill the last packet
+		RaycastBVHPackets(bvh, s.rays, s.packetHits, 13);
+		CheckPacketHits(t, s.hits, s.packetHits);
+
+		ShutdownBVH(bvh);
+		ShutdownBVH(serial);
+	}
+
+	internal void TestBVHBoxPackets(Test& t)
+	{
+		BVHScene& s{ GetBVHScene() };
+
+		BVH bvh;
+		if (!RE_CHECK(t, InitBVH(bvh, s.boxMin, s.boxMax, NUM_BVH_TRIANGLES)))
+			return;
+
+		BuildBVH(bvh);
+		RaycastBVH(bvh, s.rays, s.hits, NUM_BVH_RAYS);
+		RaycastBVHPackets(bvh, s.rays, s.packetHits, NUM_BVH_RAYS);
+
+		//slab tests are the same operations on both paths, only min/max reductions are reordered
+		uint32 numHits{};
+		for (uint32 i{}; i < NUM_BVH_RAYS && t.failures < MAX_REPORTED_FAILURES; ++i)
+		{
+			numHits += s.hits[i].prim != INVALID_PRIMITIVE;
+			RE_CHECK(t, s.packetHits[i].t == s.hits[i].t);
+			RE_CHECK(t, s.packetHits[i].prim == s.hits[i].prim || s.packetHits[i].t == s.hits[i].t);
+		}
+		RE_CHECK(t, numHits > 0);
+
+		ShutdownBVH(bvh);
+	}
+
+	internal constexpr TestEntry SCENE_ENTRIES[]
+	{
+		{ "scene/transform_hierarchy",	TestTransformHierarchy },
+		{ "scene/bvh_raycast",			TestBVHRaycast },
+		{ "scene/bvh_box_packets",		TestBVHBoxPackets },
+	};
+
+	const TestGroup SCENE_TESTS{ SCENE_ENTRIES, sizeof(SCENE_ENTRIES) / sizeof(SCENE_ENTRIES[0]) };
+
+}
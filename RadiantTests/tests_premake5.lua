@@ -0,0 +1,63 @@
+project "RadiantTests"
+
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+
+	targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+	debugdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+	objdir("%{wks.location}/bin-int/" .. outputdir .. "/%{prj.name}")
+
+	warnings "High"
+
+	links
+	{
+		"RadiantEngine",
+	}
+
+	includedirs
+	{
+		"source",
+		"../RadiantEngine/include",
+	}
+
+	files
+	{
+		"source/**.cpp",
+		"source/**.h",
+	}
+
+	defines{"NOMINMAX"}
+
+	--must match RadiantEngine, the headers pick their SIMD backend from these
+	vectorextensions "SSE4.2"
+	defines{"RE_ENABLE_SSE42"}
+
+	filter "system:windows"
+		systemversion "latest"
+		staticruntime "on"
+		flags {"MultiProcessorCompile"}
+
+	filter "system:linux"
+		links {"pthread", "dl"}
+
+
+	filter "configurations:Debug"
+			defines "RE_DEBUG"
+			symbols "on"
+			optimize "off"
+			linktimeoptimization "off"
+
+
+	filter "configurations:Release"
+			defines "RE_RELEASE"
+			symbols "on"
+			optimize "on"
+			linktimeoptimization "on"
+
+
+	filter "configurations:Shipping"
+			defines "RE_SHIPPING"
+			symbols "off"
+			optimize "full"
+			linktimeoptimization "on"
@@ -11,17 +11,12 @@ project "ShaderCompiler"
 	warnings "High"
 
 
-    links
-    {
-        "quill",
-    }
-
     includedirs
     {
         "include",
         "source",
         "../vendor/dxc/include",
-        "../vendor/quill/include"
+        "../RadiantEngine/include"
     }
 
     files
@@ -43,12 +38,14 @@ project "ShaderCompiler"
 
 
 	filter "configurations:Debug"
+			defines "RE_DEBUG"
 			symbols "on"
 			optimize "off"
 			linktimeoptimization "off"
 			
 
 	filter "configurations:Release"
+			defines "RE_RELEASE"
 			symbols "on"
 			optimize "on"
 			linktimeoptimization "on"
@@ -56,6 +53,7 @@ project "ShaderCompiler"
 			
 
 	filter "configurations:Shipping"
+			defines "RE_SHIPPING"
 			symbols "off"
 			optimize "full"
 			linktimeoptimization "on"
\ No newline at end of file
@@ -8,20 +8,32 @@
 
 #include <wrl/client.h>
 #include "dxc/dxcapi.h"
-#include <ShlObj_core.h>
 
 #undef WIN32_LEAN_AND_MEAN
 #undef NOMINMAX
 
 #include <cstdint>
-#include <fstream>
 #include <string_view>
 #include <iostream>
 
-#include "quill/Frontend.h"
-#include "quill/Backend.h"
-#include "quill/LogMacros.h"
-#include "quill/sinks/ConsoleSink.h"
+#include "RadiantEngine/core/arena.h"
+#include "RadiantEngine/core/fixedArray.h"
+#include "RadiantEngine/core/stringView.h"
+#include "RadiantEngine/core/clock.h"
+#include "RadiantEngine/core/profiler.h"
+#include "RadiantEngine/core/log.h"
+#include "RadiantEngine/platform/file.h"
+#include "RadiantEngine/platform/library.h"
+//the tool doesn't link RadiantEngine
+#include "../../RadiantEngine/source/core/arena.cpp"
+#include "../../RadiantEngine/source/core/memoryTracker.cpp"
+#include "../../RadiantEngine/source/core/clock.cpp"
+#include "../../RadiantEngine/source/core/profiler.cpp"
+#include "../../RadiantEngine/source/core/log.cpp"
+#include "../../RadiantEngine/source/platform/virtualMemory.cpp"
+#include "../../RadiantEngine/source/platform/thread.cpp"
+#include "../../RadiantEngine/source/platform/file.cpp"
+#include "../../RadiantEngine/source/platform/library.cpp"
 
 using namespace Microsoft::WRL;
 
@@ -29,31 +41,10 @@ using namespace Microsoft::WRL;
 #define persistent static //use this when declaring a variable with persistent memory locally in a function 
 #define internal static //use this when declaring a function to be internally linked to the scope of the translation unit
 
-template<typename T>
-struct Span
-{
-	T* data;
-	size_t num;
-};
-
-
-//only for POD types
-//no bounds checking anywhere
-template<typename T, int32_t N>
-struct StackArray
-{
-	T data[N];
-	size_t num;
-
-	void add(T item)
-	{
-		data[num] = item;
-		num++;
-	}
-
-	T& operator[](size_t i) { return data[i]; }
-	const T& operator[](size_t i) const { return data[i]; }
-};
+using RE::Span;
+using RE::FixedArray;
+using RE::String;
+using RE::WString;
 
 
 enum eShaderType : std::uint8_t {
@@ -117,28 +108,6 @@ internal T* find_last(T* first, T* last, T cmp)
 }
 
 
-template<typename T>
-struct str
-{
-	T* data;
-	size_t num;
-	size_t cap;
-
-	operator Span<T>()
-	{
-		return Span<T>{.data = data, .num = num };
-	}
-
-	template<typename T>
-	operator Span<const T>()
-	{
-		return Span<const T>{.data = data, .num = num }; 
-	}
-};
-
-using String = str<char>;
-using WString = str<wchar_t>;
-
 internal void string_to_wide(WString& dst, Span<const char> src)
 {
 	size_t convertedChars; //do something with this I guess?
@@ -185,14 +154,14 @@ static constexpr std::int32_t NUM_SHADER_ENTRIES{ sizeof(entries) / sizeof(shade
 
 #ifdef PROJECT_COMPILE
 
-	static constexpr const wchar_t* DX_LIB_PATH{ L"../../../vendor/dxc/bin/dxcompiler.dll" };
+	static constexpr const char* DX_LIB_PATH{ "../../../vendor/dxc/bin/dxcompiler.dll" };
 	static constexpr const wchar_t SHADERS_FOLDER_PATHW[]{ L"../../../assets/shaders" };
 	static constexpr const char SHADERS_FOLDER_PATH[]{ "../../../assets/shaders" };
 
 
 #else
 
-	static constexpr const wchar_t* DX_LIB_PATH{ L"vendor/dxc/bin/dxcompiler.dll" };
+	static constexpr const char* DX_LIB_PATH{ "vendor/dxc/bin/dxcompiler.dll" };
 	static constexpr const wchar_t SHADERS_FOLDER_PATHW[]{ L"assets/shaders" };
 	static constexpr const char SHADERS_FOLDER_PATH[]{ "assets/shaders" };
 
@@ -209,40 +178,16 @@ static constexpr std::int32_t NUM_SHADER_ENTRIES{ sizeof(entries) / sizeof(shade
 */
 int main(int argc, char* argv[])
 {
-	quill::Logger* logger;
-	quill::Backend::start();
-	
-	{
-		quill::PatternFormatterOptions loggerPattern{
-		std::string{ "%(time) [%(thread_id)] %(log_level) "
-					"%(message) "},
-		std::string{"%H:%M:%S.%Qms"},
-		quill::Timezone::LocalTime,
-		false
-		};
-
-		quill::ConsoleSinkConfig::Colours sinkColours{};
+	RE::InitProfiler();
+	const RE::int64 startTime{ RE::GetTimeNs() };
 
-		sinkColours.apply_default_colours();
-
-		sinkColours.assign_colour_to_log_level(quill::LogLevel::TraceL3, quill::ConsoleSinkConfig::Colours::white);
-		sinkColours.assign_colour_to_log_level(quill::LogLevel::TraceL2, quill::ConsoleSinkConfig::Colours::white);
-		sinkColours.assign_colour_to_log_level(quill::LogLevel::TraceL1, quill::ConsoleSinkConfig::Colours::white);
-		sinkColours.assign_colour_to_log_level(quill::LogLevel::Debug, quill::ConsoleSinkConfig::Colours::green);
-		sinkColours.assign_colour_to_log_level(quill::LogLevel::Info, quill::ConsoleSinkConfig::Colours::cyan);
-
-		quill::ConsoleSinkConfig csinkConfig{};
-		csinkConfig.set_colours(sinkColours);
-
-
-		logger = quill::Frontend::create_or_get_logger(
-			"root", quill::Frontend::create_or_get_sink<quill::ConsoleSink>("sink_id_1", csinkConfig), loggerPattern);
-	}
+	RE::InitLog({ .console = true, .textPath = nullptr, .binaryPath = nullptr, .minLevel = RE::LogLevelTrace });
 
 	//Initialize all the buffers
 	wchar_t executablePathBuffer[MAX_PATH]{ L"\0" };
 	wchar_t definesBuffers[MAX_DEFINES][DEFINES_MAX_BUFFER];
 	char outputFolderBuffer[PATH_MAX_BUFFER]{ "\0" };
+	const char* profilePath{};
 
 	//Initialize the strings
 	WString ExecutablePath{ .data = executablePathBuffer, .num = 0, .cap = MAX_PATH };
@@ -262,17 +207,19 @@ int main(int argc, char* argv[])
 		defines[i] = WString{ .data = definesBuffers[i], .num = 0, .cap = DEFINES_MAX_BUFFER };
 	}
 
-	LOG_INFO(logger, "Welcome to the offline compiler!\nAvailable commands:\n"
+	RE_LOG_INFO("Welcome to the offline compiler!\nAvailable commands:\n"
 		"-F : Output folder where all files will be saved. If a file is contained in a subfolder, then it will be written into -F + /path/to/subfolder/shadername.bin\n"
 		"-D : An array of defines that will be globally setup ( -D DEFINE1=a DEFINE2=b DEFINE3=c ...)\n"
 		"-Od : Pass this to disable optimizations\n"
-		"-Zs : Enable debug information. This will generate extra .pdb files\n");
+		"-Zs : Enable debug information. This will generate extra .pdb files\n"
+		"-Profile : Path of a Chrome trace (.json) with the time spent compiling each shader\n");
 
 	enum compileFlags : std::uint8_t {
 		F = 0x1,
 		D = 0x2,
 		Od = 0x4,
-		Zs = 0x8
+		Zs = 0x8,
+		Profile = 0x10
 	};
 
 	std::uint8_t flags{};
@@ -296,7 +243,7 @@ int main(int argc, char* argv[])
 
 			memcpy(outputFolder.data, arg.data(), bytesToCopy);
 			outputFolder.data[bytesToCopy] = '\0';
-			LOG_INFO(logger, "-F {}", outputFolder.data);
+			RE_LOG_INFO("-F {}", outputFolder.data);
 
 			replace_all(outputFolder.data, outputFolder.data + bytesToCopy, '/', '\\');
 
@@ -322,7 +269,7 @@ int main(int argc, char* argv[])
 			if (lastDefineIdx == argc || (lastDefineIdx - i) == 0)
 			{
 
-				LOG_INFO(logger, "-D command was issued but no defines were provided. Ignoring...");
+				RE_LOG_INFO("-D command was issued but no defines were provided. Ignoring...");
 				continue;
 			}
 
@@ -336,11 +283,11 @@ int main(int argc, char* argv[])
 
 				if (overflows)
 				{
-					LOG_INFO(logger, "{} is too long, the DEFINE limit size is {} characters accounting for the null terminator. Ignoring...", arg, DEFINES_MAX_BUFFER);
+					RE_LOG_INFO("{} is too long, the DEFINE limit size is {} characters accounting for the null terminator. Ignoring...", RE::StringView{ arg.data(), arg.size() }, DEFINES_MAX_BUFFER);
 					continue;
 				}
 
-				LOG_INFO(logger, "{} registered as a global define", arg);
+				RE_LOG_INFO("{} registered as a global define", RE::StringView{ arg.data(), arg.size() });
 
 				mbstowcs(defines[numDefines].data, arg.data(), arg.size());
 				defines[numDefines].num = defineLength;
@@ -361,22 +308,34 @@ int main(int argc, char* argv[])
 		
 		if (arg.compare("-Zs") == 0)
 			flags |= compileFlags::Zs;
+
+		if (arg.compare("-Profile") == 0 && (i + 1) < argc)
+		{
+			profilePath = argv[++i];
+			flags |= compileFlags::Profile;
+		}
 	}
 
 
 	
-	HINSTANCE dxcLibModule{ LoadLibrary(DX_LIB_PATH) };
-
-	if (!dxcLibModule)
+	RE::Library dxcLib;
+	if (!RE::OpenLibrary(dxcLib, DX_LIB_PATH))
 	{
-		LOG_CRITICAL(logger, "dxcompiler.dll couldn't be loaded");
+		RE_LOG_CRITICAL("dxcompiler.dll couldn't be loaded");
+		RE::ShutdownLog();
 		return 0;
 	}
 
-	DxcCreateInstanceProc DxcCreateInstance{ (DxcCreateInstanceProc)GetProcAddress(dxcLibModule, "DxcCreateInstance") };
+	DxcCreateInstanceProc DxcCreateInstance{ RE::LibraryFunction<DxcCreateInstanceProc>(dxcLib, "DxcCreateInstance") };
 	
 	ComPtr<IDxcCompiler3> dxCompiler;
 	DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&dxCompiler));
+
+	//resolves #include "file.hlsli" relative to the -I folders
+	ComPtr<IDxcUtils> dxUtils;
+	DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&dxUtils));
+	ComPtr<IDxcIncludeHandler> includeHandler;
+	dxUtils->CreateDefaultIncludeHandler(&includeHandler);
 	
 
 	
@@ -408,8 +367,8 @@ int main(int argc, char* argv[])
 	*/
 	
 	static constexpr int32_t MAX_COMPILE_PARAMS{ 128 };
-	static constexpr int32_t NUM_PERMANENT_PARAMETERS{ 4 };
-	StackArray<LPCWSTR, MAX_COMPILE_PARAMS> compileParams;
+	static constexpr int32_t NUM_PERMANENT_PARAMETERS{ 7 };
+	FixedArray<LPCWSTR, MAX_COMPILE_PARAMS> compileParams;
 	
 	//let's fill first parameters that are not configurable.
 
@@ -417,6 +376,9 @@ int main(int argc, char* argv[])
 	compileParams.data[1] = L"-Qstrip_priv";
 	compileParams.data[2] = L"-Qstrip_reflect";
 	compileParams.data[3] = L"-Qstrip_rootsignature";
+	compileParams.data[4] = L"-Zpr"; //RE::float4x4/float3x4 are stored row by row, this lets the CPU side memcpy them into cbuffers
+	compileParams.data[5] = L"-I";
+	compileParams.data[6] = SHADERS_FOLDER_PATHW; //shared .hlsli files live next to the shaders
 	compileParams.num = NUM_PERMANENT_PARAMETERS;
 
 	
@@ -425,8 +387,13 @@ int main(int argc, char* argv[])
 	//It'd be nice to have a SoA with each shader entry parameter, and compute all needed parameters at once, then just point to the right memory for each 
 	//compilation entry. This way we are always calling the same function for each operation, which is more efficient. Not needed at all but it's fun.
 
+	//per shader temporaries, rewound at the start of every iteration
+	const RE::ScratchArena scratch{ RE::BeginScratch() };
+
 	for (int32_t i{}; i < NUM_SHADER_ENTRIES; ++i, compileParams.num = NUM_PERMANENT_PARAMETERS)
 	{
+		RE::RewindArena(scratch);
+		RE_PROFILE_SCOPE("CompileShader");
 		const shaderEntry& entry{ entries[i] };
 		
 		//Get the entry point
@@ -436,12 +403,12 @@ int main(int argc, char* argv[])
 		compileParams.add(L"-T");
 		compileParams.add(ShaderTypeToString(entry.type));
 
-		str<const char> entryPath{.data = entry.path, .num = strlen(entry.path), .cap = PATH_MAX_BUFFER };
+		const RE::StringView entryPath{ RE::MakeStringView(entry.path) };
 
 		if (entryPath.num > (PATH_MAX_BUFFER - 1))//leave space for the null-terminator
 		{
 			size_t diff{ entryPath.num - PATH_MAX_BUFFER };
-			LOG_WARNING(logger, "The relative path of the shader entry {} exceeds the limit size by {} characters. Skipping...", entry.path + diff, diff);
+			RE_LOG_WARNING("The relative path of the shader entry {} exceeds the limit size by {} characters. Skipping...", entry.path + diff, diff);
 			continue;
 		}
 
@@ -511,7 +478,7 @@ int main(int argc, char* argv[])
 			wide_to_string(d1, ExecutablePath);
 			wide_to_string(d2, outputPath);
 		
-			LOG_WARNING(logger, "The full working path {}, concatenated with the relative output directory {} exceeds the limit of {} characters by {}, skipping...", 
+			RE_LOG_WARNING("The full working path {}, concatenated with the relative output directory {} exceeds the limit of {} characters by {}, skipping...", 
 				d1.data, d2.data , MAX_PATH, diff);
 			continue;
 		}
@@ -547,47 +514,36 @@ int main(int argc, char* argv[])
 		}
 		
 		//Now we are ready to compile
-		wchar_t shaderSourcePathBuffer[PATH_MAX_BUFFER];
-		WString sourceShaderPath{ .data = shaderSourcePathBuffer, .num = 0 };
-		{
-			constexpr size_t folderLen{ _countof(SHADERS_FOLDER_PATHW) - 1 };
-			memcpy(sourceShaderPath.data, SHADERS_FOLDER_PATHW, sizeof(wchar_t) * (folderLen));//dont copy the trailing '\0'
-			sourceShaderPath.data[folderLen] = L'/';
-			memcpy(sourceShaderPath.data + (folderLen + 1u), widePath.data, sizeof(wchar_t) * widePath.num);
-			size_t num{(folderLen + 1u) + widePath.num };
-			sourceShaderPath.data[num] = L'\0';
-			sourceShaderPath.num = static_cast<int32_t>(num);
-		}
+		char sourceShaderPath[PATH_MAX_BUFFER];
+		snprintf(sourceShaderPath, PATH_MAX_BUFFER, "%s/%s", SHADERS_FOLDER_PATH, entry.path);
 		
 		{
 			char entryPointBuffer[ENTRY_POINT_MAX_BUFFER + 1];
 			String tempEntryPoint{ .data = entryPointBuffer, .num = 0, .cap = ENTRY_POINT_MAX_BUFFER + 1 };
 			wide_to_string(tempEntryPoint, Span<const wchar_t>{.data = entry.entryPoint, .num = wcslen(entry.entryPoint)});
 		
-			LOG_INFO(logger, "Shader \"{}\" compilation started.Entry point: \"{}\"", entry.path, tempEntryPoint.data);
+			RE_LOG_INFO("Shader \"{}\" compilation started.Entry point: \"{}\"", entry.path, tempEntryPoint.data);
 		}
 		
-		std::ifstream file{ sourceShaderPath.data,std::ios::binary | std::ios::ate | std::ios::in };
-		char shaderBlob[81920]; //81KB
-		if (!file.is_open())
+		const Span<RE::uint8> shaderBlob{ RE::ReadEntireFile(sourceShaderPath, *scratch.arena) };
+		if (!shaderBlob.data)
 		{
-			LOG_WARNING(logger, "File couldn't be opened. Skipping compilation...");
+			RE_LOG_WARNING("File couldn't be opened. Skipping compilation...");
 			continue;
 			
 		}
-		uint32_t size{ static_cast<std::uint32_t>(file.tellg()) };
-		file.seekg(0, std::ios::beg);
-		file.read(shaderBlob, size);
-		file.close();
 		
 		const DxcBuffer dxcBuff{
-		.Ptr = shaderBlob,
-		.Size = size,
+		.Ptr = shaderBlob.data,
+		.Size = shaderBlob.num,
 		.Encoding = DXC_CP_UTF8
 		};
 		
 		ComPtr<IDxcResult> compileResult;
-		dxCompiler->Compile(&dxcBuff, compileParams.data, compileParams.num, nullptr, IID_PPV_ARGS(&compileResult));
+		{
+			RE_PROFILE_SCOPE("DxcCompile");
+			dxCompiler->Compile(&dxcBuff, compileParams.data, compileParams.num, includeHandler.Get(), IID_PPV_ARGS(&compileResult));
+		}
 		
 		HRESULT hrStatus;
 		compileResult->GetStatus(&hrStatus);
@@ -598,18 +554,18 @@ int main(int argc, char* argv[])
 		
 		if (!SUCCEEDED(hrStatus))
 		{
-			LOG_WARNING(logger, "Compilation failed, dumping errors and skipping...\n{}", pErrors->GetStringPointer());
+			RE_LOG_WARNING("Compilation failed, dumping errors and skipping...\n{}", pErrors->GetStringPointer());
 			continue;
 		}
 		
 		
 		if (pErrors->GetStringLength() > 0)
 		{
-			LOG_WARNING(logger, "Compilation succeeded, warnings have been generated\n{}",pErrors->GetStringPointer());
+			RE_LOG_WARNING("Compilation succeeded, warnings have been generated\n{}",pErrors->GetStringPointer());
 		}
 		else
 		{
-			LOG_INFO(logger, "Compilation succeeded!");
+			RE_LOG_INFO("Compilation succeeded!");
 		}
 		
 		
@@ -622,7 +578,11 @@ int main(int argc, char* argv[])
 		fullPath.num += outputPath.num - (OUTPUT_EXTENSION_SIZE + nameSize);
 		replace_all(fullPath.data, fullPath.data + fullPath.num, L'/', L'\\');
 		
-		int webo{ SHCreateDirectory(NULL, fullPath.data) };
+		//the platform layer takes UTF-8 paths
+		char narrowPathBuffer[MAX_PATH];
+		String narrowPath{ .data = narrowPathBuffer, .num = 0, .cap = MAX_PATH };
+		wide_to_string(narrowPath, Span<const wchar_t>{ .data = fullPath.data, .num = fullPath.num });
+		RE::MakeDirectories(narrowPath.data);
 		
 		ComPtr<IDxcBlob> outShader;
 		compileResult->GetOutput(DXC_OUT_OBJECT, IID_PPV_ARGS(&outShader), nullptr);
@@ -634,13 +594,9 @@ int main(int argc, char* argv[])
 		
 		if (outShader)
 		{
-			FILE* fp{};
-	
-			int result{ _wfopen_s(&fp, fullPath.data, L"wb") };
-			fwrite(outShader->GetBufferPointer(), outShader->GetBufferSize(), 1, fp);
-			fclose(fp);
-			
-		
+			wide_to_string(narrowPath, Span<const wchar_t>{ .data = fullPath.data, .num = fullPath.num });
+			if (!RE::WriteEntireFile(narrowPath.data, outShader->GetBufferPointer(), outShader->GetBufferSize()))
+				RE_LOG_WARNING("Couldn't write {}", narrowPath.data);
 		}
 
 		if (flags & compileFlags::Zs)
@@ -650,17 +606,32 @@ int main(int argc, char* argv[])
 
 			if (outPdb)
 			{
-				FILE* fp{};
-
 				wcscpy(fullPath.data + fullPath.num - DEBUG_EXTENSION_SIZE, DEBUG_EXTENSION);
-				int result{ _wfopen_s(&fp, fullPath.data, L"wb") };
-				fwrite(outPdb->GetBufferPointer(), outPdb->GetBufferSize(), 1, fp);
-				fclose(fp);
+				wide_to_string(narrowPath, Span<const wchar_t>{ .data = fullPath.data, .num = fullPath.num });
+				if (!RE::WriteEntireFile(narrowPath.data, outPdb->GetBufferPointer(), outPdb->GetBufferSize()))
+					RE_LOG_WARNING("Couldn't write {}", narrowPath.data);
 			}
 
 		}
 	}
 
+	RE::EndScratch(scratch);
+	RE::CloseLibrary(dxcLib);
+
+	if (flags & compileFlags::Profile)
+	{
+#if RE_ENABLE_PROFILER
+		if (RE::WriteProfileTrace(profilePath, startTime, RE::GetTimeNs()))
+			RE_LOG_INFO("Profile written to {}", profilePath);
+		else
+			RE_LOG_WARNING("Couldn't write the profile to {}", profilePath);
+#else
+		RE_LOG_WARNING("-Profile ignored, the profiler is compiled out of Shipping builds");
+#endif
+	}
+
+	RE::ShutdownProfiler();
+	RE::ShutdownLog();
 	return 0;
 }
 
@@ -1,10 +1,13 @@
 #ifndef _BASIC_VS_HLSL_
 #define _BASIC_VS_HLSL_
 
+#include "vertexPacking.hlsli"
 
 cbuffer pushConstants : register(b0)
 {
 	float ar;
+	float3 positionOffset;
+	float3 positionScale;
 };
 
 struct VSin
@@ -23,7 +26,8 @@ struct VSOut
 VSOut VSMain(VSin vin)
 {
     VSOut output;
-    output.pos = float4(vin.pos * float3(1.f, ar, 1.f), 1.f);
+    float3 pos = DecodePosition(vin.pos, positionOffset, positionScale);
+    output.pos = float4(pos * float3(1.f, ar, 1.f), 1.f);
     output.color = vin.color;
     
     return output;
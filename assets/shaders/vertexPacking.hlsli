@@ -0,0 +1,34 @@
+#ifndef _VERTEX_PACKING_HLSLI_
+#define _VERTEX_PACKING_HLSLI_
+
+// Decoders for the vertex formats written by RadiantEngine/render/vertexPacking.h.
+// SNORM/UNORM/FLOAT16 formats are already converted to float by the input assembler, these only undo the rest.
+
+// q comes from a R16G16B16A16_SNORM/UNORM position, offset and scale from PositionQuantization
+float3 DecodePosition(float3 q, float3 offset, float3 scale)
+{
+    return offset + q * scale;
+}
+
+float3 OctDecode(float2 e)
+{
+    float3 n = float3(e, 1.f - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += select(n.xy >= 0.f, -t, t);
+    return normalize(n);
+}
+
+// R16G16_SNORM octahedral normal
+float3 DecodeNormal(float2 e)
+{
+    return OctDecode(e);
+}
+
+// R16G16_SNORM octahedral tangent, w is the bitangent sign stored in the lowest bit of y
+float4 DecodeTangent(float2 e)
+{
+    int y = (int)round(e.y * 32767.f);
+    return float4(OctDecode(e), (y & 1) ? -1.f : 1.f);
+}
+
+#endif //_VERTEX_PACKING_HLSLI_
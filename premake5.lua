@@ -13,22 +13,15 @@ workspace "RenderingEngine"
 
 	outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
 
-	include "vendor/quill/quill_premake5.lua"
-
-
-	local quillDefines = runQuillCmake()
-
-	defines(quillDefines)
-
-	externalproject "quill"
-			location "vendor/quill"
-			uuid "8BC9CEB8-8B4A-11D0-8D11-00A0C91BC942"
-			kind "StaticLib"
-			language "C++"
-
-
-
 	include "RadiantEngine/re_premake5.lua"
-	include "ShaderCompiler/shadercompiler_premake5.lua"
-	include "ClientApp/client_premake5.lua"
+	include "RadiantBench/bench_premake5.lua"
+	include "RadiantTests/tests_premake5.lua"
+	include "LogDecoder/logdecoder_premake5.lua"
+	include "PackBuilder/packbuilder_premake5.lua"
+
+	--dxc and D3D12, Windows only. The engine, benchmarks and tools build on Linux through the platform layer
+	if os.istarget("windows") then
+		include "ShaderCompiler/shadercompiler_premake5.lua"
+		include "ClientApp/client_premake5.lua"
+	end
 